@@ -6,7 +6,10 @@
 
 #include <algorithm>
 
+#include "radio_core/base/build_config.h"
+
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T>
 constexpr auto Min(const T& a, const T& b) -> const T& {
@@ -65,4 +68,5 @@ constexpr auto CircularShift(Container& container, const int shift) {
       container.begin(), container.begin() + warped_shift, container.end());
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -12,9 +12,11 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/unroll.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class ElementType, int NumElements, int Alignment>
 class AlignedRegister {
@@ -60,4 +62,5 @@ class AlignedRegister {
   alignas(Alignment) std::array<ElementType, NumElements> data_;
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
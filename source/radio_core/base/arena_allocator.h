@@ -0,0 +1,240 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Monotonic memory arena, and an STL compatible allocator which allocates
+// memory from it.
+//
+// The arena is a single block of memory allocated upfront. Allocations from the
+// arena bump an offset within the block, and the memory is only given back
+// when the arena is destroyed. The exception is the most recent allocation,
+// which is rolled back when it is deallocated: this avoids wasting the arena
+// space when a container grows a single buffer multiple times.
+//
+// The ArenaAllocator is stateless, which allows it to be used as the
+// `Allocator` template argument of the signal processing classes. It allocates
+// memory from the arena which is made current for the calling thread using the
+// Arena::Scope, and falls back to the heap when there is no current arena or
+// when the arena does not have enough space. The memory can be deallocated
+// from any thread, regardless of the current arena.
+//
+// Typical usage is to allocate all work buffers of a signal path from a single
+// arena prior to processing samples:
+//
+//   using SignalPath = signal_path::SimpleSignalPath<float, ArenaAllocator>;
+//
+//   Arena arena(1024 * 1024);
+//   SignalPath signal_path;
+//   {
+//     Arena::Scope arena_scope(arena);
+//     signal_path.Configure(options);
+//     signal_path.Reserve(max_block_size);
+//   }
+//
+// The arena must outlive all objects which have memory allocated from it.
+//
+// The allocator asserts that it is not used within a NoAllocationScope.
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "radio_core/base/aligned_malloc.h"
+#include "radio_core/base/no_allocation_scope.h"
+#include "radio_core/base/verify.h"
+
+namespace radio_core {
+
+class Arena {
+ public:
+  // Alignment of all allocations from the arena.
+  static constexpr size_t kAlignment = 64;
+
+  // Construct arena which can hold up to the given number of bytes.
+  explicit Arena(const size_t capacity)
+      : capacity_(RoundUpToAlignment(capacity)) {
+    if (capacity_) {
+      data_ = static_cast<std::byte*>(AlignedMalloc(capacity_, kAlignment));
+      Verify(data_ != nullptr, "Unable to allocate memory for arena");
+    }
+  }
+
+  ~Arena() {
+    // Reference to the current arena would become dangling.
+    assert(GetCurrentStorage() != this);
+
+    AlignedFree(data_);
+  }
+
+  Arena(const Arena& other) = delete;
+  Arena(Arena&& other) noexcept = delete;
+
+  auto operator=(const Arena& other) -> Arena& = delete;
+  auto operator=(Arena&& other) -> Arena& = delete;
+
+  // Allocate the given number of bytes from the arena.
+  //
+  // Returns nullptr if there is not enough space left in the arena.
+  //
+  // Safe to be called from multiple threads.
+  auto Allocate(const size_t num_bytes) -> void* {
+    const size_t aligned_num_bytes = RoundUpToAlignment(num_bytes);
+
+    size_t offset = used_.load(std::memory_order_relaxed);
+    do {
+      if (aligned_num_bytes > capacity_ - offset) {
+        return nullptr;
+      }
+    } while (!used_.compare_exchange_weak(offset,
+                                          offset + aligned_num_bytes,
+                                          std::memory_order_relaxed));
+
+    return data_ + offset;
+  }
+
+  // Deallocate memory which was allocated from this arena.
+  //
+  // Only the most recent allocation gives its space back to the arena, the
+  // other deallocations are no-op.
+  //
+  // Safe to be called from multiple threads.
+  void Deallocate(void* ptr, const size_t num_bytes) {
+    assert(Contains(ptr));
+
+    const size_t offset = static_cast<std::byte*>(ptr) - data_;
+    size_t end_offset = offset + RoundUpToAlignment(num_bytes);
+    used_.compare_exchange_strong(
+        end_offset, offset, std::memory_order_relaxed);
+  }
+
+  // Returns true if the pointer points to the memory of this arena.
+  inline auto Contains(const void* ptr) const -> bool {
+    const std::byte* byte_ptr = static_cast<const std::byte*>(ptr);
+    return byte_ptr >= data_ && byte_ptr < data_ + capacity_;
+  }
+
+  inline auto GetCapacity() const -> size_t { return capacity_; }
+  inline auto GetNumUsedBytes() const -> size_t {
+    return used_.load(std::memory_order_relaxed);
+  }
+
+  // Get arena which is current for the calling thread.
+  // Returns nullptr if there is no current arena.
+  static inline auto GetCurrent() -> Arena* { return GetCurrentStorage(); }
+
+  // Scope within which the arena is the current one for the calling thread.
+  // Scopes can be nested, the previously current arena is restored when the
+  // scope ends.
+  class Scope {
+   public:
+    explicit Scope(Arena& arena) : previous_arena_(GetCurrentStorage()) {
+      GetCurrentStorage() = &arena;
+    }
+
+    ~Scope() { GetCurrentStorage() = previous_arena_; }
+
+    Scope(const Scope& other) = delete;
+    Scope(Scope&& other) noexcept = delete;
+
+    auto operator=(const Scope& other) -> Scope& = delete;
+    auto operator=(Scope&& other) -> Scope& = delete;
+
+   private:
+    Arena* previous_arena_;
+  };
+
+ private:
+  static inline auto RoundUpToAlignment(const size_t num_bytes) -> size_t {
+    return (num_bytes + kAlignment - 1) & ~(kAlignment - 1);
+  }
+
+  static inline auto GetCurrentStorage() -> Arena*& {
+    static thread_local Arena* arena = nullptr;
+    return arena;
+  }
+
+  std::byte* data_{nullptr};
+  size_t capacity_;
+
+  std::atomic<size_t> used_{0};
+};
+
+template <class T>
+struct ArenaAllocator {
+  static_assert(alignof(T) <= Arena::kAlignment);
+
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  ArenaAllocator() = default;
+
+  template <class U>
+  constexpr ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+  template <class U>
+  struct rebind {
+    using other = ArenaAllocator<U>;
+  };
+
+  [[nodiscard]] auto allocate(const std::size_t n) -> T* {
+    NoAllocationScope::AssertAllocationAllowed();
+
+    const size_t num_bytes = kHeaderSize + sizeof(T) * n;
+
+    Arena* arena = Arena::GetCurrent();
+    void* memory = arena ? arena->Allocate(num_bytes) : nullptr;
+    if (!memory) {
+      arena = nullptr;
+      memory = AlignedMalloc(num_bytes, Arena::kAlignment);
+      if (!memory) {
+        throw std::bad_alloc();
+      }
+    }
+
+    // Remember where the memory came from, so that the deallocation can be
+    // done without the arena being current.
+    new (memory) Header{arena};
+
+    return reinterpret_cast<T*>(static_cast<std::byte*>(memory) + kHeaderSize);
+  }
+
+  void deallocate(T* ptr, const std::size_t n) noexcept {
+    std::byte* memory = reinterpret_cast<std::byte*>(ptr) - kHeaderSize;
+    Arena* arena = reinterpret_cast<Header*>(memory)->arena;
+
+    if (arena) {
+      arena->Deallocate(memory, kHeaderSize + sizeof(T) * n);
+    } else {
+      AlignedFree(memory);
+    }
+  }
+
+  template <class U>
+  bool operator==(const ArenaAllocator<U>& /*other*/) const {
+    return true;
+  }
+  template <class U>
+  bool operator!=(const ArenaAllocator<U>& /*other*/) const {
+    return false;
+  }
+
+ private:
+  // Header which precedes the memory returned to the caller.
+  struct Header {
+    // Arena the memory is allocated from, nullptr for the heap.
+    Arena* arena;
+  };
+
+  // The header occupies the full alignment, so that the returned memory is
+  // aligned the same way as the arena allocations.
+  static constexpr size_t kHeaderSize = Arena::kAlignment;
+};
+
+}  // namespace radio_core
@@ -6,6 +6,7 @@
 
 #include <type_traits>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/compiler_specific.h"
 
 #if !HAS_BUILTIN(__builtin_bit_cast)
@@ -13,6 +14,7 @@
 #endif
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Obtain a value of type To by reinterpreting the object representation of
 // From. Every bit in the value representation of the returned To object is
@@ -50,4 +52,5 @@ BitCast(const From& src) noexcept {  // NOLINT(*-use-trailing-return-type)
 }
 #endif
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -497,6 +497,27 @@
 #  else
 #    define ISA_CPU_X86_FMA 0
 #  endif
+
+// AVX-512 Foundation.
+#  if defined(__AVX512F__) && _TL_BUILD_CONFIG_CAN_USE(__AVX512F__)
+#    define ISA_CPU_X86_AVX512F 1
+#  else
+#    define ISA_CPU_X86_AVX512F 0
+#  endif
+
+// F16C: conversion between half and single precision floating point values.
+#  if defined(__F16C__) && _TL_BUILD_CONFIG_CAN_USE(__F16C__)
+#    define ISA_CPU_X86_F16C 1
+#  else
+#    define ISA_CPU_X86_F16C 0
+#  endif
+
+// PCLMULQDQ: carry-less multiplication of 64-bit values.
+#  if defined(__PCLMUL__) && _TL_BUILD_CONFIG_CAN_USE(__PCLMUL__)
+#    define ISA_CPU_X86_PCLMUL 1
+#  else
+#    define ISA_CPU_X86_PCLMUL 0
+#  endif
 #endif
 
 #if ARCH_CPU_ARM_FAMILY
@@ -507,7 +528,68 @@
 #  else
 #    define ISA_CPU_ARM_NEON 0
 #  endif
+
+// PMULL: polynomial multiplication of 64-bit values, part of the cryptographic
+// extension.
+#  if ISA_CPU_ARM_NEON &&                                                      \
+      ((defined(__ARM_FEATURE_AES) &&                                          \
+        _TL_BUILD_CONFIG_CAN_USE(__ARM_FEATURE_AES)) ||                        \
+       (defined(__ARM_FEATURE_CRYPTO) &&                                       \
+        _TL_BUILD_CONFIG_CAN_USE(__ARM_FEATURE_CRYPTO)))
+#    define ISA_CPU_ARM_PMULL 1
+#  else
+#    define ISA_CPU_ARM_PMULL 0
+#  endif
 #else
 #  define ISA_CPU_ARM_NEON 0
+#  define ISA_CPU_ARM_PMULL 0
 #  define ISA_CPU_ARM_V8 0
 #endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Instruction set namespace.
+
+// Name of the inline namespace which holds the code compiled differently
+// depending on the instruction sets enabled for the translation unit.
+//
+// The name encodes the values of the ISA_CPU_* flags of the platform. Inline
+// functions of translation units compiled with different instruction sets have
+// different symbols, so the linker never picks the copy compiled for a wider
+// instruction set for the code which is to run on a baseline CPU (see
+// math/kernel/dispatch.h).
+//
+// Usage:
+//
+//   namespace radio_core {
+//   inline namespace RADIO_CORE_ISA_NAMESPACE {
+//   ...
+//   }  // namespace RADIO_CORE_ISA_NAMESPACE
+//   }  // namespace radio_core
+#if ARCH_CPU_X86_FAMILY
+#  define RADIO_CORE_ISA_NAMESPACE                                             \
+    RADIO_CORE_ISA_NAMESPACE_X86(ISA_CPU_X86_SSE2,                             \
+                                 ISA_CPU_X86_SSE3,                             \
+                                 ISA_CPU_X86_SSE4_1,                           \
+                                 ISA_CPU_X86_AVX,                              \
+                                 ISA_CPU_X86_AVX2,                             \
+                                 ISA_CPU_X86_FMA,                              \
+                                 ISA_CPU_X86_AVX512F,                          \
+                                 ISA_CPU_X86_F16C,                             \
+                                 ISA_CPU_X86_PCLMUL)
+// Expand the flags prior to the concatenation.
+#  define RADIO_CORE_ISA_NAMESPACE_X86(...)                                    \
+    RADIO_CORE_ISA_NAMESPACE_X86_CONCAT(__VA_ARGS__)
+#  define RADIO_CORE_ISA_NAMESPACE_X86_CONCAT(                                 \
+      sse2, sse3, sse4_1, avx, avx2, fma, avx512f, f16c, pclmul)               \
+    isa_x86_##sse2##sse3##sse4_1##avx##avx2##fma##avx512f##f16c##pclmul
+#elif ARCH_CPU_ARM_FAMILY
+#  define RADIO_CORE_ISA_NAMESPACE                                             \
+    RADIO_CORE_ISA_NAMESPACE_ARM(ISA_CPU_ARM_NEON, ISA_CPU_ARM_PMULL)
+// Expand the flags prior to the concatenation.
+#  define RADIO_CORE_ISA_NAMESPACE_ARM(...)                                    \
+    RADIO_CORE_ISA_NAMESPACE_ARM_CONCAT(__VA_ARGS__)
+#  define RADIO_CORE_ISA_NAMESPACE_ARM_CONCAT(neon, pmull)                     \
+    isa_arm_##neon##pmull
+#else
+#  define RADIO_CORE_ISA_NAMESPACE isa_generic
+#endif
@@ -6,9 +6,11 @@
 
 #include <numbers>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 namespace radio_core::constants {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Templated constants from the std::numbers namespace.
 template <class T>
@@ -82,4 +84,5 @@ template <>
 inline constexpr Half phi_v<Half> = 1.618033988749894848204586834365638;
 #endif
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::constants
@@ -0,0 +1,167 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Runtime detection of the instruction set extensions supported by the CPU the
+// program is running on.
+//
+// The build configuration macros (ISA_CPU_X86_AVX2 and friends) tell which
+// instructions the compiler is allowed to use for the current translation unit.
+// This file tells which instructions are actually available on the machine,
+// which allows to choose between implementations compiled for different
+// instruction sets at runtime.
+//
+// On x86 the detection is done using the CPUID instruction. The extensions
+// which use extended register state (AVX, AVX-512) are only reported as
+// available if the operating system saves and restores the corresponding
+// registers on context switch (checked using XGETBV).
+//
+// On other platforms all the fields are false.
+//
+// Example:
+//
+//   const CPUFeatures& cpu_features = GetCPUFeatures();
+//   if (cpu_features.avx2) {
+//     ...
+//   }
+
+#pragma once
+
+#include <cstdint>
+
+#include "radio_core/base/build_config.h"
+
+#if ARCH_CPU_X86_FAMILY
+#  if COMPILER_MSVC
+#    include <intrin.h>
+#  else
+#    include <cpuid.h>
+#  endif
+#endif
+
+namespace radio_core {
+
+struct CPUFeatures {
+  bool sse2{false};
+  bool sse3{false};
+  bool ssse3{false};
+  bool sse4_1{false};
+  bool pclmul{false};
+  bool avx{false};
+  bool avx2{false};
+  bool fma{false};
+  bool avx512f{false};
+};
+
+namespace cpu_features_internal {
+
+#if ARCH_CPU_X86_FAMILY
+
+// Registers returned by the CPUID instruction.
+struct CPUIDRegisters {
+  uint32_t eax{0};
+  uint32_t ebx{0};
+  uint32_t ecx{0};
+  uint32_t edx{0};
+};
+
+inline auto CPUID(const uint32_t leaf, const uint32_t subleaf)
+    -> CPUIDRegisters {
+  CPUIDRegisters r;
+#  if COMPILER_MSVC
+  int info[4];
+  __cpuidex(info, int(leaf), int(subleaf));
+  r.eax = uint32_t(info[0]);
+  r.ebx = uint32_t(info[1]);
+  r.ecx = uint32_t(info[2]);
+  r.edx = uint32_t(info[3]);
+#  else
+  __cpuid_count(leaf, subleaf, r.eax, r.ebx, r.ecx, r.edx);
+#  endif
+  return r;
+}
+
+// Read the extended control register XCR0.
+//
+// Must only be called when the CPU reports OSXSAVE support.
+inline auto ReadXCR0() -> uint64_t {
+#  if COMPILER_MSVC
+  return _xgetbv(0);
+#  else
+  uint32_t eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (uint64_t(edx) << 32) | eax;
+#  endif
+}
+
+inline auto IsBitSet(const uint32_t value, const int bit) -> bool {
+  return (value >> bit) & 1;
+}
+
+inline auto DetectCPUFeatures() -> CPUFeatures {
+  CPUFeatures features;
+
+  const uint32_t max_leaf = CPUID(0, 0).eax;
+  if (max_leaf < 1) {
+    return features;
+  }
+
+  const CPUIDRegisters leaf1 = CPUID(1, 0);
+
+  features.sse2 = IsBitSet(leaf1.edx, 26);
+  features.sse3 = IsBitSet(leaf1.ecx, 0);
+  features.ssse3 = IsBitSet(leaf1.ecx, 9);
+  features.sse4_1 = IsBitSet(leaf1.ecx, 19);
+  features.pclmul = IsBitSet(leaf1.ecx, 1);
+
+  // The extensions below operate on the YMM/ZMM registers, which requires the
+  // operating system support.
+  const bool osxsave = IsBitSet(leaf1.ecx, 27);
+  if (!osxsave) {
+    return features;
+  }
+
+  const uint64_t xcr0 = ReadXCR0();
+
+  // XMM and YMM state.
+  const bool os_avx = (xcr0 & 0x06) == 0x06;
+  // XMM, YMM, opmask, upper half of ZMM0-15 and ZMM16-31 state.
+  const bool os_avx512 = (xcr0 & 0xe6) == 0xe6;
+
+  if (!os_avx) {
+    return features;
+  }
+
+  features.avx = IsBitSet(leaf1.ecx, 28);
+  features.fma = IsBitSet(leaf1.ecx, 12);
+
+  if (max_leaf < 7) {
+    return features;
+  }
+
+  const CPUIDRegisters leaf7 = CPUID(7, 0);
+
+  features.avx2 = IsBitSet(leaf7.ebx, 5);
+  features.avx512f = os_avx512 && IsBitSet(leaf7.ebx, 16);
+
+  return features;
+}
+
+#else
+
+inline auto DetectCPUFeatures() -> CPUFeatures { return {}; }
+
+#endif
+
+}  // namespace cpu_features_internal
+
+// Get features of the CPU the program is running on.
+//
+// The detection happens once, on the first call.
+inline auto GetCPUFeatures() -> const CPUFeatures& {
+  static const CPUFeatures features =
+      cpu_features_internal::DetectCPUFeatures();
+  return features;
+}
+
+}  // namespace radio_core
@@ -20,9 +20,28 @@
 #include <cstdint>
 #include <ostream>
 
-namespace radio_core {
+// GCC supports the _Float16 on x86 starting from version 12. Without the F16C
+// instruction set the conversion to and from the single precision floating
+// point is emulated, so the half precision is only enabled when F16C is
+// available.
+#if COMPILER_GCC && ARCH_CPU_X86_FAMILY
+#  if COMPILER_GCC_VERSION >= 1200 && ISA_CPU_X86_F16C
+#    define RADIO_CORE_HALF_USE_FLOAT16 1
+#  endif
+#endif
 
 #if COMPILER_CLANG
+#  define RADIO_CORE_HALF_USE_FLOAT16 1
+#endif
+
+#if !defined(RADIO_CORE_HALF_USE_FLOAT16)
+#  define RADIO_CORE_HALF_USE_FLOAT16 0
+#endif
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+#if RADIO_CORE_HALF_USE_FLOAT16
 
 class Half;
 
@@ -158,10 +177,11 @@ inline auto UInt16AsHalf(const uint16_t arg) -> Half {
 }
 
 #  define RADIO_CORE_HAVE_HALF 1
-#endif  // COMPILER_CLANG
+#endif  // RADIO_CORE_HALF_USE_FLOAT16
 
 #if !defined(RADIO_CORE_HAVE_HALF)
 #  define RADIO_CORE_HAVE_HALF 0
 #endif
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
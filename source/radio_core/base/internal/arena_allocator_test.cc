@@ -0,0 +1,140 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/base/arena_allocator.h"
+
+#include <vector>
+
+#include "radio_core/unittest/test.h"
+
+namespace radio_core {
+
+TEST(Arena, Allocate) {
+  using aligned_malloc_internal::IsAligned;
+
+  Arena arena(1000);
+  EXPECT_EQ(arena.GetCapacity(), 1024);
+  EXPECT_EQ(arena.GetNumUsedBytes(), 0);
+
+  void* a = arena.Allocate(10);
+  ASSERT_NE(a, nullptr);
+  EXPECT_TRUE(IsAligned(a, Arena::kAlignment));
+  EXPECT_TRUE(arena.Contains(a));
+  EXPECT_EQ(arena.GetNumUsedBytes(), 64);
+
+  void* b = arena.Allocate(100);
+  ASSERT_NE(b, nullptr);
+  EXPECT_TRUE(IsAligned(b, Arena::kAlignment));
+  EXPECT_EQ(arena.GetNumUsedBytes(), 192);
+
+  // Not enough space left.
+  EXPECT_EQ(arena.Allocate(1000), nullptr);
+  EXPECT_EQ(arena.GetNumUsedBytes(), 192);
+
+  // Deallocation of the most recent allocation gives the space back.
+  arena.Deallocate(b, 100);
+  EXPECT_EQ(arena.GetNumUsedBytes(), 64);
+
+  // Deallocation of an older allocation does not.
+  void* c = arena.Allocate(10);
+  arena.Deallocate(a, 10);
+  EXPECT_EQ(arena.GetNumUsedBytes(), 128);
+  arena.Deallocate(c, 10);
+  EXPECT_EQ(arena.GetNumUsedBytes(), 64);
+}
+
+TEST(Arena, Scope) {
+  EXPECT_EQ(Arena::GetCurrent(), nullptr);
+
+  Arena arena_a(1024);
+  Arena arena_b(1024);
+
+  {
+    Arena::Scope scope_a(arena_a);
+    EXPECT_EQ(Arena::GetCurrent(), &arena_a);
+
+    {
+      Arena::Scope scope_b(arena_b);
+      EXPECT_EQ(Arena::GetCurrent(), &arena_b);
+    }
+
+    EXPECT_EQ(Arena::GetCurrent(), &arena_a);
+  }
+
+  EXPECT_EQ(Arena::GetCurrent(), nullptr);
+}
+
+TEST(ArenaAllocator, Heap) {
+  using aligned_malloc_internal::IsAligned;
+
+  ArenaAllocator<float> allocator;
+  float* ptr = allocator.allocate(128);
+  EXPECT_TRUE(IsAligned(ptr, Arena::kAlignment));
+
+  for (int i = 0; i < 128; ++i) {
+    ptr[i] = float(i);
+  }
+
+  allocator.deallocate(ptr, 128);
+}
+
+TEST(ArenaAllocator, Arena) {
+  Arena arena(4096);
+
+  std::vector<float, ArenaAllocator<float>> vec;
+  {
+    Arena::Scope arena_scope(arena);
+    vec.resize(100);
+  }
+  EXPECT_TRUE(arena.Contains(vec.data()));
+
+  // Growing outside of the scope allocates from the heap, and deallocation of
+  // the arena memory happens without the arena being current.
+  vec.resize(200);
+  EXPECT_FALSE(arena.Contains(vec.data()));
+  EXPECT_EQ(arena.GetNumUsedBytes(), 0);
+
+  // Allocations which do not fit into the arena fall back to the heap.
+  {
+    Arena::Scope arena_scope(arena);
+    vec.resize(2000);
+  }
+  EXPECT_FALSE(arena.Contains(vec.data()));
+}
+
+TEST(ArenaAllocator, Rebind) {
+  using AllocatorForInt = ArenaAllocator<int>;
+  using AllocatorForDouble =
+      std::allocator_traits<AllocatorForInt>::template rebind_alloc<double>;
+
+  Arena arena(1024);
+  Arena::Scope arena_scope(arena);
+
+  AllocatorForDouble allocator;
+
+  double* ptr = allocator.allocate(4);
+  EXPECT_TRUE(arena.Contains(ptr));
+  *ptr = 1;
+
+  allocator.deallocate(ptr, 4);
+}
+
+#if !defined(NDEBUG)
+namespace {
+
+void AllocateInNoAllocationScope() {
+  const NoAllocationScope no_allocation_scope;
+  ArenaAllocator<float> allocator;
+  float* ptr = allocator.allocate(10);
+  allocator.deallocate(ptr, 10);
+}
+
+}  // namespace
+
+TEST(ArenaAllocator, NoAllocationScope) {
+  EXPECT_DEATH_IF_SUPPORTED(AllocateInNoAllocationScope(), "");
+}
+#endif
+
+}  // namespace radio_core
@@ -0,0 +1,53 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/base/cpu_features.h"
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core {
+
+TEST(CPUFeatures, Basic) {
+  const CPUFeatures& features = GetCPUFeatures();
+
+  // The detection happens once.
+  EXPECT_EQ(&features, &GetCPUFeatures());
+
+#if ARCH_CPU_X86_FAMILY
+  // The instruction sets enabled for the compiler are to be supported by the
+  // CPU the test is running on.
+  if (ISA_CPU_X86_SSE2) {
+    EXPECT_TRUE(features.sse2);
+  }
+  if (ISA_CPU_X86_SSE4_1) {
+    EXPECT_TRUE(features.sse4_1);
+  }
+  if (ISA_CPU_X86_PCLMUL) {
+    EXPECT_TRUE(features.pclmul);
+  }
+  if (ISA_CPU_X86_AVX2) {
+    EXPECT_TRUE(features.avx2);
+  }
+  if (ISA_CPU_X86_FMA) {
+    EXPECT_TRUE(features.fma);
+  }
+  if (ISA_CPU_X86_AVX512F) {
+    EXPECT_TRUE(features.avx512f);
+  }
+
+  // Wider instruction sets imply the narrower ones.
+  if (features.avx2) {
+    EXPECT_TRUE(features.avx);
+  }
+  if (features.avx) {
+    EXPECT_TRUE(features.sse4_1);
+  }
+#else
+  EXPECT_FALSE(features.sse2);
+  EXPECT_FALSE(features.avx2);
+#endif
+}
+
+}  // namespace radio_core
@@ -0,0 +1,40 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/base/no_allocation_scope.h"
+
+#include "radio_core/unittest/test.h"
+
+namespace radio_core {
+
+TEST(NoAllocationScope, Basic) {
+  EXPECT_FALSE(NoAllocationScope::IsActive());
+
+  {
+    const NoAllocationScope no_allocation_scope;
+#if !defined(NDEBUG)
+    EXPECT_TRUE(NoAllocationScope::IsActive());
+#endif
+
+    {
+      const NoAllocationScope nested_no_allocation_scope;
+#if !defined(NDEBUG)
+      EXPECT_TRUE(NoAllocationScope::IsActive());
+#endif
+    }
+
+#if !defined(NDEBUG)
+    EXPECT_TRUE(NoAllocationScope::IsActive());
+#endif
+  }
+
+  EXPECT_FALSE(NoAllocationScope::IsActive());
+}
+
+TEST(NoAllocationScope, Inactive) {
+  const NoAllocationScope no_allocation_scope(false);
+  EXPECT_FALSE(NoAllocationScope::IsActive());
+}
+
+}  // namespace radio_core
@@ -0,0 +1,84 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Debug check that no memory allocation happens within a scope.
+//
+// The scope marks the calling thread as being in a code path which is not
+// supposed to allocate memory, such as processing of samples in a real-time
+// audio thread. Allocators which are aware of the scope (such as the
+// ArenaAllocator) assert that they are not used while the scope is active.
+//
+//   void PushSamples(std::span<const float> samples) {
+//     NoAllocationScope no_allocation_scope;
+//     ...
+//   }
+//
+// The check is only performed in debug builds. In release builds the scope is
+// a no-op.
+//
+// NOTE: Only allocations done via the scope-aware allocators are detected.
+
+#pragma once
+
+#include <cassert>
+
+namespace radio_core {
+
+class NoAllocationScope {
+ public:
+  NoAllocationScope() : NoAllocationScope(true) {}
+
+  // Construct the scope which only performs the check when the is_active is
+  // true. Allows to only check code paths for which the memory is known to be
+  // pre-allocated.
+#if !defined(NDEBUG)
+  explicit NoAllocationScope(const bool is_active) : is_active_(is_active) {
+    if (is_active_) {
+      ++GetDepth();
+    }
+  }
+  ~NoAllocationScope() {
+    if (is_active_) {
+      --GetDepth();
+    }
+  }
+#else
+  explicit NoAllocationScope(const bool /*is_active*/) {}
+  ~NoAllocationScope() = default;
+#endif
+
+  NoAllocationScope(const NoAllocationScope& other) = delete;
+  NoAllocationScope(NoAllocationScope&& other) noexcept = delete;
+
+  auto operator=(const NoAllocationScope& other) -> NoAllocationScope& = delete;
+  auto operator=(NoAllocationScope&& other) -> NoAllocationScope& = delete;
+
+  // Returns true if the calling thread is within a no-allocation scope.
+  // Always returns false in release builds.
+  static inline auto IsActive() -> bool {
+#if !defined(NDEBUG)
+    return GetDepth() != 0;
+#else
+    return false;
+#endif
+  }
+
+  // Assert that memory allocation is allowed in the calling thread.
+  static inline void AssertAllocationAllowed() {
+    assert(!IsActive() && "Memory allocation in a no-allocation scope");
+  }
+
+ private:
+#if !defined(NDEBUG)
+  // Number of nested no-allocation scopes of the calling thread.
+  static inline auto GetDepth() -> int& {
+    static thread_local int depth = 0;
+    return depth;
+  }
+
+  bool is_active_;
+#endif
+};
+
+}  // namespace radio_core
@@ -16,7 +16,10 @@
 #include <type_traits>
 #include <utility>
 
+#include "radio_core/base/build_config.h"
+
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 namespace unroll_internal {
 
@@ -44,4 +47,5 @@ constexpr void Unroll(F&& f) {
   Unroll<N>([&](auto i) { Unroll<M>([&](auto j) { f(i, j); }); });
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -20,11 +20,34 @@
 //     crc = crc16ccitt::updateCRC<crc16ccitt::FCS>(crc, byte);
 //   }
 //   crc = crc16ccitt::finalizeCRC<crc16ccitt::FCS>(crc);
+//
+// Multiple bytes could be processed at once, which is much faster than
+// updating the CRC byte by byte:
+//
+//   uint16_t crc = crc16ccitt::Init<crc16ccitt::FCS>();
+//   crc = crc16ccitt::Update<crc16ccitt::FCS>(crc, std::as_bytes(message));
+//   crc = crc16ccitt::Finalize<crc16ccitt::FCS>(crc);
+//
+// The bulk update uses carry-less multiplication when the CPU supports it
+// (PCLMULQDQ on x86, PMULL on ARM), and slice-by-8 tables otherwise.
 
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/crypto/internal/crc-16-ccitt_generic.h"
+#include "radio_core/crypto/internal/crc-16-ccitt_neon.h"
+#include "radio_core/crypto/internal/crc-16-ccitt_x86.h"
+
+#if (ARCH_CPU_X86_FAMILY && ISA_CPU_X86_PCLMUL) || ISA_CPU_ARM_PMULL
+#  define RADIO_CORE_HAVE_CRC16CCITT_FOLDING 1
+#else
+#  define RADIO_CORE_HAVE_CRC16CCITT_FOLDING 0
+#endif
 
 namespace radio_core::crypto::crc16ccitt {
 
@@ -65,6 +88,10 @@ struct FCS {
        0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330, 0x7bc7, 0x6a4e, 0x58d5, 0x495c,
        0x3de3, 0x2c6a, 0x1ef1, 0x0f78}};
 
+  // Generator polynomial x^16 + x^12 + x^5 + 1 in the normal form, without the
+  // x^16 term. The table above is calculated for its reflected form.
+  inline static constexpr uint16_t kPolynomial = 0x1021;
+
   // Initial value of CRC when calculating CRC of a message.
   inline static constexpr uint16_t kInitialValue = 0xffff;
 
@@ -87,6 +114,19 @@ inline auto Update(const uint16_t crc, const uint8_t byte) -> uint16_t {
   return ((crc) >> 8) ^ Parametrization::kTable[index];
 }
 
+// Update the CRC value with multiple bytes from the input.
+//
+// The result is the same as updating the CRC with every byte in order.
+template <class Parametrization>
+inline auto Update(const uint16_t crc, const std::span<const std::byte> bytes)
+    -> uint16_t {
+#if RADIO_CORE_HAVE_CRC16CCITT_FOLDING
+  return internal::UpdateFolding<Parametrization>(crc, bytes);
+#else
+  return internal::UpdateSliceBy8<Parametrization>(crc, bytes);
+#endif
+}
+
 // Finalize CRC.
 // This is the final step of CRC calculation.
 template <class Parametrization>
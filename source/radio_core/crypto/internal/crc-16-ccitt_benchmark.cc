@@ -0,0 +1,158 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Benchmark of the CRC-16-CCITT calculation of a message.
+//
+// Compare the byte by byte, slice-by-8, and carry-less multiplication
+// implementations:
+//
+//   ./radio_core_crypto_crc-16-ccitt_benchmark byte
+//   ./radio_core_crypto_crc-16-ccitt_benchmark slice8
+//   ./radio_core_crypto_crc-16-ccitt_benchmark folding
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "radio_core/benchmark/base_app.h"
+#include "radio_core/crypto/crc-16-ccitt.h"
+
+namespace radio_core::benchmark {
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+using crypto::crc16ccitt::FCS;
+
+class CRC16CCITTBenchmark : public Benchmark {
+ public:
+  using Benchmark::Benchmark;
+
+ protected:
+  auto GetBenchmarkName() -> std::string override { return "CRC-16-CCITT"; }
+
+  void ConfigureParser(argparse::ArgumentParser& parser) override {
+    parser.add_argument("implementation")
+        .help("Implementation of the CRC: " +
+              std::string(kSupportedImplementationsListString));
+
+    parser.add_argument("--num-bytes")
+        .default_value(256)
+        .help("The number of bytes in the message")
+        .scan<'i', int>();
+  }
+
+  auto HandleArguments(argparse::ArgumentParser& parser) -> bool override {
+    const auto implementation = parser.get<std::string>("implementation");
+    if (implementation == "byte") {
+      implementation_ = Implementation::kByte;
+    } else if (implementation == "slice8") {
+      implementation_ = Implementation::kSliceBy8;
+#if RADIO_CORE_HAVE_CRC16CCITT_FOLDING
+    } else if (implementation == "folding") {
+      implementation_ = Implementation::kFolding;
+#endif
+    } else {
+      cerr << "Unknown implementation " << implementation << endl;
+      cerr << "Supported: " << kSupportedImplementationsListString << endl;
+      return false;
+    }
+
+    num_bytes_ = parser.get<int>("--num-bytes");
+
+    return true;
+  }
+
+  void Initialize() override {
+    std::mt19937 random_engine(0);
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    bytes_.resize(num_bytes_);
+    for (std::byte& byte : bytes_) {
+      byte = std::byte(distribution(random_engine));
+    }
+
+    cout << endl;
+    cout << "Configuration" << endl;
+    cout << "=============" << endl;
+
+    switch (implementation_) {
+      case Implementation::kByte:
+        cout << "Implementation       : byte" << endl;
+        break;
+      case Implementation::kSliceBy8:
+        cout << "Implementation       : slice8" << endl;
+        break;
+      case Implementation::kFolding:
+        cout << "Implementation       : folding" << endl;
+        break;
+    }
+    cout << "Number of bytes      : " << num_bytes_ << endl;
+    cout << "Number of iterations : " << GetNumIterations() << endl;
+  }
+
+  void Iteration() override {
+    uint16_t crc = crypto::crc16ccitt::Init<FCS>();
+
+    switch (implementation_) {
+      case Implementation::kByte:
+        for (const std::byte byte : bytes_) {
+          crc = crypto::crc16ccitt::Update<FCS>(crc,
+                                                std::to_integer<uint8_t>(byte));
+        }
+        break;
+
+      case Implementation::kSliceBy8:
+        crc = crypto::crc16ccitt::internal::UpdateSliceBy8<FCS>(crc, bytes_);
+        break;
+
+      case Implementation::kFolding:
+#if RADIO_CORE_HAVE_CRC16CCITT_FOLDING
+        crc = crypto::crc16ccitt::internal::UpdateFolding<FCS>(crc, bytes_);
+#endif
+        break;
+    }
+
+    crc_checksum_ ^= crypto::crc16ccitt::Finalize<FCS>(crc);
+  }
+
+  void Finalize() override {
+    // Endurance that the calculation is not optimized out.
+    cout << "Checksum of CRCs : " << crc_checksum_ << endl;
+  }
+
+ private:
+  enum class Implementation {
+    kByte,
+    kSliceBy8,
+    kFolding,
+  };
+
+#if RADIO_CORE_HAVE_CRC16CCITT_FOLDING
+  static constexpr std::string_view kSupportedImplementationsListString =
+      "byte, slice8, folding";
+#else
+  static constexpr std::string_view kSupportedImplementationsListString =
+      "byte, slice8";
+#endif
+
+  Implementation implementation_{Implementation::kByte};
+
+  int num_bytes_{256};
+
+  std::vector<std::byte> bytes_;
+
+  uint16_t crc_checksum_{0};
+};
+
+}  // namespace radio_core::benchmark
+
+auto main(int argc, char** argv) -> int {
+  radio_core::benchmark::CRC16CCITTBenchmark app;
+  return app.Run(argc, argv);
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Generic building blocks of the bulk CRC-16-CCITT calculation.
+//
+// The slice-by-8 processing uses 8 tables derived from the byte-wise table of
+// the parametrization. The table k gives the contribution of a byte which is
+// followed by k more bytes of the message, which allows to update the CRC
+// with 8 bytes using 8 independent table lookups.
+//
+// The folding constants are used by the carry-less multiplication based
+// implementations. They follow the approach described in the
+//
+//   Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction
+//   Vinodh Gopal, Erdinc Ozturk, Jim Guilford, et al.
+//   Intel, 2009
+//
+// The message is processed in 128-bit blocks. A block is folded into the next
+// one by multiplying its two 64-bit halves by x^(D+64) mod P and x^D mod P,
+// where D is the distance between the blocks in bits. The result is congruent
+// to the original message modulo P, so the CRC of the final 128-bit block
+// equals to the CRC of the message up to this point.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace radio_core::crypto::crc16ccitt::internal {
+
+// The number of bytes processed by the slice-by-8 at once.
+inline constexpr size_t kNumSlices = 8;
+
+template <class Parametrization>
+inline constexpr auto MakeSliceTables()
+    -> std::array<std::array<uint16_t, 256>, kNumSlices> {
+  std::array<std::array<uint16_t, 256>, kNumSlices> tables{};
+
+  tables[0] = Parametrization::kTable;
+
+  for (size_t k = 1; k < kNumSlices; ++k) {
+    for (size_t i = 0; i < 256; ++i) {
+      const uint16_t value = tables[k - 1][i];
+      tables[k][i] = (value >> 8) ^ tables[0][value & 0xff];
+    }
+  }
+
+  return tables;
+}
+
+template <class Parametrization>
+inline constexpr std::array<std::array<uint16_t, 256>, kNumSlices>
+    kSliceTables = MakeSliceTables<Parametrization>();
+
+// Update the CRC with the given bytes, processing 8 bytes at a time.
+template <class Parametrization>
+inline auto UpdateSliceBy8(uint16_t crc, const std::span<const std::byte> bytes)
+    -> uint16_t {
+  const auto& tables = kSliceTables<Parametrization>;
+
+  const std::byte* data = bytes.data();
+  size_t size = bytes.size();
+
+  while (size >= kNumSlices) {
+    const auto byte = [data](const size_t i) -> uint8_t {
+      return std::to_integer<uint8_t>(data[i]);
+    };
+
+    crc = tables[7][byte(0) ^ (crc & 0xff)] ^ tables[6][byte(1) ^ (crc >> 8)] ^
+          tables[5][byte(2)] ^ tables[4][byte(3)] ^ tables[3][byte(4)] ^
+          tables[2][byte(5)] ^ tables[1][byte(6)] ^ tables[0][byte(7)];
+
+    data += kNumSlices;
+    size -= kNumSlices;
+  }
+
+  while (size--) {
+    const uint8_t index = (crc ^ std::to_integer<uint8_t>(*data++)) & 0xff;
+    crc = (crc >> 8) ^ tables[0][index];
+  }
+
+  return crc;
+}
+
+// Calculate x^n mod P, where P is the generator polynomial of the
+// parametrization in the normal (not reflected) form, without the x^16 term.
+template <class Parametrization>
+inline constexpr auto XPowModPolynomial(const int n) -> uint16_t {
+  uint32_t remainder = 1;
+  for (int i = 0; i < n; ++i) {
+    remainder <<= 1;
+    if (remainder & 0x10000) {
+      remainder ^= 0x10000 | Parametrization::kPolynomial;
+    }
+  }
+  return remainder;
+}
+
+// Get the constant for the carry-less multiplication which multiplies a 64-bit
+// half of a block by x^n mod P.
+//
+// The CRC is reflected: the first bit of the message is stored in the least
+// significant bit, and is the coefficient of the highest power of x. So the
+// constant is stored reflected in 64 bits. The carry-less product of two
+// reflected 64-bit values is 127 bits long, and when it is interpreted as a
+// reflected 128-bit value it is multiplied by x. This is compensated by using
+// x^(n-1) mod P as the constant.
+template <class Parametrization>
+inline constexpr auto GetFoldingConstant(const int n) -> uint64_t {
+  const uint16_t value = XPowModPolynomial<Parametrization>(n - 1);
+
+  uint64_t constant = 0;
+  for (int i = 0; i < 16; ++i) {
+    if (value & (1 << i)) {
+      constant |= uint64_t(1) << (63 - i);
+    }
+  }
+
+  return constant;
+}
+
+}  // namespace radio_core::crypto::crc16ccitt::internal
@@ -0,0 +1,109 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Calculation of CRC-16-CCITT of multiple bytes using polynomial multiplication
+// of the ARM cryptographic extension.
+//
+// Follows the same approach as the x86 implementation.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+
+#if ISA_CPU_ARM_PMULL
+
+#  include <arm_neon.h>
+
+#  include <cstddef>
+#  include <cstdint>
+#  include <span>
+
+#  include "radio_core/crypto/internal/crc-16-ccitt_generic.h"
+
+namespace radio_core::crypto::crc16ccitt::internal {
+
+namespace neon {
+
+// Fold the 128-bit block to the distance defined by the constants.
+inline auto Fold(const uint64x2_t block, const poly64x2_t constants)
+    -> uint64x2_t {
+  const poly64x2_t block_p64 = vreinterpretq_p64_u64(block);
+
+  const poly128_t low = vmull_p64(vgetq_lane_p64(block_p64, 0),
+                                  vgetq_lane_p64(constants, 0));
+  const poly128_t high = vmull_high_p64(block_p64, constants);
+
+  return veorq_u64(vreinterpretq_u64_p128(low), vreinterpretq_u64_p128(high));
+}
+
+inline auto Load(const std::byte* data) -> uint64x2_t {
+  return vreinterpretq_u64_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data)));
+}
+
+// Get constants which fold a block to the given distance in bits.
+template <class Parametrization, int kDistance>
+inline auto GetFoldingConstants() -> poly64x2_t {
+  constexpr uint64_t kLow = GetFoldingConstant<Parametrization>(kDistance + 64);
+  constexpr uint64_t kHigh = GetFoldingConstant<Parametrization>(kDistance);
+  return vcombine_p64(vcreate_p64(kLow), vcreate_p64(kHigh));
+}
+
+}  // namespace neon
+
+// The smallest number of bytes for which the folding is used.
+// Shorter inputs are processed using the slice-by-8.
+inline constexpr size_t kMinFoldingBytes = 64;
+
+// Update the CRC with the given bytes using polynomial multiplication.
+template <class Parametrization>
+inline auto UpdateFolding(uint16_t crc, const std::span<const std::byte> bytes)
+    -> uint16_t {
+  if (bytes.size() < kMinFoldingBytes) {
+    return UpdateSliceBy8<Parametrization>(crc, bytes);
+  }
+
+  const std::byte* data = bytes.data();
+  size_t size = bytes.size();
+
+  // The CRC of the reflected parametrization is applied to the first 16 bits of
+  // the message.
+  uint64x2_t x0 = veorq_u64(neon::Load(data),
+                            vcombine_u64(vcreate_u64(crc), vcreate_u64(0)));
+  uint64x2_t x1 = neon::Load(data + 16);
+  uint64x2_t x2 = neon::Load(data + 32);
+  uint64x2_t x3 = neon::Load(data + 48);
+  data += 64;
+  size -= 64;
+
+  const poly64x2_t k512 = neon::GetFoldingConstants<Parametrization, 512>();
+  while (size >= 64) {
+    x0 = veorq_u64(neon::Fold(x0, k512), neon::Load(data));
+    x1 = veorq_u64(neon::Fold(x1, k512), neon::Load(data + 16));
+    x2 = veorq_u64(neon::Fold(x2, k512), neon::Load(data + 32));
+    x3 = veorq_u64(neon::Fold(x3, k512), neon::Load(data + 48));
+    data += 64;
+    size -= 64;
+  }
+
+  const poly64x2_t k128 = neon::GetFoldingConstants<Parametrization, 128>();
+  x0 = veorq_u64(neon::Fold(x0, k128), x1);
+  x0 = veorq_u64(neon::Fold(x0, k128), x2);
+  x0 = veorq_u64(neon::Fold(x0, k128), x3);
+  while (size >= 16) {
+    x0 = veorq_u64(neon::Fold(x0, k128), neon::Load(data));
+    data += 16;
+    size -= 16;
+  }
+
+  alignas(16) std::byte block[16];
+  vst1q_u8(reinterpret_cast<uint8_t*>(block), vreinterpretq_u8_u64(x0));
+
+  crc = UpdateSliceBy8<Parametrization>(0, block);
+
+  return UpdateSliceBy8<Parametrization>(crc, {data, size});
+}
+
+}  // namespace radio_core::crypto::crc16ccitt::internal
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Test of the CRC-16-CCITT folding using the PCLMULQDQ instructions.
+//
+// The test is compiled with the PCLMULQDQ instructions enabled regardless of
+// the global compiler flags, so that the folding is covered by the builds which
+// target CPUs without the carry-less multiplication. The test is skipped when
+// the CPU it is running on does not support the instructions.
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/base/cpu_features.h"
+#include "radio_core/crypto/crc-16-ccitt.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::crypto {
+
+#if ARCH_CPU_X86_FAMILY && ISA_CPU_X86_PCLMUL
+
+namespace {
+
+// Generate bytes with random values.
+auto GenerateRandomBytes(const size_t num_bytes) -> std::vector<std::byte> {
+  std::mt19937 random_engine(num_bytes);
+  std::uniform_int_distribution<int> distribution(0, 255);
+
+  std::vector<std::byte> bytes(num_bytes);
+  for (std::byte& byte : bytes) {
+    byte = std::byte(distribution(random_engine));
+  }
+
+  return bytes;
+}
+
+}  // namespace
+
+TEST(crc16ccittPCLMUL, FCSFoldingMatchesSliceBy8) {
+  if (!GetCPUFeatures().pclmul) {
+    GTEST_SKIP() << "PCLMULQDQ is not supported by the CPU";
+  }
+
+  const std::vector<std::byte> bytes = GenerateRandomBytes(4096);
+
+  for (const uint16_t initial_crc : {0x0000, 0xffff, 0x1234}) {
+    for (size_t offset = 0; offset < 16; ++offset) {
+      // Cover sizes around the folding threshold, around the boundaries of
+      // the 64 and 16 byte blocks, and long inputs.
+      for (size_t size = 0; size < 600; ++size) {
+        const std::span<const std::byte> input =
+            std::span(bytes).subspan(offset, size);
+
+        ASSERT_EQ(
+            crc16ccitt::internal::UpdateFolding<crc16ccitt::FCS>(initial_crc,
+                                                                 input),
+            crc16ccitt::internal::UpdateSliceBy8<crc16ccitt::FCS>(initial_crc,
+                                                                  input))
+            << "offset " << offset << " size " << size;
+      }
+    }
+
+    const std::span<const std::byte> input(bytes);
+    ASSERT_EQ(
+        crc16ccitt::internal::UpdateFolding<crc16ccitt::FCS>(initial_crc,
+                                                             input),
+        crc16ccitt::internal::UpdateSliceBy8<crc16ccitt::FCS>(initial_crc,
+                                                              input));
+  }
+}
+
+#endif
+
+}  // namespace radio_core::crypto
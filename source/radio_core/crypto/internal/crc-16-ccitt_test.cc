@@ -4,7 +4,12 @@
 
 #include "radio_core/crypto/crc-16-ccitt.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
 #include <string_view>
+#include <vector>
 
 #include "radio_core/unittest/test.h"
 
@@ -23,6 +28,55 @@ auto CalculateCRC(const std::string_view str) -> uint16_t {
   return crc;
 }
 
+// Update the CRC with every byte, one by one.
+template <class Parametrization>
+auto UpdateByteByByte(uint16_t crc, const std::span<const std::byte> bytes)
+    -> uint16_t {
+  for (const std::byte byte : bytes) {
+    crc = crc16ccitt::Update<Parametrization>(crc,
+                                              std::to_integer<uint8_t>(byte));
+  }
+  return crc;
+}
+
+// Generate bytes with random values.
+auto GenerateRandomBytes(const size_t num_bytes) -> std::vector<std::byte> {
+  std::mt19937 random_engine(num_bytes);
+  std::uniform_int_distribution<int> distribution(0, 255);
+
+  std::vector<std::byte> bytes(num_bytes);
+  for (std::byte& byte : bytes) {
+    byte = std::byte(distribution(random_engine));
+  }
+
+  return bytes;
+}
+
+// Check that the given implementation of the bulk update matches the byte by
+// byte update, for a range of sizes and alignments of the input, and for
+// different values of the initial CRC.
+template <class Parametrization, class F>
+void CheckMatchesByteByByte(F&& update) {
+  const std::vector<std::byte> bytes = GenerateRandomBytes(1024);
+
+  for (const uint16_t initial_crc : {0x0000, 0xffff, 0x1234}) {
+    for (size_t offset = 0; offset < 16; ++offset) {
+      for (size_t size = 0; size < 300; ++size) {
+        const std::span<const std::byte> input =
+            std::span(bytes).subspan(offset, size);
+
+        ASSERT_EQ(update(initial_crc, input),
+                  UpdateByteByByte<Parametrization>(initial_crc, input))
+            << "offset " << offset << " size " << size;
+      }
+    }
+
+    const std::span<const std::byte> input(bytes);
+    ASSERT_EQ(update(initial_crc, input),
+              UpdateByteByByte<Parametrization>(initial_crc, input));
+  }
+}
+
 }  // namespace
 
 TEST(crc16ccitt, FCS) {
@@ -47,4 +101,39 @@ TEST(crc16ccitt, FCS) {
   EXPECT_EQ(CalculateCRC<crc16ccitt::FCS>("Hello, World!"), 0x9BD5);
 }
 
+TEST(crc16ccitt, FCSBytes) {
+  const std::string_view str = "123456789";
+
+  uint16_t crc = crc16ccitt::Init<crc16ccitt::FCS>();
+  crc = crc16ccitt::Update<crc16ccitt::FCS>(crc,
+                                            std::as_bytes(std::span(str)));
+  crc = crc16ccitt::Finalize<crc16ccitt::FCS>(crc);
+
+  EXPECT_EQ(crc, 0x906E);
+}
+
+TEST(crc16ccitt, FCSBytesMatchesByteByByte) {
+  CheckMatchesByteByByte<crc16ccitt::FCS>(
+      [](const uint16_t crc, const std::span<const std::byte> bytes) {
+        return crc16ccitt::Update<crc16ccitt::FCS>(crc, bytes);
+      });
+}
+
+TEST(crc16ccitt, FCSSliceBy8) {
+  CheckMatchesByteByByte<crc16ccitt::FCS>(
+      [](const uint16_t crc, const std::span<const std::byte> bytes) {
+        return crc16ccitt::internal::UpdateSliceBy8<crc16ccitt::FCS>(crc,
+                                                                     bytes);
+      });
+}
+
+#if RADIO_CORE_HAVE_CRC16CCITT_FOLDING
+TEST(crc16ccitt, FCSFolding) {
+  CheckMatchesByteByByte<crc16ccitt::FCS>(
+      [](const uint16_t crc, const std::span<const std::byte> bytes) {
+        return crc16ccitt::internal::UpdateFolding<crc16ccitt::FCS>(crc, bytes);
+      });
+}
+#endif
+
 }  // namespace radio_core::crypto
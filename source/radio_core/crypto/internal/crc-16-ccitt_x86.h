@@ -0,0 +1,109 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Calculation of CRC-16-CCITT of multiple bytes using carry-less multiplication
+// of the PCLMULQDQ instruction set.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+
+#if ARCH_CPU_X86_FAMILY && ISA_CPU_X86_PCLMUL
+
+#  include <emmintrin.h>
+#  include <wmmintrin.h>
+
+#  include <cstddef>
+#  include <cstdint>
+#  include <span>
+
+#  include "radio_core/crypto/internal/crc-16-ccitt_generic.h"
+
+namespace radio_core::crypto::crc16ccitt::internal {
+
+namespace x86 {
+
+// Fold the 128-bit block to the distance defined by the constants.
+//
+// The lower 64 bits of the constants are multiplied with the lower half of the
+// block (which holds the higher powers of x), the upper 64 bits are multiplied
+// with the upper half of the block.
+inline auto Fold(const __m128i block, const __m128i constants) -> __m128i {
+  return _mm_xor_si128(_mm_clmulepi64_si128(block, constants, 0x00),
+                       _mm_clmulepi64_si128(block, constants, 0x11));
+}
+
+inline auto Load(const std::byte* data) -> __m128i {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+// Get constants which fold a block to the given distance in bits.
+template <class Parametrization, int kDistance>
+inline auto GetFoldingConstants() -> __m128i {
+  constexpr uint64_t kLow = GetFoldingConstant<Parametrization>(kDistance + 64);
+  constexpr uint64_t kHigh = GetFoldingConstant<Parametrization>(kDistance);
+  return _mm_set_epi64x(kHigh, kLow);
+}
+
+}  // namespace x86
+
+// The smallest number of bytes for which the folding is used.
+// Shorter inputs are processed using the slice-by-8.
+inline constexpr size_t kMinFoldingBytes = 64;
+
+// Update the CRC with the given bytes using carry-less multiplication.
+//
+// Four independent 128-bit blocks are folded at a time to hide the latency of
+// the multiplication. They are then folded into a single block, and the CRC of
+// the block and the remaining bytes is calculated using the slice-by-8.
+template <class Parametrization>
+inline auto UpdateFolding(uint16_t crc, const std::span<const std::byte> bytes)
+    -> uint16_t {
+  if (bytes.size() < kMinFoldingBytes) {
+    return UpdateSliceBy8<Parametrization>(crc, bytes);
+  }
+
+  const std::byte* data = bytes.data();
+  size_t size = bytes.size();
+
+  // The CRC of the reflected parametrization is applied to the first 16 bits of
+  // the message.
+  __m128i x0 = _mm_xor_si128(x86::Load(data), _mm_cvtsi32_si128(crc));
+  __m128i x1 = x86::Load(data + 16);
+  __m128i x2 = x86::Load(data + 32);
+  __m128i x3 = x86::Load(data + 48);
+  data += 64;
+  size -= 64;
+
+  const __m128i k512 = x86::GetFoldingConstants<Parametrization, 512>();
+  while (size >= 64) {
+    x0 = _mm_xor_si128(x86::Fold(x0, k512), x86::Load(data));
+    x1 = _mm_xor_si128(x86::Fold(x1, k512), x86::Load(data + 16));
+    x2 = _mm_xor_si128(x86::Fold(x2, k512), x86::Load(data + 32));
+    x3 = _mm_xor_si128(x86::Fold(x3, k512), x86::Load(data + 48));
+    data += 64;
+    size -= 64;
+  }
+
+  const __m128i k128 = x86::GetFoldingConstants<Parametrization, 128>();
+  x0 = _mm_xor_si128(x86::Fold(x0, k128), x1);
+  x0 = _mm_xor_si128(x86::Fold(x0, k128), x2);
+  x0 = _mm_xor_si128(x86::Fold(x0, k128), x3);
+  while (size >= 16) {
+    x0 = _mm_xor_si128(x86::Fold(x0, k128), x86::Load(data));
+    data += 16;
+    size -= 16;
+  }
+
+  alignas(16) std::byte block[16];
+  _mm_store_si128(reinterpret_cast<__m128i*>(block), x0);
+
+  crc = UpdateSliceBy8<Parametrization>(0, block);
+
+  return UpdateSliceBy8<Parametrization>(crc, {data, size});
+}
+
+}  // namespace radio_core::crypto::crc16ccitt::internal
+
+#endif
@@ -7,9 +7,11 @@
 #include <array>
 #include <cassert>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Accurate-ish moving average calculator.
 //
@@ -118,4 +120,5 @@ inline auto ExponentialMovingAverage(const T sample,
   return Lerp(average, sample, sample_weight);
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -6,12 +6,14 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/math.h"
 
 #include <cmath>
 #include <ostream>
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T>
 class BaseComplex {
@@ -249,4 +251,5 @@ inline auto Exp(const BaseComplex<T>& z) -> BaseComplex<T> {
   return Exp(z.real) * ComplexExp(z.imag);
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
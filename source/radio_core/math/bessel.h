@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Calculate the zeroth-order modified Bessel function of the first kind.
 template <class T>
@@ -31,12 +33,21 @@ inline auto ModifiedBesselI0(T x) -> T {
   // Point is: is not immediately obvious that pulling Boost or other bigger
   // library will have measurable impact on DSP aspects.
 
-  T fct = 1;
-  T sum = 0;
-  for (int k = 0; k < 10; fct *= ++k) {
-    sum += Pow((x / 2), T(2 * k)) / Pow(fct, T(2));
+  //
+  // The terms of the series are calculated incrementally from the previous
+  // term, which avoids overflow of the factorial and the power on the types
+  // with a small range, such as half precision floating point values.
+
+  const T x2_4 = (x / 2) * (x / 2);
+
+  T term = 1;
+  T sum = 1;
+  for (int k = 1; k < 10; ++k) {
+    term = term * x2_4 / T(k * k);
+    sum += term;
   }
   return sum;
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -10,6 +10,7 @@
 #include <type_traits>
 
 #include "radio_core/base/bit_cast.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/compiler_specific.h"
 
 // Polymorphic functions for the half-precision floating point values.
@@ -20,6 +21,7 @@
 #endif
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // BitfieldWithSize allows to access type which is needed to hold bits of a bit
 // field with given size in bytes.
@@ -80,4 +82,5 @@ inline auto Select(const typename BitfieldForType<T>::Type& mask,
   return BitCast<T>(result_bits);
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
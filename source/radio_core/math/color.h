@@ -6,9 +6,11 @@
 
 #include <cstdint>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 ////////////////////////////////////////////////////////////////////////////////
 // Common utilities.
@@ -404,4 +406,5 @@ using Color3ub = Color3<uint8_t>;
 using Color4f = Color4<float>;
 using Color4ub = Color4<uint8_t>;
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -11,10 +11,12 @@
 #include <cmath>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/color.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Definition of a color of gradient at the specific coordinate u.
 // The coordinate is in the normalized space: 0 means the very first color,
@@ -86,4 +88,5 @@ inline auto GradientSampleNearest(const std::span<const ColorType> pixels,
   return pixels[RoundToInt(u * (pixels.size() - 1))];
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
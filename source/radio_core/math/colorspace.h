@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/color.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Formula from Python Imaging Library:
 //
@@ -50,4 +52,5 @@ inline constexpr auto RGBToYCbCr(const Color3<T>& rgb) -> Color3<T> {
   return ycc;
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
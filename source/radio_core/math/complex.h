@@ -7,10 +7,13 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/base_complex.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Complex = BaseComplex<float>;
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -0,0 +1,34 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Vectorized data type which holds 16 complex values in single floating point
+// precision.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/internal/vectorized_complex_scalar.h"
+#include "radio_core/math/vectorized_complex_type.h"
+
+#include "radio_core/math/internal/complex16_complex8x2.h"
+#include "radio_core/math/internal/complex16_x86.h"
+
+// Some Complex16 operations return Float16, so ensure there are specializers
+// of vectorized type available.
+#include "radio_core/math/float16.h"
+
+// Types for extracting lower and upper parts, and constructing from 2 parts.
+#include "radio_core/math/complex8.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+using Complex16 = VectorizedComplexType<float, 16>;
+
+static_assert(alignof(Complex16) == alignof(Complex16::RegisterType));
+static_assert(sizeof(Complex16) == sizeof(Complex16::RegisterType));
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/internal/vectorized_complex_scalar.h"
 #include "radio_core/math/vectorized_complex_type.h"
@@ -15,10 +16,12 @@
 #include "radio_core/math/float2.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Complex2 = VectorizedComplexType<float, 2>;
 
 static_assert(alignof(Complex2) == alignof(Complex2::RegisterType));
 static_assert(sizeof(Complex2) == sizeof(Complex2::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/internal/vectorized_complex_scalar.h"
 #include "radio_core/math/vectorized_complex_type.h"
@@ -15,10 +16,12 @@
 #include "radio_core/math/float3.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Complex3 = VectorizedComplexType<float, 3>;
 
 static_assert(alignof(Complex3) == alignof(Complex3::RegisterType));
 static_assert(sizeof(Complex3) == sizeof(Complex3::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
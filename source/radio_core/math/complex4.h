@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/internal/vectorized_complex_scalar.h"
 #include "radio_core/math/vectorized_complex_type.h"
@@ -21,10 +22,12 @@
 #include "radio_core/math/internal/complex4_x86.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Complex4 = VectorizedComplexType<float, 4>;
 
 static_assert(alignof(Complex4) == alignof(Complex4::RegisterType));
 static_assert(sizeof(Complex4) == sizeof(Complex4::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
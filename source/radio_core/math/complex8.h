@@ -7,11 +7,13 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/internal/vectorized_complex_scalar.h"
 #include "radio_core/math/vectorized_complex_type.h"
 
 #include "radio_core/math/internal/complex8_complex4x2.h"
+#include "radio_core/math/internal/complex8_x86.h"
 
 // Some Complex8 operations return Float8, so ensure there are specializers of
 // vectorized type available.
@@ -21,10 +23,12 @@
 #include "radio_core/math/complex4.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Complex8 = VectorizedComplexType<float, 8>;
 
 static_assert(alignof(Complex8) == alignof(Complex8::RegisterType));
 static_assert(sizeof(Complex8) == sizeof(Complex8::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -7,6 +7,7 @@
 #include <cassert>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/constants.h"
 #include "radio_core/math/complex.h"
 
@@ -18,6 +19,7 @@
 #include "radio_core/math/float8.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Calculate value of a single DFT bin k.
 //
@@ -263,4 +265,5 @@ inline auto CalculateMultipleDFTBinsGoertzel(
   return dft_storage.subspan(0, bins.size());
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -6,9 +6,11 @@
 
 #include <limits>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Follow the STL naming convention.
 //
@@ -151,4 +153,5 @@ class NormalDistribution {
 
 // NOLINTEND(readability-identifier-naming)
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -6,9 +6,11 @@
 
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/base_complex.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Shift the zero-frequency component to the center of the spectrum.
 //
@@ -91,4 +93,5 @@ inline void FFTNormalizeAndShift(const std::span<BaseComplex<T>> x) {
   fft_internal::FFTNormalizeAndShift<BaseComplex<T>, T>(x);
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -22,9 +22,11 @@
 #include <span>
 
 #include "radio_core/base/aligned_allocator.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/base_complex.h"
 
 namespace radio_core::fft {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Aligned allocator with the most common alignment used by FFT libraries.
 template <class T>
@@ -98,6 +100,16 @@ class FFT : public fft_internal::BaseFFT<T, Allocator> {
                        const TransformOptions& options = TransformOptions())
       -> std::span<BaseComplex<T>> = 0;
 
+  // Perform backward (inverse) FFT of the given spectrum of a real signal.
+  // The input is expected to have the number of points/2+1 elements, and the
+  // output must be at least the number of points.
+  // Returns the subspan of the output which is sized to the exact size of the
+  // calculated signal.
+  virtual auto Backward(std::span<const BaseComplex<T>> input,
+                        std::span<T> output,
+                        const TransformOptions& options = TransformOptions())
+      -> std::span<T> = 0;
+
  protected:
   FFT() = default;
 };
@@ -129,8 +141,21 @@ class FFT<BaseComplex<T>, Allocator>
                        const TransformOptions& options = TransformOptions())
       -> std::span<BaseComplex<T>> = 0;
 
+  // Perform backward (inverse) FFT of the given input.
+  // The output must be at least the size of the input. The input and output
+  // might match, but not alias.
+  // The shift option is ignored: the input is expected to have the DC at the
+  // first element.
+  // Returns the subspan of the output which is sized to the exact size of the
+  // calculated FFT.
+  virtual auto Backward(std::span<const BaseComplex<T>> input,
+                        std::span<BaseComplex<T>> output,
+                        const TransformOptions& options = TransformOptions())
+      -> std::span<BaseComplex<T>> = 0;
+
  protected:
   FFT() = default;
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::fft
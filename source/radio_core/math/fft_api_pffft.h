@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <span>
@@ -15,11 +16,13 @@
 
 #include <pffft.h>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/fft.h"
 #include "radio_core/math/fft_api.h"
 
 namespace radio_core::fft {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Forwards declaration of the PFFFT API.
 //
@@ -139,6 +142,8 @@ class PFFFT<float, Allocator> final : public FFT<float, Allocator> {
   void Configure(const SetupOptions& options) override {
     setup_ = pffft_internal::Setup::Create(options.num_points, PFFFT_REAL);
     work_.Allocate(options.num_points);
+    backward_input_.Allocate(options.num_points);
+    num_points_ = options.num_points;
   }
 
   auto Forward(const std::span<const float> input,
@@ -168,9 +173,45 @@ class PFFFT<float, Allocator> final : public FFT<float, Allocator> {
     return result;
   }
 
+  auto Backward(const std::span<const Complex> input,
+                const std::span<float> output,
+                const TransformOptions& options = TransformOptions())
+      -> std::span<float> override {
+    assert(input.size() == std::size_t(num_points_) / 2 + 1);
+    assert(output.size() >= std::size_t(num_points_));
+
+    // Pack the input into the PFFFT order: the 0-frequency and half frequency
+    // components are stored in the first entry as `F(0) + i*F(n / 2)`.
+    float* packed_input = backward_input_.GetData();
+    std::copy(reinterpret_cast<const float*>(input.data()),
+              reinterpret_cast<const float*>(input.data()) + num_points_,
+              packed_input);
+    packed_input[1] = input[input.size() - 1].real;
+
+    pffft_transform_ordered(setup_,
+                            packed_input,
+                            output.data(),
+                            work_.GetData(),
+                            PFFFT_BACKWARD);
+
+    const std::span<float> result = output.subspan(0, num_points_);
+
+    if (options.normalize) {
+      fft_internal::Normalize(result, result.size());
+    }
+
+    return result;
+  }
+
  private:
   pffft_internal::Setup setup_;
   pffft_internal::Work<Allocator> work_;
+
+  // Storage of the input of the backward transform packed into the order
+  // expected by the PFFFT.
+  pffft_internal::Work<Allocator> backward_input_;
+
+  int num_points_{0};
 };
 
 // Specialization of the FFT API which uses PFFFT to perform complex-type FFT.
@@ -216,9 +257,31 @@ class PFFFT<Complex, Allocator> final : public FFT<Complex, Allocator> {
     return result;
   }
 
+  auto Backward(const std::span<const Complex> input,
+                const std::span<Complex> output,
+                const TransformOptions& options = TransformOptions())
+      -> std::span<Complex> override {
+    assert(output.size() >= input.size());
+
+    pffft_transform_ordered(setup_,
+                            reinterpret_cast<const float*>(input.data()),
+                            reinterpret_cast<float*>(output.data()),
+                            work_.GetData(),
+                            PFFFT_BACKWARD);
+
+    const std::span<Complex> result = output.subspan(0, input.size());
+
+    if (options.normalize) {
+      fft_internal::Normalize(result, input.size());
+    }
+
+    return result;
+  }
+
  private:
   pffft_internal::Setup setup_;
   pffft_internal::Work<Allocator> work_;
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::fft
@@ -0,0 +1,33 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Vectorized data type which holds 16 single precision floating point values.
+//
+// The type is natively vectorized on CPUs with AVX-512, and is implemented as
+// 2 Float8 otherwise. It is not used by the kernels and is to be opted in
+// explicitly by the code which benefits from the wider registers.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/internal/vectorized_float_scalar.h"
+#include "radio_core/math/uint16.h"
+#include "radio_core/math/vectorized_float_type.h"
+
+// Types for extracting lower and upper parts, and constructing from 2 parts.
+#include "radio_core/math/float8.h"
+
+#include "radio_core/math/internal/float16_float8x2.h"
+#include "radio_core/math/internal/float16_x86.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+using Float16 = VectorizedFloatType<float, 16>;
+
+static_assert(alignof(Float16) == alignof(Float16::RegisterType));
+static_assert(sizeof(Float16) == sizeof(Float16::RegisterType));
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
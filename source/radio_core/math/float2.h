@@ -6,15 +6,18 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_float_scalar.h"
 #include "radio_core/math/uint2.h"
 #include "radio_core/math/vectorized_float_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Float2 = VectorizedFloatType<float, 2>;
 
 static_assert(alignof(Float2) == alignof(Float2::RegisterType));
 static_assert(sizeof(Float2) == sizeof(Float2::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
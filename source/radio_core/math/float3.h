@@ -6,15 +6,18 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_float_scalar.h"
 #include "radio_core/math/uint3.h"
 #include "radio_core/math/vectorized_float_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Float3 = VectorizedFloatType<float, 3>;
 
 static_assert(alignof(Float3) == alignof(Float3::RegisterType));
 static_assert(sizeof(Float3) == sizeof(Float3::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_float_scalar.h"
 #include "radio_core/math/uint4.h"  // Bit-wise mask type.
 #include "radio_core/math/vectorized_float_type.h"
@@ -17,10 +18,12 @@
 #include "radio_core/math/internal/float4_x86.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Float4 = VectorizedFloatType<float, 4>;
 
 static_assert(alignof(Float4) == alignof(Float4::RegisterType));
 static_assert(sizeof(Float4) == sizeof(Float4::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_float_scalar.h"
 #include "radio_core/math/uint8.h"
 #include "radio_core/math/vectorized_float_type.h"
@@ -14,12 +15,15 @@
 #include "radio_core/math/float4.h"
 
 #include "radio_core/math/internal/float8_float4x2.h"
+#include "radio_core/math/internal/float8_x86.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Float8 = VectorizedFloatType<float, 8>;
 
 static_assert(alignof(Float8) == alignof(Float8::RegisterType));
 static_assert(sizeof(Float8) == sizeof(Float8::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
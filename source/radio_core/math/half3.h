@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 #if RADIO_CORE_HAVE_HALF
@@ -15,12 +16,14 @@
 #  include "radio_core/math/vectorized_float_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Half3 = VectorizedFloatType<Half, 3>;
 
 static_assert(alignof(Half3) == alignof(Half3::RegisterType));
 static_assert(sizeof(Half3) == sizeof(Half3::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // RADIO_CORE_HAVE_HALF
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 #if RADIO_CORE_HAVE_HALF
@@ -18,14 +19,17 @@
 #  include "radio_core/math/half2.h"
 
 #  include "radio_core/math/internal/half4_neon.h"
+#  include "radio_core/math/internal/half4_x86.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Half4 = VectorizedFloatType<Half, 4>;
 
 static_assert(alignof(Half4) == alignof(Half4::RegisterType));
 static_assert(sizeof(Half4) == sizeof(Half4::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // RADIO_CORE_HAVE_HALF
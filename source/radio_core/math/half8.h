@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 #if RADIO_CORE_HAVE_HALF
@@ -19,16 +20,19 @@
 
 #  include "radio_core/math/internal/half8_half4x2.h"
 #  include "radio_core/math/internal/half8_neon.h"
+#  include "radio_core/math/internal/half8_x86.h"
 
 // TODO(sergey): Implementation which operates on float16x8_t on Neon.
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using Half8 = VectorizedFloatType<Half, 8>;
 
 static_assert(alignof(Half8) == alignof(Half8::RegisterType));
 static_assert(sizeof(Half8) == sizeof(Half8::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // RADIO_CORE_HAVE_HALF
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 #if RADIO_CORE_HAVE_HALF
@@ -14,9 +15,11 @@
 #  include "radio_core/math/base_complex.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using HalfComplex = BaseComplex<Half>;
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // RADIO_CORE_HAVE_HALF
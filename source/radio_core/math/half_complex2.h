@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 #if RADIO_CORE_HAVE_HALF
@@ -20,12 +21,14 @@
 #  include "radio_core/math/half2.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using HalfComplex2 = VectorizedComplexType<Half, 2>;
 
 static_assert(alignof(HalfComplex2) == alignof(HalfComplex2::RegisterType));
 static_assert(sizeof(HalfComplex2) == sizeof(HalfComplex2::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // RADIO_CORE_HAVE_HALF
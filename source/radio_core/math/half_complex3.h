@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 #if RADIO_CORE_HAVE_HALF
@@ -20,12 +21,14 @@
 #  include "radio_core/math/half3.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using HalfComplex3 = VectorizedComplexType<Half, 3>;
 
 static_assert(alignof(HalfComplex3) == alignof(HalfComplex3::RegisterType));
 static_assert(sizeof(HalfComplex3) == sizeof(HalfComplex3::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // RADIO_CORE_HAVE_HALF
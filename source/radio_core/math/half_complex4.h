@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 #if RADIO_CORE_HAVE_HALF
@@ -23,14 +24,17 @@
 #  include "radio_core/math/half_complex2.h"
 
 #  include "radio_core/math/internal/half_complex4_neon.h"
+#  include "radio_core/math/internal/half_complex4_x86.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using HalfComplex4 = VectorizedComplexType<Half, 4>;
 
 static_assert(alignof(HalfComplex4) == alignof(HalfComplex4::RegisterType));
 static_assert(sizeof(HalfComplex4) == sizeof(HalfComplex4::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // RADIO_CORE_HAVE_HALF
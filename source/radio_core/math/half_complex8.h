@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 #if RADIO_CORE_HAVE_HALF
@@ -24,14 +25,17 @@
 
 #  include "radio_core/math/internal/half_complex8_half_complex4x2.h"
 #  include "radio_core/math/internal/half_complex8_neon.h"
+#  include "radio_core/math/internal/half_complex8_x86.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using HalfComplex8 = VectorizedComplexType<Half, 8>;
 
 static_assert(alignof(HalfComplex8) == alignof(HalfComplex8::RegisterType));
 static_assert(sizeof(HalfComplex8) == sizeof(HalfComplex8::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // RADIO_CORE_HAVE_HALF
@@ -0,0 +1,243 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 16-element single precision floating point complex values
+// using 2 Complex8 scalars. Relies on the SIMD optimization of the Complex8.
+
+#pragma once
+
+#include "radio_core/base/aligned_register.h"
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/complex8.h"
+#include "radio_core/math/float16.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedComplexTypeInfo;
+
+template <bool SpecializationMarker>
+struct VectorizedComplexTypeInfo<float, 16, SpecializationMarker> {
+  using RegisterType = AlignedRegister<Complex8, 2, 64>;
+
+  static constexpr int kSize = 16;
+  static constexpr bool kIsVectorized = false;
+
+  static auto GetName() -> const char* { return "Complex8x2"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const Complex values[16]) -> RegisterType {
+    return {Complex8(values), Complex8(values + 8)};
+  }
+
+  static inline auto Load(const Complex& a,
+                          const Complex& b,
+                          const Complex& c,
+                          const Complex& d,
+                          const Complex& e,
+                          const Complex& f,
+                          const Complex& g,
+                          const Complex& h,
+                          const Complex& i,
+                          const Complex& j,
+                          const Complex& k,
+                          const Complex& l,
+                          const Complex& m,
+                          const Complex& n,
+                          const Complex& o,
+                          const Complex& p) -> RegisterType {
+    return {Complex8(a, b, c, d, e, f, g, h),
+            Complex8(i, j, k, l, m, n, o, p)};
+  }
+
+  static inline auto Load(const Complex& value) -> RegisterType {
+    return {Complex8(value), Complex8(value)};
+  }
+
+  static inline auto Load(const Float16::RegisterType& real,
+                          const Float16::RegisterType& imag) -> RegisterType {
+    RegisterType result;
+    result[0] = Complex8(Float16::TypeInfo::ExtractLow(real),
+                         Float16::TypeInfo::ExtractLow(imag));
+    result[1] = Complex8(Float16::TypeInfo::ExtractHigh(real),
+                         Float16::TypeInfo::ExtractHigh(imag));
+    return result;
+  }
+
+  static inline auto Load(const float real) -> RegisterType {
+    return {Complex8(real), Complex8(real)};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Unary operations.
+
+  static inline auto Negate(const RegisterType& value) -> RegisterType {
+    return {-value[0], -value[1]};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Mathematical operation between two vectorized registers.
+
+  static inline auto Add(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return {lhs[0] + rhs[0], lhs[1] + rhs[1]};
+  }
+
+  static inline auto Subtract(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return {lhs[0] - rhs[0], lhs[1] - rhs[1]};
+  }
+
+  static inline auto Multiply(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return {lhs[0] * rhs[0], lhs[1] * rhs[1]};
+  }
+
+  static inline auto Multiply(const RegisterType& lhs,
+                              const typename Float16::RegisterType& rhs)
+      -> RegisterType {
+    return {lhs[0] * rhs[0], lhs[1] * rhs[1]};
+  }
+
+  static inline auto Divide(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return {lhs[0] / rhs[0], lhs[1] / rhs[1]};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const RegisterType& value, Complex dst[16]) {
+    value[0].Store(dst);
+    value[1].Store(dst + 8);
+  }
+
+  template <int Index>
+  static inline void Store(const RegisterType& value, Complex* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      value[0].Store<Index>(dst);
+      return;
+    }
+
+    if constexpr (Index >= 8) {
+      value[1].Store<Index - 8>(dst);
+      return;
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const RegisterType& value) -> Complex {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      return value[0].Extract<Index>();
+    }
+
+    if constexpr (Index >= 8) {
+      return value[1].Extract<Index - 8>();
+    }
+  }
+
+  static inline auto ExtractLow(const RegisterType& value) -> Complex8 {
+    return value[0];
+  }
+
+  static inline auto ExtractHigh(const RegisterType& value) -> Complex8 {
+    return value[1];
+  }
+
+  static inline auto ExtractReal(const RegisterType& value) -> Float16 {
+    const Float8 real_low = value[0].ExtractReal();
+    const Float8 real_high = value[1].ExtractReal();
+    return Float16(real_low, real_high);
+  }
+
+  static inline auto ExtractImag(const RegisterType& value) -> Float16 {
+    const Float8 imag_low = value[0].ExtractImag();
+    const Float8 imag_high = value[1].ExtractImag();
+    return Float16(imag_low, imag_high);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const RegisterType& value,
+                             const Complex new_lane_value) -> RegisterType {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      return {value[0].SetLane<Index>(new_lane_value), value[1]};
+    }
+
+    if constexpr (Index >= 8) {
+      return {value[0], value[1].SetLane<Index - 8>(new_lane_value)};
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto Abs(const RegisterType& value) -> Float16 {
+    return {radio_core::Abs(value[0]), radio_core::Abs(value[1])};
+  }
+
+  static inline auto FastAbs(const RegisterType& value) -> Float16 {
+    return {radio_core::FastAbs(value[0]), radio_core::FastAbs(value[1])};
+  }
+
+  static inline auto Norm(const RegisterType& value) -> Float16 {
+    return {radio_core::Norm(value[0]), radio_core::Norm(value[1])};
+  }
+
+  static inline auto HorizontalSum(const RegisterType& value) -> Complex {
+    return radio_core::HorizontalSum(value[0]) +
+           radio_core::HorizontalSum(value[1]);
+  }
+
+  static inline auto MultiplyAdd(const RegisterType& a,
+                                 const RegisterType& b,
+                                 const typename Float16::RegisterType& c)
+      -> RegisterType {
+    return {
+        radio_core::MultiplyAdd(a[0], b[0], Float16::TypeInfo::ExtractLow(c)),
+        radio_core::MultiplyAdd(a[1], b[1], Float16::TypeInfo::ExtractHigh(c))};
+  }
+
+  static inline auto FastArg(const RegisterType& value) -> Float16 {
+    return {radio_core::FastArg(value[0]), radio_core::FastArg(value[1])};
+  }
+
+  static inline auto Conj(const RegisterType& value) -> RegisterType {
+    return {radio_core::Conj(value[0]), radio_core::Conj(value[1])};
+  }
+
+  static inline auto ComplexExp(const typename Float16::RegisterType& x)
+      -> RegisterType {
+    return {radio_core::ComplexExp(Float16::TypeInfo::ExtractLow(x)),
+            radio_core::ComplexExp(Float16::TypeInfo::ExtractHigh(x))};
+  }
+
+  static inline auto Exp(const RegisterType& z) -> RegisterType {
+    return {radio_core::Exp(z[0]), radio_core::Exp(z[1])};
+  }
+
+  static inline auto Reverse(const RegisterType& value) -> RegisterType {
+    return {radio_core::Reverse(value[1]), radio_core::Reverse(value[0])};
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
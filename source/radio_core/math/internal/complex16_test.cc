@@ -0,0 +1,317 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/math/complex16.h"
+
+#include <algorithm>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/math.h"
+#include "radio_core/math/unittest/complex_matchers.h"
+#include "radio_core/math/unittest/vectorized_matchers.h"
+#include "radio_core/unittest/mock.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core {
+
+using testing::ComplexNear;
+using testing::VectorizedNear;
+
+// The tests compare the result of the vectorized operation with the result of
+// the same operation performed on every individual complex value.
+
+namespace {
+
+const Complex kA[16] = {Complex(2, 3),
+                        Complex(-4, 5),
+                        Complex(6, -7),
+                        Complex(-8, -9),
+                        Complex(10, 11),
+                        Complex(-12, 13),
+                        Complex(14, -15),
+                        Complex(-16, -17),
+                        Complex(0.5f, 0.25f),
+                        Complex(1, 0),
+                        Complex(0, 1),
+                        Complex(-1, 0),
+                        Complex(0, -1),
+                        Complex(3, 4),
+                        Complex(-0.5f, 2),
+                        Complex(7, -0.125f)};
+
+const Complex kB[16] = {Complex(3, 4),
+                        Complex(5, 7),
+                        Complex(9, 6),
+                        Complex(2, 10),
+                        Complex(3, 11),
+                        Complex(4, 12),
+                        Complex(5, 13),
+                        Complex(6, 14),
+                        Complex(-1, 2),
+                        Complex(0.5f, 0.5f),
+                        Complex(2, -3),
+                        Complex(-4, -5),
+                        Complex(1, 1),
+                        Complex(-2, 0.25f),
+                        Complex(8, -1),
+                        Complex(0.75f, 3)};
+
+// Expect that every lane of the vectorized value is near to the corresponding
+// scalar value.
+void ExpectNear(const Complex16& actual,
+                const Complex expected[16],
+                const float abs_error) {
+  Complex data[16];
+  actual.Store(data);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_THAT(data[i], ComplexNear(expected[i], abs_error)) << "i=" << i;
+  }
+}
+
+void ExpectNear(const Float16& actual,
+                const float expected[16],
+                const float abs_error) {
+  EXPECT_THAT(actual, VectorizedNear(Float16(expected), abs_error));
+}
+
+}  // namespace
+
+TEST(Complex16, Load) {
+  ExpectNear(Complex16(kA), kA, 1e-6f);
+
+  ExpectNear(Complex16(kA[0],
+                       kA[1],
+                       kA[2],
+                       kA[3],
+                       kA[4],
+                       kA[5],
+                       kA[6],
+                       kA[7],
+                       kA[8],
+                       kA[9],
+                       kA[10],
+                       kA[11],
+                       kA[12],
+                       kA[13],
+                       kA[14],
+                       kA[15]),
+             kA,
+             1e-6f);
+
+  {
+    const Complex16 value(Complex(2, 3));
+    EXPECT_THAT(value.Extract<0>(), ComplexNear(Complex(2, 3), 1e-6f));
+    EXPECT_THAT(value.Extract<15>(), ComplexNear(Complex(2, 3), 1e-6f));
+  }
+
+  {
+    const Complex16 value(2.0f);
+    EXPECT_THAT(value.Extract<0>(), ComplexNear(Complex(2, 0), 1e-6f));
+    EXPECT_THAT(value.Extract<15>(), ComplexNear(Complex(2, 0), 1e-6f));
+  }
+
+  {
+    float real[16], imag[16];
+    for (int i = 0; i < 16; ++i) {
+      real[i] = kA[i].real;
+      imag[i] = kA[i].imag;
+    }
+    ExpectNear(Complex16(Float16(real), Float16(imag)), kA, 1e-6f);
+  }
+}
+
+TEST(Complex16, Store) {
+  const Complex16 value(kA);
+
+  Complex data[16];
+  value.Store(data);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_THAT(data[i], ComplexNear(kA[i], 1e-6f));
+  }
+
+  Complex lane;
+
+  value.Store<0>(&lane);
+  EXPECT_THAT(lane, ComplexNear(kA[0], 1e-6f));
+
+  value.Store<9>(&lane);
+  EXPECT_THAT(lane, ComplexNear(kA[9], 1e-6f));
+
+  value.Store<15>(&lane);
+  EXPECT_THAT(lane, ComplexNear(kA[15], 1e-6f));
+}
+
+TEST(Complex16, Extract) {
+  const Complex16 value(kA);
+
+  EXPECT_THAT(value.Extract<0>(), ComplexNear(kA[0], 1e-6f));
+  EXPECT_THAT(value.Extract<3>(), ComplexNear(kA[3], 1e-6f));
+  EXPECT_THAT(value.Extract<7>(), ComplexNear(kA[7], 1e-6f));
+  EXPECT_THAT(value.Extract<8>(), ComplexNear(kA[8], 1e-6f));
+  EXPECT_THAT(value.Extract<12>(), ComplexNear(kA[12], 1e-6f));
+  EXPECT_THAT(value.Extract<15>(), ComplexNear(kA[15], 1e-6f));
+}
+
+TEST(Complex16, ExtractLowHigh) {
+  const Complex16 value(kA);
+
+  Complex low[8], high[8];
+  value.ExtractLow().Store(low);
+  value.ExtractHigh().Store(high);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_THAT(low[i], ComplexNear(kA[i], 1e-6f));
+    EXPECT_THAT(high[i], ComplexNear(kA[i + 8], 1e-6f));
+  }
+}
+
+TEST(Complex16, ExtractRealImag) {
+  const Complex16 value(kA);
+
+  float real[16], imag[16];
+  for (int i = 0; i < 16; ++i) {
+    real[i] = kA[i].real;
+    imag[i] = kA[i].imag;
+  }
+
+  ExpectNear(value.ExtractReal(), real, 1e-6f);
+  ExpectNear(value.ExtractImag(), imag, 1e-6f);
+}
+
+TEST(Complex16, SetLane) {
+  const Complex16 value(kA);
+
+  Complex expected[16];
+
+  std::copy(kA, kA + 16, expected);
+  expected[0] = Complex(99, 98);
+  ExpectNear(value.SetLane<0>(Complex(99, 98)), expected, 1e-6f);
+
+  std::copy(kA, kA + 16, expected);
+  expected[8] = Complex(99, 98);
+  ExpectNear(value.SetLane<8>(Complex(99, 98)), expected, 1e-6f);
+
+  std::copy(kA, kA + 16, expected);
+  expected[15] = Complex(99, 98);
+  ExpectNear(value.SetLane<15>(Complex(99, 98)), expected, 1e-6f);
+}
+
+TEST(Complex16, Arithmetic) {
+  const Complex16 a(kA);
+  const Complex16 b(kB);
+
+  Complex expected[16];
+
+  for (int i = 0; i < 16; ++i) {
+    expected[i] = -kA[i];
+  }
+  ExpectNear(-a, expected, 1e-6f);
+
+  for (int i = 0; i < 16; ++i) {
+    expected[i] = kA[i] + kB[i];
+  }
+  ExpectNear(a + b, expected, 1e-6f);
+
+  for (int i = 0; i < 16; ++i) {
+    expected[i] = kA[i] - kB[i];
+  }
+  ExpectNear(a - b, expected, 1e-6f);
+
+  for (int i = 0; i < 16; ++i) {
+    expected[i] = kA[i] * kB[i];
+  }
+  ExpectNear(a * b, expected, 1e-5f);
+
+  for (int i = 0; i < 16; ++i) {
+    expected[i] = kA[i] / kB[i];
+  }
+  ExpectNear(a / b, expected, 1e-5f);
+}
+
+TEST(Complex16, MultiplyScalar) {
+  float scale[16];
+  Complex expected[16];
+  for (int i = 0; i < 16; ++i) {
+    scale[i] = float(i) - 7.5f;
+    expected[i] = kA[i] * scale[i];
+  }
+  ExpectNear(Complex16(kA) * Float16(scale), expected, 1e-5f);
+}
+
+TEST(Complex16, AbsNorm) {
+  float abs[16], norm[16];
+  for (int i = 0; i < 16; ++i) {
+    abs[i] = Abs(kA[i]);
+    norm[i] = Norm(kA[i]);
+  }
+
+  ExpectNear(Abs(Complex16(kA)), abs, 1e-5f);
+  ExpectNear(FastAbs(Complex16(kA)), abs, 1e-2f);
+  ExpectNear(Norm(Complex16(kA)), norm, 1e-4f);
+}
+
+TEST(Complex16, HorizontalSum) {
+  Complex expected(0);
+  for (int i = 0; i < 16; ++i) {
+    expected += kA[i];
+  }
+  EXPECT_THAT(HorizontalSum(Complex16(kA)), ComplexNear(expected, 1e-5f));
+}
+
+TEST(Complex16, MultiplyAdd) {
+  float c[16];
+  Complex expected[16];
+  for (int i = 0; i < 16; ++i) {
+    c[i] = float(i) * 0.5f;
+    expected[i] = kA[i] + kB[i] * c[i];
+  }
+  ExpectNear(
+      MultiplyAdd(Complex16(kA), Complex16(kB), Float16(c)), expected, 1e-5f);
+}
+
+TEST(Complex16, FastArg) {
+  float expected[16];
+  for (int i = 0; i < 16; ++i) {
+    expected[i] = ArcTan2(kA[i].imag, kA[i].real);
+  }
+  ExpectNear(FastArg(Complex16(kA)), expected, 0.01f);
+}
+
+TEST(Complex16, Conj) {
+  Complex expected[16];
+  for (int i = 0; i < 16; ++i) {
+    expected[i] = Conj(kA[i]);
+  }
+  ExpectNear(Conj(Complex16(kA)), expected, 1e-6f);
+}
+
+TEST(Complex16, ComplexExp) {
+  float x[16];
+  Complex expected[16];
+  for (int i = 0; i < 16; ++i) {
+    x[i] = float(i - 8) * 0.4f;
+    expected[i] = Complex(Cos(x[i]), Sin(x[i]));
+  }
+  ExpectNear(ComplexExp(Float16(x)), expected, 1e-6f);
+}
+
+TEST(Complex16, Exp) {
+  Complex z[16];
+  Complex expected[16];
+  for (int i = 0; i < 16; ++i) {
+    z[i] = Complex(float(i - 8) * 0.1f, float(i) * 0.3f);
+    expected[i] = Complex(Exp(z[i].real) * Cos(z[i].imag),
+                          Exp(z[i].real) * Sin(z[i].imag));
+  }
+  ExpectNear(Exp(Complex16(z)), expected, 1e-6f);
+}
+
+TEST(Complex16, Reverse) {
+  Complex expected[16];
+  for (int i = 0; i < 16; ++i) {
+    expected[i] = kA[15 - i];
+  }
+  ExpectNear(Reverse(Complex16(kA)), expected, 1e-6f);
+}
+
+}  // namespace radio_core
@@ -0,0 +1,326 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 16-element complex values using AVX-512 Foundation CPU
+// instruction set.
+//
+// The values are stored de-interleaved: one register holds the real parts and
+// another one holds the imaginary parts.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+
+#if ARCH_CPU_X86_FAMILY && ISA_CPU_X86_AVX2 && ISA_CPU_X86_AVX512F
+
+#  include "radio_core/math/complex.h"
+#  include "radio_core/math/complex8.h"
+#  include "radio_core/math/float16.h"
+#  include "radio_core/math/internal/math_x86.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedComplexTypeInfo;
+
+template <>
+struct VectorizedComplexTypeInfo<float, 16, true> {
+  struct RegisterType {
+    __m512 val[2];
+  };
+
+  static constexpr int kSize = 16;
+  static constexpr bool kIsVectorized = true;
+
+  static auto GetName() -> const char* { return "X86"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const Complex values[16]) -> RegisterType {
+    const auto* data = reinterpret_cast<const float*>(values);
+
+    const __m512 a = _mm512_loadu_ps(data);
+    const __m512 b = _mm512_loadu_ps(data + 16);
+
+    // Gather even and odd elements of the concatenation of a and b.
+    const __m512i real_index = _mm512_setr_epi32(
+        0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i imag_index = _mm512_setr_epi32(
+        1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+
+    RegisterType r;
+    r.val[0] = _mm512_permutex2var_ps(a, real_index, b);
+    r.val[1] = _mm512_permutex2var_ps(a, imag_index, b);
+    return r;
+  }
+
+  static inline auto Load(const Complex& a,
+                          const Complex& b,
+                          const Complex& c,
+                          const Complex& d,
+                          const Complex& e,
+                          const Complex& f,
+                          const Complex& g,
+                          const Complex& h,
+                          const Complex& i,
+                          const Complex& j,
+                          const Complex& k,
+                          const Complex& l,
+                          const Complex& m,
+                          const Complex& n,
+                          const Complex& o,
+                          const Complex& p) -> RegisterType {
+    // NOTE: Can not trust order of function arguments in memory, so ensure they
+    // are loaded into a continuous memory chunk.
+    const Complex values[16] = {a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p};
+    return Load(values);
+  }
+
+  static inline auto Load(const Complex& value) -> RegisterType {
+    RegisterType r;
+    r.val[0] = _mm512_set1_ps(value.real);
+    r.val[1] = _mm512_set1_ps(value.imag);
+    return r;
+  }
+
+  static inline auto Load(const Float16::RegisterType& real,
+                          const Float16::RegisterType& imag) -> RegisterType {
+    RegisterType r;
+    r.val[0] = real;
+    r.val[1] = imag;
+    return r;
+  }
+
+  static inline auto Load(const float real) -> RegisterType {
+    RegisterType r;
+    r.val[0] = _mm512_set1_ps(real);
+    r.val[1] = _mm512_setzero_ps();
+    return r;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Unary operations.
+
+  static inline auto Negate(const RegisterType& value) -> RegisterType {
+    RegisterType r;
+    r.val[0] = Float16::TypeInfo::Negate(value.val[0]);
+    r.val[1] = Float16::TypeInfo::Negate(value.val[1]);
+    return r;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Mathematical operation between two vectorized registers.
+
+  static inline auto Add(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    RegisterType result;
+    result.val[0] = _mm512_add_ps(lhs.val[0], rhs.val[0]);
+    result.val[1] = _mm512_add_ps(lhs.val[1], rhs.val[1]);
+    return result;
+  }
+
+  static inline auto Subtract(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    RegisterType result;
+    result.val[0] = _mm512_sub_ps(lhs.val[0], rhs.val[0]);
+    result.val[1] = _mm512_sub_ps(lhs.val[1], rhs.val[1]);
+    return result;
+  }
+
+  static inline auto Multiply(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    const __m512 ac = _mm512_mul_ps(lhs.val[0], rhs.val[0]);
+    const __m512 ad = _mm512_mul_ps(lhs.val[0], rhs.val[1]);
+
+    RegisterType result;
+    result.val[0] = _mm512_fnmadd_ps(lhs.val[1], rhs.val[1], ac);
+    result.val[1] = _mm512_fmadd_ps(lhs.val[1], rhs.val[0], ad);
+    return result;
+  }
+
+  static inline auto Multiply(const RegisterType& lhs,
+                              const typename Float16::RegisterType& rhs)
+      -> RegisterType {
+    RegisterType result;
+    result.val[0] = _mm512_mul_ps(lhs.val[0], rhs);
+    result.val[1] = _mm512_mul_ps(lhs.val[1], rhs);
+    return result;
+  }
+
+  static inline auto Divide(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    const __m512 ac = _mm512_mul_ps(lhs.val[0], rhs.val[0]);
+    const __m512 bd = _mm512_mul_ps(lhs.val[1], rhs.val[1]);
+    const __m512 ad = _mm512_mul_ps(lhs.val[0], rhs.val[1]);
+    const __m512 bc = _mm512_mul_ps(lhs.val[1], rhs.val[0]);
+
+    const __m512 c2 = _mm512_mul_ps(rhs.val[0], rhs.val[0]);
+    const __m512 d2 = _mm512_mul_ps(rhs.val[1], rhs.val[1]);
+    const __m512 den = _mm512_add_ps(c2, d2);
+    const __m512 den_inv = _mm512_div_ps(_mm512_set1_ps(1), den);
+
+    RegisterType result;
+    result.val[0] = _mm512_mul_ps(_mm512_add_ps(ac, bd), den_inv);
+    result.val[1] = _mm512_mul_ps(_mm512_sub_ps(bc, ad), den_inv);
+    return result;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const RegisterType& value, Complex dst[16]) {
+    auto* data = reinterpret_cast<float*>(dst);
+
+    // Interleave the real parts (indices 0..15) with the imaginary parts
+    // (indices 16..31).
+    const __m512i low_index = _mm512_setr_epi32(
+        0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i high_index = _mm512_setr_epi32(
+        8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+    _mm512_storeu_ps(
+        data, _mm512_permutex2var_ps(value.val[0], low_index, value.val[1]));
+    _mm512_storeu_ps(
+        data + 16,
+        _mm512_permutex2var_ps(value.val[0], high_index, value.val[1]));
+  }
+
+  template <int Index>
+  static inline void Store(const RegisterType& value, Complex* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    *dst = Extract<Index>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const RegisterType& value) -> Complex {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return {Float16::TypeInfo::Extract<Index>(value.val[0]),
+            Float16::TypeInfo::Extract<Index>(value.val[1])};
+  }
+
+  static inline auto ExtractLow(const RegisterType& value) -> Complex8 {
+    return Complex8(Float16::TypeInfo::ExtractLow(value.val[0]),
+                    Float16::TypeInfo::ExtractLow(value.val[1]));
+  }
+
+  static inline auto ExtractHigh(const RegisterType& value) -> Complex8 {
+    return Complex8(Float16::TypeInfo::ExtractHigh(value.val[0]),
+                    Float16::TypeInfo::ExtractHigh(value.val[1]));
+  }
+
+  static inline auto ExtractReal(const RegisterType& value) -> Float16 {
+    return Float16(value.val[0]);
+  }
+
+  static inline auto ExtractImag(const RegisterType& value) -> Float16 {
+    return Float16(value.val[1]);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const RegisterType& value,
+                             const Complex new_lane_value) -> RegisterType {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    RegisterType result;
+    result.val[0] = Float16::TypeInfo::SetLane<Index>(value.val[0],
+                                                      new_lane_value.real);
+    result.val[1] = Float16::TypeInfo::SetLane<Index>(value.val[1],
+                                                      new_lane_value.imag);
+    return result;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto NormImpl(const RegisterType& value) -> __m512 {
+    // Multiply the real part by real path, then multiply-add square of the
+    // imaginary part.
+    const __m512 real2 = _mm512_mul_ps(value.val[0], value.val[0]);
+    return internal::x86::MultiplyAdd(real2, value.val[1], value.val[1]);
+  }
+
+  static inline auto Abs(const RegisterType& value) -> Float16 {
+    return Float16(_mm512_sqrt_ps(NormImpl(value)));
+  }
+
+  static inline auto FastAbs(const RegisterType& value) -> Float16 {
+    const __m512 magnitude_sq = NormImpl(value);
+    const __m512 magnitude_inv = _mm512_rsqrt14_ps(magnitude_sq);
+    return Float16(_mm512_rcp14_ps(magnitude_inv));
+  }
+
+  static inline auto Norm(const RegisterType& value) -> Float16 {
+    return Float16(NormImpl(value));
+  }
+
+  static inline auto HorizontalSum(const RegisterType& value) -> Complex {
+    const float real = internal::x86::HorizontalSum(value.val[0]);
+    const float imag = internal::x86::HorizontalSum(value.val[1]);
+    return {real, imag};
+  }
+
+  static inline auto MultiplyAdd(const RegisterType& a,
+                                 const RegisterType& b,
+                                 const typename Float16::RegisterType& c)
+      -> RegisterType {
+    RegisterType result;
+    result.val[0] = internal::x86::MultiplyAdd(a.val[0], b.val[0], c);
+    result.val[1] = internal::x86::MultiplyAdd(a.val[1], b.val[1], c);
+    return result;
+  }
+
+  static inline auto FastArg(const RegisterType& value) -> Float16 {
+    const Float16 x(value.val[0]);
+    const Float16 y(value.val[1]);
+
+    return FastArcTan2(y, x);
+  }
+
+  static inline auto Conj(const RegisterType& value) -> RegisterType {
+    RegisterType result;
+    result.val[0] = value.val[0];
+    result.val[1] = Float16::TypeInfo::Negate(value.val[1]);
+    return result;
+  }
+
+  static inline auto ComplexExp(const typename Float16::RegisterType& x)
+      -> RegisterType {
+    RegisterType result;
+    internal::x86::sincos_ps(x, &result.val[1], &result.val[0]);
+    return result;
+  }
+
+  static inline auto Exp(const RegisterType& z) -> RegisterType {
+    const __m512 exp_real = internal::x86::exp_ps(z.val[0]);
+    RegisterType result = ComplexExp(z.val[1]);
+    result.val[0] = _mm512_mul_ps(result.val[0], exp_real);
+    result.val[1] = _mm512_mul_ps(result.val[1], exp_real);
+    return result;
+  }
+
+  static inline auto Reverse(const RegisterType& value) -> RegisterType {
+    RegisterType result;
+    result.val[0] = Float16::TypeInfo::Reverse(value.val[0]);
+    result.val[1] = Float16::TypeInfo::Reverse(value.val[1]);
+    return result;
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
+
+#endif
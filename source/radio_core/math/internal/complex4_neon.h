@@ -16,6 +16,7 @@
 #  include "radio_core/math/internal/math_neon.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedComplexTypeInfo;
@@ -280,6 +281,7 @@ struct VectorizedComplexTypeInfo<float, 4, true> {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // ISA_CPU_ARM_NEON
@@ -448,6 +448,19 @@ TEST(Complex4, MultiplyAdd) {
   EXPECT_THAT(result.Extract<3>(), ComplexNear(Complex(12, 29), 1e-6f));
 }
 
+TEST(Complex4, MultiplyAddComplex) {
+  const Complex4 a(Complex(2, 3), Complex(4, 10), Complex(6, 7), Complex(8, 9));
+  const Complex4 b(Complex(3, 4), Complex(5, 7), Complex(9, 6), Complex(2, 10));
+  const Complex4 c(
+      Complex(1, 2), Complex(-1, 1), Complex(2, -1), Complex(0, 3));
+
+  const Complex4 result = MultiplyAdd(a, b, c);
+  EXPECT_THAT(result.Extract<0>(), ComplexNear(Complex(-3, 13), 1e-6f));
+  EXPECT_THAT(result.Extract<1>(), ComplexNear(Complex(-8, 8), 1e-6f));
+  EXPECT_THAT(result.Extract<2>(), ComplexNear(Complex(30, 10), 1e-6f));
+  EXPECT_THAT(result.Extract<3>(), ComplexNear(Complex(-22, 15), 1e-6f));
+}
+
 TEST(Complex4, FastArg) {
   const Complex4 a(Complex(1.0f, 0.0f),
                    Complex(0.0f, 1.0f),
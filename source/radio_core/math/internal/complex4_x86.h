@@ -17,6 +17,7 @@
 #  include "radio_core/math/internal/math_x86.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedComplexTypeInfo;
@@ -321,6 +322,7 @@ struct VectorizedComplexTypeInfo<float, 4, true> {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif
@@ -8,10 +8,12 @@
 #pragma once
 
 #include "radio_core/base/aligned_register.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/complex4.h"
 #include "radio_core/math/float8.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedComplexTypeInfo;
@@ -228,4 +230,5 @@ struct VectorizedComplexTypeInfo<float, 8, SpecializationMarker> {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -820,6 +820,44 @@ TEST(Complex8, MultiplyAdd) {
   EXPECT_THAT(result.Extract<7>(), ComplexNear(Complex(46, 87), 1e-6f));
 }
 
+TEST(Complex8, MultiplyAddComplex) {
+  const Complex8 a(Complex(2, 3),
+                   Complex(4, 10),
+                   Complex(6, 7),
+                   Complex(8, 9),
+                   Complex(10, 11),
+                   Complex(12, 13),
+                   Complex(14, 15),
+                   Complex(16, 17));
+  const Complex8 b(Complex(3, 4),
+                   Complex(5, 7),
+                   Complex(9, 6),
+                   Complex(2, 10),
+                   Complex(3, 11),
+                   Complex(4, 12),
+                   Complex(5, 13),
+                   Complex(6, 14));
+  const Complex8 c(Complex(1, 2),
+                   Complex(-1, 1),
+                   Complex(2, -1),
+                   Complex(0, 3),
+                   Complex(1, -1),
+                   Complex(2, 0),
+                   Complex(0, -2),
+                   Complex(-1, -1));
+
+  const Complex8 result = MultiplyAdd(a, b, c);
+
+  EXPECT_THAT(result.Extract<0>(), ComplexNear(Complex(-3, 13), 1e-6f));
+  EXPECT_THAT(result.Extract<1>(), ComplexNear(Complex(-8, 8), 1e-6f));
+  EXPECT_THAT(result.Extract<2>(), ComplexNear(Complex(30, 10), 1e-6f));
+  EXPECT_THAT(result.Extract<3>(), ComplexNear(Complex(-22, 15), 1e-6f));
+  EXPECT_THAT(result.Extract<4>(), ComplexNear(Complex(24, 19), 1e-6f));
+  EXPECT_THAT(result.Extract<5>(), ComplexNear(Complex(20, 37), 1e-6f));
+  EXPECT_THAT(result.Extract<6>(), ComplexNear(Complex(40, 5), 1e-6f));
+  EXPECT_THAT(result.Extract<7>(), ComplexNear(Complex(24, -3), 1e-6f));
+}
+
 TEST(Complex8, FastArg) {
   const Complex8 a(Complex(1.0f, 0.0f),
                    Complex(0.0f, 1.0f),
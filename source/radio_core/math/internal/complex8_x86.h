@@ -0,0 +1,322 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 8-element complex values using AVX2 and above CPU
+// instruction set.
+//
+// The values are stored de-interleaved: one register holds the real parts and
+// another one holds the imaginary parts.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+
+#if ARCH_CPU_X86_FAMILY && ISA_CPU_X86_AVX2
+
+#  include "radio_core/math/complex.h"
+#  include "radio_core/math/complex4.h"
+#  include "radio_core/math/float8.h"
+#  include "radio_core/math/internal/math_x86.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedComplexTypeInfo;
+
+template <>
+struct VectorizedComplexTypeInfo<float, 8, true> {
+  struct RegisterType {
+    __m256 val[2];
+  };
+
+  static constexpr int kSize = 8;
+  static constexpr bool kIsVectorized = true;
+
+  static auto GetName() -> const char* { return "X86"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const Complex values[8]) -> RegisterType {
+    const auto* data = reinterpret_cast<const float*>(values);
+
+    // a = [r0 i0 r1 i1 | r2 i2 r3 i3], b = [r4 i4 r5 i5 | r6 i6 r7 i7]
+    const __m256 a = _mm256_loadu_ps(data);
+    const __m256 b = _mm256_loadu_ps(data + 8);
+
+    // The shuffle operates within 128 bit lanes, giving
+    // [r0 r1 r4 r5 | r2 r3 r6 r7]. Swap the middle 64 bit chunks to get the
+    // elements in order.
+    const __m256 real = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m256 imag = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+
+    RegisterType r;
+    r.val[0] = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(real),
+                                                      _MM_SHUFFLE(3, 1, 2, 0)));
+    r.val[1] = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(imag),
+                                                      _MM_SHUFFLE(3, 1, 2, 0)));
+    return r;
+  }
+
+  static inline auto Load(const Complex& a,
+                          const Complex& b,
+                          const Complex& c,
+                          const Complex& d,
+                          const Complex& e,
+                          const Complex& f,
+                          const Complex& g,
+                          const Complex& h) -> RegisterType {
+    RegisterType r;
+    r.val[0] = _mm256_setr_ps(
+        a.real, b.real, c.real, d.real, e.real, f.real, g.real, h.real);
+    r.val[1] = _mm256_setr_ps(
+        a.imag, b.imag, c.imag, d.imag, e.imag, f.imag, g.imag, h.imag);
+    return r;
+  }
+
+  static inline auto Load(const Complex& value) -> RegisterType {
+    RegisterType r;
+    r.val[0] = _mm256_set1_ps(value.real);
+    r.val[1] = _mm256_set1_ps(value.imag);
+    return r;
+  }
+
+  static inline auto Load(const Float8::RegisterType& real,
+                          const Float8::RegisterType& imag) -> RegisterType {
+    RegisterType r;
+    r.val[0] = real;
+    r.val[1] = imag;
+    return r;
+  }
+
+  static inline auto Load(const float real) -> RegisterType {
+    RegisterType r;
+    r.val[0] = _mm256_set1_ps(real);
+    r.val[1] = _mm256_setzero_ps();
+    return r;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Unary operations.
+
+  static inline auto Negate(const RegisterType& value) -> RegisterType {
+    const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+    RegisterType r;
+    r.val[0] = _mm256_xor_ps(value.val[0], sign_mask);
+    r.val[1] = _mm256_xor_ps(value.val[1], sign_mask);
+    return r;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Mathematical operation between two vectorized registers.
+
+  static inline auto Add(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    RegisterType result;
+    result.val[0] = _mm256_add_ps(lhs.val[0], rhs.val[0]);
+    result.val[1] = _mm256_add_ps(lhs.val[1], rhs.val[1]);
+    return result;
+  }
+
+  static inline auto Subtract(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    RegisterType result;
+    result.val[0] = _mm256_sub_ps(lhs.val[0], rhs.val[0]);
+    result.val[1] = _mm256_sub_ps(lhs.val[1], rhs.val[1]);
+    return result;
+  }
+
+  static inline auto Multiply(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    const __m256 ac = _mm256_mul_ps(lhs.val[0], rhs.val[0]);
+    const __m256 bd = _mm256_mul_ps(lhs.val[1], rhs.val[1]);
+    const __m256 ad = _mm256_mul_ps(lhs.val[0], rhs.val[1]);
+    const __m256 bc = _mm256_mul_ps(lhs.val[1], rhs.val[0]);
+
+    RegisterType result;
+    result.val[0] = _mm256_sub_ps(ac, bd);
+    result.val[1] = _mm256_add_ps(ad, bc);
+    return result;
+  }
+
+  static inline auto Multiply(const RegisterType& lhs,
+                              const typename Float8::RegisterType& rhs)
+      -> RegisterType {
+    RegisterType result;
+    result.val[0] = _mm256_mul_ps(lhs.val[0], rhs);
+    result.val[1] = _mm256_mul_ps(lhs.val[1], rhs);
+    return result;
+  }
+
+  static inline auto Divide(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    const __m256 ac = _mm256_mul_ps(lhs.val[0], rhs.val[0]);
+    const __m256 bd = _mm256_mul_ps(lhs.val[1], rhs.val[1]);
+    const __m256 ad = _mm256_mul_ps(lhs.val[0], rhs.val[1]);
+    const __m256 bc = _mm256_mul_ps(lhs.val[1], rhs.val[0]);
+
+    const __m256 c2 = _mm256_mul_ps(rhs.val[0], rhs.val[0]);
+    const __m256 d2 = _mm256_mul_ps(rhs.val[1], rhs.val[1]);
+    const __m256 den = _mm256_add_ps(c2, d2);
+    const __m256 den_inv = _mm256_div_ps(_mm256_set1_ps(1), den);
+
+    RegisterType result;
+    result.val[0] = _mm256_mul_ps(_mm256_add_ps(ac, bd), den_inv);
+    result.val[1] = _mm256_mul_ps(_mm256_sub_ps(bc, ad), den_inv);
+    return result;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const RegisterType& value, Complex dst[8]) {
+    auto* data = reinterpret_cast<float*>(dst);
+
+    // The unpack operates within 128 bit lanes, giving
+    // lo = [c0 c1 | c4 c5] and hi = [c2 c3 | c6 c7].
+    const __m256 lo = _mm256_unpacklo_ps(value.val[0], value.val[1]);
+    const __m256 hi = _mm256_unpackhi_ps(value.val[0], value.val[1]);
+
+    _mm256_storeu_ps(data, _mm256_permute2f128_ps(lo, hi, 0x20));
+    _mm256_storeu_ps(data + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+  }
+
+  template <int Index>
+  static inline void Store(const RegisterType& value, Complex* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    *dst = Extract<Index>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const RegisterType& value) -> Complex {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return {Float8::TypeInfo::Extract<Index>(value.val[0]),
+            Float8::TypeInfo::Extract<Index>(value.val[1])};
+  }
+
+  static inline auto ExtractLow(const RegisterType& value) -> Complex4 {
+    return Complex4(Float8::TypeInfo::ExtractLow(value.val[0]),
+                    Float8::TypeInfo::ExtractLow(value.val[1]));
+  }
+
+  static inline auto ExtractHigh(const RegisterType& value) -> Complex4 {
+    return Complex4(Float8::TypeInfo::ExtractHigh(value.val[0]),
+                    Float8::TypeInfo::ExtractHigh(value.val[1]));
+  }
+
+  static inline auto ExtractReal(const RegisterType& value) -> Float8 {
+    return Float8(value.val[0]);
+  }
+
+  static inline auto ExtractImag(const RegisterType& value) -> Float8 {
+    return Float8(value.val[1]);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const RegisterType& value,
+                             const Complex new_lane_value) -> RegisterType {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    RegisterType result;
+    result.val[0] = Float8::TypeInfo::SetLane<Index>(value.val[0],
+                                                     new_lane_value.real);
+    result.val[1] = Float8::TypeInfo::SetLane<Index>(value.val[1],
+                                                     new_lane_value.imag);
+    return result;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto NormImpl(const RegisterType& value) -> __m256 {
+    // Multiply the real part by real path, then multiply-add square of the
+    // imaginary part.
+    const __m256 real2 = _mm256_mul_ps(value.val[0], value.val[0]);
+    return internal::x86::MultiplyAdd(real2, value.val[1], value.val[1]);
+  }
+
+  static inline auto Abs(const RegisterType& value) -> Float8 {
+    return Float8(_mm256_sqrt_ps(NormImpl(value)));
+  }
+
+  static inline auto FastAbs(const RegisterType& value) -> Float8 {
+    const __m256 magnitude_sq = NormImpl(value);
+    const __m256 magnitude_inv = _mm256_rsqrt_ps(magnitude_sq);
+    return Float8(_mm256_rcp_ps(magnitude_inv));
+  }
+
+  static inline auto Norm(const RegisterType& value) -> Float8 {
+    return Float8(NormImpl(value));
+  }
+
+  static inline auto HorizontalSum(const RegisterType& value) -> Complex {
+    const float real = internal::x86::HorizontalSum(value.val[0]);
+    const float imag = internal::x86::HorizontalSum(value.val[1]);
+    return {real, imag};
+  }
+
+  static inline auto MultiplyAdd(const RegisterType& a,
+                                 const RegisterType& b,
+                                 const typename Float8::RegisterType& c)
+      -> RegisterType {
+    RegisterType result;
+    result.val[0] = internal::x86::MultiplyAdd(a.val[0], b.val[0], c);
+    result.val[1] = internal::x86::MultiplyAdd(a.val[1], b.val[1], c);
+    return result;
+  }
+
+  static inline auto FastArg(const RegisterType& value) -> Float8 {
+    const Float8 x(value.val[0]);
+    const Float8 y(value.val[1]);
+
+    return FastArcTan2(y, x);
+  }
+
+  static inline auto Conj(const RegisterType& value) -> RegisterType {
+    const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+    RegisterType result;
+    result.val[0] = value.val[0];
+    result.val[1] = _mm256_xor_ps(value.val[1], sign_mask);
+    return result;
+  }
+
+  static inline auto ComplexExp(const typename Float8::RegisterType& x)
+      -> RegisterType {
+    RegisterType result;
+    internal::x86::sincos_ps(x, &result.val[1], &result.val[0]);
+    return result;
+  }
+
+  static inline auto Exp(const RegisterType& z) -> RegisterType {
+    const __m256 exp_real = internal::x86::exp_ps(z.val[0]);
+    RegisterType result = ComplexExp(z.val[1]);
+    result.val[0] = _mm256_mul_ps(result.val[0], exp_real);
+    result.val[1] = _mm256_mul_ps(result.val[1], exp_real);
+    return result;
+  }
+
+  static inline auto Reverse(const RegisterType& value) -> RegisterType {
+    RegisterType result;
+    result.val[0] = Float8::TypeInfo::Reverse(value.val[0]);
+    result.val[1] = Float8::TypeInfo::Reverse(value.val[1]);
+    return result;
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
+
+#endif
@@ -14,6 +14,7 @@
 namespace radio_core::fft {
 
 using testing::ComplexNear;
+using testing::FloatNear;
 using testing::Pointwise;
 
 TEST(PFFFT, Real) {
@@ -47,6 +48,20 @@ TEST(PFFFT, Real) {
   }
 }
 
+TEST(PFFFT, RealBackward) {
+  PFFFT<float> real_fft(PFFFT<float>::SetupOptions{.num_points = 64});
+
+  std::vector<Complex, FFTAllocator<Complex>> input(
+      test::FloatSignal64::kOutput.begin(), test::FloatSignal64::kOutput.end());
+
+  std::vector<float, FFTAllocator<float>> fft_buffer(64);
+  const std::span<float> fft_result =
+      real_fft.Backward(input, fft_buffer, {.normalize = true});
+
+  EXPECT_THAT(fft_result,
+              Pointwise(FloatNear(1e-5f), test::FloatSignal64::kInput));
+}
+
 TEST(PFFFT, Complex) {
   {
     PFFFT<Complex> complex_fft(PFFFT<Complex>::SetupOptions{.num_points = 64});
@@ -112,4 +127,19 @@ TEST(PFFFT, Complex) {
   }
 }
 
+TEST(PFFFT, ComplexBackward) {
+  PFFFT<Complex> complex_fft(PFFFT<Complex>::SetupOptions{.num_points = 64});
+
+  std::vector<Complex, FFTAllocator<Complex>> input(
+      test::ComplexSignal64::kOutput.begin(),
+      test::ComplexSignal64::kOutput.end());
+
+  std::vector<Complex, FFTAllocator<Complex>> fft_buffer(64);
+  const std::span<Complex> fft_result =
+      complex_fft.Backward(input, fft_buffer, {.normalize = true});
+
+  EXPECT_THAT(fft_result,
+              Pointwise(ComplexNear(1e-5f), test::ComplexSignal64::kInput));
+}
+
 }  // namespace radio_core::fft
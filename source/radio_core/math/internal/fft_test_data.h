@@ -8,7 +8,10 @@
 
 #include <radio_core/math/complex.h>
 
+#include "radio_core/base/build_config.h"
+
 namespace radio_core::fft::test {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // 64 floating point samples.
 struct FloatSignal64 {
@@ -256,4 +259,5 @@ struct ComplexSignal64 {
   });
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::fft::test
@@ -0,0 +1,294 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 16-element single precision floating point values using
+// 2 Float8 scalars.
+// Relies on the SIMD optimization of the Float8.
+
+#pragma once
+
+#include "radio_core/base/aligned_register.h"
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/float8.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedFloatTypeInfo;
+
+template <bool SpecializationMarker>
+struct VectorizedFloatTypeInfo<float, 16, SpecializationMarker> {
+  using RegisterType = AlignedRegister<Float8, 2, 64>;
+  using MaskType = VectorizedIntType<typename BitfieldForType<float>::Type, 16>;
+
+  static constexpr int kSize = 16;
+  static constexpr bool kIsVectorized = false;
+
+  static auto GetName() -> const char* { return "Float8x2"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const float values[16]) -> RegisterType {
+    return {Float8(values), Float8(values + 8)};
+  }
+
+  static inline auto Load(const float a,
+                          const float b,
+                          const float c,
+                          const float d,
+                          const float e,
+                          const float f,
+                          const float g,
+                          const float h,
+                          const float i,
+                          const float j,
+                          const float k,
+                          const float l,
+                          const float m,
+                          const float n,
+                          const float o,
+                          const float p) -> RegisterType {
+    return {Float8(a, b, c, d, e, f, g, h),
+            Float8(i, j, k, l, m, n, o, p)};
+  }
+
+  static inline auto Load(const float& value) -> RegisterType {
+    return {Float8(value), Float8(value)};
+  }
+
+  static inline auto Load(const Float8::RegisterType& low,
+                          const Float8::RegisterType& high) -> RegisterType {
+    return {low, high};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Unary operations.
+
+  static inline auto Negate(const RegisterType& value) -> RegisterType {
+    return {-value[0], -value[1]};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Math between vectorized and scalar types.
+
+  static inline auto Multiply(const RegisterType& value, const float scalar)
+      -> RegisterType {
+    return {value[0] * scalar, value[1] * scalar};
+  }
+
+  static inline auto Divide(const RegisterType& value, const float scalar)
+      -> RegisterType {
+    return {value[0] / scalar, value[1] / scalar};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Math between 2 vectorized registers.
+
+  static inline auto Add(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return {lhs[0] + rhs[0], lhs[1] + rhs[1]};
+  }
+
+  static inline auto Subtract(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return {lhs[0] - rhs[0], lhs[1] - rhs[1]};
+  }
+
+  static inline auto Multiply(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return {lhs[0] * rhs[0], lhs[1] * rhs[1]};
+  }
+
+  static inline auto Divide(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return {lhs[0] / rhs[0], lhs[1] / rhs[1]};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Comparators.
+
+  static inline auto LessThan(const RegisterType& lhs, const RegisterType& rhs)
+      -> MaskType {
+    return {(lhs[0] < rhs[0]), (lhs[1] < rhs[1])};
+  }
+
+  static inline auto GreaterThan(const RegisterType& lhs,
+                                 const RegisterType& rhs) -> MaskType {
+    return {(lhs[0] > rhs[0]), (lhs[1] > rhs[1])};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const RegisterType& value, float dst[16]) {
+    value[0].Store(dst);
+    value[1].Store(dst + 8);
+  }
+
+  template <int Index>
+  static inline void Store(const RegisterType& value, float* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      value[0].Store<Index>(dst);
+      return;
+    }
+
+    if constexpr (Index >= 8) {
+      value[1].Store<Index - 8>(dst);
+      return;
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const RegisterType& value) -> float {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      return value[0].Extract<Index>();
+    }
+
+    if constexpr (Index >= 8) {
+      return value[1].Extract<Index - 8>();
+    }
+  }
+
+  static inline auto ExtractLow(const RegisterType& value) -> Float8 {
+    return value[0];
+  }
+
+  static inline auto ExtractHigh(const RegisterType& value) -> Float8 {
+    return value[1];
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const RegisterType& value,
+                             const float new_lane_value) -> RegisterType {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      return {value[0].SetLane<Index>(new_lane_value), value[1]};
+    }
+
+    if constexpr (Index >= 8) {
+      return {value[0], value[1].SetLane<Index - 8>(new_lane_value)};
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto FastLog10(const RegisterType& value) -> RegisterType {
+    return {radio_core::FastLog10(value[0]), radio_core::FastLog10(value[1])};
+  }
+
+  static inline auto Abs(const RegisterType& value) -> RegisterType {
+    return {radio_core::Abs(value[0]), radio_core::Abs(value[1])};
+  }
+
+  static inline auto SquaredNorm(const RegisterType& value) -> float {
+    return HorizontalSum(Multiply(value, value));
+  }
+
+  static inline auto Norm(const RegisterType& value) -> float {
+    return radio_core::Sqrt(SquaredNorm(value));
+  }
+
+  static inline auto Min(const RegisterType& a, const RegisterType& b)
+      -> RegisterType {
+    return {radio_core::Min(a[0], b[0]), radio_core::Min(a[1], b[1])};
+  }
+
+  static inline auto Max(const RegisterType& a, const RegisterType& b)
+      -> RegisterType {
+    return {radio_core::Max(a[0], b[0]), radio_core::Max(a[1], b[1])};
+  }
+
+  static inline auto HorizontalMax(const RegisterType& value) -> float {
+    return radio_core::Max(radio_core::HorizontalMax(value[0]),
+                           radio_core::HorizontalMax(value[1]));
+  }
+
+  static inline auto HorizontalSum(const RegisterType& value) -> float {
+    return radio_core::HorizontalSum(value[0]) +
+           radio_core::HorizontalSum(value[1]);
+  }
+
+  static inline auto MultiplyAdd(const RegisterType& a,
+                                 const RegisterType& b,
+                                 const RegisterType& c) -> RegisterType {
+    return {radio_core::MultiplyAdd(a[0], b[0], c[0]),
+            radio_core::MultiplyAdd(a[1], b[1], c[1])};
+  }
+
+  static inline auto Select(const MaskType& mask,
+                            const RegisterType& source1,
+                            const RegisterType& source2) -> RegisterType {
+    return {radio_core::Select(mask.ExtractLow(), source1[0], source2[0]),
+            radio_core::Select(mask.ExtractHigh(), source1[1], source2[1])};
+  }
+
+  static inline auto Sign(const RegisterType& arg) -> RegisterType {
+    return {radio_core::Sign(arg[0]), radio_core::Sign(arg[1])};
+  }
+
+  static inline auto CopySign(const RegisterType& mag, const RegisterType& sgn)
+      -> RegisterType {
+    return {radio_core::CopySign(mag[0], sgn[0]),
+            radio_core::CopySign(mag[1], sgn[1])};
+  }
+
+  static inline auto Reverse(const RegisterType& value) -> RegisterType {
+    return {radio_core::Reverse(value[1]), radio_core::Reverse(value[0])};
+  }
+
+  static inline auto Sin(const RegisterType& arg) -> RegisterType {
+    return {radio_core::Sin(arg[0]), radio_core::Sin(arg[1])};
+  }
+
+  static inline auto Cos(const RegisterType& arg) -> RegisterType {
+    return {radio_core::Cos(arg[0]), radio_core::Cos(arg[1])};
+  }
+
+  static inline void SinCos(const RegisterType& arg,
+                            RegisterType& sin,
+                            RegisterType& cos) {
+    Float8 sin_low, cos_low;
+    Float8 sin_high, cos_high;
+    radio_core::SinCos(arg[0], sin_low, cos_low);
+    radio_core::SinCos(arg[1], sin_high, cos_high);
+    sin = RegisterType(sin_low, sin_high);
+    cos = RegisterType(cos_low, cos_high);
+  }
+
+  static inline auto Exp(const RegisterType& arg) -> RegisterType {
+    return {radio_core::Exp(arg[0]), radio_core::Exp(arg[1])};
+  }
+
+  static inline auto Log(const RegisterType& arg) -> RegisterType {
+    return {radio_core::Log(arg[0]), radio_core::Log(arg[1])};
+  }
+
+  static inline auto Sqrt(const RegisterType& arg) -> RegisterType {
+    return {radio_core::Sqrt(arg[0]), radio_core::Sqrt(arg[1])};
+  }
+
+  static inline auto RSqrt(const RegisterType& arg) -> RegisterType {
+    return {radio_core::RSqrt(arg[0]), radio_core::RSqrt(arg[1])};
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
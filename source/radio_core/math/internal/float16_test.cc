@@ -0,0 +1,459 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/math/float16.h"
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/unittest/vectorized_matchers.h"
+#include "radio_core/unittest/mock.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core {
+
+using testing::VectorizedNear;
+
+namespace {
+
+// Values used by the majority of the tests: 16 different values, with both
+// positive and negative values in both halves of the register.
+const float kValues[16] = {
+    2, -3, 4, 5, -6, 7, 8, 9, 10, -11, 12, 13, 14, 15, -16, 17};
+
+}  // namespace
+
+TEST(Float16, Load) {
+  {
+    const Float16 value = Float16(kValues);
+    EXPECT_NEAR(value.Extract<0>(), 2, 1e-6f);
+    EXPECT_NEAR(value.Extract<1>(), -3, 1e-6f);
+    EXPECT_NEAR(value.Extract<7>(), 9, 1e-6f);
+    EXPECT_NEAR(value.Extract<8>(), 10, 1e-6f);
+    EXPECT_NEAR(value.Extract<14>(), -16, 1e-6f);
+    EXPECT_NEAR(value.Extract<15>(), 17, 1e-6f);
+  }
+
+  {
+    const Float16 value = Float16(
+        2, -3, 4, 5, -6, 7, 8, 9, 10, -11, 12, 13, 14, 15, -16, 17);
+    EXPECT_THAT(value, VectorizedNear(Float16(kValues), 1e-6f));
+  }
+
+  {
+    const Float16 value = Float16(2);
+    EXPECT_NEAR(value.Extract<0>(), 2, 1e-6f);
+    EXPECT_NEAR(value.Extract<7>(), 2, 1e-6f);
+    EXPECT_NEAR(value.Extract<8>(), 2, 1e-6f);
+    EXPECT_NEAR(value.Extract<15>(), 2, 1e-6f);
+  }
+
+  {
+    const Float16 value = Float16(Float8(kValues), Float8(kValues + 8));
+    EXPECT_THAT(value, VectorizedNear(Float16(kValues), 1e-6f));
+  }
+}
+
+TEST(Float16, Store) {
+  const Float16 value = Float16(kValues);
+
+  float data[16] = {0};
+  value.Store(data);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_NEAR(data[i], kValues[i], 1e-6f);
+  }
+
+  float lane;
+
+  value.Store<0>(&lane);
+  EXPECT_NEAR(lane, 2, 1e-6f);
+
+  value.Store<9>(&lane);
+  EXPECT_NEAR(lane, -11, 1e-6f);
+
+  value.Store<15>(&lane);
+  EXPECT_NEAR(lane, 17, 1e-6f);
+}
+
+TEST(Float16, Extract) {
+  const Float16 value = Float16(kValues);
+
+  EXPECT_NEAR(value.Extract<0>(), 2, 1e-6f);
+  EXPECT_NEAR(value.Extract<1>(), -3, 1e-6f);
+  EXPECT_NEAR(value.Extract<2>(), 4, 1e-6f);
+  EXPECT_NEAR(value.Extract<3>(), 5, 1e-6f);
+  EXPECT_NEAR(value.Extract<4>(), -6, 1e-6f);
+  EXPECT_NEAR(value.Extract<5>(), 7, 1e-6f);
+  EXPECT_NEAR(value.Extract<6>(), 8, 1e-6f);
+  EXPECT_NEAR(value.Extract<7>(), 9, 1e-6f);
+  EXPECT_NEAR(value.Extract<8>(), 10, 1e-6f);
+  EXPECT_NEAR(value.Extract<9>(), -11, 1e-6f);
+  EXPECT_NEAR(value.Extract<10>(), 12, 1e-6f);
+  EXPECT_NEAR(value.Extract<11>(), 13, 1e-6f);
+  EXPECT_NEAR(value.Extract<12>(), 14, 1e-6f);
+  EXPECT_NEAR(value.Extract<13>(), 15, 1e-6f);
+  EXPECT_NEAR(value.Extract<14>(), -16, 1e-6f);
+  EXPECT_NEAR(value.Extract<15>(), 17, 1e-6f);
+}
+
+TEST(Float16, ExtractLow) {
+  const Float16 value = Float16(kValues);
+  EXPECT_THAT(value.ExtractLow(),
+              VectorizedNear(Float8(2, -3, 4, 5, -6, 7, 8, 9), 1e-6f));
+}
+
+TEST(Float16, ExtractHigh) {
+  const Float16 value = Float16(kValues);
+  EXPECT_THAT(value.ExtractHigh(),
+              VectorizedNear(Float8(10, -11, 12, 13, 14, 15, -16, 17), 1e-6f));
+}
+
+TEST(Float16, SetLane) {
+  const Float16 value = Float16(kValues);
+
+  EXPECT_THAT(value.SetLane<0>(99),
+              VectorizedNear(Float16(99, -3, 4, 5, -6, 7, 8, 9,
+                                     10, -11, 12, 13, 14, 15, -16, 17),
+                             1e-6f));
+  EXPECT_THAT(value.SetLane<7>(99),
+              VectorizedNear(Float16(2, -3, 4, 5, -6, 7, 8, 99,
+                                     10, -11, 12, 13, 14, 15, -16, 17),
+                             1e-6f));
+  EXPECT_THAT(value.SetLane<8>(99),
+              VectorizedNear(Float16(2, -3, 4, 5, -6, 7, 8, 9,
+                                     99, -11, 12, 13, 14, 15, -16, 17),
+                             1e-6f));
+  EXPECT_THAT(value.SetLane<15>(99),
+              VectorizedNear(Float16(2, -3, 4, 5, -6, 7, 8, 9,
+                                     10, -11, 12, 13, 14, 15, -16, 99),
+                             1e-6f));
+}
+
+TEST(Float16, Negate) {
+  EXPECT_THAT(-Float16(kValues),
+              VectorizedNear(Float16(-2, 3, -4, -5, 6, -7, -8, -9,
+                                     -10, 11, -12, -13, -14, -15, 16, -17),
+                             1e-6f));
+}
+
+TEST(Float16, MultiplyScalar) {
+  EXPECT_THAT(Float16(kValues) * 2.0f,
+              VectorizedNear(Float16(4, -6, 8, 10, -12, 14, 16, 18,
+                                     20, -22, 24, 26, 28, 30, -32, 34),
+                             1e-6f));
+}
+
+TEST(Float16, DivideScalar) {
+  EXPECT_THAT(Float16(kValues) / 2.0f,
+              VectorizedNear(Float16(1, -1.5f, 2, 2.5f, -3, 3.5f, 4, 4.5f,
+                                     5, -5.5f, 6, 6.5f, 7, 7.5f, -8, 8.5f),
+                             1e-6f));
+}
+
+TEST(Float16, Add) {
+  EXPECT_THAT(Float16(kValues) + Float16(1),
+              VectorizedNear(Float16(3, -2, 5, 6, -5, 8, 9, 10,
+                                     11, -10, 13, 14, 15, 16, -15, 18),
+                             1e-6f));
+}
+
+TEST(Float16, Subtract) {
+  EXPECT_THAT(Float16(kValues) - Float16(1),
+              VectorizedNear(Float16(1, -4, 3, 4, -7, 6, 7, 8,
+                                     9, -12, 11, 12, 13, 14, -17, 16),
+                             1e-6f));
+}
+
+TEST(Float16, Multiply) {
+  EXPECT_THAT(Float16(kValues) * Float16(kValues),
+              VectorizedNear(Float16(4, 9, 16, 25, 36, 49, 64, 81,
+                                     100, 121, 144, 169, 196, 225, 256, 289),
+                             1e-6f));
+}
+
+TEST(Float16, Divide) {
+  EXPECT_THAT(Float16(kValues) / Float16(-2),
+              VectorizedNear(Float16(-1, 1.5f, -2, -2.5f, 3, -3.5f, -4, -4.5f,
+                                     -5, 5.5f, -6, -6.5f, -7, -7.5f, 8, -8.5f),
+                             1e-6f));
+}
+
+TEST(Float16, LessThan) {
+  const UInt16 mask = Float16(kValues) < Float16(5);
+  uint32_t data[16];
+  mask.Store(data);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(data[i], kValues[i] < 5 ? 0xffffffffu : 0u) << "i=" << i;
+  }
+}
+
+TEST(Float16, GreaterThan) {
+  const UInt16 mask = Float16(kValues) > Float16(5);
+  uint32_t data[16];
+  mask.Store(data);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(data[i], kValues[i] > 5 ? 0xffffffffu : 0u) << "i=" << i;
+  }
+}
+
+TEST(Float16, FastLog10) {
+  const Float16 result = FastLog10(Float16(1,
+                                           10,
+                                           100,
+                                           1000,
+                                           0.1f,
+                                           0.01f,
+                                           2,
+                                           20,
+                                           200,
+                                           5,
+                                           50,
+                                           500,
+                                           3,
+                                           30,
+                                           300,
+                                           3000));
+  EXPECT_THAT(result,
+              VectorizedNear(Float16(0,
+                                     1,
+                                     2,
+                                     3,
+                                     -1,
+                                     -2,
+                                     0.30103f,
+                                     1.30103f,
+                                     2.30103f,
+                                     0.69897f,
+                                     1.69897f,
+                                     2.69897f,
+                                     0.47712f,
+                                     1.47712f,
+                                     2.47712f,
+                                     3.47712f),
+                             1e-4f));
+}
+
+TEST(Float16, Abs) {
+  EXPECT_THAT(Abs(Float16(kValues)),
+              VectorizedNear(Float16(2, 3, 4, 5, 6, 7, 8, 9,
+                                     10, 11, 12, 13, 14, 15, 16, 17),
+                             1e-6f));
+}
+
+TEST(Float16, Min) {
+  EXPECT_THAT(Min(Float16(kValues), Float16(5)),
+              VectorizedNear(Float16(2, -3, 4, 5, -6, 5, 5, 5,
+                                     5, -11, 5, 5, 5, 5, -16, 5),
+                             1e-6f));
+}
+
+TEST(Float16, Max) {
+  EXPECT_THAT(Max(Float16(kValues), Float16(5)),
+              VectorizedNear(Float16(5, 5, 5, 5, 5, 7, 8, 9,
+                                     10, 5, 12, 13, 14, 15, 5, 17),
+                             1e-6f));
+}
+
+TEST(Float16, HorizontalMax) {
+  float values[16];
+  for (int i = 0; i < 16; ++i) {
+    for (int j = 0; j < 16; ++j) {
+      values[j] = float(j);
+    }
+    values[i] = 99;
+    EXPECT_NEAR(HorizontalMax(Float16(values)), 99, 1e-6f) << "i=" << i;
+  }
+}
+
+TEST(Float16, HorizontalSum) {
+  EXPECT_NEAR(HorizontalSum(Float16(kValues)), 80, 1e-6f);
+}
+
+TEST(Float16, MultiplyAdd) {
+  const Float16 result =
+      MultiplyAdd(Float16(kValues), Float16(kValues), Float16(2));
+  EXPECT_THAT(result,
+              VectorizedNear(Float16(6, -9, 12, 15, -18, 21, 24, 27,
+                                     30, -33, 36, 39, 42, 45, -48, 51),
+                             1e-6f));
+}
+
+TEST(Float16, Select) {
+  const UInt16 mask(0xffffffffu,
+                    0,
+                    0xffffffffu,
+                    0,
+                    0,
+                    0xffffffffu,
+                    0,
+                    0xffffffffu,
+                    0,
+                    0,
+                    0xffffffffu,
+                    0xffffffffu,
+                    0,
+                    0xffffffffu,
+                    0xffffffffu,
+                    0);
+  const Float16 result = Select(mask, Float16(kValues), Float16(0));
+  EXPECT_THAT(result,
+              VectorizedNear(Float16(2, 0, 4, 0, 0, 7, 0, 9,
+                                     0, 0, 12, 13, 0, 15, -16, 0),
+                             1e-6f));
+}
+
+TEST(Float16, Sign) {
+  EXPECT_THAT(Sign(Float16(kValues)),
+              VectorizedNear(Float16(1, -1, 1, 1, -1, 1, 1, 1,
+                                     1, -1, 1, 1, 1, 1, -1, 1),
+                             1e-6f));
+}
+
+TEST(Float16, CopySign) {
+  EXPECT_THAT(CopySign(Float16(3), Float16(kValues)),
+              VectorizedNear(Float16(3, -3, 3, 3, -3, 3, 3, 3,
+                                     3, -3, 3, 3, 3, 3, -3, 3),
+                             1e-6f));
+}
+
+TEST(Float16, Reverse) {
+  EXPECT_THAT(Reverse(Float16(kValues)),
+              VectorizedNear(Float16(17, -16, 15, 14, 13, 12, -11, 10,
+                                     9, 8, 7, -6, 5, 4, -3, 2),
+                             1e-6f));
+}
+
+TEST(Float16, Dot) {
+  EXPECT_NEAR(Dot(Float16(kValues), Float16(1)), 80, 1e-6f);
+}
+
+TEST(Float16, SinCos) {
+  // Test values in the range from -20*pi to 20*pi, in all lanes.
+  constexpr int N = 10000;
+  for (int i = 0; i < N; ++i) {
+    float args[16];
+    for (int j = 0; j < 16; ++j) {
+      const float fac = (float(i * 16 + j) / (N * 16 - 1) - 0.5f) * 2;
+      args[j] = fac * 20 * constants::pi_v<float>;
+    }
+
+    float sin_values[16], cos_values[16];
+    Sin(Float16(args)).Store(sin_values);
+    Cos(Float16(args)).Store(cos_values);
+
+    Float16 sin, cos;
+    SinCos(Float16(args), sin, cos);
+    float sincos_sin_values[16], sincos_cos_values[16];
+    sin.Store(sincos_sin_values);
+    cos.Store(sincos_cos_values);
+
+    for (int j = 0; j < 16; ++j) {
+      ASSERT_NEAR(sin_values[j], Sin(args[j]), 1e-6f) << "arg=" << args[j];
+      ASSERT_NEAR(cos_values[j], Cos(args[j]), 1e-6f) << "arg=" << args[j];
+      ASSERT_NEAR(sincos_sin_values[j], Sin(args[j]), 1e-6f)
+          << "arg=" << args[j];
+      ASSERT_NEAR(sincos_cos_values[j], Cos(args[j]), 1e-6f)
+          << "arg=" << args[j];
+    }
+  }
+}
+
+TEST(Float16, Exp) {
+  float args[16];
+  for (int i = 0; i < 16; ++i) {
+    args[i] = float(i - 8) * 0.75f;
+  }
+
+  float result[16];
+  Exp(Float16(args)).Store(result);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_NEAR(result[i], Exp(args[i]), Exp(args[i]) * 1e-6f)
+        << "arg=" << args[i];
+  }
+}
+
+TEST(Float16, Log) {
+  float args[16];
+  for (int i = 0; i < 16; ++i) {
+    args[i] = float(i + 1) * 0.75f;
+  }
+
+  float result[16];
+  Log(Float16(args)).Store(result);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_NEAR(result[i], Log(args[i]), 1e-6f) << "arg=" << args[i];
+  }
+}
+
+TEST(Float16, Sqrt) {
+  float args[16];
+  for (int i = 0; i < 16; ++i) {
+    args[i] = float(i) * 0.75f;
+  }
+
+  float result[16];
+  Sqrt(Float16(args)).Store(result);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(result[i], Sqrt(args[i])) << "arg=" << args[i];
+  }
+}
+
+TEST(Float16, RSqrt) {
+  float args[16];
+  for (int i = 0; i < 16; ++i) {
+    args[i] = float(i + 1) * 0.75f;
+  }
+
+  float result[16];
+  RSqrt(Float16(args)).Store(result);
+  for (int i = 0; i < 16; ++i) {
+    const float expected = 1.0f / Sqrt(args[i]);
+    EXPECT_NEAR(result[i], expected, expected * 1e-6f) << "arg=" << args[i];
+  }
+}
+
+TEST(Float16, ArcTan2) {
+  float y[16];
+  float x[16];
+  for (int i = 0; i < 16; ++i) {
+    const float angle = float(i - 8) * 0.39f;
+    y[i] = Sin(angle) * 2.0f;
+    x[i] = Cos(angle) * 2.0f;
+  }
+
+  float result[16];
+  ArcTan2(Float16(y), Float16(x)).Store(result);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_NEAR(result[i], ArcTan2(y[i], x[i]), 1e-6f)
+        << "y=" << y[i] << " x=" << x[i];
+  }
+}
+
+TEST(Float16, Pow) {
+  float base[16];
+  float exp[16];
+  for (int i = 0; i < 16; ++i) {
+    base[i] = float(i + 1) * 0.5f;
+    exp[i] = float(i - 8) * 0.25f;
+  }
+
+  float result[16];
+  Pow(Float16(base), Float16(exp)).Store(result);
+  for (int i = 0; i < 16; ++i) {
+    const float expected = Pow(base[i], exp[i]);
+    EXPECT_NEAR(result[i], expected, expected * 2e-6f)
+        << "base=" << base[i] << " exp=" << exp[i];
+  }
+}
+
+TEST(Float16, Norm) {
+  // >>> import numpy
+  // >>> numpy.linalg.norm(numpy.arange(16))
+  // 35.21363372331802
+  float values[16];
+  for (int i = 0; i < 16; ++i) {
+    values[i] = float(i);
+  }
+  EXPECT_NEAR(linalg::Norm(Float16(values)), 35.21363372331802f, 1e-5f);
+}
+
+}  // namespace radio_core
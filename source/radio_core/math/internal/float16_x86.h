@@ -0,0 +1,309 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 16-element single precision floating point values using
+// AVX-512 Foundation CPU instruction set.
+//
+// Only the Foundation subset of the AVX-512 is used, so the bit-wise operations
+// on the floating point registers are done via the integer instructions.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+
+#if ARCH_CPU_X86_FAMILY && ISA_CPU_X86_AVX2 && ISA_CPU_X86_AVX512F
+
+#  include "radio_core/math/bitwise.h"
+#  include "radio_core/math/float8.h"
+#  include "radio_core/math/internal/math_x86.h"
+#  include "radio_core/math/uint16.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedFloatTypeInfo;
+
+template <>
+struct VectorizedFloatTypeInfo<float, 16, true> {
+  using RegisterType = __m512;
+  using MaskType = VectorizedIntType<typename BitfieldForType<float>::Type, 16>;
+
+  static constexpr int kSize = 16;
+  static constexpr bool kIsVectorized = true;
+
+  static auto GetName() -> const char* { return "X86"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Helpers.
+
+  // Bit-wise operations on floating point registers.
+  static inline auto BitwiseAnd(const __m512& a, const __m512& b) -> __m512 {
+    return _mm512_castsi512_ps(
+        _mm512_and_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+  }
+  static inline auto BitwiseAndNot(const __m512& a, const __m512& b) -> __m512 {
+    return _mm512_castsi512_ps(
+        _mm512_andnot_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+  }
+  static inline auto BitwiseOr(const __m512& a, const __m512& b) -> __m512 {
+    return _mm512_castsi512_ps(
+        _mm512_or_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+  }
+  static inline auto BitwiseXor(const __m512& a, const __m512& b) -> __m512 {
+    return _mm512_castsi512_ps(
+        _mm512_xor_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+  }
+
+  // Convert comparison result to a bit-wise mask with all bits set for the
+  // lanes where the comparison is true.
+  static inline auto ToMask(const __mmask16 mask) -> MaskType {
+    return MaskType(_mm512_maskz_set1_epi32(mask, -1));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const float values[16]) -> __m512 {
+    return _mm512_loadu_ps(values);
+  }
+
+  static inline auto Load(const float a,
+                          const float b,
+                          const float c,
+                          const float d,
+                          const float e,
+                          const float f,
+                          const float g,
+                          const float h,
+                          const float i,
+                          const float j,
+                          const float k,
+                          const float l,
+                          const float m,
+                          const float n,
+                          const float o,
+                          const float p) -> __m512 {
+    return _mm512_setr_ps(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p);
+  }
+
+  static inline auto Load(const float value) -> __m512 {
+    return _mm512_set1_ps(value);
+  }
+
+  static inline auto Load(const Float8::RegisterType& low,
+                          const Float8::RegisterType& high) -> __m512 {
+    return internal::x86::Combine256(low, high);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Unary operations.
+
+  static inline auto Negate(const __m512& value) -> __m512 {
+    return BitwiseXor(value, _mm512_set1_ps(-0.0f));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Math between vectorized and scalar types.
+
+  static inline auto Multiply(const __m512& value, const float scalar)
+      -> __m512 {
+    return _mm512_mul_ps(value, Load(scalar));
+  }
+
+  static inline auto Divide(const __m512& value, const float scalar)
+      -> __m512 {
+    return _mm512_div_ps(value, Load(scalar));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Math between 2 vectorized registers.
+
+  static inline auto Add(const __m512& lhs, const __m512& rhs) -> __m512 {
+    return _mm512_add_ps(lhs, rhs);
+  }
+
+  static inline auto Subtract(const __m512& lhs, const __m512& rhs) -> __m512 {
+    return _mm512_sub_ps(lhs, rhs);
+  }
+
+  static inline auto Multiply(const __m512& lhs, const __m512& rhs) -> __m512 {
+    return _mm512_mul_ps(lhs, rhs);
+  }
+
+  static inline auto Divide(const __m512& lhs, const __m512& rhs) -> __m512 {
+    return _mm512_div_ps(lhs, rhs);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Comparators.
+
+  static inline auto LessThan(const __m512& lhs, const __m512& rhs)
+      -> MaskType {
+    return ToMask(_mm512_cmp_ps_mask(lhs, rhs, _CMP_LT_OQ));
+  }
+
+  static inline auto GreaterThan(const __m512& lhs, const __m512& rhs)
+      -> MaskType {
+    return ToMask(_mm512_cmp_ps_mask(lhs, rhs, _CMP_GT_OQ));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const __m512& value, float dst[16]) {
+    _mm512_storeu_ps(dst, value);
+  }
+
+  template <int Index>
+  static inline void Store(const __m512& value, float* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    *dst = Extract<Index>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const __m512& value) -> float {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      return Float8::TypeInfo::Extract<Index>(
+          internal::x86::ExtractLow256(value));
+    } else {
+      return Float8::TypeInfo::Extract<Index - 8>(
+          internal::x86::ExtractHigh256(value));
+    }
+  }
+
+  static inline auto ExtractLow(const __m512& value) -> Float8 {
+    return Float8(internal::x86::ExtractLow256(value));
+  }
+
+  static inline auto ExtractHigh(const __m512& value) -> Float8 {
+    return Float8(internal::x86::ExtractHigh256(value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const __m512& value, const float new_lane_value)
+      -> __m512 {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return _mm512_mask_broadcastss_ps(
+        value, __mmask16(1 << Index), _mm_set_ss(new_lane_value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto FastLog10(const __m512& value) -> __m512 {
+    // Calculate Log10(x) as Log2(x) / Ln(10).
+
+    // 1 / Log2(10)
+    static constexpr float kLn2ToLog10Fac = 0.3010299956639812f;
+
+    return _mm512_mul_ps(internal::x86::ApproximateLog2(value),
+                         _mm512_set1_ps(kLn2ToLog10Fac));
+  }
+
+  static inline auto Abs(const __m512& value) -> __m512 {
+    return BitwiseAndNot(_mm512_set1_ps(-0.0f), value);
+  }
+
+  static inline auto SquaredNorm(const __m512& value) -> float {
+    return HorizontalSum(Multiply(value, value));
+  }
+
+  static inline auto Norm(const __m512& value) -> float {
+    return radio_core::Sqrt(SquaredNorm(value));
+  }
+
+  static inline auto Min(const __m512& a, const __m512& b) -> __m512 {
+    return _mm512_min_ps(a, b);
+  }
+
+  static inline auto Max(const __m512& a, const __m512& b) -> __m512 {
+    return _mm512_max_ps(a, b);
+  }
+
+  static inline auto HorizontalMax(const __m512& value) -> float {
+    return Float8::TypeInfo::HorizontalMax(
+        _mm256_max_ps(internal::x86::ExtractLow256(value),
+                      internal::x86::ExtractHigh256(value)));
+  }
+
+  static inline auto HorizontalSum(const __m512& value) -> float {
+    return internal::x86::HorizontalSum(value);
+  }
+
+  static inline auto MultiplyAdd(const __m512& a,
+                                 const __m512& b,
+                                 const __m512& c) -> __m512 {
+    return internal::x86::MultiplyAdd(a, b, c);
+  }
+
+  static inline auto Select(const MaskType& mask,
+                            const __m512& source1,
+                            const __m512& source2) -> __m512 {
+    const __m512i mask_reg = mask.GetRegister();
+    return _mm512_mask_blend_ps(
+        _mm512_test_epi32_mask(mask_reg, mask_reg), source2, source1);
+  }
+
+  static inline auto Sign(const __m512& arg) -> __m512 {
+    return CopySign(Load(1.0f), arg);
+  }
+
+  static inline auto CopySign(const __m512& mag, const __m512& sgn) -> __m512 {
+    const __m512 signbit = _mm512_set1_ps(-0.0f);
+    return BitwiseOr(BitwiseAnd(signbit, sgn), BitwiseAndNot(signbit, mag));
+  }
+
+  static inline auto Reverse(const __m512& value) -> __m512 {
+    return _mm512_permutexvar_ps(
+        _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+        value);
+  }
+
+  static inline auto Sin(const __m512& arg) -> __m512 {
+    return internal::x86::sin_ps(arg);
+  }
+
+  static inline auto Cos(const __m512& arg) -> __m512 {
+    return internal::x86::cos_ps(arg);
+  }
+
+  static inline void SinCos(const __m512& arg, __m512& sin, __m512& cos) {
+    return internal::x86::sincos_ps(arg, &sin, &cos);
+  }
+
+  static inline auto Exp(const __m512& arg) -> __m512 {
+    return internal::x86::exp_ps(arg);
+  }
+
+  static inline auto Log(const __m512& arg) -> __m512 {
+    return internal::x86::log_ps(arg);
+  }
+
+  static inline auto Sqrt(const __m512& arg) -> __m512 {
+    return _mm512_sqrt_ps(arg);
+  }
+
+  static inline auto RSqrt(const __m512& arg) -> __m512 {
+    return internal::x86::rsqrt_ps(arg);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
+
+#endif
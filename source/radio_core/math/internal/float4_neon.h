@@ -16,6 +16,7 @@
 #  include "radio_core/math/uint4.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedFloatTypeInfo;
@@ -247,8 +248,21 @@ struct VectorizedFloatTypeInfo<float, 4, true> {
   static inline auto Exp(const float32x4_t& arg) -> float32x4_t {
     return internal::neon::vexpq_f32(arg);
   }
+
+  static inline auto Log(const float32x4_t& arg) -> float32x4_t {
+    return internal::neon::vlogq_f32(arg);
+  }
+
+  static inline auto Sqrt(const float32x4_t& arg) -> float32x4_t {
+    return internal::neon::vsqrtq_f32(arg);
+  }
+
+  static inline auto RSqrt(const float32x4_t& arg) -> float32x4_t {
+    return internal::neon::vinvsqrtq_f32(arg);
+  }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // ISA_CPU_ARM_NEON
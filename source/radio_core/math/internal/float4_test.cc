@@ -712,6 +712,74 @@ TEST(Float4, Exp) {
 ////////////////////////////////////////////////////////////////////////////////
 // Linear algebra.
 
+TEST(Float4, Log) {
+  // >>> import numpy
+  // >>> numpy.log([0.5, 1.0, 2.0, 10.0])
+  // array([-0.69314718,  0.        ,  0.69314718,  2.30258509])
+  const Float4 result = Log(Float4(0.5f, 1.0f, 2.0f, 10.0f));
+  EXPECT_NEAR(result.Extract<0>(), -0.69314718f, 1e-6f);
+  EXPECT_NEAR(result.Extract<1>(), 0.0f, 1e-6f);
+  EXPECT_NEAR(result.Extract<2>(), 0.69314718f, 1e-6f);
+  EXPECT_NEAR(result.Extract<3>(), 2.30258509f, 1e-6f);
+}
+
+TEST(Float4, Sqrt) {
+  const Float4 result = Sqrt(Float4(0.0f, 1.0f, 2.0f, 9.0f));
+  EXPECT_EQ(result.Extract<0>(), 0.0f);
+  EXPECT_EQ(result.Extract<1>(), 1.0f);
+  EXPECT_NEAR(result.Extract<2>(), 1.41421356f, 1e-6f);
+  EXPECT_EQ(result.Extract<3>(), 3.0f);
+}
+
+TEST(Float4, RSqrt) {
+  const Float4 result = RSqrt(Float4(0.25f, 1.0f, 2.0f, 4.0f));
+  EXPECT_NEAR(result.Extract<0>(), 2.0f, 1e-6f);
+  EXPECT_NEAR(result.Extract<1>(), 1.0f, 1e-6f);
+  EXPECT_NEAR(result.Extract<2>(), 0.70710678f, 1e-6f);
+  EXPECT_NEAR(result.Extract<3>(), 0.5f, 1e-6f);
+}
+
+TEST(Float4, ArcTan2) {
+  // >>> import numpy
+  // >>> numpy.arctan2([1, 1, -1, -1], [1, -1, -1, 1])
+  // array([ 0.78539816,  2.35619449, -2.35619449, -0.78539816])
+  {
+    const Float4 result = ArcTan2(Float4(1.0f, 1.0f, -1.0f, -1.0f),
+                                  Float4(1.0f, -1.0f, -1.0f, 1.0f));
+    EXPECT_NEAR(result.Extract<0>(), 0.78539816f, 1e-6f);
+    EXPECT_NEAR(result.Extract<1>(), 2.35619449f, 1e-6f);
+    EXPECT_NEAR(result.Extract<2>(), -2.35619449f, 1e-6f);
+    EXPECT_NEAR(result.Extract<3>(), -0.78539816f, 1e-6f);
+  }
+
+  // >>> import numpy
+  // >>> numpy.arctan2([0, 0, 2, 1], [1, -1, 1, -3])
+  // array([0.        , 3.14159265, 1.10714872, 2.8198421 ])
+  {
+    const Float4 result = ArcTan2(Float4(0.0f, 0.0f, 2.0f, 1.0f),
+                                  Float4(1.0f, -1.0f, 1.0f, -3.0f));
+    EXPECT_EQ(result.Extract<0>(), 0.0f);
+    EXPECT_NEAR(result.Extract<1>(), 3.14159265f, 1e-6f);
+    EXPECT_NEAR(result.Extract<2>(), 1.10714872f, 1e-6f);
+    EXPECT_NEAR(result.Extract<3>(), 2.8198421f, 1e-6f);
+  }
+
+  // Zero arguments.
+  EXPECT_EQ(ArcTan2(Float4(0.0f), Float4(0.0f)).Extract<0>(), 0.0f);
+}
+
+TEST(Float4, Pow) {
+  // >>> import numpy
+  // >>> numpy.power([2.0, 2.0, 10.0, 0.5], [0.5, 3.0, -1.0, 2.0])
+  // array([1.41421356, 8.        , 0.1       , 0.25      ])
+  const Float4 result =
+      Pow(Float4(2.0f, 2.0f, 10.0f, 0.5f), Float4(0.5f, 3.0f, -1.0f, 2.0f));
+  EXPECT_NEAR(result.Extract<0>(), 1.41421356f, 1e-6f);
+  EXPECT_NEAR(result.Extract<1>(), 8.0f, 1e-5f);
+  EXPECT_NEAR(result.Extract<2>(), 0.1f, 1e-6f);
+  EXPECT_NEAR(result.Extract<3>(), 0.25f, 1e-6f);
+}
+
 TEST(Float4, Norm) {
   // >>> import numpy
   // >>> numpy.linalg.norm([2, 3, 4, 5])
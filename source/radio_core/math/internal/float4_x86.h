@@ -17,6 +17,7 @@
 #  include "radio_core/math/uint4.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 static_assert(ISA_CPU_X86_SSE2, "SSE 2 is the required minimum");
 
@@ -258,8 +259,21 @@ struct VectorizedFloatTypeInfo<float, 4, true> {
   static inline auto Exp(const __m128& arg) -> __m128 {
     return internal::x86::exp_ps(arg);
   }
+
+  static inline auto Log(const __m128& arg) -> __m128 {
+    return internal::x86::log_ps(arg);
+  }
+
+  static inline auto Sqrt(const __m128& arg) -> __m128 {
+    return _mm_sqrt_ps(arg);
+  }
+
+  static inline auto RSqrt(const __m128& arg) -> __m128 {
+    return internal::x86::rsqrt_ps(arg);
+  }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif
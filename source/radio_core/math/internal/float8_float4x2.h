@@ -9,9 +9,11 @@
 #pragma once
 
 #include "radio_core/base/aligned_register.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/float4.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedFloatTypeInfo;
@@ -265,6 +267,19 @@ struct VectorizedFloatTypeInfo<float, 8, SpecializationMarker> {
   static inline auto Exp(const RegisterType& arg) -> RegisterType {
     return {radio_core::Exp(arg[0]), radio_core::Exp(arg[1])};
   }
+
+  static inline auto Log(const RegisterType& arg) -> RegisterType {
+    return {radio_core::Log(arg[0]), radio_core::Log(arg[1])};
+  }
+
+  static inline auto Sqrt(const RegisterType& arg) -> RegisterType {
+    return {radio_core::Sqrt(arg[0]), radio_core::Sqrt(arg[1])};
+  }
+
+  static inline auto RSqrt(const RegisterType& arg) -> RegisterType {
+    return {radio_core::RSqrt(arg[0]), radio_core::RSqrt(arg[1])};
+  }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
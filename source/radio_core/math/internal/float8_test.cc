@@ -1286,6 +1286,87 @@ TEST(Float8, Exp) {
 ////////////////////////////////////////////////////////////////////////////////
 // Linear algebra.
 
+TEST(Float8, Log) {
+  // >>> import numpy
+  // >>> numpy.log([0.5, 1.0, 2.0, 10.0, 0.1, 100.0, 3.0, 0.001])
+  // array([-0.69314718,  0.        ,  0.69314718,  2.30258509, -2.30258509,
+  //         4.60517019,  1.09861229, -6.90775528])
+  const Float8 result =
+      Log(Float8(0.5f, 1.0f, 2.0f, 10.0f, 0.1f, 100.0f, 3.0f, 0.001f));
+  EXPECT_NEAR(result.Extract<0>(), -0.69314718f, 1e-6f);
+  EXPECT_NEAR(result.Extract<1>(), 0.0f, 1e-6f);
+  EXPECT_NEAR(result.Extract<2>(), 0.69314718f, 1e-6f);
+  EXPECT_NEAR(result.Extract<3>(), 2.30258509f, 1e-6f);
+  EXPECT_NEAR(result.Extract<4>(), -2.30258509f, 1e-6f);
+  EXPECT_NEAR(result.Extract<5>(), 4.60517019f, 1e-6f);
+  EXPECT_NEAR(result.Extract<6>(), 1.09861229f, 1e-6f);
+  EXPECT_NEAR(result.Extract<7>(), -6.90775528f, 1e-6f);
+}
+
+TEST(Float8, Sqrt) {
+  const Float8 result =
+      Sqrt(Float8(0.0f, 1.0f, 2.0f, 9.0f, 0.25f, 100.0f, 3.0f, 1e-4f));
+  EXPECT_EQ(result.Extract<0>(), 0.0f);
+  EXPECT_EQ(result.Extract<1>(), 1.0f);
+  EXPECT_NEAR(result.Extract<2>(), 1.41421356f, 1e-6f);
+  EXPECT_EQ(result.Extract<3>(), 3.0f);
+  EXPECT_EQ(result.Extract<4>(), 0.5f);
+  EXPECT_EQ(result.Extract<5>(), 10.0f);
+  EXPECT_NEAR(result.Extract<6>(), 1.73205081f, 1e-6f);
+  EXPECT_NEAR(result.Extract<7>(), 0.01f, 1e-6f);
+}
+
+TEST(Float8, RSqrt) {
+  const Float8 result =
+      RSqrt(Float8(0.25f, 1.0f, 2.0f, 4.0f, 0.5f, 100.0f, 3.0f, 1e4f));
+  EXPECT_NEAR(result.Extract<0>(), 2.0f, 1e-6f);
+  EXPECT_NEAR(result.Extract<1>(), 1.0f, 1e-6f);
+  EXPECT_NEAR(result.Extract<2>(), 0.70710678f, 1e-6f);
+  EXPECT_NEAR(result.Extract<3>(), 0.5f, 1e-6f);
+  EXPECT_NEAR(result.Extract<4>(), 1.41421356f, 1e-6f);
+  EXPECT_NEAR(result.Extract<5>(), 0.1f, 1e-6f);
+  EXPECT_NEAR(result.Extract<6>(), 0.57735027f, 1e-6f);
+  EXPECT_NEAR(result.Extract<7>(), 0.01f, 1e-6f);
+}
+
+TEST(Float8, ArcTan2) {
+  // >>> import numpy
+  // >>> numpy.arctan2([1, 1, -1, -1, 0, 0, 2, 1],
+  // ...               [1, -1, -1, 1, 1, -1, 1, -3])
+  // array([ 0.78539816,  2.35619449, -2.35619449, -0.78539816,  0.        ,
+  //         3.14159265,  1.10714872,  2.8198421 ])
+  const Float8 result =
+      ArcTan2(Float8(1.0f, 1.0f, -1.0f, -1.0f, 0.0f, 0.0f, 2.0f, 1.0f),
+              Float8(1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f, -3.0f));
+  EXPECT_NEAR(result.Extract<0>(), 0.78539816f, 1e-6f);
+  EXPECT_NEAR(result.Extract<1>(), 2.35619449f, 1e-6f);
+  EXPECT_NEAR(result.Extract<2>(), -2.35619449f, 1e-6f);
+  EXPECT_NEAR(result.Extract<3>(), -0.78539816f, 1e-6f);
+  EXPECT_EQ(result.Extract<4>(), 0.0f);
+  EXPECT_NEAR(result.Extract<5>(), 3.14159265f, 1e-6f);
+  EXPECT_NEAR(result.Extract<6>(), 1.10714872f, 1e-6f);
+  EXPECT_NEAR(result.Extract<7>(), 2.8198421f, 1e-6f);
+}
+
+TEST(Float8, Pow) {
+  // >>> import numpy
+  // >>> numpy.power([2.0, 2.0, 10.0, 0.5, 3.0, 1.5, 7.0, 0.1],
+  // ...             [0.5, 3.0, -1.0, 2.0, 0.25, -2.5, 1.5, 0.3])
+  // array([ 1.41421356,  8.        ,  0.1       ,  0.25      ,  1.31607401,
+  //         0.36288737, 18.52025918,  0.50118723])
+  const Float8 result =
+      Pow(Float8(2.0f, 2.0f, 10.0f, 0.5f, 3.0f, 1.5f, 7.0f, 0.1f),
+          Float8(0.5f, 3.0f, -1.0f, 2.0f, 0.25f, -2.5f, 1.5f, 0.3f));
+  EXPECT_NEAR(result.Extract<0>(), 1.41421356f, 1e-6f);
+  EXPECT_NEAR(result.Extract<1>(), 8.0f, 1e-5f);
+  EXPECT_NEAR(result.Extract<2>(), 0.1f, 1e-6f);
+  EXPECT_NEAR(result.Extract<3>(), 0.25f, 1e-6f);
+  EXPECT_NEAR(result.Extract<4>(), 1.31607401f, 1e-6f);
+  EXPECT_NEAR(result.Extract<5>(), 0.36288737f, 1e-6f);
+  EXPECT_NEAR(result.Extract<6>(), 18.52025918f, 1e-5f);
+  EXPECT_NEAR(result.Extract<7>(), 0.50118723f, 1e-6f);
+}
+
 TEST(Float8, Norm) {
   // >>> import numpy
   // >>> numpy.linalg.norm([2, 3, 4, 5, 6, 7, 8, 9])
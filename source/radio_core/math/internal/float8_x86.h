@@ -0,0 +1,271 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 8-element single precision floating point values using
+// AVX2 and above CPU instruction set.
+//
+// The FMA instruction set is used for the multiply-add operations when it is
+// available.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+
+#if ARCH_CPU_X86_FAMILY && ISA_CPU_X86_AVX2
+
+#  include "radio_core/math/bitwise.h"
+#  include "radio_core/math/float4.h"
+#  include "radio_core/math/internal/math_x86.h"
+#  include "radio_core/math/uint8.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedFloatTypeInfo;
+
+template <>
+struct VectorizedFloatTypeInfo<float, 8, true> {
+  using RegisterType = __m256;
+  using MaskType = VectorizedIntType<typename BitfieldForType<float>::Type, 8>;
+
+  static constexpr int kSize = 8;
+  static constexpr bool kIsVectorized = true;
+
+  static auto GetName() -> const char* { return "X86"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const float values[8]) -> __m256 {
+    return _mm256_loadu_ps(values);
+  }
+
+  static inline auto Load(const float a,
+                          const float b,
+                          const float c,
+                          const float d,
+                          const float e,
+                          const float f,
+                          const float g,
+                          const float h) -> __m256 {
+    return _mm256_setr_ps(a, b, c, d, e, f, g, h);
+  }
+
+  static inline auto Load(const float value) -> __m256 {
+    return _mm256_set1_ps(value);
+  }
+
+  static inline auto Load(const Float4::RegisterType& low,
+                          const Float4::RegisterType& high) -> __m256 {
+    return _mm256_insertf128_ps(_mm256_zextps128_ps256(low), high, 1);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Unary operations.
+
+  static inline auto Negate(const __m256& value) -> __m256 {
+    return _mm256_xor_ps(value, _mm256_set1_ps(-0.0f));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Math between vectorized and scalar types.
+
+  static inline auto Multiply(const __m256& value, const float scalar)
+      -> __m256 {
+    return _mm256_mul_ps(value, Load(scalar));
+  }
+
+  static inline auto Divide(const __m256& value, const float scalar)
+      -> __m256 {
+    return _mm256_div_ps(value, Load(scalar));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Math between 2 vectorized registers.
+
+  static inline auto Add(const __m256& lhs, const __m256& rhs) -> __m256 {
+    return _mm256_add_ps(lhs, rhs);
+  }
+
+  static inline auto Subtract(const __m256& lhs, const __m256& rhs) -> __m256 {
+    return _mm256_sub_ps(lhs, rhs);
+  }
+
+  static inline auto Multiply(const __m256& lhs, const __m256& rhs) -> __m256 {
+    return _mm256_mul_ps(lhs, rhs);
+  }
+
+  static inline auto Divide(const __m256& lhs, const __m256& rhs) -> __m256 {
+    return _mm256_div_ps(lhs, rhs);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Comparators.
+
+  static inline auto LessThan(const __m256& lhs, const __m256& rhs)
+      -> MaskType {
+    return MaskType(_mm256_castps_si256(_mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ)));
+  }
+
+  static inline auto GreaterThan(const __m256& lhs, const __m256& rhs)
+      -> MaskType {
+    return MaskType(_mm256_castps_si256(_mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ)));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const __m256& value, float dst[8]) {
+    _mm256_storeu_ps(dst, value);
+  }
+
+  template <int Index>
+  static inline void Store(const __m256& value, float* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    *dst = Extract<Index>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const __m256& value) -> float {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 4) {
+      return Float4::TypeInfo::Extract<Index>(_mm256_castps256_ps128(value));
+    } else {
+      return Float4::TypeInfo::Extract<Index - 4>(
+          _mm256_extractf128_ps(value, 1));
+    }
+  }
+
+  static inline auto ExtractLow(const __m256& value) -> Float4 {
+    return Float4(_mm256_castps256_ps128(value));
+  }
+
+  static inline auto ExtractHigh(const __m256& value) -> Float4 {
+    return Float4(_mm256_extractf128_ps(value, 1));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const __m256& value, const float new_lane_value)
+      -> __m256 {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    // Blend the broadcasted value into the lane of the index.
+    return _mm256_blend_ps(value, _mm256_set1_ps(new_lane_value), 1 << Index);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto FastLog10(const __m256& value) -> __m256 {
+    // Calculate Log10(x) as Log2(x) / Ln(10).
+
+    // 1 / Log2(10)
+    static constexpr float kLn2ToLog10Fac = 0.3010299956639812f;
+
+    return _mm256_mul_ps(internal::x86::ApproximateLog2(value),
+                         _mm256_set1_ps(kLn2ToLog10Fac));
+  }
+
+  static inline auto Abs(const __m256& value) -> __m256 {
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value);
+  }
+
+  static inline auto SquaredNorm(const __m256& value) -> float {
+    return HorizontalSum(Multiply(value, value));
+  }
+
+  static inline auto Norm(const __m256& value) -> float {
+    return radio_core::Sqrt(SquaredNorm(value));
+  }
+
+  static inline auto Min(const __m256& a, const __m256& b) -> __m256 {
+    return _mm256_min_ps(a, b);
+  }
+
+  static inline auto Max(const __m256& a, const __m256& b) -> __m256 {
+    return _mm256_max_ps(a, b);
+  }
+
+  static inline auto HorizontalMax(const __m256& value) -> float {
+    return Float4::TypeInfo::HorizontalMax(_mm_max_ps(
+        _mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1)));
+  }
+
+  static inline auto HorizontalSum(const __m256& value) -> float {
+    return internal::x86::HorizontalSum(value);
+  }
+
+  static inline auto MultiplyAdd(const __m256& a,
+                                 const __m256& b,
+                                 const __m256& c) -> __m256 {
+    return internal::x86::MultiplyAdd(a, b, c);
+  }
+
+  static inline auto Select(const MaskType& mask,
+                            const __m256& source1,
+                            const __m256& source2) -> __m256 {
+    return _mm256_blendv_ps(
+        source2, source1, _mm256_castsi256_ps(mask.GetRegister()));
+  }
+
+  static inline auto Sign(const __m256& arg) -> __m256 {
+    return CopySign(Load(1.0f), arg);
+  }
+
+  static inline auto CopySign(const __m256& mag, const __m256& sgn) -> __m256 {
+    const __m256 signbit = _mm256_set1_ps(-0.0f);
+    return _mm256_or_ps(_mm256_and_ps(signbit, sgn),
+                        _mm256_andnot_ps(signbit, mag));
+  }
+
+  static inline auto Reverse(const __m256& value) -> __m256 {
+    return _mm256_permutevar8x32_ps(value,
+                                    _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  }
+
+  static inline auto Sin(const __m256& arg) -> __m256 {
+    return internal::x86::sin_ps(arg);
+  }
+
+  static inline auto Cos(const __m256& arg) -> __m256 {
+    return internal::x86::cos_ps(arg);
+  }
+
+  static inline void SinCos(const __m256& arg, __m256& sin, __m256& cos) {
+    return internal::x86::sincos_ps(arg, &sin, &cos);
+  }
+
+  static inline auto Exp(const __m256& arg) -> __m256 {
+    return internal::x86::exp_ps(arg);
+  }
+
+  static inline auto Log(const __m256& arg) -> __m256 {
+    return internal::x86::log_ps(arg);
+  }
+
+  static inline auto Sqrt(const __m256& arg) -> __m256 {
+    return _mm256_sqrt_ps(arg);
+  }
+
+  static inline auto RSqrt(const __m256& arg) -> __m256 {
+    return internal::x86::rsqrt_ps(arg);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
+
+#endif
@@ -19,6 +19,7 @@
 #    include "radio_core/math/ushort4.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedFloatTypeInfo;
@@ -263,8 +264,21 @@ struct VectorizedFloatTypeInfo<Half, 4, true> {
   static inline auto Exp(const float16x4_t& value) -> float16x4_t {
     return internal::neon::vexp_f16(value);
   }
+
+  static inline auto Log(const float16x4_t& value) -> float16x4_t {
+    return internal::neon::vlog_f16(value);
+  }
+
+  static inline auto Sqrt(const float16x4_t& value) -> float16x4_t {
+    return internal::neon::vsqrt_f16(value);
+  }
+
+  static inline auto RSqrt(const float16x4_t& value) -> float16x4_t {
+    return internal::neon::vinvsqrt_f16(value);
+  }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #  endif  //__ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -0,0 +1,281 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 4-element half precision floating point values using F16C
+// and SSE2 and above CPU instruction set.
+//
+// The x86 CPUs do not have arithmetic on half precision values, so the values
+// are only stored in memory using half precision. They are converted to single
+// precision on load, and all the calculations happen on single precision
+// values. The result is rounded to half precision when it is stored or
+// extracted.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/base/half.h"
+
+#if ARCH_CPU_X86_FAMILY && RADIO_CORE_HAVE_HALF
+#  if ISA_CPU_X86_F16C
+
+#    include "radio_core/math/float4.h"
+#    include "radio_core/math/internal/math_x86.h"
+#    include "radio_core/math/ushort4.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedFloatTypeInfo;
+
+template <>
+struct VectorizedFloatTypeInfo<Half, 4, true> {
+  using RegisterType = __m128;
+  using MaskType = UShort4;
+
+  static constexpr int kSize = 4;
+  static constexpr bool kIsVectorized = true;
+
+  static auto GetName() -> const char* { return "X86"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Helpers.
+
+  using FloatTypeInfo = VectorizedFloatTypeInfo<float, 4, true>;
+
+  // Convert 4 single precision values to half precision values stored in the
+  // lower 64 bits of the result.
+  static inline auto ToHalfBits(const __m128& value) -> __m128i {
+    return _mm_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT);
+  }
+
+  // Convert 16-bit lanes of the lower 64 bits of the mask to a mask type.
+  static inline auto ToMask(const __m128i& bits) -> MaskType {
+    alignas(16) uint16_t values[8];
+    _mm_store_si128(reinterpret_cast<__m128i*>(values), bits);
+    return MaskType(values);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const Half values[4]) -> __m128 {
+    return _mm_cvtph_ps(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)));
+  }
+
+  static inline auto Load(const Half a,
+                          const Half b,
+                          const Half c,
+                          const Half d) -> __m128 {
+    return _mm_setr_ps(float(a), float(b), float(c), float(d));
+  }
+
+  static inline auto Load(const Half value) -> __m128 {
+    return _mm_set1_ps(float(value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Unary operations.
+
+  static inline auto Negate(const __m128& value) -> __m128 {
+    return FloatTypeInfo::Negate(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Math between vectorized and scalar types.
+
+  static inline auto Multiply(const __m128& value, const Half scalar)
+      -> __m128 {
+    return FloatTypeInfo::Multiply(value, float(scalar));
+  }
+
+  static inline auto Divide(const __m128& value, const Half scalar) -> __m128 {
+    return FloatTypeInfo::Divide(value, float(scalar));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Math between 2 vectorized registers.
+
+  static inline auto Add(const __m128& lhs, const __m128& rhs) -> __m128 {
+    return FloatTypeInfo::Add(lhs, rhs);
+  }
+
+  static inline auto Subtract(const __m128& lhs, const __m128& rhs) -> __m128 {
+    return FloatTypeInfo::Subtract(lhs, rhs);
+  }
+
+  static inline auto Multiply(const __m128& lhs, const __m128& rhs) -> __m128 {
+    return FloatTypeInfo::Multiply(lhs, rhs);
+  }
+
+  static inline auto Divide(const __m128& lhs, const __m128& rhs) -> __m128 {
+    return FloatTypeInfo::Divide(lhs, rhs);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Comparators.
+
+  // The 32-bit masks of the single precision comparison are narrowed down to
+  // the 16-bit lanes of the half precision mask using the signed saturation.
+
+  static inline auto LessThan(const __m128& lhs, const __m128& rhs)
+      -> MaskType {
+    const __m128i mask = _mm_castps_si128(_mm_cmplt_ps(lhs, rhs));
+    return ToMask(_mm_packs_epi32(mask, mask));
+  }
+
+  static inline auto GreaterThan(const __m128& lhs, const __m128& rhs)
+      -> MaskType {
+    const __m128i mask = _mm_castps_si128(_mm_cmpgt_ps(lhs, rhs));
+    return ToMask(_mm_packs_epi32(mask, mask));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const __m128& value, Half dst[4]) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), ToHalfBits(value));
+  }
+
+  template <int Index>
+  static inline void Store(const __m128& value, Half* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    *dst = Extract<Index>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const __m128& value) -> Half {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return FloatTypeInfo::Extract<Index>(value);
+  }
+
+  static inline auto ExtractLow(const __m128& value) -> Half2 {
+    return Half2(Extract<0>(value), Extract<1>(value));
+  }
+
+  static inline auto ExtractHigh(const __m128& value) -> Half2 {
+    return Half2(Extract<2>(value), Extract<3>(value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const __m128& value, const Half new_lane_value)
+      -> __m128 {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return FloatTypeInfo::SetLane<Index>(value, float(new_lane_value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto FastLog10(const __m128& value) -> __m128 {
+    return FloatTypeInfo::FastLog10(value);
+  }
+
+  static inline auto Abs(const __m128& value) -> __m128 {
+    return FloatTypeInfo::Abs(value);
+  }
+
+  static inline auto Norm(const __m128& value) -> Half {
+    return FloatTypeInfo::Norm(value);
+  }
+
+  static inline auto Min(const __m128& a, const __m128& b) -> __m128 {
+    return FloatTypeInfo::Min(a, b);
+  }
+
+  static inline auto Max(const __m128& a, const __m128& b) -> __m128 {
+    return FloatTypeInfo::Max(a, b);
+  }
+
+  static inline auto HorizontalMax(const __m128& value) -> Half {
+    return FloatTypeInfo::HorizontalMax(value);
+  }
+
+  static inline auto HorizontalSum(const __m128& value) -> Half {
+    return FloatTypeInfo::HorizontalSum(value);
+  }
+
+  static inline auto MultiplyAdd(const __m128& a,
+                                 const __m128& b,
+                                 const __m128& c) -> __m128 {
+    return FloatTypeInfo::MultiplyAdd(a, b, c);
+  }
+
+  // The mask is applied bit-wise to the half precision representation of the
+  // values, matching the semantic of the Select() for the scalar values.
+  static inline auto Select(const MaskType& mask,
+                            const __m128& source1,
+                            const __m128& source2) -> __m128 {
+    alignas(16) uint16_t mask_values[8] = {};
+    mask.Store(mask_values);
+
+    const __m128i mask_bits =
+        _mm_load_si128(reinterpret_cast<const __m128i*>(mask_values));
+
+    const __m128i bits = _mm_or_si128(
+        _mm_and_si128(mask_bits, ToHalfBits(source1)),
+        _mm_andnot_si128(mask_bits, ToHalfBits(source2)));
+
+    return _mm_cvtph_ps(bits);
+  }
+
+  static inline auto Sign(const __m128& arg) -> __m128 {
+    return FloatTypeInfo::Sign(arg);
+  }
+
+  static inline auto CopySign(const __m128& mag, const __m128& sgn) -> __m128 {
+    return FloatTypeInfo::CopySign(mag, sgn);
+  }
+
+  static inline auto Reverse(const __m128& value) -> __m128 {
+    return FloatTypeInfo::Reverse(value);
+  }
+
+  static inline auto Sin(const __m128& arg) -> __m128 {
+    return FloatTypeInfo::Sin(arg);
+  }
+
+  static inline auto Cos(const __m128& arg) -> __m128 {
+    return FloatTypeInfo::Cos(arg);
+  }
+
+  static inline void SinCos(const __m128& arg, __m128& sin, __m128& cos) {
+    FloatTypeInfo::SinCos(arg, sin, cos);
+  }
+
+  static inline auto Exp(const __m128& arg) -> __m128 {
+    return FloatTypeInfo::Exp(arg);
+  }
+
+  static inline auto Log(const __m128& arg) -> __m128 {
+    return FloatTypeInfo::Log(arg);
+  }
+
+  static inline auto Sqrt(const __m128& arg) -> __m128 {
+    return FloatTypeInfo::Sqrt(arg);
+  }
+
+  static inline auto RSqrt(const __m128& arg) -> __m128 {
+    return FloatTypeInfo::RSqrt(arg);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
+
+#  endif  // ISA_CPU_X86_F16C
+#endif    // ARCH_CPU_X86_FAMILY && RADIO_CORE_HAVE_HALF
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 #if RADIO_CORE_HAVE_HALF
@@ -16,6 +17,7 @@
 #  include "radio_core/math/half4.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedFloatTypeInfo;
@@ -265,8 +267,21 @@ struct VectorizedFloatTypeInfo<Half, 8, SpecializationMarker> {
   static inline auto Exp(const RegisterType& arg) -> RegisterType {
     return {radio_core::Exp(arg[0]), radio_core::Exp(arg[1])};
   }
+
+  static inline auto Log(const RegisterType& arg) -> RegisterType {
+    return {radio_core::Log(arg[0]), radio_core::Log(arg[1])};
+  }
+
+  static inline auto Sqrt(const RegisterType& arg) -> RegisterType {
+    return {radio_core::Sqrt(arg[0]), radio_core::Sqrt(arg[1])};
+  }
+
+  static inline auto RSqrt(const RegisterType& arg) -> RegisterType {
+    return {radio_core::RSqrt(arg[0]), radio_core::RSqrt(arg[1])};
+  }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // RADIO_CORE_HAVE_HALF
@@ -18,6 +18,7 @@
 #    include "radio_core/math/internal/math_neon.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedFloatTypeInfo;
@@ -269,8 +270,21 @@ struct VectorizedFloatTypeInfo<Half, 8, true> {
   static inline auto Exp(const float16x8_t& arg) -> float16x8_t {
     return internal::neon::vexpq_f16(arg);
   }
+
+  static inline auto Log(const float16x8_t& arg) -> float16x8_t {
+    return internal::neon::vlogq_f16(arg);
+  }
+
+  static inline auto Sqrt(const float16x8_t& arg) -> float16x8_t {
+    return internal::neon::vsqrtq_f16(arg);
+  }
+
+  static inline auto RSqrt(const float16x8_t& arg) -> float16x8_t {
+    return internal::neon::vinvsqrtq_f16(arg);
+  }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #  endif  //__ARM_FEATURE_FP16_VECTOR_ARITHMETIC
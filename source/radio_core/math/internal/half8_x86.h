@@ -0,0 +1,295 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 8-element half precision floating point values using F16C
+// and AVX2 and above CPU instruction set.
+//
+// Follows the same approach as the Half4 implementation: the values are stored
+// in memory using half precision, and all the calculations happen on single
+// precision values.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/base/half.h"
+
+#if ARCH_CPU_X86_FAMILY && RADIO_CORE_HAVE_HALF
+#  if ISA_CPU_X86_F16C && ISA_CPU_X86_AVX2
+
+#    include "radio_core/math/float8.h"
+#    include "radio_core/math/half4.h"
+#    include "radio_core/math/internal/math_x86.h"
+#    include "radio_core/math/ushort8.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedFloatTypeInfo;
+
+template <>
+struct VectorizedFloatTypeInfo<Half, 8, true> {
+  using RegisterType = __m256;
+  using MaskType = UShort8;
+
+  static constexpr int kSize = 8;
+  static constexpr bool kIsVectorized = true;
+
+  static auto GetName() -> const char* { return "X86"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Helpers.
+
+  using FloatTypeInfo = VectorizedFloatTypeInfo<float, 8, true>;
+
+  // Convert 8 single precision values to half precision values.
+  static inline auto ToHalfBits(const __m256& value) -> __m128i {
+    return _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT);
+  }
+
+  // Convert 32-bit masks of the single precision comparison to a mask type.
+  // The masks are narrowed down to 16-bit lanes using the signed saturation.
+  static inline auto ToMask(const __m256& mask) -> MaskType {
+    const __m256i mask_bits = _mm256_castps_si256(mask);
+
+    alignas(16) uint16_t values[8];
+    _mm_store_si128(reinterpret_cast<__m128i*>(values),
+                    _mm_packs_epi32(_mm256_castsi256_si128(mask_bits),
+                                    _mm256_extracti128_si256(mask_bits, 1)));
+    return MaskType(values);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const Half values[8]) -> __m256 {
+    return _mm256_cvtph_ps(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+  }
+
+  static inline auto Load(const Half a,
+                          const Half b,
+                          const Half c,
+                          const Half d,
+                          const Half e,
+                          const Half f,
+                          const Half g,
+                          const Half h) -> __m256 {
+    return _mm256_setr_ps(float(a),
+                          float(b),
+                          float(c),
+                          float(d),
+                          float(e),
+                          float(f),
+                          float(g),
+                          float(h));
+  }
+
+  static inline auto Load(const Half value) -> __m256 {
+    return _mm256_set1_ps(float(value));
+  }
+
+  static inline auto Load(const Half4::RegisterType& low,
+                          const Half4::RegisterType& high) -> __m256 {
+    return FloatTypeInfo::Load(low, high);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Unary operations.
+
+  static inline auto Negate(const __m256& value) -> __m256 {
+    return FloatTypeInfo::Negate(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Math between vectorized and scalar types.
+
+  static inline auto Multiply(const __m256& value, const Half scalar)
+      -> __m256 {
+    return FloatTypeInfo::Multiply(value, float(scalar));
+  }
+
+  static inline auto Divide(const __m256& value, const Half scalar) -> __m256 {
+    return FloatTypeInfo::Divide(value, float(scalar));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Math between 2 vectorized registers.
+
+  static inline auto Add(const __m256& lhs, const __m256& rhs) -> __m256 {
+    return FloatTypeInfo::Add(lhs, rhs);
+  }
+
+  static inline auto Subtract(const __m256& lhs, const __m256& rhs) -> __m256 {
+    return FloatTypeInfo::Subtract(lhs, rhs);
+  }
+
+  static inline auto Multiply(const __m256& lhs, const __m256& rhs) -> __m256 {
+    return FloatTypeInfo::Multiply(lhs, rhs);
+  }
+
+  static inline auto Divide(const __m256& lhs, const __m256& rhs) -> __m256 {
+    return FloatTypeInfo::Divide(lhs, rhs);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Comparators.
+
+  static inline auto LessThan(const __m256& lhs, const __m256& rhs)
+      -> MaskType {
+    return ToMask(_mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ));
+  }
+
+  static inline auto GreaterThan(const __m256& lhs, const __m256& rhs)
+      -> MaskType {
+    return ToMask(_mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const __m256& value, Half dst[8]) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), ToHalfBits(value));
+  }
+
+  template <int Index>
+  static inline void Store(const __m256& value, Half* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    *dst = Extract<Index>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const __m256& value) -> Half {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return FloatTypeInfo::Extract<Index>(value);
+  }
+
+  static inline auto ExtractLow(const __m256& value) -> Half4 {
+    return Half4(_mm256_castps256_ps128(value));
+  }
+
+  static inline auto ExtractHigh(const __m256& value) -> Half4 {
+    return Half4(_mm256_extractf128_ps(value, 1));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const __m256& value, const Half new_lane_value)
+      -> __m256 {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return FloatTypeInfo::SetLane<Index>(value, float(new_lane_value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto FastLog10(const __m256& value) -> __m256 {
+    return FloatTypeInfo::FastLog10(value);
+  }
+
+  static inline auto Abs(const __m256& value) -> __m256 {
+    return FloatTypeInfo::Abs(value);
+  }
+
+  static inline auto Norm(const __m256& value) -> Half {
+    return FloatTypeInfo::Norm(value);
+  }
+
+  static inline auto Min(const __m256& a, const __m256& b) -> __m256 {
+    return FloatTypeInfo::Min(a, b);
+  }
+
+  static inline auto Max(const __m256& a, const __m256& b) -> __m256 {
+    return FloatTypeInfo::Max(a, b);
+  }
+
+  static inline auto HorizontalMax(const __m256& value) -> Half {
+    return FloatTypeInfo::HorizontalMax(value);
+  }
+
+  static inline auto HorizontalSum(const __m256& value) -> Half {
+    return FloatTypeInfo::HorizontalSum(value);
+  }
+
+  static inline auto MultiplyAdd(const __m256& a,
+                                 const __m256& b,
+                                 const __m256& c) -> __m256 {
+    return FloatTypeInfo::MultiplyAdd(a, b, c);
+  }
+
+  // The mask is applied bit-wise to the half precision representation of the
+  // values, matching the semantic of the Select() for the scalar values.
+  static inline auto Select(const MaskType& mask,
+                            const __m256& source1,
+                            const __m256& source2) -> __m256 {
+    alignas(16) uint16_t mask_values[8];
+    mask.Store(mask_values);
+
+    const __m128i mask_bits =
+        _mm_load_si128(reinterpret_cast<const __m128i*>(mask_values));
+
+    const __m128i bits = _mm_or_si128(
+        _mm_and_si128(mask_bits, ToHalfBits(source1)),
+        _mm_andnot_si128(mask_bits, ToHalfBits(source2)));
+
+    return _mm256_cvtph_ps(bits);
+  }
+
+  static inline auto Sign(const __m256& arg) -> __m256 {
+    return FloatTypeInfo::Sign(arg);
+  }
+
+  static inline auto CopySign(const __m256& mag, const __m256& sgn) -> __m256 {
+    return FloatTypeInfo::CopySign(mag, sgn);
+  }
+
+  static inline auto Reverse(const __m256& value) -> __m256 {
+    return FloatTypeInfo::Reverse(value);
+  }
+
+  static inline auto Sin(const __m256& arg) -> __m256 {
+    return FloatTypeInfo::Sin(arg);
+  }
+
+  static inline auto Cos(const __m256& arg) -> __m256 {
+    return FloatTypeInfo::Cos(arg);
+  }
+
+  static inline void SinCos(const __m256& arg, __m256& sin, __m256& cos) {
+    FloatTypeInfo::SinCos(arg, sin, cos);
+  }
+
+  static inline auto Exp(const __m256& arg) -> __m256 {
+    return FloatTypeInfo::Exp(arg);
+  }
+
+  static inline auto Log(const __m256& arg) -> __m256 {
+    return FloatTypeInfo::Log(arg);
+  }
+
+  static inline auto Sqrt(const __m256& arg) -> __m256 {
+    return FloatTypeInfo::Sqrt(arg);
+  }
+
+  static inline auto RSqrt(const __m256& arg) -> __m256 {
+    return FloatTypeInfo::RSqrt(arg);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
+
+#  endif  // ISA_CPU_X86_F16C && ISA_CPU_X86_AVX2
+#endif    // ARCH_CPU_X86_FAMILY && RADIO_CORE_HAVE_HALF
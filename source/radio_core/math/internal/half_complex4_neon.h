@@ -19,6 +19,7 @@
 #    include "radio_core/math/internal/math_neon.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedComplexTypeInfo;
@@ -295,6 +296,7 @@ struct VectorizedComplexTypeInfo<Half, 4, true> {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #  endif  //__ARM_FEATURE_FP16_VECTOR_ARITHMETIC
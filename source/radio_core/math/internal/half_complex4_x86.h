@@ -0,0 +1,243 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 4-element half precision complex values using F16C and
+// SSE2 and above CPU instruction set.
+//
+// The values are stored in memory using half precision. The real and imaginary
+// parts are converted to single precision on load, and all the calculations
+// happen on single precision values, similar to the Half4.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/base/half.h"
+
+#if ARCH_CPU_X86_FAMILY && RADIO_CORE_HAVE_HALF
+#  if ISA_CPU_X86_F16C
+
+#    include "radio_core/math/complex4.h"
+#    include "radio_core/math/half4.h"
+#    include "radio_core/math/half_complex.h"
+#    include "radio_core/math/half_complex2.h"
+#    include "radio_core/math/internal/math_x86.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedComplexTypeInfo;
+
+template <>
+struct VectorizedComplexTypeInfo<Half, 4, true> {
+  using ComplexTypeInfo = VectorizedComplexTypeInfo<float, 4, true>;
+
+  using RegisterType = ComplexTypeInfo::RegisterType;
+
+  static constexpr int kSize = 4;
+  static constexpr bool kIsVectorized = true;
+
+  static auto GetName() -> const char* { return "X86"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Helpers.
+
+  static inline auto ToComplex(const HalfComplex& value) -> Complex {
+    return {float(value.real), float(value.imag)};
+  }
+
+  static inline auto ToHalfComplex(const Complex& value) -> HalfComplex {
+    return {Half(value.real), Half(value.imag)};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const HalfComplex values[4]) -> RegisterType {
+    const __m128i bits =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+
+    const __m128 a = _mm_cvtph_ps(bits);
+    const __m128 b = _mm_cvtph_ps(_mm_unpackhi_epi64(bits, bits));
+
+    RegisterType r;
+    r.val[0] = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    r.val[1] = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    return r;
+  }
+
+  static inline auto Load(const HalfComplex& a,
+                          const HalfComplex& b,
+                          const HalfComplex& c,
+                          const HalfComplex& d) -> RegisterType {
+    // NOTE: Can not trust order of function arguments in memory, so ensure they
+    // are loaded into a continuous memory chunk.
+    const HalfComplex values[4] = {a, b, c, d};
+    return Load(values);
+  }
+
+  static inline auto Load(const HalfComplex& value) -> RegisterType {
+    RegisterType r;
+    r.val[0] = _mm_set1_ps(float(value.real));
+    r.val[1] = _mm_set1_ps(float(value.imag));
+    return r;
+  }
+
+  static inline auto Load(const Half4::RegisterType& real,
+                          const Half4::RegisterType& imag) -> RegisterType {
+    return ComplexTypeInfo::Load(real, imag);
+  }
+
+  static inline auto Load(const Half real) -> RegisterType {
+    return ComplexTypeInfo::Load(float(real));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Unary operations.
+
+  static inline auto Negate(const RegisterType& value) -> RegisterType {
+    return ComplexTypeInfo::Negate(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Mathematical operation between two vectorized registers.
+
+  static inline auto Add(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return ComplexTypeInfo::Add(lhs, rhs);
+  }
+
+  static inline auto Subtract(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return ComplexTypeInfo::Subtract(lhs, rhs);
+  }
+
+  static inline auto Multiply(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return ComplexTypeInfo::Multiply(lhs, rhs);
+  }
+
+  static inline auto Multiply(const RegisterType& lhs,
+                              const Half4::RegisterType& rhs) -> RegisterType {
+    return ComplexTypeInfo::Multiply(lhs, rhs);
+  }
+
+  static inline auto Divide(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return ComplexTypeInfo::Divide(lhs, rhs);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const RegisterType& value, HalfComplex dst[4]) {
+    const __m128 xy = _mm_unpacklo_ps(value.val[0], value.val[1]);
+    const __m128 zw = _mm_unpackhi_ps(value.val[0], value.val[1]);
+
+    const __m128i bits =
+        _mm_unpacklo_epi64(_mm_cvtps_ph(xy, _MM_FROUND_TO_NEAREST_INT),
+                           _mm_cvtps_ph(zw, _MM_FROUND_TO_NEAREST_INT));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bits);
+  }
+
+  template <int Index>
+  static inline void Store(const RegisterType& value, HalfComplex* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    *dst = Extract<Index>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const RegisterType& value) -> HalfComplex {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return ToHalfComplex(ComplexTypeInfo::Extract<Index>(value));
+  }
+
+  static inline auto ExtractLow(const RegisterType& value) -> HalfComplex2 {
+    return HalfComplex2(Extract<0>(value), Extract<1>(value));
+  }
+
+  static inline auto ExtractHigh(const RegisterType& value) -> HalfComplex2 {
+    return HalfComplex2(Extract<2>(value), Extract<3>(value));
+  }
+
+  static inline auto ExtractReal(const RegisterType& value) -> Half4 {
+    return Half4(value.val[0]);
+  }
+
+  static inline auto ExtractImag(const RegisterType& value) -> Half4 {
+    return Half4(value.val[1]);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const RegisterType& value,
+                             const HalfComplex new_lane_value) -> RegisterType {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return ComplexTypeInfo::SetLane<Index>(value, ToComplex(new_lane_value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto Abs(const RegisterType& value) -> Half4 {
+    return Half4(ComplexTypeInfo::Abs(value).GetRegister());
+  }
+
+  static inline auto FastAbs(const RegisterType& value) -> Half4 {
+    return Half4(ComplexTypeInfo::FastAbs(value).GetRegister());
+  }
+
+  static inline auto Norm(const RegisterType& value) -> Half4 {
+    return Half4(ComplexTypeInfo::Norm(value).GetRegister());
+  }
+
+  static inline auto HorizontalSum(const RegisterType& value) -> HalfComplex {
+    return ToHalfComplex(ComplexTypeInfo::HorizontalSum(value));
+  }
+
+  static inline auto MultiplyAdd(const RegisterType& a,
+                                 const RegisterType& b,
+                                 const Half4::RegisterType& c)
+      -> RegisterType {
+    return ComplexTypeInfo::MultiplyAdd(a, b, c);
+  }
+
+  static inline auto FastArg(const RegisterType& value) -> Half4 {
+    return Half4(ComplexTypeInfo::FastArg(value).GetRegister());
+  }
+
+  static inline auto Conj(const RegisterType& value) -> RegisterType {
+    return ComplexTypeInfo::Conj(value);
+  }
+
+  static inline auto ComplexExp(const Half4::RegisterType& x) -> RegisterType {
+    return ComplexTypeInfo::ComplexExp(x);
+  }
+
+  static inline auto Exp(const RegisterType& z) -> RegisterType {
+    return ComplexTypeInfo::Exp(z);
+  }
+
+  static inline auto Reverse(const RegisterType& value) -> RegisterType {
+    return ComplexTypeInfo::Reverse(value);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
+
+#  endif  // ISA_CPU_X86_F16C
+#endif    // ARCH_CPU_X86_FAMILY && RADIO_CORE_HAVE_HALF
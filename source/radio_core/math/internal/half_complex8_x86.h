@@ -0,0 +1,258 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 8-element half precision complex values using F16C and
+// AVX2 and above CPU instruction set.
+//
+// The values are stored in memory using half precision. The real and imaginary
+// parts are converted to single precision on load, and all the calculations
+// happen on single precision values, similar to the Half8.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/base/half.h"
+
+#if ARCH_CPU_X86_FAMILY && RADIO_CORE_HAVE_HALF
+#  if ISA_CPU_X86_F16C && ISA_CPU_X86_AVX2
+
+#    include "radio_core/math/complex8.h"
+#    include "radio_core/math/half8.h"
+#    include "radio_core/math/half_complex.h"
+#    include "radio_core/math/half_complex4.h"
+#    include "radio_core/math/internal/math_x86.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedComplexTypeInfo;
+
+template <>
+struct VectorizedComplexTypeInfo<Half, 8, true> {
+  using ComplexTypeInfo = VectorizedComplexTypeInfo<float, 8, true>;
+
+  using RegisterType = ComplexTypeInfo::RegisterType;
+
+  static constexpr int kSize = 8;
+  static constexpr bool kIsVectorized = true;
+
+  static auto GetName() -> const char* { return "X86"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Helpers.
+
+  static inline auto ToComplex(const HalfComplex& value) -> Complex {
+    return {float(value.real), float(value.imag)};
+  }
+
+  static inline auto ToHalfComplex(const Complex& value) -> HalfComplex {
+    return {Half(value.real), Half(value.imag)};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const HalfComplex values[8]) -> RegisterType {
+    const auto* data = reinterpret_cast<const __m128i*>(values);
+
+    // a = [r0 i0 r1 i1 | r2 i2 r3 i3], b = [r4 i4 r5 i5 | r6 i6 r7 i7]
+    const __m256 a = _mm256_cvtph_ps(_mm_loadu_si128(data));
+    const __m256 b = _mm256_cvtph_ps(_mm_loadu_si128(data + 1));
+
+    // De-interleave the same way as the single precision complex values.
+    const __m256 real = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m256 imag = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+
+    RegisterType r;
+    r.val[0] = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(real),
+                                                      _MM_SHUFFLE(3, 1, 2, 0)));
+    r.val[1] = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(imag),
+                                                      _MM_SHUFFLE(3, 1, 2, 0)));
+    return r;
+  }
+
+  static inline auto Load(const HalfComplex& a,
+                          const HalfComplex& b,
+                          const HalfComplex& c,
+                          const HalfComplex& d,
+                          const HalfComplex& e,
+                          const HalfComplex& f,
+                          const HalfComplex& g,
+                          const HalfComplex& h) -> RegisterType {
+    // NOTE: Can not trust order of function arguments in memory, so ensure they
+    // are loaded into a continuous memory chunk.
+    const HalfComplex values[8] = {a, b, c, d, e, f, g, h};
+    return Load(values);
+  }
+
+  static inline auto Load(const HalfComplex& value) -> RegisterType {
+    RegisterType r;
+    r.val[0] = _mm256_set1_ps(float(value.real));
+    r.val[1] = _mm256_set1_ps(float(value.imag));
+    return r;
+  }
+
+  static inline auto Load(const Half8::RegisterType& real,
+                          const Half8::RegisterType& imag) -> RegisterType {
+    return ComplexTypeInfo::Load(real, imag);
+  }
+
+  static inline auto Load(const Half real) -> RegisterType {
+    return ComplexTypeInfo::Load(float(real));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Unary operations.
+
+  static inline auto Negate(const RegisterType& value) -> RegisterType {
+    return ComplexTypeInfo::Negate(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Mathematical operation between two vectorized registers.
+
+  static inline auto Add(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return ComplexTypeInfo::Add(lhs, rhs);
+  }
+
+  static inline auto Subtract(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return ComplexTypeInfo::Subtract(lhs, rhs);
+  }
+
+  static inline auto Multiply(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return ComplexTypeInfo::Multiply(lhs, rhs);
+  }
+
+  static inline auto Multiply(const RegisterType& lhs,
+                              const Half8::RegisterType& rhs) -> RegisterType {
+    return ComplexTypeInfo::Multiply(lhs, rhs);
+  }
+
+  static inline auto Divide(const RegisterType& lhs, const RegisterType& rhs)
+      -> RegisterType {
+    return ComplexTypeInfo::Divide(lhs, rhs);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const RegisterType& value, HalfComplex dst[8]) {
+    auto* data = reinterpret_cast<__m128i*>(dst);
+
+    // The unpack operates within 128 bit lanes, giving
+    // lo = [c0 c1 | c4 c5] and hi = [c2 c3 | c6 c7].
+    const __m256 lo = _mm256_unpacklo_ps(value.val[0], value.val[1]);
+    const __m256 hi = _mm256_unpackhi_ps(value.val[0], value.val[1]);
+
+    _mm_storeu_si128(data,
+                     _mm256_cvtps_ph(_mm256_permute2f128_ps(lo, hi, 0x20),
+                                     _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128(data + 1,
+                     _mm256_cvtps_ph(_mm256_permute2f128_ps(lo, hi, 0x31),
+                                     _MM_FROUND_TO_NEAREST_INT));
+  }
+
+  template <int Index>
+  static inline void Store(const RegisterType& value, HalfComplex* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    *dst = Extract<Index>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const RegisterType& value) -> HalfComplex {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return ToHalfComplex(ComplexTypeInfo::Extract<Index>(value));
+  }
+
+  static inline auto ExtractLow(const RegisterType& value) -> HalfComplex4 {
+    return HalfComplex4(ComplexTypeInfo::ExtractLow(value).GetRegister());
+  }
+
+  static inline auto ExtractHigh(const RegisterType& value) -> HalfComplex4 {
+    return HalfComplex4(ComplexTypeInfo::ExtractHigh(value).GetRegister());
+  }
+
+  static inline auto ExtractReal(const RegisterType& value) -> Half8 {
+    return Half8(value.val[0]);
+  }
+
+  static inline auto ExtractImag(const RegisterType& value) -> Half8 {
+    return Half8(value.val[1]);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const RegisterType& value,
+                             const HalfComplex new_lane_value) -> RegisterType {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return ComplexTypeInfo::SetLane<Index>(value, ToComplex(new_lane_value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto Abs(const RegisterType& value) -> Half8 {
+    return Half8(ComplexTypeInfo::Abs(value).GetRegister());
+  }
+
+  static inline auto FastAbs(const RegisterType& value) -> Half8 {
+    return Half8(ComplexTypeInfo::FastAbs(value).GetRegister());
+  }
+
+  static inline auto Norm(const RegisterType& value) -> Half8 {
+    return Half8(ComplexTypeInfo::Norm(value).GetRegister());
+  }
+
+  static inline auto HorizontalSum(const RegisterType& value) -> HalfComplex {
+    return ToHalfComplex(ComplexTypeInfo::HorizontalSum(value));
+  }
+
+  static inline auto MultiplyAdd(const RegisterType& a,
+                                 const RegisterType& b,
+                                 const Half8::RegisterType& c)
+      -> RegisterType {
+    return ComplexTypeInfo::MultiplyAdd(a, b, c);
+  }
+
+  static inline auto FastArg(const RegisterType& value) -> Half8 {
+    return Half8(ComplexTypeInfo::FastArg(value).GetRegister());
+  }
+
+  static inline auto Conj(const RegisterType& value) -> RegisterType {
+    return ComplexTypeInfo::Conj(value);
+  }
+
+  static inline auto ComplexExp(const Half8::RegisterType& x) -> RegisterType {
+    return ComplexTypeInfo::ComplexExp(x);
+  }
+
+  static inline auto Exp(const RegisterType& z) -> RegisterType {
+    return ComplexTypeInfo::Exp(z);
+  }
+
+  static inline auto Reverse(const RegisterType& value) -> RegisterType {
+    return ComplexTypeInfo::Reverse(value);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
+
+#  endif  // ISA_CPU_X86_F16C && ISA_CPU_X86_AVX2
+#endif    // ARCH_CPU_X86_FAMILY && RADIO_CORE_HAVE_HALF
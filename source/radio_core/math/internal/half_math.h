@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 
 #if RADIO_CORE_HAVE_HALF
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Computes the smallest integer value not less than arg.
 inline auto Ceil(const Half arg) -> Half { return Half(std::ceil(float(arg))); }
@@ -113,6 +115,7 @@ inline auto IsNaN(const Half f) -> bool {
   return exponent_bits == 0x7e00;
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif
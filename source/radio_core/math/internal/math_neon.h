@@ -11,6 +11,7 @@
 #  include <arm_neon.h>
 
 namespace radio_core::internal::neon {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Reciprocal of v, with higher precision than vrecpeq_f32.
 inline auto vinvertq_f32(const float32x4_t v) -> float32x4_t {
@@ -36,6 +37,14 @@ inline auto vinvsqrt_f32(const float32x2_t v) -> float32x2_t {
   return r;
 }
 
+// Higher precision variant of vrsqrteq_f32().
+inline auto vinvsqrtq_f32(const float32x4_t v) -> float32x4_t {
+  float32x4_t r = vrsqrteq_f32(v);
+  r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(r, r), v), r);
+  r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(r, r), v), r);
+  return r;
+}
+
 #  if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) &&                         \
       __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 
@@ -110,10 +119,19 @@ inline auto vsqrt_f32(const float32x2_t v) -> float32x2_t {
   return vinvert_f32(vinvsqrt_f32(v));
 }
 
+inline auto vsqrtq_f32(const float32x4_t v) -> float32x4_t {
+  const float32x4_t zero = vdupq_n_f32(0);
+
+  const float32x4_t r = vinvertq_f32(vinvsqrtq_f32(v));
+  const uint32x4_t mask = vceqq_f32(v, zero);
+  return vbslq_f32(mask, zero, r);
+}
+
 #  else
 using ::vaddvq_f32;
 using ::vdivq_f32;
 using ::vsqrt_f32;
+using ::vsqrtq_f32;
 #  endif
 
 // Reverse elements of the given vector.
@@ -305,6 +323,11 @@ inline auto vlogq_f32(float32x4_t x) -> float32x4_t
 #  if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) &&                         \
       __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 
+inline float16x4_t vlog_f16(float16x4_t x)
+{
+    return vcvt_f16_f32(vlogq_f32(vcvt_f32_f16(x)));
+}
+
 inline float16x8_t vlogq_f16(float16x8_t x)
 {
     const float32x4_t x_high = vcvt_f32_f16(vget_high_f16(x));
@@ -557,4 +580,5 @@ inline float16x8_t vcosq_f16(float16x8_t x) {
 
 #endif  // ISA_CPU_ARM_NEON
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::internal::neon
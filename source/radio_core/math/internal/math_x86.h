@@ -8,9 +8,23 @@
 
 #if ARCH_CPU_X86_FAMILY
 
+// The AVX-512 intrinsics of GCC 12 use self-initialized variables for the
+// undefined parts of the registers, which causes false-positive warnings about
+// uninitialized variables when the intrinsics are inlined.
+#  if COMPILER_GCC
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wuninitialized"
+#    pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#  endif
 #  include <immintrin.h>
+#  if COMPILER_GCC
+#    pragma GCC diagnostic pop
+#  endif
+
+#  include <limits>
 
 namespace radio_core::internal::x86 {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Multiply-add to accumulator:
 //   RESULT[i] = a[i] + (b[i] * c[i]) for i = 0 to N
@@ -206,6 +220,90 @@ inline __m128 exp_ps(__m128 x) {
   return y;
 }
 
+const __m128 _ps_min_norm_pos = _mm_castsi128_ps(_mm_set1_epi32(0x00800000));
+const __m128 _ps_inv_mant_mask = _mm_castsi128_ps(_mm_set1_epi32(~0x7f800000));
+
+const __m128 _ps_cephes_SQRTHF = _mm_set1_ps(0.707106781186547524f);
+const __m128 _ps_cephes_log_p0 = _mm_set1_ps(7.0376836292E-2f);
+const __m128 _ps_cephes_log_p1 = _mm_set1_ps(-1.1514610310E-1f);
+const __m128 _ps_cephes_log_p2 = _mm_set1_ps(1.1676998740E-1f);
+const __m128 _ps_cephes_log_p3 = _mm_set1_ps(-1.2420140846E-1f);
+const __m128 _ps_cephes_log_p4 = _mm_set1_ps(1.4249322787E-1f);
+const __m128 _ps_cephes_log_p5 = _mm_set1_ps(-1.6668057665E-1f);
+const __m128 _ps_cephes_log_p6 = _mm_set1_ps(2.0000714765E-1f);
+const __m128 _ps_cephes_log_p7 = _mm_set1_ps(-2.4999993993E-1f);
+const __m128 _ps_cephes_log_p8 = _mm_set1_ps(3.3333331174E-1f);
+const __m128 _ps_cephes_log_q1 = _mm_set1_ps(-2.12194440e-4f);
+const __m128 _ps_cephes_log_q2 = _mm_set1_ps(0.693359375f);
+
+/* natural logarithm computed for 4 simultaneous float
+   return NaN for x <= 0 */
+inline __m128 log_ps(__m128 x) {
+  __m128i emm0;
+  __m128 one = _ps_1;
+
+  __m128 invalid_mask = _mm_cmple_ps(x, _mm_setzero_ps());
+
+  x = _mm_max_ps(x, _ps_min_norm_pos); /* cut off denormalized stuff */
+
+  emm0 = _mm_srli_epi32(_mm_castps_si128(x), 23);
+  /* keep only the fractional part */
+  x = _mm_and_ps(x, _ps_inv_mant_mask);
+  x = _mm_or_ps(x, _ps_0p5);
+
+  emm0 = _mm_sub_epi32(emm0, _pi32_0x7f);
+  __m128 e = _mm_cvtepi32_ps(emm0);
+
+  e = _mm_add_ps(e, one);
+
+  /* part2:
+     if( x < SQRTHF ) {
+       e -= 1;
+       x = x + x - 1.0;
+     } else { x = x - 1.0; }
+  */
+  __m128 mask = _mm_cmplt_ps(x, _ps_cephes_SQRTHF);
+  __m128 tmp = _mm_and_ps(x, mask);
+  x = _mm_sub_ps(x, one);
+  e = _mm_sub_ps(e, _mm_and_ps(one, mask));
+  x = _mm_add_ps(x, tmp);
+
+  __m128 z = _mm_mul_ps(x, x);
+
+  __m128 y = _ps_cephes_log_p0;
+  y = _mm_mul_ps(y, x);
+  y = _mm_add_ps(y, _ps_cephes_log_p1);
+  y = _mm_mul_ps(y, x);
+  y = _mm_add_ps(y, _ps_cephes_log_p2);
+  y = _mm_mul_ps(y, x);
+  y = _mm_add_ps(y, _ps_cephes_log_p3);
+  y = _mm_mul_ps(y, x);
+  y = _mm_add_ps(y, _ps_cephes_log_p4);
+  y = _mm_mul_ps(y, x);
+  y = _mm_add_ps(y, _ps_cephes_log_p5);
+  y = _mm_mul_ps(y, x);
+  y = _mm_add_ps(y, _ps_cephes_log_p6);
+  y = _mm_mul_ps(y, x);
+  y = _mm_add_ps(y, _ps_cephes_log_p7);
+  y = _mm_mul_ps(y, x);
+  y = _mm_add_ps(y, _ps_cephes_log_p8);
+  y = _mm_mul_ps(y, x);
+
+  y = _mm_mul_ps(y, z);
+
+  tmp = _mm_mul_ps(e, _ps_cephes_log_q1);
+  y = _mm_add_ps(y, tmp);
+
+  tmp = _mm_mul_ps(z, _ps_0p5);
+  y = _mm_sub_ps(y, tmp);
+
+  tmp = _mm_mul_ps(e, _ps_cephes_log_q2);
+  x = _mm_add_ps(x, y);
+  x = _mm_add_ps(x, tmp);
+  x = _mm_or_ps(x, invalid_mask);  // negative arg will be NAN
+  return x;
+}
+
 const __m128 _ps_minus_cephes_DP1 = _mm_set1_ps(-0.78515625f);
 const __m128 _ps_minus_cephes_DP2 = _mm_set1_ps(-2.4187564849853515625e-4f);
 const __m128 _ps_minus_cephes_DP3 = _mm_set1_ps(-3.77489497744594108e-8f);
@@ -322,6 +420,391 @@ inline __m128 cos_ps(__m128 x) {
   return ycos;
 }
 
+// Reciprocal square root.
+//
+// The 12 bit approximation of the _mm_rsqrt_ps() is refined with a single
+// Newton-Raphson step:
+//
+//   r = r * (1.5 - 0.5 * x * r * r)
+//
+// The result for zero is infinity, and for negative arguments is NaN.
+inline auto rsqrt_ps(const __m128& x) -> __m128 {
+  const __m128 r = _mm_rsqrt_ps(x);
+  const __m128 half_x_r = _mm_mul_ps(_mm_mul_ps(_ps_0p5, x), r);
+  const __m128 refined = _mm_mul_ps(
+      r, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(half_x_r, r)));
+
+  // The Newton-Raphson step gives NaN for zero and infinity arguments: use the
+  // approximation as-is for them.
+  const __m128 is_special = _mm_or_ps(
+      _mm_cmpeq_ps(x, _mm_setzero_ps()),
+      _mm_cmpeq_ps(x, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+  return _mm_or_ps(_mm_and_ps(is_special, r),
+                   _mm_andnot_ps(is_special, refined));
+}
+
+// =============================================================================
+// 256 bit registers.
+//
+// Same algorithms as above, operating on 8 elements at a time.
+// =============================================================================
+
+#  if ISA_CPU_X86_AVX2
+
+// Multiply-add to accumulator:
+//   RESULT[i] = a[i] + (b[i] * c[i]) for i = 0 to N
+inline auto MultiplyAdd(const __m256& a, const __m256& b, const __m256& c)
+    -> __m256 {
+#    if ISA_CPU_X86_FMA
+  return _mm256_fmadd_ps(b, c, a);
+#    else
+  return _mm256_add_ps(a, _mm256_mul_ps(b, c));
+#    endif
+}
+
+// Sum of all elements:
+//  RESULT = a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7]
+inline auto HorizontalSum(const __m256& value) -> float {
+  return HorizontalSum(_mm_add_ps(_mm256_castps256_ps128(value),
+                                  _mm256_extractf128_ps(value, 1)));
+}
+
+// Calculate the following polynomial:
+//
+//   c7*x^7 + c6*x^6 + c5*x^5 + c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0
+inline auto CalculatePolynom(const __m256& x,
+                             const float c0,
+                             const float c1,
+                             const float c2,
+                             const float c3,
+                             const float c4,
+                             const float c5,
+                             const float c6,
+                             const float c7) -> __m256 {
+  __m256 result = _mm256_set1_ps(c7);
+
+  result = MultiplyAdd(_mm256_set1_ps(c6), result, x);
+  result = MultiplyAdd(_mm256_set1_ps(c5), result, x);
+  result = MultiplyAdd(_mm256_set1_ps(c4), result, x);
+  result = MultiplyAdd(_mm256_set1_ps(c3), result, x);
+  result = MultiplyAdd(_mm256_set1_ps(c2), result, x);
+  result = MultiplyAdd(_mm256_set1_ps(c1), result, x);
+  result = MultiplyAdd(_mm256_set1_ps(c0), result, x);
+
+  return result;
+}
+
+// Approximate per-element element base-2 logarithm.
+// See the 128 bit version for the details.
+inline auto ApproximateLog2(__m256 x) -> __m256 {
+  const __m256i exp = _mm256_set1_epi32(0x7f800000);
+  const __m256i mant = _mm256_set1_epi32(0x007fffff);
+
+  const __m256 one = _mm256_set1_ps(1.0f);
+
+  const __m256i i = _mm256_castps_si256(x);
+
+  const __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(
+      _mm256_srli_epi32(_mm256_and_si256(i, exp), 23), _mm256_set1_epi32(127)));
+
+  const __m256 m =
+      _mm256_or_ps(_mm256_castsi256_ps(_mm256_and_si256(i, mant)), one);
+
+  __m256 p = CalculatePolynom(m,
+                              3.484752333259812739311f,
+                              -5.010303889272714897639f,
+                              5.842652591696923438221f,
+                              -4.634291907077220346919f,
+                              2.418069084345598673746f,
+                              -7.957081900627795076299e-01f,
+                              1.498442116273012398156e-01f,
+                              -1.231947399129126435606e-02f);
+
+  p = _mm256_mul_ps(p, _mm256_sub_ps(m, one));
+
+  return _mm256_add_ps(p, e);
+}
+
+inline __m256 exp_ps(__m256 x) {
+  const __m256 one = _mm256_set1_ps(1.0f);
+
+  x = _mm256_min_ps(x, _mm256_set1_ps(88.3762626647949f));
+  x = _mm256_max_ps(x, _mm256_set1_ps(-88.3762626647949f));
+
+  /* express exp(x) as exp(g + n*log(2)) */
+  __m256 fx = MultiplyAdd(
+      _mm256_set1_ps(0.5f), x, _mm256_set1_ps(1.44269504088896341f));
+
+  /* floor with the AVX instruction set */
+  fx = _mm256_floor_ps(fx);
+
+  x = _mm256_sub_ps(x, _mm256_mul_ps(fx, _mm256_set1_ps(0.693359375f)));
+  x = _mm256_sub_ps(x, _mm256_mul_ps(fx, _mm256_set1_ps(-2.12194440e-4f)));
+
+  const __m256 z = _mm256_mul_ps(x, x);
+
+  __m256 y = _mm256_set1_ps(1.9875691500E-4f);
+  y = MultiplyAdd(_mm256_set1_ps(1.3981999507E-3f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(8.3334519073E-3f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(4.1665795894E-2f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(1.6666665459E-1f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(5.0000001201E-1f), y, x);
+  y = MultiplyAdd(x, y, z);
+  y = _mm256_add_ps(y, one);
+
+  /* build 2^n */
+  __m256i emm0 = _mm256_cvttps_epi32(fx);
+  emm0 = _mm256_add_epi32(emm0, _mm256_set1_epi32(0x7f));
+  emm0 = _mm256_slli_epi32(emm0, 23);
+  const __m256 pow2n = _mm256_castsi256_ps(emm0);
+
+  return _mm256_mul_ps(y, pow2n);
+}
+
+inline __m256 log_ps(__m256 x) {
+  const __m256 one = _mm256_set1_ps(1.0f);
+
+  const __m256 invalid_mask =
+      _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LE_OQ);
+
+  /* cut off denormalized stuff */
+  x = _mm256_max_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x00800000)));
+
+  __m256i emm0 = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
+
+  /* keep only the fractional part */
+  x = _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(~0x7f800000)));
+  x = _mm256_or_ps(x, _mm256_set1_ps(0.5f));
+
+  emm0 = _mm256_sub_epi32(emm0, _mm256_set1_epi32(0x7f));
+  __m256 e = _mm256_add_ps(_mm256_cvtepi32_ps(emm0), one);
+
+  /* part2:
+     if( x < SQRTHF ) {
+       e -= 1;
+       x = x + x - 1.0;
+     } else { x = x - 1.0; }
+  */
+  const __m256 mask =
+      _mm256_cmp_ps(x, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+  const __m256 tmp = _mm256_and_ps(x, mask);
+  x = _mm256_sub_ps(x, one);
+  e = _mm256_sub_ps(e, _mm256_and_ps(one, mask));
+  x = _mm256_add_ps(x, tmp);
+
+  const __m256 z = _mm256_mul_ps(x, x);
+
+  __m256 y = _mm256_set1_ps(7.0376836292E-2f);
+  y = MultiplyAdd(_mm256_set1_ps(-1.1514610310E-1f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(1.1676998740E-1f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(-1.2420140846E-1f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(1.4249322787E-1f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(-1.6668057665E-1f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(2.0000714765E-1f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(-2.4999993993E-1f), y, x);
+  y = MultiplyAdd(_mm256_set1_ps(3.3333331174E-1f), y, x);
+  y = _mm256_mul_ps(_mm256_mul_ps(y, x), z);
+
+  y = MultiplyAdd(y, e, _mm256_set1_ps(-2.12194440e-4f));
+  y = MultiplyAdd(y, z, _mm256_set1_ps(-0.5f));
+
+  x = _mm256_add_ps(x, y);
+  x = MultiplyAdd(x, e, _mm256_set1_ps(0.693359375f));
+
+  /* negative arg will be NAN */
+  return _mm256_or_ps(x, invalid_mask);
+}
+
+inline void sincos_ps(__m256 x, __m256* s, __m256* c) {
+  const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+
+  /* extract the sign bit, and take the absolute value */
+  __m256 sign_bit_sin = _mm256_and_ps(x, sign_mask);
+  x = _mm256_andnot_ps(sign_mask, x);
+
+  /* scale by 4/Pi */
+  __m256 y = _mm256_mul_ps(x, _mm256_set1_ps(1.27323954473516f));
+
+  /* store the integer part of y in emm2 */
+  __m256i emm2 = _mm256_cvttps_epi32(y);
+
+  /* j=(j+1) & (~1) (see the cephes sources) */
+  emm2 = _mm256_add_epi32(emm2, _mm256_set1_epi32(1));
+  emm2 = _mm256_and_si256(emm2, _mm256_set1_epi32(~1));
+  y = _mm256_cvtepi32_ps(emm2);
+
+  __m256i emm4 = emm2;
+
+  /* get the swap sign flag for the sine */
+  __m256i emm0 = _mm256_and_si256(emm2, _mm256_set1_epi32(4));
+  emm0 = _mm256_slli_epi32(emm0, 29);
+  const __m256 swap_sign_bit_sin = _mm256_castsi256_ps(emm0);
+
+  /* get the polynom selection mask for the sine*/
+  emm2 = _mm256_and_si256(emm2, _mm256_set1_epi32(2));
+  emm2 = _mm256_cmpeq_epi32(emm2, _mm256_setzero_si256());
+  const __m256 poly_mask = _mm256_castsi256_ps(emm2);
+
+  /* The magic pass: "Extended precision modular arithmetic"
+     x = ((x - y * DP1) - y * DP2) - y * DP3; */
+  x = MultiplyAdd(x, y, _mm256_set1_ps(-0.78515625f));
+  x = MultiplyAdd(x, y, _mm256_set1_ps(-2.4187564849853515625e-4f));
+  x = MultiplyAdd(x, y, _mm256_set1_ps(-3.77489497744594108e-8f));
+
+  emm4 = _mm256_sub_epi32(emm4, _mm256_set1_epi32(2));
+  emm4 = _mm256_andnot_si256(emm4, _mm256_set1_epi32(4));
+  emm4 = _mm256_slli_epi32(emm4, 29);
+  const __m256 sign_bit_cos = _mm256_castsi256_ps(emm4);
+
+  sign_bit_sin = _mm256_xor_ps(sign_bit_sin, swap_sign_bit_sin);
+
+  /* Evaluate the first polynom  (0 <= x <= Pi/4) */
+  const __m256 z = _mm256_mul_ps(x, x);
+  y = _mm256_set1_ps(2.443315711809948E-005f);
+  y = MultiplyAdd(_mm256_set1_ps(-1.388731625493765E-003f), y, z);
+  y = MultiplyAdd(_mm256_set1_ps(4.166664568298827E-002f), y, z);
+  y = _mm256_mul_ps(y, z);
+  y = _mm256_mul_ps(y, z);
+  y = _mm256_sub_ps(y, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+  y = _mm256_add_ps(y, _mm256_set1_ps(1.0f));
+
+  /* Evaluate the second polynom  (Pi/4 <= x <= 0) */
+  __m256 y2 = _mm256_set1_ps(-1.9515295891E-4f);
+  y2 = MultiplyAdd(_mm256_set1_ps(8.3321608736E-3f), y2, z);
+  y2 = MultiplyAdd(_mm256_set1_ps(-1.6666654611E-1f), y2, z);
+  y2 = _mm256_mul_ps(y2, z);
+  y2 = MultiplyAdd(x, y2, x);
+
+  /* select the correct result from the two polynoms */
+  const __m256 ysin = _mm256_blendv_ps(y, y2, poly_mask);
+  const __m256 ycos = _mm256_blendv_ps(y2, y, poly_mask);
+
+  /* update the sign */
+  *s = _mm256_xor_ps(ysin, sign_bit_sin);
+  *c = _mm256_xor_ps(ycos, sign_bit_cos);
+}
+
+inline __m256 sin_ps(__m256 x) {
+  __m256 ysin, ycos;
+  sincos_ps(x, &ysin, &ycos);
+  return ysin;
+}
+
+inline __m256 cos_ps(__m256 x) {
+  __m256 ysin, ycos;
+  sincos_ps(x, &ysin, &ycos);
+  return ycos;
+}
+
+// Reciprocal square root.
+// See the 128 bit version for the details.
+inline auto rsqrt_ps(const __m256& x) -> __m256 {
+  const __m256 r = _mm256_rsqrt_ps(x);
+  const __m256 half_x_r =
+      _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), x), r);
+  const __m256 refined = _mm256_mul_ps(
+      r, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(half_x_r, r)));
+
+  const __m256 is_special = _mm256_or_ps(
+      _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_EQ_OQ),
+      _mm256_cmp_ps(x,
+                    _mm256_set1_ps(std::numeric_limits<float>::infinity()),
+                    _CMP_EQ_OQ));
+  return _mm256_blendv_ps(refined, r, is_special);
+}
+
+#  endif  // ISA_CPU_X86_AVX2
+
+// =============================================================================
+// 512 bit registers.
+//
+// The arithmetic is done natively on 16 elements at a time. The polynomial
+// approximations are done on two 256 bit halves of the register.
+// =============================================================================
+
+#  if ISA_CPU_X86_AVX2 && ISA_CPU_X86_AVX512F
+
+// Get lower and upper 256 bit halves of the register.
+inline auto ExtractLow256(const __m512& value) -> __m256 {
+  return _mm512_castps512_ps256(value);
+}
+inline auto ExtractHigh256(const __m512& value) -> __m256 {
+  return _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(value), 1));
+}
+
+// Construct register from lower and upper 256 bit halves.
+inline auto Combine256(const __m256& low, const __m256& high) -> __m512 {
+  return _mm512_castpd_ps(
+      _mm512_insertf64x4(_mm512_castps_pd(_mm512_zextps256_ps512(low)),
+                         _mm256_castps_pd(high),
+                         1));
+}
+
+// Multiply-add to accumulator:
+//   RESULT[i] = a[i] + (b[i] * c[i]) for i = 0 to N
+inline auto MultiplyAdd(const __m512& a, const __m512& b, const __m512& c)
+    -> __m512 {
+  return _mm512_fmadd_ps(b, c, a);
+}
+
+// Sum of all elements:
+//  RESULT = a[0] + a[1] + ... + a[15]
+inline auto HorizontalSum(const __m512& value) -> float {
+  return HorizontalSum(
+      _mm256_add_ps(ExtractLow256(value), ExtractHigh256(value)));
+}
+
+inline auto ApproximateLog2(const __m512& x) -> __m512 {
+  return Combine256(ApproximateLog2(ExtractLow256(x)),
+                    ApproximateLog2(ExtractHigh256(x)));
+}
+
+inline auto exp_ps(const __m512& x) -> __m512 {
+  return Combine256(exp_ps(ExtractLow256(x)), exp_ps(ExtractHigh256(x)));
+}
+
+inline auto log_ps(const __m512& x) -> __m512 {
+  return Combine256(log_ps(ExtractLow256(x)), log_ps(ExtractHigh256(x)));
+}
+
+inline void sincos_ps(const __m512& x, __m512* s, __m512* c) {
+  __m256 s_low, c_low;
+  __m256 s_high, c_high;
+  sincos_ps(ExtractLow256(x), &s_low, &c_low);
+  sincos_ps(ExtractHigh256(x), &s_high, &c_high);
+  *s = Combine256(s_low, s_high);
+  *c = Combine256(c_low, c_high);
+}
+
+inline auto sin_ps(const __m512& x) -> __m512 {
+  return Combine256(sin_ps(ExtractLow256(x)), sin_ps(ExtractHigh256(x)));
+}
+
+inline auto cos_ps(const __m512& x) -> __m512 {
+  return Combine256(cos_ps(ExtractLow256(x)), cos_ps(ExtractHigh256(x)));
+}
+
+// Reciprocal square root.
+//
+// The 14 bit approximation of the _mm512_rsqrt14_ps() is refined with a single
+// Newton-Raphson step. See the 128 bit version for the details.
+inline auto rsqrt_ps(const __m512& x) -> __m512 {
+  const __m512 r = _mm512_rsqrt14_ps(x);
+  const __m512 half_x_r =
+      _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(0.5f), x), r);
+  const __m512 refined = _mm512_mul_ps(
+      r, _mm512_fnmadd_ps(half_x_r, r, _mm512_set1_ps(1.5f)));
+
+  const __m512 inf = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+  const __mmask16 is_special =
+      _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_EQ_OQ) |
+      _mm512_cmp_ps_mask(x, inf, _CMP_EQ_OQ);
+  return _mm512_mask_blend_ps(is_special, refined, r);
+}
+
+#  endif  // ISA_CPU_X86_AVX2 && ISA_CPU_X86_AVX512F
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::internal::x86
 
 #endif  // ARCH_CPU_X86_FAMILY
@@ -0,0 +1,194 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/math/uint16.h"
+
+#include <array>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core {
+
+namespace {
+
+const uint32_t kValues[16] = {
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+
+// Store all lanes of the value into an array for comparison.
+auto ToArray(const UInt16& value) -> std::array<uint32_t, 16> {
+  std::array<uint32_t, 16> result;
+  value.Store(result.data());
+  return result;
+}
+
+}  // namespace
+
+TEST(UInt16, Load) {
+  {
+    const UInt16 value = UInt16(kValues);
+    EXPECT_EQ(value.Extract<0>(), 2);
+    EXPECT_EQ(value.Extract<7>(), 9);
+    EXPECT_EQ(value.Extract<8>(), 10);
+    EXPECT_EQ(value.Extract<15>(), 17);
+  }
+
+  {
+    const UInt16 value =
+        UInt16(2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17);
+    EXPECT_EQ(ToArray(value), ToArray(UInt16(kValues)));
+  }
+
+  {
+    const UInt16 value = UInt16(2);
+    EXPECT_EQ(value.Extract<0>(), 2);
+    EXPECT_EQ(value.Extract<7>(), 2);
+    EXPECT_EQ(value.Extract<8>(), 2);
+    EXPECT_EQ(value.Extract<15>(), 2);
+  }
+
+  {
+    const UInt16 value = UInt16(UInt8(kValues), UInt8(kValues + 8));
+    EXPECT_EQ(ToArray(value), ToArray(UInt16(kValues)));
+  }
+}
+
+TEST(UInt16, Store) {
+  const UInt16 value = UInt16(kValues);
+
+  uint32_t data[16] = {0};
+  value.Store(data);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(data[i], kValues[i]);
+  }
+
+  uint32_t lane;
+
+  value.Store<0>(&lane);
+  EXPECT_EQ(lane, 2);
+
+  value.Store<9>(&lane);
+  EXPECT_EQ(lane, 11);
+
+  value.Store<15>(&lane);
+  EXPECT_EQ(lane, 17);
+}
+
+TEST(UInt16, Extract) {
+  const UInt16 value = UInt16(kValues);
+
+  EXPECT_EQ(value.Extract<0>(), 2);
+  EXPECT_EQ(value.Extract<1>(), 3);
+  EXPECT_EQ(value.Extract<2>(), 4);
+  EXPECT_EQ(value.Extract<3>(), 5);
+  EXPECT_EQ(value.Extract<4>(), 6);
+  EXPECT_EQ(value.Extract<5>(), 7);
+  EXPECT_EQ(value.Extract<6>(), 8);
+  EXPECT_EQ(value.Extract<7>(), 9);
+  EXPECT_EQ(value.Extract<8>(), 10);
+  EXPECT_EQ(value.Extract<9>(), 11);
+  EXPECT_EQ(value.Extract<10>(), 12);
+  EXPECT_EQ(value.Extract<11>(), 13);
+  EXPECT_EQ(value.Extract<12>(), 14);
+  EXPECT_EQ(value.Extract<13>(), 15);
+  EXPECT_EQ(value.Extract<14>(), 16);
+  EXPECT_EQ(value.Extract<15>(), 17);
+}
+
+TEST(UInt16, ExtractLow) {
+  const UInt8 low = UInt16(kValues).ExtractLow();
+
+  EXPECT_EQ(low.Extract<0>(), 2);
+  EXPECT_EQ(low.Extract<1>(), 3);
+  EXPECT_EQ(low.Extract<2>(), 4);
+  EXPECT_EQ(low.Extract<3>(), 5);
+  EXPECT_EQ(low.Extract<4>(), 6);
+  EXPECT_EQ(low.Extract<5>(), 7);
+  EXPECT_EQ(low.Extract<6>(), 8);
+  EXPECT_EQ(low.Extract<7>(), 9);
+}
+
+TEST(UInt16, ExtractHigh) {
+  const UInt8 high = UInt16(kValues).ExtractHigh();
+
+  EXPECT_EQ(high.Extract<0>(), 10);
+  EXPECT_EQ(high.Extract<1>(), 11);
+  EXPECT_EQ(high.Extract<2>(), 12);
+  EXPECT_EQ(high.Extract<3>(), 13);
+  EXPECT_EQ(high.Extract<4>(), 14);
+  EXPECT_EQ(high.Extract<5>(), 15);
+  EXPECT_EQ(high.Extract<6>(), 16);
+  EXPECT_EQ(high.Extract<7>(), 17);
+}
+
+TEST(UInt16, SetLane) {
+  const UInt16 value = UInt16(kValues);
+
+  EXPECT_EQ(ToArray(value.SetLane<0>(99)),
+            ToArray(UInt16(
+                99, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17)));
+  EXPECT_EQ(ToArray(value.SetLane<7>(99)),
+            ToArray(UInt16(
+                2, 3, 4, 5, 6, 7, 8, 99, 10, 11, 12, 13, 14, 15, 16, 17)));
+  EXPECT_EQ(ToArray(value.SetLane<8>(99)),
+            ToArray(UInt16(
+                2, 3, 4, 5, 6, 7, 8, 9, 99, 11, 12, 13, 14, 15, 16, 17)));
+  EXPECT_EQ(ToArray(value.SetLane<15>(99)),
+            ToArray(UInt16(
+                2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 99)));
+}
+
+TEST(UInt16, Min) {
+  EXPECT_EQ(ToArray(Min(UInt16(kValues), UInt16(8))),
+            ToArray(UInt16(2, 3, 4, 5, 6, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8)));
+}
+
+TEST(UInt16, Max) {
+  EXPECT_EQ(
+      ToArray(Max(UInt16(kValues), UInt16(8))),
+      ToArray(UInt16(
+          8, 8, 8, 8, 8, 8, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17)));
+}
+
+TEST(UInt16, HorizontalMax) {
+  uint32_t values[16];
+  for (int i = 0; i < 16; ++i) {
+    for (int j = 0; j < 16; ++j) {
+      values[j] = uint32_t(j);
+    }
+    values[i] = 99;
+    EXPECT_EQ(HorizontalMax(UInt16(values)), 99) << "i=" << i;
+  }
+}
+
+TEST(UInt16, Select) {
+  const UInt16 mask(0xffffffffu,
+                    0,
+                    0xffffffffu,
+                    0,
+                    0,
+                    0xffffffffu,
+                    0,
+                    0xffffffffu,
+                    0,
+                    0,
+                    0xffffffffu,
+                    0xffffffffu,
+                    0,
+                    0xffffffffu,
+                    0xffffffffu,
+                    0);
+  EXPECT_EQ(ToArray(Select(mask, UInt16(kValues), UInt16(1))),
+            ToArray(
+                UInt16(2, 1, 4, 1, 1, 7, 1, 9, 1, 1, 12, 13, 1, 15, 16, 1)));
+}
+
+TEST(UInt16, Reverse) {
+  EXPECT_EQ(
+      ToArray(Reverse(UInt16(kValues))),
+      ToArray(UInt16(
+          17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2)));
+}
+
+}  // namespace radio_core
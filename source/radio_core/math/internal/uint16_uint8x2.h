@@ -0,0 +1,165 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 16-element 32 bit integer values using 2 UInt8 scalars.
+// Relies on the SIMD optimization of the UInt8.
+
+#pragma once
+
+#include "radio_core/base/aligned_register.h"
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/uint8.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedIntTypeInfo;
+
+template <bool SpecializationMarker>
+struct VectorizedIntTypeInfo<uint32_t, 16, SpecializationMarker> {
+  using RegisterType = AlignedRegister<UInt8, 2, 64>;
+
+  static constexpr int kSize = 16;
+  static constexpr bool kIsVectorized = false;
+
+  static auto GetName() -> const char* { return "UInt8x2"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const uint32_t values[16]) -> RegisterType {
+    return {UInt8(values), UInt8(values + 8)};
+  }
+
+  static inline auto Load(const uint32_t a,
+                          const uint32_t b,
+                          const uint32_t c,
+                          const uint32_t d,
+                          const uint32_t e,
+                          const uint32_t f,
+                          const uint32_t g,
+                          const uint32_t h,
+                          const uint32_t i,
+                          const uint32_t j,
+                          const uint32_t k,
+                          const uint32_t l,
+                          const uint32_t m,
+                          const uint32_t n,
+                          const uint32_t o,
+                          const uint32_t p) -> RegisterType {
+    return {UInt8(a, b, c, d, e, f, g, h),
+            UInt8(i, j, k, l, m, n, o, p)};
+  }
+
+  static inline auto Load(const uint32_t value) -> RegisterType {
+    return {UInt8(value), UInt8(value)};
+  }
+
+  static inline auto Load(const UInt8::RegisterType& low,
+                          const UInt8::RegisterType& high) -> RegisterType {
+    return {low, high};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const RegisterType& value, uint32_t dst[16]) {
+    value[0].Store(dst);
+    value[1].Store(dst + 8);
+  }
+
+  template <int Index>
+  static inline void Store(const RegisterType& value, uint32_t* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      value[0].Store<Index>(dst);
+      return;
+    }
+
+    if constexpr (Index >= 8) {
+      value[1].Store<Index - 8>(dst);
+      return;
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const RegisterType& value) -> uint32_t {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      return value[0].Extract<Index>();
+    }
+
+    if constexpr (Index >= 8) {
+      return value[1].Extract<Index - 8>();
+    }
+  }
+
+  static inline auto ExtractLow(const RegisterType& value)
+      -> VectorizedIntType<uint32_t, 8> {
+    return value[0];
+  }
+
+  static inline auto ExtractHigh(const RegisterType& value)
+      -> VectorizedIntType<uint32_t, 8> {
+    return value[1];
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const RegisterType& value,
+                             const float new_lane_value) -> RegisterType {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      return {value[0].SetLane<Index>(new_lane_value), value[1]};
+    }
+
+    if constexpr (Index >= 8) {
+      return {value[0], value[1].SetLane<Index - 8>(new_lane_value)};
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto Min(const RegisterType& a, const RegisterType& b)
+      -> RegisterType {
+    return {radio_core::Min(a[0], b[0]), radio_core::Min(a[1], b[1])};
+  }
+
+  static inline auto Max(const RegisterType& a, const RegisterType& b)
+      -> RegisterType {
+    return {radio_core::Max(a[0], b[0]), radio_core::Max(a[1], b[1])};
+  }
+
+  static inline auto HorizontalMax(const RegisterType& value) -> uint32_t {
+    return radio_core::Max(radio_core::HorizontalMax(value[0]),
+                           radio_core::HorizontalMax(value[1]));
+  }
+
+  static inline auto Select(const RegisterType& mask,
+                            const RegisterType& source1,
+                            const RegisterType& source2) -> RegisterType {
+    return {radio_core::Select(ExtractLow(mask), source1[0], source2[0]),
+            radio_core::Select(ExtractHigh(mask), source1[1], source2[1])};
+  }
+
+  static inline auto Reverse(const RegisterType& value) -> RegisterType {
+    return {radio_core::Reverse(value[1]), radio_core::Reverse(value[0])};
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
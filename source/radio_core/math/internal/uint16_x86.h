@@ -0,0 +1,167 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 16-element 32 bit integer values using AVX-512 Foundation
+// CPU instruction set.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+
+#if ARCH_CPU_X86_FAMILY && ISA_CPU_X86_AVX2 && ISA_CPU_X86_AVX512F
+
+#  include "radio_core/math/internal/math_x86.h"
+#  include "radio_core/math/uint8.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedIntTypeInfo;
+
+template <>
+struct VectorizedIntTypeInfo<uint32_t, 16, true> {
+  using RegisterType = __m512i;
+
+  static constexpr int kSize = 16;
+  static constexpr bool kIsVectorized = true;
+
+  static auto GetName() -> const char* { return "X86"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const uint32_t values[16]) -> __m512i {
+    return _mm512_loadu_si512(values);
+  }
+
+  static inline auto Load(const uint32_t a,
+                          const uint32_t b,
+                          const uint32_t c,
+                          const uint32_t d,
+                          const uint32_t e,
+                          const uint32_t f,
+                          const uint32_t g,
+                          const uint32_t h,
+                          const uint32_t i,
+                          const uint32_t j,
+                          const uint32_t k,
+                          const uint32_t l,
+                          const uint32_t m,
+                          const uint32_t n,
+                          const uint32_t o,
+                          const uint32_t p) -> __m512i {
+    return _mm512_setr_epi32(int(a),
+                             int(b),
+                             int(c),
+                             int(d),
+                             int(e),
+                             int(f),
+                             int(g),
+                             int(h),
+                             int(i),
+                             int(j),
+                             int(k),
+                             int(l),
+                             int(m),
+                             int(n),
+                             int(o),
+                             int(p));
+  }
+
+  static inline auto Load(const uint32_t value) -> __m512i {
+    return _mm512_set1_epi32(int(value));
+  }
+
+  static inline auto Load(const UInt8::RegisterType& low,
+                          const UInt8::RegisterType& high) -> __m512i {
+    return _mm512_inserti64x4(_mm512_zextsi256_si512(low), high, 1);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const __m512i& value, uint32_t dst[16]) {
+    _mm512_storeu_si512(dst, value);
+  }
+
+  template <int Index>
+  static inline void Store(const __m512i& value, uint32_t* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    *dst = Extract<Index>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const __m512i& value) -> uint32_t {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    if constexpr (Index < 8) {
+      return UInt8::TypeInfo::Extract<Index>(_mm512_castsi512_si256(value));
+    } else {
+      return UInt8::TypeInfo::Extract<Index - 8>(
+          _mm512_extracti64x4_epi64(value, 1));
+    }
+  }
+
+  static inline auto ExtractLow(const __m512i& value) -> UInt8 {
+    return UInt8(_mm512_castsi512_si256(value));
+  }
+
+  static inline auto ExtractHigh(const __m512i& value) -> UInt8 {
+    return UInt8(_mm512_extracti64x4_epi64(value, 1));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const __m512i& value,
+                             const uint32_t new_lane_value) -> __m512i {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return _mm512_mask_set1_epi32(
+        value, __mmask16(1 << Index), int(new_lane_value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto Min(const __m512i& a, const __m512i& b) -> __m512i {
+    return _mm512_min_epu32(a, b);
+  }
+
+  static inline auto Max(const __m512i& a, const __m512i& b) -> __m512i {
+    return _mm512_max_epu32(a, b);
+  }
+
+  static inline auto HorizontalMax(const __m512i& value) -> uint32_t {
+    return UInt8::TypeInfo::HorizontalMax(_mm256_max_epu32(
+        _mm512_castsi512_si256(value), _mm512_extracti64x4_epi64(value, 1)));
+  }
+
+  static inline auto Select(const __m512i& mask,
+                            const __m512i& source1,
+                            const __m512i& source2) -> __m512i {
+    // Bitwise (mask & source1) | (~mask & source2).
+    return _mm512_ternarylogic_epi32(mask, source1, source2, 0xca);
+  }
+
+  static inline auto Reverse(const __m512i& value) -> __m512i {
+    return _mm512_permutexvar_epi32(
+        _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+        value);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
+
+#endif
@@ -14,6 +14,7 @@
 #  include "radio_core/math/internal/math_neon.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedIntTypeInfo;
@@ -123,6 +124,7 @@ struct VectorizedIntTypeInfo<uint32_t, 4, true> {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // ISA_CPU_ARM_NEON
@@ -14,14 +14,10 @@
 
 #  include "radio_core/math/internal/math_x86.h"
 
-namespace radio_core {
-
 static_assert(ISA_CPU_X86_SSE2, "SSE 2 is the required minimum");
 
-template <class T, int N, bool SpecializationMarker>
-struct VectorizedIntTypeInfo;
-
-namespace internal::x64 {
+namespace radio_core::internal::x64 {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // An implementation pf _mm_min_epi32() from SSE4.1 which falls back to an
 // emulation for SSE2.
@@ -49,7 +45,14 @@ inline auto mm_max_epi32(__m128i a, __m128i b) -> __m128i {
 #  endif
 }
 
-}  // namespace internal::x64
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core::internal::x64
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedIntTypeInfo;
 
 template <>
 struct VectorizedIntTypeInfo<uint32_t, 4, true> {
@@ -179,6 +182,7 @@ struct VectorizedIntTypeInfo<uint32_t, 4, true> {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif
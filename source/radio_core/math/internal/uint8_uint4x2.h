@@ -8,9 +8,11 @@
 #pragma once
 
 #include "radio_core/base/aligned_register.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/uint4.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedIntTypeInfo;
@@ -150,4 +152,5 @@ struct VectorizedIntTypeInfo<uint32_t, 8, SpecializationMarker> {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
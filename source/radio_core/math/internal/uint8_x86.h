@@ -0,0 +1,157 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of 8-element 32 bit integer values using AVX2 and above CPU
+// instruction set.
+
+#pragma once
+
+#include "radio_core/base/build_config.h"
+
+#if ARCH_CPU_X86_FAMILY && ISA_CPU_X86_AVX2
+
+#  include "radio_core/math/internal/math_x86.h"
+#  include "radio_core/math/uint4.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, int N, bool SpecializationMarker>
+struct VectorizedIntTypeInfo;
+
+template <>
+struct VectorizedIntTypeInfo<uint32_t, 8, true> {
+  using RegisterType = __m256i;
+
+  static constexpr int kSize = 8;
+  static constexpr bool kIsVectorized = true;
+
+  static auto GetName() -> const char* { return "X86"; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Helpers.
+
+  // Cast from memory pointer type to __m256i*.
+  static inline auto CastPtr(uint32_t* ptr) -> __m256i* {
+    return reinterpret_cast<__m256i*>(ptr);
+  }
+  static inline auto CastPtr(const uint32_t* ptr) -> const __m256i* {
+    return reinterpret_cast<const __m256i*>(ptr);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Load.
+
+  static inline auto Load(const uint32_t values[8]) -> __m256i {
+    return _mm256_loadu_si256(CastPtr(values));
+  }
+
+  static inline auto Load(const uint32_t a,
+                          const uint32_t b,
+                          const uint32_t c,
+                          const uint32_t d,
+                          const uint32_t e,
+                          const uint32_t f,
+                          const uint32_t g,
+                          const uint32_t h) -> __m256i {
+    return _mm256_setr_epi32(
+        int(a), int(b), int(c), int(d), int(e), int(f), int(g), int(h));
+  }
+
+  static inline auto Load(const uint32_t value) -> __m256i {
+    return _mm256_set1_epi32(int(value));
+  }
+
+  static inline auto Load(const UInt4::RegisterType& low,
+                          const UInt4::RegisterType& high) -> __m256i {
+    return _mm256_inserti128_si256(_mm256_zextsi128_si256(low), high, 1);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Store.
+
+  static inline void Store(const __m256i& value, uint32_t dst[8]) {
+    _mm256_storeu_si256(CastPtr(dst), value);
+  }
+
+  template <int Index>
+  static inline void Store(const __m256i& value, uint32_t* dst) {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    *dst = Extract<Index>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Extract.
+
+  template <int Index>
+  static inline auto Extract(const __m256i& value) -> uint32_t {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return uint32_t(_mm256_extract_epi32(value, Index));
+  }
+
+  static inline auto ExtractLow(const __m256i& value)
+      -> VectorizedIntType<uint32_t, 4> {
+    return VectorizedIntType<uint32_t, 4>(_mm256_castsi256_si128(value));
+  }
+
+  static inline auto ExtractHigh(const __m256i& value)
+      -> VectorizedIntType<uint32_t, 4> {
+    return VectorizedIntType<uint32_t, 4>(_mm256_extracti128_si256(value, 1));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Lane.
+
+  template <int Index>
+  static inline auto SetLane(const __m256i& value,
+                             const uint32_t new_lane_value) -> __m256i {
+    static_assert(Index >= 0);
+    static_assert(Index < kSize);
+
+    return _mm256_insert_epi32(value, int(new_lane_value), Index);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Non-class functions.
+
+  static inline auto Min(const __m256i& a, const __m256i& b) -> __m256i {
+    return _mm256_min_epu32(a, b);
+  }
+
+  static inline auto Max(const __m256i& a, const __m256i& b) -> __m256i {
+    return _mm256_max_epu32(a, b);
+  }
+
+  static inline auto HorizontalMax(const __m256i& value) -> uint32_t {
+    const __m128i max1 = _mm_max_epu32(_mm256_castsi256_si128(value),
+                                       _mm256_extracti128_si256(value, 1));
+    const __m128i max2 =
+        _mm_max_epu32(max1, _mm_shuffle_epi32(max1, _MM_SHUFFLE(0, 0, 3, 2)));
+    const __m128i max3 =
+        _mm_max_epu32(max2, _mm_shuffle_epi32(max2, _MM_SHUFFLE(0, 0, 0, 1)));
+    return uint32_t(_mm_cvtsi128_si32(max3));
+  }
+
+  static inline auto Select(const __m256i& mask,
+                            const __m256i& source1,
+                            const __m256i& source2) -> __m256i {
+    const __m256i bits_from_source1 = _mm256_and_si256(mask, source1);
+    const __m256i bits_from_source2 = _mm256_andnot_si256(mask, source2);
+    return _mm256_or_si256(bits_from_source1, bits_from_source2);
+  }
+
+  static inline auto Reverse(const __m256i& value) -> __m256i {
+    return _mm256_permutevar8x32_epi32(
+        value, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
+
+#endif
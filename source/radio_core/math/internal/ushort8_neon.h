@@ -16,6 +16,7 @@
 #  include <cstdint>
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedIntTypeInfo;
@@ -131,6 +132,7 @@ struct VectorizedIntTypeInfo<uint16_t, 8, true> {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
 
 #endif  // ISA_CPU_ARM_NEON
@@ -12,9 +12,11 @@
 #include <ostream>
 
 #include "radio_core/base/aligned_register.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/ushort4.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedIntTypeInfo;
@@ -138,4 +140,5 @@ struct VectorizedIntTypeInfo<uint16_t, 8, SpecializationMarker> {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -8,12 +8,14 @@
 #pragma once
 
 #include "radio_core/base/aligned_register.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/unroll.h"
 #include "radio_core/math/base_complex.h"
 #include "radio_core/math/vectorized_complex_type.h"
 #include "radio_core/math/vectorized_float_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N, bool SpecializationMarker>
 struct VectorizedComplexTypeInfo {
@@ -269,4 +271,5 @@ struct VectorizedComplexTypeInfo {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -0,0 +1,249 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Benchmark of the transcendental functions of the vectorized floating point
+// types.
+//
+// Compare the per-element calculation using the standard library with the
+// vectorized implementation:
+//
+//   ./radio_core_math_vectorized_float_math_benchmark exp libm
+//   ./radio_core_math_vectorized_float_math_benchmark exp vectorized
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "radio_core/benchmark/base_app.h"
+#include "radio_core/math/float16.h"
+#include "radio_core/math/math.h"
+
+namespace radio_core::benchmark {
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+class VectorizedFloatMathBenchmark : public Benchmark {
+ public:
+  using Benchmark::Benchmark;
+
+ protected:
+  auto GetBenchmarkName() -> std::string override {
+    return "VectorizedFloatType math";
+  }
+
+  void ConfigureParser(argparse::ArgumentParser& parser) override {
+    parser.add_argument("function").help(
+        "Function to benchmark: " + std::string(kSupportedFunctionsListString));
+
+    parser.add_argument("implementation")
+        .help("Implementation of the function: " +
+              std::string(kSupportedImplementationsListString));
+
+    parser.add_argument("--num-samples")
+        .default_value(65536)
+        .help("The number of samples to be processed in each iteration")
+        .scan<'i', int>();
+  }
+
+  auto HandleArguments(argparse::ArgumentParser& parser) -> bool override {
+    const auto function = parser.get<std::string>("function");
+    if (function == "sincos") {
+      function_ = Function::kSinCos;
+    } else if (function == "exp") {
+      function_ = Function::kExp;
+    } else if (function == "log") {
+      function_ = Function::kLog;
+    } else if (function == "sqrt") {
+      function_ = Function::kSqrt;
+    } else if (function == "rsqrt") {
+      function_ = Function::kRSqrt;
+    } else if (function == "atan2") {
+      function_ = Function::kArcTan2;
+    } else if (function == "pow") {
+      function_ = Function::kPow;
+    } else {
+      cerr << "Unknown function " << function << endl;
+      cerr << "Supported: " << kSupportedFunctionsListString << endl;
+      return false;
+    }
+
+    const auto implementation = parser.get<std::string>("implementation");
+    if (implementation == "libm") {
+      implementation_ = Implementation::kLibM;
+    } else if (implementation == "vectorized") {
+      implementation_ = Implementation::kVectorized;
+    } else {
+      cerr << "Unknown implementation " << implementation << endl;
+      cerr << "Supported: " << kSupportedImplementationsListString << endl;
+      return false;
+    }
+
+    num_samples_ = parser.get<int>("--num-samples");
+    if (num_samples_ <= 0 || num_samples_ % 16) {
+      cerr << "Number of samples is expected to be a positive multiple of 16"
+           << endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  void Initialize() override {
+    cout << endl;
+    cout << "Configuration" << endl;
+    cout << "=============" << endl;
+
+    cout << "Function             : " << GetFunctionName() << endl;
+    switch (implementation_) {
+      case Implementation::kLibM:
+        cout << "Implementation       : libm" << endl;
+        break;
+      case Implementation::kVectorized:
+        cout << "Implementation       : vectorized" << endl;
+        break;
+    }
+    cout << "Number of samples    : " << num_samples_ << endl;
+    cout << "Number of iterations : " << GetNumIterations() << endl;
+
+    a_.resize(num_samples_);
+    b_.resize(num_samples_);
+    result_.resize(num_samples_);
+    result2_.resize(num_samples_);
+
+    // Positive arguments are valid for all the benchmarked functions, and the
+    // range keeps the result of Exp() and Pow() finite.
+    std::random_device random_device;
+    std::mt19937 random_engine(random_device());
+    std::uniform_real_distribution<float> distribution(0.01f, 10.0f);
+    for (int i = 0; i < num_samples_; ++i) {
+      a_[i] = distribution(random_engine);
+      b_[i] = distribution(random_engine);
+    }
+  }
+
+  void Iteration() override {
+    switch (implementation_) {
+      case Implementation::kLibM: IterationLibM(); break;
+      case Implementation::kVectorized: IterationVectorized(); break;
+    }
+  }
+
+  void Finalize() override {
+    a_[0] += 0.001f;
+
+    // Sanity check and endurance that the evaluation is not optimized out.
+    bool has_non_finite = false;
+    for (int i = 0; i < num_samples_; ++i) {
+      if (!IsFinite(result_[i]) || !IsFinite(result2_[i])) {
+        has_non_finite = true;
+      }
+    }
+    if (has_non_finite) {
+      cerr << "Result has non-finite values" << endl;
+      ::exit(1);
+    }
+  }
+
+ private:
+  enum class Function {
+    kSinCos,
+    kExp,
+    kLog,
+    kSqrt,
+    kRSqrt,
+    kArcTan2,
+    kPow,
+  };
+
+  enum class Implementation {
+    kLibM,
+    kVectorized,
+  };
+
+  static constexpr std::string_view kSupportedFunctionsListString =
+      "sincos, exp, log, sqrt, rsqrt, atan2, pow";
+
+  static constexpr std::string_view kSupportedImplementationsListString =
+      "libm, vectorized";
+
+  auto GetFunctionName() const -> std::string_view {
+    switch (function_) {
+      case Function::kSinCos: return "sincos";
+      case Function::kExp: return "exp";
+      case Function::kLog: return "log";
+      case Function::kSqrt: return "sqrt";
+      case Function::kRSqrt: return "rsqrt";
+      case Function::kArcTan2: return "atan2";
+      case Function::kPow: return "pow";
+    }
+    return "";
+  }
+
+  void IterationLibM() {
+    for (int i = 0; i < num_samples_; ++i) {
+      const float a = a_[i];
+      const float b = b_[i];
+      switch (function_) {
+        case Function::kSinCos:
+          result_[i] = Sin(a);
+          result2_[i] = Cos(a);
+          break;
+        case Function::kExp: result_[i] = Exp(a); break;
+        case Function::kLog: result_[i] = Log(a); break;
+        case Function::kSqrt: result_[i] = Sqrt(a); break;
+        case Function::kRSqrt: result_[i] = 1.0f / Sqrt(a); break;
+        case Function::kArcTan2: result_[i] = ArcTan2(a, b); break;
+        case Function::kPow: result_[i] = Pow(a, b); break;
+      }
+    }
+  }
+
+  void IterationVectorized() {
+    for (int i = 0; i < num_samples_; i += 16) {
+      const Float16 a(a_.data() + i);
+      const Float16 b(b_.data() + i);
+      switch (function_) {
+        case Function::kSinCos: {
+          Float16 sin, cos;
+          SinCos(a, sin, cos);
+          sin.Store(result_.data() + i);
+          cos.Store(result2_.data() + i);
+          break;
+        }
+        case Function::kExp: Exp(a).Store(result_.data() + i); break;
+        case Function::kLog: Log(a).Store(result_.data() + i); break;
+        case Function::kSqrt: Sqrt(a).Store(result_.data() + i); break;
+        case Function::kRSqrt: RSqrt(a).Store(result_.data() + i); break;
+        case Function::kArcTan2:
+          ArcTan2(a, b).Store(result_.data() + i);
+          break;
+        case Function::kPow: Pow(a, b).Store(result_.data() + i); break;
+      }
+    }
+  }
+
+  Function function_{Function::kExp};
+  Implementation implementation_{Implementation::kVectorized};
+
+  int num_samples_{65536};
+
+  // Arguments of the function.
+  std::vector<float> a_;
+  std::vector<float> b_;
+
+  // Result of the function. The second result is only used by SinCos.
+  std::vector<float> result_;
+  std::vector<float> result2_;
+};
+
+}  // namespace radio_core::benchmark
+
+auto main(int argc, char** argv) -> int {
+  radio_core::benchmark::VectorizedFloatMathBenchmark app;
+  return app.Run(argc, argv);
+}
@@ -0,0 +1,190 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Accuracy of the transcendental functions of the vectorized floating point
+// types.
+//
+// The result is compared against the double precision implementation from the
+// standard library, and the error is checked to be within the bound which is
+// documented in the vectorized_float_type.h.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "radio_core/math/float16.h"
+#include "radio_core/math/float4.h"
+#include "radio_core/math/float8.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core {
+
+namespace {
+
+// Number of points at which every function is evaluated.
+constexpr int kNumPoints = 100000;
+
+// Distance between the actual and expected values, in the units of the last
+// place of the expected value rounded to the single precision.
+auto ULPDistance(const float actual, const double expected) -> double {
+  const float expected_float = float(expected);
+  const float magnitude = std::fabs(expected_float);
+  const float ulp =
+      std::nextafter(magnitude, std::numeric_limits<float>::infinity()) -
+      magnitude;
+  return std::fabs(double(actual) - expected) / double(ulp);
+}
+
+// Argument at the given point of a uniform grid over the [min, max] range.
+auto GridArgument(const int point, const double min, const double max)
+    -> float {
+  return float(min + (max - min) * point / (kNumPoints - 1));
+}
+
+// Argument at the given point of a grid with the logarithmic distribution
+// over the [2^min_exponent, 2^max_exponent] range.
+auto LogGridArgument(const int point,
+                     const int min_exponent,
+                     const int max_exponent) -> float {
+  const double exponent = GridArgument(point, min_exponent, max_exponent);
+  return float(std::exp2(exponent));
+}
+
+template <class VectorType>
+void TestExpAccuracy() {
+  double max_error = 0;
+  for (int i = 0; i < kNumPoints; ++i) {
+    const float arg = GridArgument(i, -87, 88);
+    const float actual = Exp(VectorType(arg)).template Extract<0>();
+    max_error = std::max(max_error, ULPDistance(actual, std::exp(double(arg))));
+  }
+  EXPECT_LE(max_error, 1.0);
+}
+
+template <class VectorType>
+void TestLogAccuracy() {
+  double max_error = 0;
+  for (int i = 0; i < kNumPoints; ++i) {
+    const float arg = LogGridArgument(i, -126, 127);
+    const float actual = Log(VectorType(arg)).template Extract<0>();
+    max_error = std::max(max_error, ULPDistance(actual, std::log(double(arg))));
+  }
+  EXPECT_LE(max_error, 1.0);
+
+  EXPECT_TRUE(std::isnan(Log(VectorType(0.0f)).template Extract<0>()));
+  EXPECT_TRUE(std::isnan(Log(VectorType(-1.0f)).template Extract<0>()));
+}
+
+template <class VectorType>
+void TestSqrtAccuracy() {
+  double max_error = 0;
+  for (int i = 0; i < kNumPoints; ++i) {
+    const float arg = LogGridArgument(i, -126, 127);
+    const float actual = Sqrt(VectorType(arg)).template Extract<0>();
+    max_error =
+        std::max(max_error, ULPDistance(actual, std::sqrt(double(arg))));
+  }
+  EXPECT_LE(max_error, 0.5);
+}
+
+template <class VectorType>
+void TestRSqrtAccuracy() {
+  double max_error = 0;
+  for (int i = 0; i < kNumPoints; ++i) {
+    const float arg = LogGridArgument(i, -126, 127);
+    const float actual = RSqrt(VectorType(arg)).template Extract<0>();
+    max_error =
+        std::max(max_error, ULPDistance(actual, 1 / std::sqrt(double(arg))));
+  }
+  EXPECT_LE(max_error, 4.0);
+}
+
+template <class VectorType>
+void TestArcTan2Accuracy() {
+  // Points on circles of different radii, so that all the octants and the
+  // reduced and non-reduced argument ranges are covered.
+  double max_error = 0;
+  for (int i = 0; i < kNumPoints; ++i) {
+    const double angle = GridArgument(i, -3.14159265, 3.14159265);
+    const double radius = std::exp2(i % 41 - 20);
+    const float y = float(std::sin(angle) * radius);
+    const float x = float(std::cos(angle) * radius);
+    const float actual =
+        ArcTan2(VectorType(y), VectorType(x)).template Extract<0>();
+    const double expected = std::atan2(double(y), double(x));
+    max_error = std::max(max_error, ULPDistance(actual, expected));
+  }
+  EXPECT_LE(max_error, 4.0);
+
+  EXPECT_EQ(ArcTan2(VectorType(0.0f), VectorType(0.0f)).template Extract<0>(),
+            0.0f);
+}
+
+template <class VectorType>
+void TestPowAccuracy() {
+  double max_error = 0;
+  for (int i = 0; i < kNumPoints; ++i) {
+    const float base = LogGridArgument(i, -30, 30);
+    const float exp = float((i % 321 - 160) * 0.25);
+    const double expected = std::pow(double(base), double(exp));
+    if (expected < std::exp2(-24) || expected > std::exp2(24)) {
+      continue;
+    }
+    const float actual =
+        Pow(VectorType(base), VectorType(exp)).template Extract<0>();
+    max_error = std::max(max_error, ULPDistance(actual, expected));
+  }
+  EXPECT_LE(max_error, 32.0);
+}
+
+template <class VectorType>
+void TestSinCosAccuracy() {
+  double max_error = 0;
+  for (int i = 0; i < kNumPoints; ++i) {
+    const float arg = GridArgument(i, -8192, 8192);
+    VectorType sin, cos;
+    SinCos(VectorType(arg), sin, cos);
+    const double actual_sin = sin.template Extract<0>();
+    const double actual_cos = cos.template Extract<0>();
+    max_error =
+        std::max(max_error, std::fabs(actual_sin - std::sin(double(arg))));
+    max_error =
+        std::max(max_error, std::fabs(actual_cos - std::cos(double(arg))));
+  }
+  EXPECT_LE(max_error, std::exp2(-23));
+}
+
+}  // namespace
+
+TEST(VectorizedFloatMath, Float4) {
+  TestExpAccuracy<Float4>();
+  TestLogAccuracy<Float4>();
+  TestSqrtAccuracy<Float4>();
+  TestRSqrtAccuracy<Float4>();
+  TestArcTan2Accuracy<Float4>();
+  TestPowAccuracy<Float4>();
+  TestSinCosAccuracy<Float4>();
+}
+
+TEST(VectorizedFloatMath, Float8) {
+  TestExpAccuracy<Float8>();
+  TestLogAccuracy<Float8>();
+  TestSqrtAccuracy<Float8>();
+  TestRSqrtAccuracy<Float8>();
+  TestArcTan2Accuracy<Float8>();
+  TestPowAccuracy<Float8>();
+  TestSinCosAccuracy<Float8>();
+}
+
+TEST(VectorizedFloatMath, Float16) {
+  TestExpAccuracy<Float16>();
+  TestLogAccuracy<Float16>();
+  TestSqrtAccuracy<Float16>();
+  TestRSqrtAccuracy<Float16>();
+  TestArcTan2Accuracy<Float16>();
+  TestPowAccuracy<Float16>();
+  TestSinCosAccuracy<Float16>();
+}
+
+}  // namespace radio_core
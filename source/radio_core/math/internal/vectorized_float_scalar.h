@@ -9,6 +9,7 @@
 
 #include "radio_core/base/algorithm.h"
 #include "radio_core/base/aligned_register.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/unroll.h"
 #include "radio_core/math/bitwise.h"
 #include "radio_core/math/internal/vectorized_type.h"
@@ -16,6 +17,7 @@
 #include "radio_core/math/vectorized_int_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N>
 class VectorizedFloatType;
@@ -312,6 +314,25 @@ struct VectorizedFloatTypeInfo {
     Unroll<N>([&](const auto i) { r[i] = radio_core::Exp(value[i]); });
     return r;
   }
+
+  static inline auto Log(const RegisterType& value) -> RegisterType {
+    RegisterType r;
+    Unroll<N>([&](const auto i) { r[i] = radio_core::Log(value[i]); });
+    return r;
+  }
+
+  static inline auto Sqrt(const RegisterType& value) -> RegisterType {
+    RegisterType r;
+    Unroll<N>([&](const auto i) { r[i] = radio_core::Sqrt(value[i]); });
+    return r;
+  }
+
+  static inline auto RSqrt(const RegisterType& value) -> RegisterType {
+    RegisterType r;
+    Unroll<N>([&](const auto i) { r[i] = T(1) / radio_core::Sqrt(value[i]); });
+    return r;
+  }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
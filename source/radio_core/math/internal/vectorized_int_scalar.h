@@ -13,11 +13,13 @@
 
 #include "radio_core/base/algorithm.h"
 #include "radio_core/base/aligned_register.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/unroll.h"
 #include "radio_core/math/bitwise.h"
 #include "radio_core/math/internal/vectorized_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, int N>
 class VectorizedIntType;
@@ -159,4 +161,5 @@ struct VectorizedIntTypeInfo {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -9,7 +9,10 @@
 #include <ostream>
 #include <utility>
 
+#include "radio_core/base/build_config.h"
+
 namespace radio_core::vectorized_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class VectorizedType, std::size_t... I>
 void PrintImpl(std::ostream& os,
@@ -33,4 +36,5 @@ constexpr auto HasLowAndHighParts() -> bool {
   return (N >= 4) && ((N & (N - 1)) == 0);
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::vectorized_internal
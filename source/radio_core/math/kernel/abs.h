@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/kernel/internal/abs_vectorized.h"
@@ -17,6 +18,7 @@
 #include "radio_core/math/kernel/internal/abs_neon.h"
 
 namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // The output buffer must have at least same number of elements as the input
 // samples buffer. It is possible to have the output buffer bigger than input
@@ -58,4 +60,5 @@ inline auto Abs(const std::span<const HalfComplex>& samples,
 
 #endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel
@@ -0,0 +1,104 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Kernels with the implementation chosen at runtime based on the instruction
+// sets supported by the CPU.
+//
+// The kernels from the math/kernel are compiled for the instruction sets
+// enabled by the compiler flags. This works well when the program is built
+// for the machine it runs on, but a package distributed to a fleet of machines
+// has to be compiled for the lowest common denominator.
+//
+// The kernels from this file are compiled for multiple instruction sets (on
+// x86: the baseline SSE2, SSE4.1, AVX2 with FMA, and AVX-512), and the best
+// variant supported by the CPU is chosen on the first use of any of the
+// kernels. The functions have the same semantic as the corresponding kernels
+// from math/kernel.
+//
+// The variants are only available when the radio_core_math_kernel_dispatch
+// library is compiled for x86 with GCC or Clang. On other configurations the
+// only variant is the one compiled for the baseline instruction set.
+//
+// When the WITH_KERNEL_DISPATCH is enabled in the build configuration, the
+// kernels from math/kernel which have a variant in this file (for example,
+// kernel::Dot() of float and Complex samples) call the dispatched
+// implementation, so that all the signal processing benefits from it. This is
+// intended for the builds for the baseline instruction set: when the code is
+// compiled for the CPU it runs on the dispatch only adds an indirect call.
+//
+// The code of every variant is compiled in its own RADIO_CORE_ISA_NAMESPACE,
+// and the variants only share the raw pointer interface of the kernel table.
+//
+// Example:
+//
+//   const float dot = kernel::dispatch::Dot(f, g);
+//
+//   std::cout << "Using " << kernel::dispatch::GetVariantName() << " kernels"
+//             << std::endl;
+
+#pragma once
+
+#include <span>
+
+#include "radio_core/math/complex.h"
+#include "radio_core/math/kernel/internal/dispatch_table.h"
+
+namespace radio_core::kernel::dispatch {
+
+// Get variant of the kernels which is used by the dispatched kernels.
+auto GetVariant() -> Variant;
+
+// Get human readable name of the variant.
+auto GetVariantName(Variant variant) -> const char*;
+
+// Get human readable name of the variant which is used by the dispatched
+// kernels.
+inline auto GetVariantName() -> const char* {
+  return GetVariantName(GetVariant());
+}
+
+// See kernel::Dot().
+auto Dot(std::span<const float> f, std::span<const float> g) -> float;
+auto Dot(std::span<const Complex> f, std::span<const float> g) -> Complex;
+
+// See kernel::experimental::DotFlipG().
+auto DotFlipG(std::span<const float> f, std::span<const float> g) -> float;
+auto DotFlipG(std::span<const Complex> f, std::span<const float> g)
+    -> Complex;
+
+// See kernel::Rotator().
+auto Rotator(std::span<const Complex> samples,
+             Complex& phase,
+             Complex phase_increment_per_sample,
+             std::span<Complex> output) -> std::span<Complex>;
+
+// See kernel::FastArg().
+auto FastArg(std::span<const Complex> samples, std::span<float> arg)
+    -> std::span<float>;
+
+// See kernel::FastAbs().
+auto FastAbs(std::span<const Complex> samples,
+             std::span<float> absolute_values) -> std::span<float>;
+
+// See kernel::Norm().
+auto Norm(std::span<const Complex> samples, std::span<float> norm)
+    -> std::span<float>;
+
+// See kernel::PowerSpectralDensity().
+auto PowerSpectralDensity(std::span<const Complex> samples,
+                          std::span<float> power) -> std::span<float>;
+
+// See kernel::HorizontalMax().
+auto HorizontalMax(std::span<const float> samples) -> float;
+
+// See kernel::HorizontalSum().
+auto HorizontalSum(std::span<const float> samples) -> float;
+
+// See kernel::PerPointLerpPeakDetector().
+auto PerPointLerpPeakDetector(std::span<const float> samples,
+                              std::span<float> peak,
+                              float charge_rate,
+                              float discharge_rate) -> std::span<float>;
+
+}  // namespace radio_core::kernel::dispatch
@@ -16,6 +16,7 @@
 #include <span>
 #include <utility>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/kernel/internal/dot_vectorized.h"
@@ -26,7 +27,12 @@
 
 #include "radio_core/math/kernel/internal/dot_neon.h"
 
+#if defined(WITH_KERNEL_DISPATCH)
+#  include "radio_core/math/kernel/dispatch.h"
+#endif
+
 namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class FType,
           class GType,
@@ -50,14 +56,29 @@ inline auto Dot(const std::span<const FType>& f,
 template <>
 inline auto Dot(const std::span<const float>& f,
                 const std::span<const float>& g) -> float {
+#if defined(WITH_KERNEL_DISPATCH)
+  return dispatch::Dot(f, g);
+#else
   return dot_internal::Kernel<float, float, true>::Execute(f, g);
+#endif
 }
 
 // Specialization for dot product between Complex and float arguments.
 template <>
 inline auto Dot(const std::span<const Complex>& f,
                 const std::span<const float>& g) -> Complex {
+#if defined(WITH_KERNEL_DISPATCH)
+  return dispatch::Dot(f, g);
+#else
   return dot_internal::Kernel<Complex, float, true>::Execute(f, g);
+#endif
+}
+
+// Specialization for dot product between Complex and Complex arguments.
+template <>
+inline auto Dot(const std::span<const Complex>& f,
+                const std::span<const Complex>& g) -> Complex {
+  return dot_internal::Kernel<Complex, Complex, true>::Execute(f, g);
 }
 
 #if RADIO_CORE_HAVE_HALF
@@ -76,6 +97,15 @@ inline auto Dot(const std::span<const HalfComplex>& f,
   return dot_internal::Kernel<HalfComplex, Half, true>::Execute(f, g);
 }
 
+// Specialization for dot product between HalfComplex and HalfComplex
+// arguments.
+template <>
+inline auto Dot(const std::span<const HalfComplex>& f,
+                const std::span<const HalfComplex>& g) -> HalfComplex {
+  return dot_internal::Kernel<HalfComplex, HalfComplex, true>::Execute(f, g);
+}
+
 #endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel
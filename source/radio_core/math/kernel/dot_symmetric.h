@@ -0,0 +1,149 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Calculate dot-product of a signal and a symmetric or antisymmetric kernel.
+//
+// Kernels of linear-phase FIR filters are symmetric (g[i] == g[N - 1 - i]) or
+// antisymmetric (g[i] == -g[N - 1 - i]). This allows to add (or subtract) the
+// mirrored samples of the signal prior to the multiplication with the kernel,
+// halving the number of multiplications:
+//
+//   sum(f[i] * g[i]) == sum((f[i] + f[N - 1 - i]) * g[i]) for i < N / 2
+//                       + f[N / 2] * g[N / 2] if N is odd
+//
+// Only the first half of the kernel (including the central element) is
+// accessed, the rest of it is assumed to follow the symmetry.
+//
+// Since flipping of a symmetric kernel is a no-op, the same functions can be
+// used instead of both Dot() and DotFlipG(). For the antisymmetric kernels the
+// DotFlipG() equals to the negated DotAntisymmetricG().
+//
+// NOTE: A bit of a niche use-case, so it is marked as an experimental API.
+
+#pragma once
+
+#include <cassert>
+#include <span>
+#include <utility>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/base/half.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/kernel/internal/dot_symmetric_vectorized.h"
+
+#if RADIO_CORE_HAVE_HALF
+#  include "radio_core/math/half_complex.h"
+#endif
+
+namespace radio_core::kernel::experimental {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+// Equivalent of `numpy.dot(f, g)` for a symmetric g.
+template <class FType,
+          class GType,
+          class OutputType = decltype(std::declval<FType>() *
+                                      std::declval<GType>())>
+inline auto DotSymmetricG(const std::span<const FType>& f,
+                          const std::span<const GType>& g) -> OutputType {
+  assert(f.size() == g.size());
+  const size_t num_samples = f.size();
+  const size_t half_num_samples = num_samples / 2;
+
+  OutputType output(0);
+
+  for (size_t i = 0, j = num_samples - 1; i < half_num_samples; ++i, --j) {
+    output += (f[i] + f[j]) * g[i];
+  }
+
+  if (num_samples & 1) {
+    output += f[half_num_samples] * g[half_num_samples];
+  }
+
+  return output;
+}
+
+// Equivalent of `numpy.dot(f, g)` for an antisymmetric g.
+//
+// The central element of an antisymmetric kernel of an odd size is zero, so it
+// is not accessed.
+template <class FType,
+          class GType,
+          class OutputType = decltype(std::declval<FType>() *
+                                      std::declval<GType>())>
+inline auto DotAntisymmetricG(const std::span<const FType>& f,
+                              const std::span<const GType>& g) -> OutputType {
+  assert(f.size() == g.size());
+  const size_t num_samples = f.size();
+  const size_t half_num_samples = num_samples / 2;
+
+  OutputType output(0);
+
+  for (size_t i = 0, j = num_samples - 1; i < half_num_samples; ++i, --j) {
+    output += (f[i] - f[j]) * g[i];
+  }
+
+  return output;
+}
+
+// Specializations for float and float arguments.
+template <>
+inline auto DotSymmetricG(const std::span<const float>& f,
+                          const std::span<const float>& g) -> float {
+  return dot_symmetric_internal::Kernel<float, float, false, true>::Execute(f,
+                                                                           g);
+}
+template <>
+inline auto DotAntisymmetricG(const std::span<const float>& f,
+                              const std::span<const float>& g) -> float {
+  return dot_symmetric_internal::Kernel<float, float, true, true>::Execute(f,
+                                                                          g);
+}
+
+// Specializations for Complex and float arguments.
+template <>
+inline auto DotSymmetricG(const std::span<const Complex>& f,
+                          const std::span<const float>& g) -> Complex {
+  return dot_symmetric_internal::Kernel<Complex, float, false, true>::Execute(
+      f, g);
+}
+template <>
+inline auto DotAntisymmetricG(const std::span<const Complex>& f,
+                              const std::span<const float>& g) -> Complex {
+  return dot_symmetric_internal::Kernel<Complex, float, true, true>::Execute(
+      f, g);
+}
+
+#if RADIO_CORE_HAVE_HALF
+
+// Specializations for Half and Half arguments.
+template <>
+inline auto DotSymmetricG(const std::span<const Half>& f,
+                          const std::span<const Half>& g) -> Half {
+  return dot_symmetric_internal::Kernel<Half, Half, false, true>::Execute(f,
+                                                                         g);
+}
+template <>
+inline auto DotAntisymmetricG(const std::span<const Half>& f,
+                              const std::span<const Half>& g) -> Half {
+  return dot_symmetric_internal::Kernel<Half, Half, true, true>::Execute(f, g);
+}
+
+// Specializations for HalfComplex and Half arguments.
+template <>
+inline auto DotSymmetricG(const std::span<const HalfComplex>& f,
+                          const std::span<const Half>& g) -> HalfComplex {
+  return dot_symmetric_internal::Kernel<HalfComplex, Half, false, true>::
+      Execute(f, g);
+}
+template <>
+inline auto DotAntisymmetricG(const std::span<const HalfComplex>& f,
+                              const std::span<const Half>& g) -> HalfComplex {
+  return dot_symmetric_internal::Kernel<HalfComplex, Half, true, true>::
+      Execute(f, g);
+}
+
+#endif  // RADIO_CORE_HAVE_HALF
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core::kernel::experimental
@@ -0,0 +1,76 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Automatic gain control which uses exponential moving average of the signal
+// magnitude as the normalization factor.
+//
+// This is a block-based kernel of the signal::EMAAGC.
+
+#pragma once
+
+#include <cassert>
+#include <span>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/kernel/internal/ema_agc_vectorized.h"
+#include "radio_core/math/math.h"
+
+namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+// Normalize samples by the exponential moving average of their magnitude:
+//
+//   for i in range(len(input_samples)):
+//     abs_sample = Abs(input_samples[i])
+//     rate = charge_rate if abs_sample > charge else discharge_rate
+//     charge = Lerp(charge, abs_sample, rate)
+//     output_samples[i] = input_samples[i] / charge if charge != 0 else 0
+//
+// The charge is updated to the value after the last sample, which allows to
+// continue the processing on the next block of samples.
+//
+// The input and output buffers are allowed to be the same.
+//
+// The output buffer must have at least same number of elements as the input
+// samples buffer. Returns subspan of the output buffer where values has
+// actually been written.
+template <class T>
+inline auto EMAAGC(const std::span<const T> input_samples,
+                   const std::span<T> output_samples,
+                   const T charge_rate,
+                   const T discharge_rate,
+                   T& charge) -> std::span<T> {
+  assert(input_samples.size() <= output_samples.size());
+
+  const size_t num_samples = input_samples.size();
+
+  for (size_t i = 0; i < num_samples; ++i) {
+    const T sample = input_samples[i];
+    const T abs_sample = Abs(sample);
+
+    if (abs_sample > charge) {
+      charge = Lerp(charge, abs_sample, charge_rate);
+    } else {
+      charge = Lerp(charge, abs_sample, discharge_rate);
+    }
+
+    output_samples[i] = (charge == 0) ? T(0) : sample / charge;
+  }
+
+  return output_samples.subspan(0, num_samples);
+}
+
+// Vectorized and optimized version of EMAAGC<float>.
+template <>
+inline auto EMAAGC(const std::span<const float> input_samples,
+                   const std::span<float> output_samples,
+                   const float charge_rate,
+                   const float discharge_rate,
+                   float& charge) -> std::span<float> {
+  return ema_agc_internal::Kernel<float, true>::Execute(
+      input_samples, output_samples, charge_rate, discharge_rate, charge);
+}
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core::kernel
@@ -10,6 +10,7 @@
 
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/kernel/internal/fast_abs_vectorized.h"
@@ -20,7 +21,12 @@
 
 #include "radio_core/math/kernel/internal/fast_abs_neon.h"
 
+#if defined(WITH_KERNEL_DISPATCH)
+#  include "radio_core/math/kernel/dispatch.h"
+#endif
+
 namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // The output buffer must have at least same number of elements as the input
 // samples buffer. It is possible to have the output buffer bigger than input
@@ -48,8 +54,12 @@ template <>
 inline auto FastAbs(const std::span<const Complex>& samples,
                     const std::span<float>& absolute_values)
     -> std::span<float> {
+#if defined(WITH_KERNEL_DISPATCH)
+  return dispatch::FastAbs(samples, absolute_values);
+#else
   return fast_abs_internal::Kernel<Complex, true>::Execute(samples,
                                                            absolute_values);
+#endif
 }
 
 #if RADIO_CORE_HAVE_HALF
@@ -64,4 +74,5 @@ inline auto FastAbs(const std::span<const HalfComplex>& samples,
 
 #endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel
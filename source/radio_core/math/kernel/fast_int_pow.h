@@ -13,6 +13,7 @@
 
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/kernel/internal/fast_int_pow_vectorized.h"
@@ -23,6 +24,7 @@
 #endif
 
 namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // The output buffer must have at least same number of elements as the input
 // samples buffer. It is possible to have the output buffer bigger than input
@@ -73,4 +75,5 @@ inline auto FastIntPow(const std::span<const HalfComplex>& base,
 }
 #endif
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel
@@ -0,0 +1,130 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Frequency discriminator: calculates the instantaneous frequency of a complex
+// signal.
+//
+// The instantaneous frequency is calculated as the phase angle of the product
+// of the sample and the complex conjugate of the previous sample:
+//
+//   arg(x[n] * conj(x[n - 1])) == arg(x[n]) - arg(x[n - 1])
+//
+// Unlike the difference of the phase angles of individual samples the result
+// is always within the (-pi, pi] range and does not need to be unwrapped. This
+// allows to calculate it for multiple samples at once.
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <span>
+
+#include "radio_core/base/algorithm.h"
+#include "radio_core/base/build_config.h"
+#include "radio_core/base/half.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/kernel/internal/fm_discriminator_vectorized.h"
+
+#if RADIO_CORE_HAVE_HALF
+#  include "radio_core/math/half_complex.h"
+#endif
+
+namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+// Calculate instantaneous frequency of the input samples, scaled by the given
+// gain:
+//
+//   for i in range(len(input_samples)):
+//     output_samples[i] = FastArg(input_samples[i] * Conj(prev_sample)) * gain
+//     prev_sample = input_samples[i]
+//
+// The prev_sample is updated to the last input sample, which allows to continue
+// the processing on the next block of samples.
+//
+// The output buffer must have at least same number of elements as the input
+// samples buffer. Returns subspan of the output buffer where values has
+// actually been written.
+template <class T>
+inline auto FMDiscriminator(const std::span<const BaseComplex<T>> input_samples,
+                            const std::span<T> output_samples,
+                            const T gain,
+                            BaseComplex<T>& prev_sample) -> std::span<T> {
+  assert(input_samples.size() <= output_samples.size());
+
+  const size_t num_samples = input_samples.size();
+
+  for (size_t i = 0; i < num_samples; ++i) {
+    const BaseComplex<T> sample = input_samples[i];
+
+    output_samples[i] = FastArg(sample * Conj(prev_sample)) * gain;
+
+    prev_sample = sample;
+  }
+
+  return output_samples.subspan(0, num_samples);
+}
+
+// Specialization for single floating point precision complex values.
+template <>
+inline auto FMDiscriminator(const std::span<const Complex> input_samples,
+                            const std::span<float> output_samples,
+                            const float gain,
+                            Complex& prev_sample) -> std::span<float> {
+  return fm_discriminator_internal::Kernel<float, true>::Execute(
+      input_samples, output_samples, gain, prev_sample);
+}
+
+#if RADIO_CORE_HAVE_HALF
+// Specialization for half floating point precision complex values.
+//
+// The product of the samples and the phase angle are calculated in the single
+// floating point precision: for the typical magnitudes of the IQ samples the
+// product is below the normal range of the half precision values, and the
+// precision of the phase angle is lost.
+template <>
+inline auto FMDiscriminator(const std::span<const HalfComplex> input_samples,
+                            const std::span<Half> output_samples,
+                            const Half gain,
+                            HalfComplex& prev_sample) -> std::span<Half> {
+  assert(input_samples.size() <= output_samples.size());
+
+  // Convert the samples to the single precision in chunks which fit into the
+  // stack.
+  constexpr size_t kChunkSize = 256;
+  std::array<Complex, kChunkSize> chunk_samples;
+  std::array<float, kChunkSize> chunk_frequencies;
+
+  const size_t num_samples = input_samples.size();
+
+  Complex chunk_prev_sample(float(prev_sample.real), float(prev_sample.imag));
+  for (size_t offset = 0; offset < num_samples; offset += kChunkSize) {
+    const size_t chunk_size = Min(kChunkSize, num_samples - offset);
+
+    for (size_t i = 0; i < chunk_size; ++i) {
+      const HalfComplex sample = input_samples[offset + i];
+      chunk_samples[i] = Complex(float(sample.real), float(sample.imag));
+    }
+
+    fm_discriminator_internal::Kernel<float, true>::Execute(
+        std::span<const Complex>(chunk_samples).subspan(0, chunk_size),
+        std::span<float>(chunk_frequencies).subspan(0, chunk_size),
+        float(gain),
+        chunk_prev_sample);
+
+    for (size_t i = 0; i < chunk_size; ++i) {
+      output_samples[offset + i] = Half(chunk_frequencies[i]);
+    }
+  }
+
+  if (num_samples != 0) {
+    prev_sample = input_samples.back();
+  }
+
+  return output_samples.subspan(0, num_samples);
+}
+#endif
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core::kernel
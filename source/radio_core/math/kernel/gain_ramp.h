@@ -0,0 +1,69 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Multiplication of samples by a linearly increasing gain.
+
+#pragma once
+
+#include <cassert>
+#include <span>
+
+#include "radio_core/base/algorithm.h"
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/kernel/internal/gain_ramp_vectorized.h"
+#include "radio_core/math/math.h"
+
+namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+// Multiply samples by a gain which increases by the given increment after
+// every sample, until it reaches the maximum gain:
+//
+//   for i in range(len(input_samples)):
+//     output_samples[i] = input_samples[i] * gain
+//     gain = Min(max_gain, gain + gain_increment)
+//
+// The gain is updated to the value to be used for the next sample, which
+// allows to continue the ramp on the next block of samples.
+//
+// The gain increment is expected to be non-negative, and the initial gain is
+// expected to not exceed the maximum gain.
+//
+// The input and output buffers are allowed to be the same.
+//
+// The output buffer must have at least same number of elements as the input
+// samples buffer. Returns subspan of the output buffer where values has
+// actually been written.
+template <class T>
+inline auto GainRamp(const std::span<const T> input_samples,
+                     const std::span<T> output_samples,
+                     T& gain,
+                     const T gain_increment,
+                     const T max_gain) -> std::span<T> {
+  assert(input_samples.size() <= output_samples.size());
+  assert(gain_increment >= 0);
+
+  const size_t num_samples = input_samples.size();
+
+  for (size_t i = 0; i < num_samples; ++i) {
+    output_samples[i] = input_samples[i] * gain;
+    gain = Min(max_gain, gain + gain_increment);
+  }
+
+  return output_samples.subspan(0, num_samples);
+}
+
+// Vectorized and optimized version of GainRamp<float>.
+template <>
+inline auto GainRamp(const std::span<const float> input_samples,
+                     const std::span<float> output_samples,
+                     float& gain,
+                     const float gain_increment,
+                     const float max_gain) -> std::span<float> {
+  return gain_ramp_internal::Kernel<float, true>::Execute(
+      input_samples, output_samples, gain, gain_increment, max_gain);
+}
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core::kernel
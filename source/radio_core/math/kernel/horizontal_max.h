@@ -12,12 +12,18 @@
 #include <span>
 
 #include "radio_core/base/algorithm.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 #include "radio_core/math/kernel/internal/horizontal_max_vectorized.h"
 
 #include "radio_core/math/kernel/internal/horizontal_max_neon.h"
 
+#if defined(WITH_KERNEL_DISPATCH)
+#  include "radio_core/math/kernel/dispatch.h"
+#endif
+
 namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T>
 inline auto HorizontalMax(const std::span<const T> samples) -> T {
@@ -39,7 +45,11 @@ inline auto HorizontalMax(const std::span<const T> samples) -> T {
 // Specialization for the single precision floating point samples.
 template <>
 inline auto HorizontalMax(const std::span<const float> samples) -> float {
+#if defined(WITH_KERNEL_DISPATCH)
+  return dispatch::HorizontalMax(samples);
+#else
   return horizontal_max_internal::Kernel<float, true>::Execute(samples);
+#endif
 }
 
 #if RADIO_CORE_HAVE_HALF
@@ -52,4 +62,5 @@ inline auto HorizontalMax(const std::span<const Half> samples) -> Half {
 
 #endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel
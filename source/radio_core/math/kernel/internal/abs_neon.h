@@ -26,6 +26,7 @@
 #  endif
 
 namespace radio_core::kernel::abs_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, bool SpecializationMarker>
 struct Kernel;
@@ -144,6 +145,7 @@ struct Kernel<HalfComplex, HalfComplex8::kIsVectorized> {
 
 #  endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::abs_internal
 
 #endif  // ISA_CPU_ARM_NEON
@@ -11,10 +11,12 @@
 #include <cassert>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/kernel/internal/kernel_common.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core::kernel::abs_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, bool SpecializationMarker>
 struct Kernel {
@@ -93,4 +95,5 @@ struct Kernel {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::abs_internal
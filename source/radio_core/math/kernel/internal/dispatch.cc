@@ -0,0 +1,279 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/math/kernel/dispatch.h"
+
+#include <cassert>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/base/cpu_features.h"
+#include "radio_core/math/kernel/internal/dispatch_kernels.h"
+#include "radio_core/math/kernel/internal/dispatch_table.h"
+
+namespace radio_core::kernel {
+
+namespace dispatch_internal {
+namespace {
+
+// Variant which corresponds to the instruction sets enabled by the compiler
+// flags of this translation unit.
+constexpr auto GetBaselineVariant() -> dispatch::Variant {
+#if ARCH_CPU_X86_FAMILY
+  if (ISA_CPU_X86_AVX512F && ISA_CPU_X86_AVX2 && ISA_CPU_X86_FMA) {
+    return dispatch::Variant::kAVX512;
+  }
+  if (ISA_CPU_X86_AVX2 && ISA_CPU_X86_FMA) {
+    return dispatch::Variant::kAVX2;
+  }
+  if (ISA_CPU_X86_SSE4_1) {
+    return dispatch::Variant::kSSE4_1;
+  }
+  if (ISA_CPU_X86_SSE2) {
+    return dispatch::Variant::kSSE2;
+  }
+#elif ARCH_CPU_ARM_FAMILY
+  if (ISA_CPU_ARM_NEON) {
+    return dispatch::Variant::kNEON;
+  }
+#endif
+  return dispatch::Variant::kGeneric;
+}
+
+// Kernels compiled with the compiler flags of this translation unit.
+constexpr KernelTable kBaselineKernelTable =
+    MakeKernelTable<Kernels>(GetBaselineVariant());
+
+// Check whether the CPU supports instructions needed for the variant.
+auto IsVariantSupportedByCPU(const dispatch::Variant variant) -> bool {
+  const CPUFeatures& cpu = GetCPUFeatures();
+
+  switch (variant) {
+    case dispatch::Variant::kGeneric: return true;
+    case dispatch::Variant::kNEON: return ARCH_CPU_ARM_FAMILY;
+    case dispatch::Variant::kSSE2: return cpu.sse2;
+    case dispatch::Variant::kSSE4_1: return cpu.sse2 && cpu.sse4_1;
+    case dispatch::Variant::kAVX2: return cpu.avx2 && cpu.fma;
+    case dispatch::Variant::kAVX512:
+      return cpu.avx2 && cpu.fma && cpu.avx512f;
+  }
+
+  return false;
+}
+
+// Get table compiled for the given variant, regardless of whether the CPU
+// supports it or not.
+auto GetCompiledKernelTable(const dispatch::Variant variant)
+    -> const KernelTable* {
+  if (variant == kBaselineKernelTable.variant) {
+    return &kBaselineKernelTable;
+  }
+
+#if defined(RADIO_CORE_KERNEL_DISPATCH_X86)
+  if (variant == dispatch::Variant::kSSE4_1) {
+    return &kSSE4_1KernelTable;
+  }
+  if (variant == dispatch::Variant::kAVX2) {
+    return &kAVX2KernelTable;
+  }
+  if (variant == dispatch::Variant::kAVX512) {
+    return &kAVX512KernelTable;
+  }
+#endif
+
+  return nullptr;
+}
+
+// Choose the best kernel table for the CPU.
+auto ChooseKernelTable() -> const KernelTable& {
+  // Variants in the order of preference.
+  constexpr dispatch::Variant kVariants[] = {
+      dispatch::Variant::kAVX512,
+      dispatch::Variant::kAVX2,
+      dispatch::Variant::kSSE4_1,
+  };
+
+  for (const dispatch::Variant variant : kVariants) {
+    // Variants with a smaller instruction set than the baseline are compiled
+    // with the baseline flags as well, so there is no benefit of using them.
+    if (variant == kBaselineKernelTable.variant) {
+      break;
+    }
+
+    const KernelTable* table = GetKernelTableIfSupported(variant);
+    if (table) {
+      return *table;
+    }
+  }
+
+  return kBaselineKernelTable;
+}
+
+inline auto GetKernelTable() -> const KernelTable& {
+  static const KernelTable& table = ChooseKernelTable();
+  return table;
+}
+
+// Force the choice of the kernel table during the static initialization, so
+// that the CPU detection does not happen on a time-critical path.
+[[maybe_unused]] const KernelTable& kChosenKernelTable = GetKernelTable();
+
+}  // namespace
+
+auto GetKernelTableIfSupported(const dispatch::Variant variant)
+    -> const KernelTable* {
+  const KernelTable* table = GetCompiledKernelTable(variant);
+  if (!table) {
+    return nullptr;
+  }
+
+  // The baseline is always supported: the program would not run otherwise.
+  if (table != &kBaselineKernelTable && !IsVariantSupportedByCPU(variant)) {
+    return nullptr;
+  }
+
+  return table;
+}
+
+}  // namespace dispatch_internal
+
+namespace dispatch {
+
+using dispatch_internal::GetKernelTable;
+
+namespace {
+
+inline auto AsFloat(const Complex* data) -> const float* {
+  return reinterpret_cast<const float*>(data);
+}
+
+inline auto AsFloat(Complex* data) -> float* {
+  return reinterpret_cast<float*>(data);
+}
+
+}  // namespace
+
+auto GetVariant() -> Variant { return GetKernelTable().variant; }
+
+auto GetVariantName(const Variant variant) -> const char* {
+  switch (variant) {
+    case Variant::kGeneric: return "Generic";
+    case Variant::kNEON: return "NEON";
+    case Variant::kSSE2: return "SSE2";
+    case Variant::kSSE4_1: return "SSE4.1";
+    case Variant::kAVX2: return "AVX2";
+    case Variant::kAVX512: return "AVX-512";
+  }
+
+  return "Unknown";
+}
+
+auto Dot(const std::span<const float> f, const std::span<const float> g)
+    -> float {
+  assert(f.size() == g.size());
+  return GetKernelTable().dot(f.data(), g.data(), f.size());
+}
+
+auto Dot(const std::span<const Complex> f, const std::span<const float> g)
+    -> Complex {
+  assert(f.size() == g.size());
+  float result[2];
+  GetKernelTable().dot_complex(AsFloat(f.data()), g.data(), f.size(), result);
+  return {result[0], result[1]};
+}
+
+auto DotFlipG(const std::span<const float> f, const std::span<const float> g)
+    -> float {
+  assert(f.size() == g.size());
+  return GetKernelTable().dot_flip_g(f.data(), g.data(), f.size());
+}
+
+auto DotFlipG(const std::span<const Complex> f, const std::span<const float> g)
+    -> Complex {
+  assert(f.size() == g.size());
+  float result[2];
+  GetKernelTable().dot_flip_g_complex(
+      AsFloat(f.data()), g.data(), f.size(), result);
+  return {result[0], result[1]};
+}
+
+auto Rotator(const std::span<const Complex> samples,
+             Complex& phase,
+             const Complex phase_increment_per_sample,
+             const std::span<Complex> output) -> std::span<Complex> {
+  assert(samples.size() <= output.size());
+
+  const size_t num_samples = samples.size();
+
+  float phase_data[2] = {phase.real, phase.imag};
+  const float phase_increment_data[2] = {phase_increment_per_sample.real,
+                                         phase_increment_per_sample.imag};
+
+  GetKernelTable().rotator(AsFloat(samples.data()),
+                           num_samples,
+                           phase_data,
+                           phase_increment_data,
+                           AsFloat(output.data()));
+
+  phase = Complex(phase_data[0], phase_data[1]);
+
+  return output.subspan(0, num_samples);
+}
+
+auto FastArg(const std::span<const Complex> samples,
+             const std::span<float> arg) -> std::span<float> {
+  assert(samples.size() <= arg.size());
+  GetKernelTable().fast_arg(
+      AsFloat(samples.data()), samples.size(), arg.data());
+  return arg.subspan(0, samples.size());
+}
+
+auto FastAbs(const std::span<const Complex> samples,
+             const std::span<float> absolute_values) -> std::span<float> {
+  assert(samples.size() <= absolute_values.size());
+  GetKernelTable().fast_abs(
+      AsFloat(samples.data()), samples.size(), absolute_values.data());
+  return absolute_values.subspan(0, samples.size());
+}
+
+auto Norm(const std::span<const Complex> samples, const std::span<float> norm)
+    -> std::span<float> {
+  assert(samples.size() <= norm.size());
+  GetKernelTable().norm(AsFloat(samples.data()), samples.size(), norm.data());
+  return norm.subspan(0, samples.size());
+}
+
+auto PowerSpectralDensity(const std::span<const Complex> samples,
+                          const std::span<float> power) -> std::span<float> {
+  assert(samples.size() == power.size());
+  GetKernelTable().power_spectral_density(
+      AsFloat(samples.data()), samples.size(), power.data());
+  return power.subspan(0, samples.size());
+}
+
+auto HorizontalMax(const std::span<const float> samples) -> float {
+  assert(!samples.empty());
+  return GetKernelTable().horizontal_max(samples.data(), samples.size());
+}
+
+auto HorizontalSum(const std::span<const float> samples) -> float {
+  assert(!samples.empty());
+  return GetKernelTable().horizontal_sum(samples.data(), samples.size());
+}
+
+auto PerPointLerpPeakDetector(const std::span<const float> samples,
+                              const std::span<float> peak,
+                              const float charge_rate,
+                              const float discharge_rate) -> std::span<float> {
+  assert(samples.size() == peak.size());
+  GetKernelTable().per_point_lerp_peak_detector(samples.data(),
+                                                samples.size(),
+                                                peak.data(),
+                                                charge_rate,
+                                                discharge_rate);
+  return peak.subspan(0, samples.size());
+}
+
+}  // namespace dispatch
+
+}  // namespace radio_core::kernel
@@ -0,0 +1,27 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Kernels compiled for the AVX-512F, AVX2 and FMA instruction sets.
+//
+// The build system compiles this file with the compiler flags which enable the
+// instruction sets.
+
+#include "radio_core/math/kernel/internal/dispatch_table.h"
+
+#if !ARCH_CPU_X86_FAMILY ||                                                    \
+    !(ISA_CPU_X86_AVX512F && ISA_CPU_X86_AVX2 && ISA_CPU_X86_FMA)
+#  error "The file is to be compiled with AVX-512F, AVX2 and FMA enabled"
+#endif
+
+// The kernels are compiled in the RADIO_CORE_ISA_NAMESPACE which corresponds to
+// the AVX-512F, AVX2 and FMA instruction sets, so none of their inline
+// functions is shared with other translation units.
+#include "radio_core/math/kernel/internal/dispatch_kernels.h"
+
+namespace radio_core::kernel::dispatch_internal {
+
+constexpr KernelTable kAVX512KernelTable =
+    MakeKernelTable<Kernels>(dispatch::Variant::kAVX512);
+
+}  // namespace radio_core::kernel::dispatch_internal
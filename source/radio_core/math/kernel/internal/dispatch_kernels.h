@@ -0,0 +1,160 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Wrappers around the kernels which adapt them to the raw pointer interface of
+// the dispatch table.
+//
+// This file is compiled once per instruction set variant. The kernels and all
+// the code they use are declared in the RADIO_CORE_ISA_NAMESPACE, so every
+// variant gets its own copy of all the inline code and there is no violation
+// of one definition rule between the variants.
+//
+// The wrappers call the kernel implementations directly rather than the public
+// kernels, as the public kernels are routed to the dispatch table when the
+// WITH_KERNEL_DISPATCH is defined.
+//
+// NOTE: The standard library templates used by the wrappers (such as the
+// std::span constructors) are still shared between the variants. They are
+// trivial and are inlined in optimized builds, but in non-optimized builds the
+// linker might pick their out-of-line copy compiled for a wider instruction
+// set than the baseline.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/kernel/dot.h"
+#include "radio_core/math/kernel/dot_flip.h"
+#include "radio_core/math/kernel/fast_abs.h"
+#include "radio_core/math/kernel/fast_arg.h"
+#include "radio_core/math/kernel/horizontal_max.h"
+#include "radio_core/math/kernel/horizontal_sum.h"
+#include "radio_core/math/kernel/norm.h"
+#include "radio_core/math/kernel/peak_detector.h"
+#include "radio_core/math/kernel/power_spectral_density.h"
+#include "radio_core/math/kernel/rotator.h"
+
+namespace radio_core::kernel::dispatch_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+struct Kernels {
+  static auto AsComplex(const float* data) -> const Complex* {
+    return reinterpret_cast<const Complex*>(data);
+  }
+
+  static auto Dot(const float* f, const float* g, const size_t num_samples)
+      -> float {
+    return dot_internal::Kernel<float, float, true>::Execute(
+        std::span<const float>(f, num_samples),
+        std::span<const float>(g, num_samples));
+  }
+
+  static void DotComplex(const float* f,
+                         const float* g,
+                         const size_t num_samples,
+                         float result[2]) {
+    const Complex dot = dot_internal::Kernel<Complex, float, true>::Execute(
+        std::span<const Complex>(AsComplex(f), num_samples),
+        std::span<const float>(g, num_samples));
+    result[0] = dot.real;
+    result[1] = dot.imag;
+  }
+
+  static auto DotFlipG(const float* f,
+                       const float* g,
+                       const size_t num_samples) -> float {
+    return experimental::dot_flip_kernel_internal::Kernel<float, float, true>::
+        Execute(std::span<const float>(f, num_samples),
+                std::span<const float>(g, num_samples));
+  }
+
+  static void DotFlipGComplex(const float* f,
+                              const float* g,
+                              const size_t num_samples,
+                              float result[2]) {
+    const Complex dot =
+        experimental::dot_flip_kernel_internal::Kernel<Complex, float, true>::
+            Execute(std::span<const Complex>(AsComplex(f), num_samples),
+                    std::span<const float>(g, num_samples));
+    result[0] = dot.real;
+    result[1] = dot.imag;
+  }
+
+  static void Rotator(const float* samples,
+                      const size_t num_samples,
+                      float phase[2],
+                      const float phase_increment_per_sample[2],
+                      float* output) {
+    Complex complex_phase(phase[0], phase[1]);
+    rotator_internal::Kernel<float, true>::Execute(
+        std::span<const Complex>(AsComplex(samples), num_samples),
+        complex_phase,
+        Complex(phase_increment_per_sample[0], phase_increment_per_sample[1]),
+        std::span<Complex>(reinterpret_cast<Complex*>(output), num_samples));
+    phase[0] = complex_phase.real;
+    phase[1] = complex_phase.imag;
+  }
+
+  static void FastArg(const float* samples,
+                      const size_t num_samples,
+                      float* output) {
+    fast_arg_internal::Kernel<float, true>::Execute(
+        std::span<const Complex>(AsComplex(samples), num_samples),
+        std::span<float>(output, num_samples));
+  }
+
+  static void FastAbs(const float* samples,
+                      const size_t num_samples,
+                      float* output) {
+    fast_abs_internal::Kernel<Complex, true>::Execute(
+        std::span<const Complex>(AsComplex(samples), num_samples),
+        std::span<float>(output, num_samples));
+  }
+
+  static void Norm(const float* samples,
+                   const size_t num_samples,
+                   float* output) {
+    norm_internal::Kernel<float, true>::Execute(
+        std::span<const Complex>(AsComplex(samples), num_samples),
+        std::span<float>(output, num_samples));
+  }
+
+  static void PowerSpectralDensity(const float* samples,
+                                   const size_t num_samples,
+                                   float* output) {
+    power_spectral_density_internal::Kernel<float, true>::Execute(
+        std::span<const Complex>(AsComplex(samples), num_samples),
+        std::span<float>(output, num_samples));
+  }
+
+  static auto HorizontalMax(const float* samples, const size_t num_samples)
+      -> float {
+    return horizontal_max_internal::Kernel<float, true>::Execute(
+        std::span<const float>(samples, num_samples));
+  }
+
+  static auto HorizontalSum(const float* samples, const size_t num_samples)
+      -> float {
+    return horizontal_sum_internal::Kernel<float, true>::Execute(
+        std::span<const float>(samples, num_samples));
+  }
+
+  static void PerPointLerpPeakDetector(const float* samples,
+                                       const size_t num_samples,
+                                       float* peak,
+                                       const float charge_rate,
+                                       const float discharge_rate) {
+    peak_detector_internal::Kernel<float, true>::Execute(
+        std::span<const float>(samples, num_samples),
+        std::span<float>(peak, num_samples),
+        charge_rate,
+        discharge_rate);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core::kernel::dispatch_internal
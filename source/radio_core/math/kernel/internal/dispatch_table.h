@@ -0,0 +1,120 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Table of kernel implementations compiled for a specific instruction set.
+//
+// The table uses raw pointers and sizes in its interface: complex values are
+// passed as interleaved real and imaginary parts. This allows the table to be
+// defined in translation units compiled for different instruction sets without
+// sharing any inline code between them.
+//
+// NOTE: This file is to only include standard headers and the build
+// configuration. It is included by the instruction set specific translation
+// units before the kernels are compiled in an instruction set specific
+// namespace (see dispatch_kernels.h).
+
+#pragma once
+
+#include <cstddef>
+
+#include "radio_core/base/build_config.h"
+
+namespace radio_core::kernel::dispatch {
+
+// Instruction set the kernel implementation is compiled for.
+enum class Variant {
+  // Compiled for the baseline of a platform which has no dedicated variants.
+  kGeneric,
+
+  // ARM NEON.
+  kNEON,
+
+  // x86 variants.
+  kSSE2,
+  kSSE4_1,
+  kAVX2,
+  kAVX512,
+};
+
+}  // namespace radio_core::kernel::dispatch
+
+namespace radio_core::kernel::dispatch_internal {
+
+struct KernelTable {
+  dispatch::Variant variant;
+
+  float (*dot)(const float* f, const float* g, size_t num_samples);
+  void (*dot_complex)(const float* f,
+                      const float* g,
+                      size_t num_samples,
+                      float result[2]);
+
+  float (*dot_flip_g)(const float* f, const float* g, size_t num_samples);
+  void (*dot_flip_g_complex)(const float* f,
+                             const float* g,
+                             size_t num_samples,
+                             float result[2]);
+
+  void (*rotator)(const float* samples,
+                  size_t num_samples,
+                  float phase[2],
+                  const float phase_increment_per_sample[2],
+                  float* output);
+
+  void (*fast_arg)(const float* samples, size_t num_samples, float* output);
+  void (*fast_abs)(const float* samples, size_t num_samples, float* output);
+  void (*norm)(const float* samples, size_t num_samples, float* output);
+  void (*power_spectral_density)(const float* samples,
+                                 size_t num_samples,
+                                 float* output);
+
+  float (*horizontal_max)(const float* samples, size_t num_samples);
+  float (*horizontal_sum)(const float* samples, size_t num_samples);
+
+  void (*per_point_lerp_peak_detector)(const float* samples,
+                                       size_t num_samples,
+                                       float* peak,
+                                       float charge_rate,
+                                       float discharge_rate);
+};
+
+// Construct kernel table from the static functions of the Kernels class.
+template <class Kernels>
+constexpr auto MakeKernelTable(const dispatch::Variant variant)
+    -> KernelTable {
+  return {
+      .variant = variant,
+      .dot = &Kernels::Dot,
+      .dot_complex = &Kernels::DotComplex,
+      .dot_flip_g = &Kernels::DotFlipG,
+      .dot_flip_g_complex = &Kernels::DotFlipGComplex,
+      .rotator = &Kernels::Rotator,
+      .fast_arg = &Kernels::FastArg,
+      .fast_abs = &Kernels::FastAbs,
+      .norm = &Kernels::Norm,
+      .power_spectral_density = &Kernels::PowerSpectralDensity,
+      .horizontal_max = &Kernels::HorizontalMax,
+      .horizontal_sum = &Kernels::HorizontalSum,
+      .per_point_lerp_peak_detector = &Kernels::PerPointLerpPeakDetector,
+  };
+}
+
+// Tables compiled for the specific instruction sets.
+//
+// They are only available when the build system compiled the corresponding
+// translation units, which is indicated by RADIO_CORE_KERNEL_DISPATCH_X86.
+#if defined(RADIO_CORE_KERNEL_DISPATCH_X86)
+extern const KernelTable kSSE4_1KernelTable;
+extern const KernelTable kAVX2KernelTable;
+extern const KernelTable kAVX512KernelTable;
+#endif
+
+// Get kernel table for the given variant.
+//
+// Returns nullptr if the variant is not compiled in, or if it is not supported
+// by the CPU the program is running on.
+auto GetKernelTableIfSupported(dispatch::Variant variant)
+    -> const KernelTable*;
+
+}  // namespace radio_core::kernel::dispatch_internal
@@ -0,0 +1,251 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/math/kernel/dispatch.h"
+
+#include <array>
+
+#include "radio_core/math/complex.h"
+#include "radio_core/math/kernel/dot.h"
+#include "radio_core/math/kernel/horizontal_max.h"
+#include "radio_core/math/kernel/horizontal_sum.h"
+#include "radio_core/math/kernel/peak_detector.h"
+#include "radio_core/math/kernel/power_spectral_density.h"
+#include "radio_core/math/math.h"
+#include "radio_core/math/unittest/complex_matchers.h"
+#include "radio_core/unittest/mock.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::kernel::dispatch {
+
+using dispatch_internal::GetKernelTableIfSupported;
+using dispatch_internal::KernelTable;
+using testing::ComplexNear;
+
+namespace {
+
+constexpr Variant kAllVariants[] = {
+    Variant::kGeneric,
+    Variant::kNEON,
+    Variant::kSSE2,
+    Variant::kSSE4_1,
+    Variant::kAVX2,
+    Variant::kAVX512,
+};
+
+// Number of samples which is not a multiple of any vector size, so that the
+// tail handling is covered as well.
+constexpr size_t kNumSamples = 45;
+
+struct TestData {
+  TestData() {
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      const float x = float(i);
+      f[i] = Sin(x * 0.3f) * 2.0f;
+      g[i] = Cos(x * 0.17f) - 0.25f;
+      complex_f[i] = Complex(Cos(x * 0.21f) * 3.0f, Sin(x * 0.4f) - 1.0f);
+    }
+  }
+
+  auto ComplexFData() const -> const float* {
+    return reinterpret_cast<const float*>(complex_f.data());
+  }
+
+  std::array<float, kNumSamples> f;
+  std::array<float, kNumSamples> g;
+  std::array<Complex, kNumSamples> complex_f;
+};
+
+// Run all kernels of the table and compare them against the straightforward
+// implementation.
+void ExpectTableMatchesReference(const KernelTable& table) {
+  const TestData data;
+
+  // Dot, DotFlipG.
+  {
+    float dot = 0;
+    float dot_flip = 0;
+    Complex complex_dot(0);
+    Complex complex_dot_flip(0);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      dot += data.f[i] * data.g[i];
+      dot_flip += data.f[i] * data.g[kNumSamples - i - 1];
+      complex_dot += data.complex_f[i] * data.g[i];
+      complex_dot_flip += data.complex_f[i] * data.g[kNumSamples - i - 1];
+    }
+
+    EXPECT_NEAR(table.dot(data.f.data(), data.g.data(), kNumSamples),
+                dot,
+                1e-4f);
+    EXPECT_NEAR(table.dot_flip_g(data.f.data(), data.g.data(), kNumSamples),
+                dot_flip,
+                1e-4f);
+
+    float result[2];
+
+    table.dot_complex(
+        data.ComplexFData(), data.g.data(), kNumSamples, result);
+    EXPECT_THAT(Complex(result[0], result[1]),
+                ComplexNear(complex_dot, 1e-4f));
+
+    table.dot_flip_g_complex(
+        data.ComplexFData(), data.g.data(), kNumSamples, result);
+    EXPECT_THAT(Complex(result[0], result[1]),
+                ComplexNear(complex_dot_flip, 1e-4f));
+  }
+
+  // Rotator.
+  {
+    const Complex phase_increment(Cos(0.1f), Sin(0.1f));
+
+    std::array<Complex, kNumSamples> output;
+    float phase[2] = {1, 0};
+    const float phase_increment_data[2] = {phase_increment.real,
+                                           phase_increment.imag};
+    table.rotator(data.ComplexFData(),
+                  kNumSamples,
+                  phase,
+                  phase_increment_data,
+                  reinterpret_cast<float*>(output.data()));
+
+    Complex expected_phase(1, 0);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      EXPECT_THAT(output[i],
+                  ComplexNear(data.complex_f[i] * expected_phase, 1e-4f))
+          << "i=" << i;
+      expected_phase *= phase_increment;
+    }
+    EXPECT_THAT(Complex(phase[0], phase[1]),
+                ComplexNear(expected_phase, 1e-4f));
+  }
+
+  // Per-sample complex to float kernels.
+  {
+    std::array<float, kNumSamples> output;
+
+    table.fast_arg(data.ComplexFData(), kNumSamples, output.data());
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      EXPECT_NEAR(output[i], Arg(data.complex_f[i]), 2e-2f) << "i=" << i;
+    }
+
+    table.fast_abs(data.ComplexFData(), kNumSamples, output.data());
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      EXPECT_NEAR(output[i], Abs(data.complex_f[i]), 2e-2f) << "i=" << i;
+    }
+
+    table.norm(data.ComplexFData(), kNumSamples, output.data());
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      EXPECT_NEAR(output[i], Norm(data.complex_f[i]), 1e-4f) << "i=" << i;
+    }
+
+    std::array<float, kNumSamples> expected_psd;
+    kernel::PowerSpectralDensity(data.complex_f, expected_psd);
+    table.power_spectral_density(
+        data.ComplexFData(), kNumSamples, output.data());
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      EXPECT_NEAR(output[i], expected_psd[i], 1e-4f) << "i=" << i;
+    }
+  }
+
+  // Horizontal reductions.
+  {
+    float max = data.f[0];
+    float sum = 0;
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      max = Max(max, data.f[i]);
+      sum += data.f[i];
+    }
+
+    EXPECT_EQ(table.horizontal_max(data.f.data(), kNumSamples), max);
+    EXPECT_NEAR(table.horizontal_sum(data.f.data(), kNumSamples), sum, 1e-4f);
+  }
+
+  // Peak detector.
+  {
+    std::array<float, kNumSamples> peak;
+    std::array<float, kNumSamples> expected_peak;
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      peak[i] = expected_peak[i] = data.g[i];
+    }
+
+    kernel::PerPointLerpPeakDetector<float>(
+        data.f, expected_peak, 0.8f, 0.2f);
+    table.per_point_lerp_peak_detector(
+        data.f.data(), kNumSamples, peak.data(), 0.8f, 0.2f);
+
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      EXPECT_NEAR(peak[i], expected_peak[i], 1e-6f) << "i=" << i;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(KernelDispatch, ChosenVariantIsSupported) {
+  const Variant variant = GetVariant();
+
+  const KernelTable* table = GetKernelTableIfSupported(variant);
+  ASSERT_NE(table, nullptr);
+  EXPECT_EQ(table->variant, variant);
+
+  EXPECT_STRNE(GetVariantName(), "Unknown");
+  EXPECT_STREQ(GetVariantName(), GetVariantName(variant));
+}
+
+TEST(KernelDispatch, ChosenVariantIsBest) {
+  // None of the variants which are preferred over the chosen one is available.
+  const Variant variant = GetVariant();
+  for (const Variant other_variant : kAllVariants) {
+    if (int(other_variant) <= int(variant)) {
+      continue;
+    }
+    EXPECT_EQ(GetKernelTableIfSupported(other_variant), nullptr)
+        << GetVariantName(other_variant);
+  }
+}
+
+TEST(KernelDispatch, AllSupportedVariants) {
+  for (const Variant variant : kAllVariants) {
+    const KernelTable* table = GetKernelTableIfSupported(variant);
+    if (!table) {
+      continue;
+    }
+
+    SCOPED_TRACE(GetVariantName(variant));
+    ExpectTableMatchesReference(*table);
+  }
+}
+
+TEST(KernelDispatch, Dispatched) {
+  const TestData data;
+
+  const float expected_dot = kernel::Dot<float, float>(data.f, data.g);
+  EXPECT_NEAR(Dot(std::span<const float>(data.f), data.g), expected_dot, 1e-4f);
+
+  const Complex expected_complex_dot =
+      kernel::Dot<Complex, float>(data.complex_f, data.g);
+  EXPECT_THAT(Dot(std::span<const Complex>(data.complex_f), data.g),
+              ComplexNear(expected_complex_dot, 1e-4f));
+
+  EXPECT_NEAR(
+      HorizontalSum(data.f), kernel::HorizontalSum<float>(data.f), 1e-4f);
+  EXPECT_EQ(HorizontalMax(data.f), kernel::HorizontalMax<float>(data.f));
+
+  std::array<float, kNumSamples> norm;
+  EXPECT_EQ(Norm(data.complex_f, norm).size(), kNumSamples);
+  for (size_t i = 0; i < kNumSamples; ++i) {
+    EXPECT_NEAR(norm[i], radio_core::Norm(data.complex_f[i]), 1e-4f);
+  }
+
+  std::array<Complex, kNumSamples> rotated;
+  Complex phase(1, 0);
+  EXPECT_EQ(Rotator(data.complex_f, phase, Complex(1, 0), rotated).size(),
+            kNumSamples);
+  for (size_t i = 0; i < kNumSamples; ++i) {
+    EXPECT_THAT(rotated[i], ComplexNear(data.complex_f[i], 1e-5f));
+  }
+  EXPECT_THAT(phase, ComplexNear(Complex(1, 0), 1e-5f));
+}
+
+}  // namespace radio_core::kernel::dispatch
@@ -53,12 +53,16 @@ class DotBenchmark : public Benchmark {
       arguments_type_ = ArgumentsType::kFloatFloat;
     } else if (arguments_type == "complex_float") {
       arguments_type_ = ArgumentsType::kComplexFloat;
+    } else if (arguments_type == "complex_complex") {
+      arguments_type_ = ArgumentsType::kComplexComplex;
     }
 #if RADIO_CORE_HAVE_HALF
     else if (arguments_type == "half_half") {
       arguments_type_ = ArgumentsType::kHalfHalf;
     } else if (arguments_type == "half_complex_half") {
       arguments_type_ = ArgumentsType::kHalfComplexHalf;
+    } else if (arguments_type == "half_complex_half_complex") {
+      arguments_type_ = ArgumentsType::kHalfComplexHalfComplex;
     }
 #endif
     else {
@@ -73,7 +77,8 @@ class DotBenchmark : public Benchmark {
 #  if RADIO_CORE_HAVE_HALF
     if (use_volk_) {
       if (arguments_type_ == ArgumentsType::kHalfHalf ||
-          arguments_type_ == ArgumentsType::kHalfComplexHalf) {
+          arguments_type_ == ArgumentsType::kHalfComplexHalf ||
+          arguments_type_ == ArgumentsType::kHalfComplexHalfComplex) {
         cerr << "Volk implementation is not available for the requested "
                 "arguments type.";
         return false;
@@ -101,6 +106,11 @@ class DotBenchmark : public Benchmark {
         InitializeData(complex_float_data_);
         break;
 
+      case ArgumentsType::kComplexComplex:
+        cout << "Arguments            : Complex x Complex" << endl;
+        InitializeData(complex_complex_data_);
+        break;
+
 #if RADIO_CORE_HAVE_HALF
       case ArgumentsType::kHalfHalf:
         cout << "Arguments            : Half x Half" << endl;
@@ -110,6 +120,10 @@ class DotBenchmark : public Benchmark {
         cout << "Arguments            : HalfComplex x Half" << endl;
         InitializeData(half_complex_half_data_);
         break;
+      case ArgumentsType::kHalfComplexHalfComplex:
+        cout << "Arguments            : HalfComplex x HalfComplex" << endl;
+        InitializeData(half_complex_half_complex_data_);
+        break;
 #endif
     }
 
@@ -169,6 +183,29 @@ class DotBenchmark : public Benchmark {
         break;
       }
 
+      case ArgumentsType::kComplexComplex: {
+        Complex d;
+
+#if defined(WITH_BENCHMARKS_VOLK)
+        if (use_volk_) {
+          lv_32fc_t result;
+          volk_32fc_x2_dot_prod_32fc(
+              &result,
+              reinterpret_cast<lv_32fc_t*>(complex_complex_data_.f.data()),
+              reinterpret_cast<lv_32fc_t*>(complex_complex_data_.g.data()),
+              complex_complex_data_.f.size());
+          d = Complex(result.real(), result.imag());
+        } else
+#endif
+        {
+          d = kernel::Dot<Complex, Complex>(complex_complex_data_.f,
+                                            complex_complex_data_.g);
+        }
+
+        is_finite = IsFinite(d);
+        break;
+      }
+
 #if RADIO_CORE_HAVE_HALF
       case ArgumentsType::kHalfHalf: {
         const Half d =
@@ -183,6 +220,14 @@ class DotBenchmark : public Benchmark {
         is_finite = IsFinite(d);
         break;
       }
+
+      case ArgumentsType::kHalfComplexHalfComplex: {
+        const HalfComplex d = kernel::Dot<HalfComplex, HalfComplex>(
+            half_complex_half_complex_data_.f,
+            half_complex_half_complex_data_.g);
+        is_finite = IsFinite(d);
+        break;
+      }
 #endif
     }
 
@@ -196,17 +241,21 @@ class DotBenchmark : public Benchmark {
   enum class ArgumentsType {
     kFloatFloat,
     kComplexFloat,
+    kComplexComplex,
 #if RADIO_CORE_HAVE_HALF
     kHalfHalf,
     kHalfComplexHalf,
+    kHalfComplexHalfComplex,
 #endif
   };
   static constexpr std::string_view kSupportedArgumentTypesListString =
       "float_float"
       ", complex_float"
+      ", complex_complex"
 #if RADIO_CORE_HAVE_HALF
       ", half_half"
       ", half_complex_half"
+      ", half_complex_half_complex"
 #endif
       ;
 
@@ -256,10 +305,12 @@ class DotBenchmark : public Benchmark {
 
   Data<float, float> float_float_data_;
   Data<Complex, float> complex_float_data_;
+  Data<Complex, Complex> complex_complex_data_;
 
 #if RADIO_CORE_HAVE_HALF
   Data<Half, Half> half_half_data_;
   Data<HalfComplex, Half> half_complex_half_data_;
+  Data<HalfComplex, HalfComplex> half_complex_half_complex_data_;
 #endif
 
 #if defined(WITH_BENCHMARKS_VOLK)
@@ -42,12 +42,16 @@ class DotBenchmark : public Benchmark {
       arguments_type_ = ArgumentsType::kFloatFloat;
     } else if (arguments_type == "complex_float") {
       arguments_type_ = ArgumentsType::kComplexFloat;
+    } else if (arguments_type == "complex_complex") {
+      arguments_type_ = ArgumentsType::kComplexComplex;
     }
 #if RADIO_CORE_HAVE_HALF
     else if (arguments_type == "half_half") {
       arguments_type_ = ArgumentsType::kHalfHalf;
     } else if (arguments_type == "half_complex_half") {
       arguments_type_ = ArgumentsType::kHalfComplexHalf;
+    } else if (arguments_type == "half_complex_half_complex") {
+      arguments_type_ = ArgumentsType::kHalfComplexHalfComplex;
     }
 #endif
     else {
@@ -75,6 +79,11 @@ class DotBenchmark : public Benchmark {
         InitializeData(complex_float_data_);
         break;
 
+      case ArgumentsType::kComplexComplex:
+        cout << "Arguments            : Complex x Complex" << endl;
+        InitializeData(complex_complex_data_);
+        break;
+
 #if RADIO_CORE_HAVE_HALF
       case ArgumentsType::kHalfHalf:
         cout << "Arguments            : Half x Half" << endl;
@@ -84,6 +93,10 @@ class DotBenchmark : public Benchmark {
         cout << "Arguments            : HalfComplex x Half" << endl;
         InitializeData(half_complex_half_data_);
         break;
+      case ArgumentsType::kHalfComplexHalfComplex:
+        cout << "Arguments            : HalfComplex x HalfComplex" << endl;
+        InitializeData(half_complex_half_complex_data_);
+        break;
 #endif
     }
 
@@ -111,6 +124,14 @@ class DotBenchmark : public Benchmark {
         break;
       }
 
+      case ArgumentsType::kComplexComplex: {
+        const Complex d = kernel::experimental::DotFlipG<Complex, Complex>(
+            complex_complex_data_.f, complex_complex_data_.g);
+
+        is_finite = IsFinite(d);
+        break;
+      }
+
 #if RADIO_CORE_HAVE_HALF
       case ArgumentsType::kHalfHalf: {
         const Half d = kernel::experimental::DotFlipG<Half, Half>(
@@ -125,6 +146,15 @@ class DotBenchmark : public Benchmark {
         is_finite = IsFinite(d);
         break;
       }
+
+      case ArgumentsType::kHalfComplexHalfComplex: {
+        const HalfComplex d =
+            kernel::experimental::DotFlipG<HalfComplex, HalfComplex>(
+                half_complex_half_complex_data_.f,
+                half_complex_half_complex_data_.g);
+        is_finite = IsFinite(d);
+        break;
+      }
 #endif
     }
 
@@ -138,17 +168,21 @@ class DotBenchmark : public Benchmark {
   enum class ArgumentsType {
     kFloatFloat,
     kComplexFloat,
+    kComplexComplex,
 #if RADIO_CORE_HAVE_HALF
     kHalfHalf,
     kHalfComplexHalf,
+    kHalfComplexHalfComplex,
 #endif
   };
   static constexpr std::string_view kSupportedArgumentTypesListString =
       "float_float"
       ", complex_float"
+      ", complex_complex"
 #if RADIO_CORE_HAVE_HALF
       ", half_half"
       ", half_complex_half"
+      ", half_complex_half_complex"
 #endif
       ;
 
@@ -198,10 +232,12 @@ class DotBenchmark : public Benchmark {
 
   Data<float, float> float_float_data_;
   Data<Complex, float> complex_float_data_;
+  Data<Complex, Complex> complex_complex_data_;
 
 #if RADIO_CORE_HAVE_HALF
   Data<Half, Half> half_half_data_;
   Data<HalfComplex, Half> half_complex_half_data_;
+  Data<HalfComplex, HalfComplex> half_complex_half_complex_data_;
 #endif
 };
 
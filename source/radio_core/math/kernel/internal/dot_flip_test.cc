@@ -96,6 +96,49 @@ struct ComplexFloatData {
   static inline const BaseComplex<Float> dot_flip{948, 1095};
 };
 
+template <class Float>
+struct ComplexComplexData {
+  // Same as the ComplexFloatData::a.
+  static inline const auto& a = ComplexFloatData<Float>::a;
+
+  // Small values, so that the products and their sums are exactly representable
+  // in the half precision floating point.
+  //
+  // >>> b = [complex((i * 7) % 3 - 1, (i * i + i // 2) % 3 - 1)
+  // ...      for i in range(num_samples)]
+  static inline const auto b = std::to_array<BaseComplex<Float>>({
+      {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0},
+      {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0},
+      {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0},
+      {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0},
+      {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0},
+      {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0},
+      {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0},
+      {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0},
+      {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0},
+      {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0},
+      {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0},
+      {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0},
+      {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0},
+      {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0},
+      {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0},
+      {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0},
+      {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0},
+      {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0},
+      {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0},
+      {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0},
+      {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0},
+      {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0}, {0.0, 0.0},
+      {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0}, {-1.0, -1.0},
+      {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0}, {1.0, -1.0},
+      {-1.0, -1.0}, {0.0, 0.0}, {1.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0},
+      {1.0, -1.0},
+  });
+
+  // >>> numpy.dot(a, numpy.flip(b))
+  static inline const BaseComplex<Float> dot_flip{156, -82};
+};
+
 TEST(Dot, float_float) {
   const float dot_flip = kernel::experimental::DotFlipG<float, float>(
       FloatFloatData<float>::a, FloatFloatData<float>::b);
@@ -110,6 +153,14 @@ TEST(Dot, complex_float) {
   EXPECT_THAT(dot_flip, ComplexNear(ComplexFloatData<float>::dot_flip, 1e-6f));
 }
 
+TEST(Dot, complex_complex) {
+  const Complex dot_flip = kernel::experimental::DotFlipG<Complex, Complex>(
+      ComplexComplexData<float>::a, ComplexComplexData<float>::b);
+
+  EXPECT_THAT(dot_flip,
+              ComplexNear(ComplexComplexData<float>::dot_flip, 1e-6f));
+}
+
 #if RADIO_CORE_HAVE_HALF
 
 TEST(Dot, half_half) {
@@ -128,6 +179,15 @@ TEST(Dot, half_complex_half) {
               ComplexNear(ComplexFloatData<float>::dot_flip, 1e-6f));
 }
 
+TEST(Dot, half_complex_half_complex) {
+  const HalfComplex dot_flip =
+      kernel::experimental::DotFlipG<HalfComplex, HalfComplex>(
+          ComplexComplexData<Half>::a, ComplexComplexData<Half>::b);
+
+  EXPECT_THAT(Complex(float(dot_flip.real), float(dot_flip.imag)),
+              ComplexNear(ComplexComplexData<float>::dot_flip, 1e-6f));
+}
+
 #endif  // RADIO_CORE_HAVE_HALF
 
 }  // namespace radio_core
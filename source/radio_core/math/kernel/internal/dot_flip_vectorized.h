@@ -11,9 +11,11 @@
 #include <cassert>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/kernel/internal/kernel_common.h"
 
 namespace radio_core::kernel::experimental::dot_flip_kernel_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class FType, class GType, bool SpecializationMarker>
 struct Kernel {
@@ -97,4 +99,5 @@ struct Kernel {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::experimental::dot_flip_kernel_internal
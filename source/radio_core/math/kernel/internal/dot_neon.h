@@ -21,6 +21,7 @@
 #  endif
 
 namespace radio_core::kernel::dot_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class FType, class GType, bool SpecializationMarker>
 struct Kernel;
@@ -334,6 +335,7 @@ struct Kernel<HalfComplex, Half, Half8::kIsVectorized> {
 
 #  endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::dot_internal
 
 #endif  // ISA_CPU_ARM_NEON
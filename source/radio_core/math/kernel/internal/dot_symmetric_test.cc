@@ -0,0 +1,156 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/math/kernel/dot_symmetric.h"
+
+#include <vector>
+
+#include "radio_core/base/half.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/unittest/complex_matchers.h"
+#include "radio_core/unittest/mock.h"
+#include "radio_core/unittest/test.h"
+
+#if RADIO_CORE_HAVE_HALF
+#  include "radio_core/math/half_complex.h"
+#endif
+
+namespace radio_core::kernel::experimental {
+
+using testing::ComplexNear;
+
+namespace {
+
+// Sizes which cover all combinations of the vectorized loops and the tail, for
+// both odd and even kernel sizes.
+constexpr size_t kSizes[] = {1, 2, 3, 7, 8, 9, 16, 17, 24, 31, 32, 45, 67};
+
+// Generate kernel of the given size with the given symmetry.
+//
+// The values are small integers, so that the result is exact for all types.
+template <class T>
+auto GenerateKernel(const size_t size, const bool is_antisymmetric)
+    -> std::vector<T> {
+  std::vector<T> g(size);
+  for (size_t i = 0, j = size - 1; i <= j && j < size; ++i, --j) {
+    const T value = T(float(int(i * 5 % 7) - 3));
+    g[i] = value;
+    g[j] = is_antisymmetric ? -value : value;
+  }
+  if (is_antisymmetric && (size & 1)) {
+    g[size / 2] = T(0);
+  }
+  return g;
+}
+
+template <class T>
+auto GenerateSamples(const size_t size) -> std::vector<T> {
+  std::vector<T> f(size);
+  for (size_t i = 0; i < size; ++i) {
+    f[i] = T(float(int(i * 3 % 5) - 2));
+  }
+  return f;
+}
+
+template <class T>
+auto GenerateComplexSamples(const size_t size)
+    -> std::vector<BaseComplex<T>> {
+  std::vector<BaseComplex<T>> f(size);
+  for (size_t i = 0; i < size; ++i) {
+    f[i] = BaseComplex<T>(T(float(int(i * 3 % 5) - 2)),
+                          T(float(int(i * 2 % 3) - 1)));
+  }
+  return f;
+}
+
+// Straightforward dot product, used as a reference.
+template <class F, class G>
+auto ReferenceDot(const std::vector<F>& f, const std::vector<G>& g) {
+  decltype(F() * G()) output(0);
+  for (size_t i = 0; i < f.size(); ++i) {
+    output += f[i] * g[i];
+  }
+  return output;
+}
+
+}  // namespace
+
+TEST(DotSymmetricG, float_float) {
+  for (const size_t size : kSizes) {
+    const std::vector<float> f = GenerateSamples<float>(size);
+
+    const std::vector<float> g = GenerateKernel<float>(size, false);
+    const float dot = DotSymmetricG<float, float>(f, g);
+    EXPECT_EQ(dot, ReferenceDot(f, g)) << "size=" << size;
+
+    const std::vector<float> g_anti = GenerateKernel<float>(size, true);
+    const float dot_anti = DotAntisymmetricG<float, float>(f, g_anti);
+    EXPECT_EQ(dot_anti, ReferenceDot(f, g_anti)) << "size=" << size;
+  }
+}
+
+TEST(DotSymmetricG, complex_float) {
+  for (const size_t size : kSizes) {
+    const std::vector<Complex> f = GenerateComplexSamples<float>(size);
+
+    const std::vector<float> g = GenerateKernel<float>(size, false);
+    const Complex dot = DotSymmetricG<Complex, float>(f, g);
+    EXPECT_THAT(dot, ComplexNear(ReferenceDot(f, g), 1e-6f))
+        << "size=" << size;
+
+    const std::vector<float> g_anti = GenerateKernel<float>(size, true);
+    const Complex dot_anti = DotAntisymmetricG<Complex, float>(f, g_anti);
+    EXPECT_THAT(dot_anti, ComplexNear(ReferenceDot(f, g_anti), 1e-6f))
+        << "size=" << size;
+  }
+}
+
+TEST(DotSymmetricG, OnlyFirstHalfOfKernelIsUsed) {
+  const std::vector<float> f = GenerateSamples<float>(45);
+
+  const std::vector<float> g = GenerateKernel<float>(45, false);
+  std::vector<float> g_half = g;
+  for (size_t i = 23; i < g_half.size(); ++i) {
+    g_half[i] = 1000;
+  }
+
+  const float dot = DotSymmetricG<float, float>(f, g_half);
+  EXPECT_EQ(dot, ReferenceDot(f, g));
+}
+
+#if RADIO_CORE_HAVE_HALF
+
+TEST(DotSymmetricG, half_half) {
+  for (const size_t size : kSizes) {
+    const std::vector<Half> f = GenerateSamples<Half>(size);
+
+    const std::vector<Half> g = GenerateKernel<Half>(size, false);
+    const Half dot = DotSymmetricG<Half, Half>(f, g);
+    EXPECT_EQ(float(dot), float(ReferenceDot(f, g))) << "size=" << size;
+
+    const std::vector<Half> g_anti = GenerateKernel<Half>(size, true);
+    const Half dot_anti = DotAntisymmetricG<Half, Half>(f, g_anti);
+    EXPECT_EQ(float(dot_anti), float(ReferenceDot(f, g_anti)))
+        << "size=" << size;
+  }
+}
+
+TEST(DotSymmetricG, half_complex_half) {
+  for (const size_t size : kSizes) {
+    const std::vector<HalfComplex> f = GenerateComplexSamples<Half>(size);
+
+    const std::vector<Half> g = GenerateKernel<Half>(size, false);
+    const HalfComplex dot = DotSymmetricG<HalfComplex, Half>(f, g);
+    const HalfComplex expected = ReferenceDot(f, g);
+    EXPECT_THAT(Complex(float(dot.real), float(dot.imag)),
+                ComplexNear(Complex(float(expected.real),
+                                    float(expected.imag)),
+                            1e-6f))
+        << "size=" << size;
+  }
+}
+
+#endif  // RADIO_CORE_HAVE_HALF
+
+}  // namespace radio_core::kernel::experimental
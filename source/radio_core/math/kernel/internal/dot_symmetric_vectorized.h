@@ -0,0 +1,136 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of the dot product with a symmetric or antisymmetric kernel
+// which uses the available vectorized types on the current platform.
+//
+// The mirrored samples are loaded from the end of the signal and are reversed
+// in the register, so that they line up with the samples from the beginning of
+// the signal and the first half of the kernel.
+
+#pragma once
+
+#include <cassert>
+#include <span>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/kernel/internal/kernel_common.h"
+
+namespace radio_core::kernel::experimental::dot_symmetric_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class FType,
+          class GType,
+          bool IsAntisymmetric,
+          bool SpecializationMarker>
+struct Kernel {
+  using OutputType = decltype(std::declval<FType>() * std::declval<GType>());
+
+  // Combine the sample with its mirrored pair according to the symmetry.
+  template <class T>
+  static inline auto PreAdd(const T& f, const T& f_mirrored) -> T {
+    if constexpr (IsAntisymmetric) {
+      return f - f_mirrored;
+    } else {
+      return f + f_mirrored;
+    }
+  }
+
+  static inline auto Execute(const std::span<const FType>& f,
+                             const std::span<const GType>& g) -> OutputType {
+    using kernel_internal::VectorizedBase;
+
+    using FType4 = typename VectorizedBase<FType>::template VectorizedType<4>;
+    using FType8 = typename VectorizedBase<FType>::template VectorizedType<8>;
+
+    using GType4 = typename VectorizedBase<GType>::template VectorizedType<4>;
+    using GType8 = typename VectorizedBase<GType>::template VectorizedType<8>;
+
+    assert(f.size() == g.size());
+
+    const size_t num_samples = f.size();
+    const size_t half_num_samples = num_samples / 2;
+
+    // Pointer to the sample from the beginning of the signal, and pointer past
+    // its mirrored pair at the end of the signal.
+    const FType* f_ptr = f.data();
+    const FType* f_mirrored_end = f_ptr + num_samples;
+
+    const FType* f_half_end = f_ptr + half_num_samples;
+
+    const GType* g_ptr = g.data();
+
+    OutputType output(0);
+
+    // Handle 8 pairs at a time.
+    if constexpr (FType8::kIsVectorized && GType8::kIsVectorized) {
+      using OutputType8 =
+          typename VectorizedBase<OutputType>::template VectorizedType<8>;
+      OutputType8 output8(OutputType(0));
+
+      const FType* aligned_f_end = f_ptr + (half_num_samples & ~size_t(7));
+
+      while (f_ptr < aligned_f_end) {
+        const FType8 f8(f_ptr);
+        const FType8 f8_mirrored = Reverse(FType8(f_mirrored_end - 8));
+        const GType8 g8(g_ptr);
+
+        f_ptr += 8;
+        f_mirrored_end -= 8;
+        g_ptr += 8;
+
+        output8 = MultiplyAdd(output8, PreAdd(f8, f8_mirrored), g8);
+      }
+
+      output += HorizontalSum(output8);
+    }
+
+    // Handle 4 pairs at a time.
+    if constexpr (FType4::kIsVectorized && GType4::kIsVectorized) {
+      using OutputType4 =
+          typename VectorizedBase<OutputType>::template VectorizedType<4>;
+      OutputType4 output4(OutputType(0));
+
+      const size_t num_remaining_pairs = f_half_end - f_ptr;
+      const FType* aligned_f_end = f_ptr + (num_remaining_pairs & ~size_t(3));
+
+      while (f_ptr < aligned_f_end) {
+        const FType4 f4(f_ptr);
+        const FType4 f4_mirrored = Reverse(FType4(f_mirrored_end - 4));
+        const GType4 g4(g_ptr);
+
+        f_ptr += 4;
+        f_mirrored_end -= 4;
+        g_ptr += 4;
+
+        output4 = MultiplyAdd(output4, PreAdd(f4, f4_mirrored), g4);
+      }
+
+      output += HorizontalSum(output4);
+    }
+
+    // Handle the remaining pairs.
+    while (f_ptr < f_half_end) {
+      --f_mirrored_end;
+
+      output = MultiplyAdd(output, PreAdd(*f_ptr, *f_mirrored_end), *g_ptr);
+
+      ++f_ptr;
+      ++g_ptr;
+    }
+
+    // The central element of an odd-sized kernel. It is zero for antisymmetric
+    // kernels.
+    if constexpr (!IsAntisymmetric) {
+      if (num_samples & 1) {
+        output = MultiplyAdd(output, *f_ptr, *g_ptr);
+      }
+    }
+
+    return output;
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core::kernel::experimental::dot_symmetric_internal
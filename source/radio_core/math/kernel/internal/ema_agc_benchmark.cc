@@ -0,0 +1,78 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "radio_core/benchmark/base_app.h"
+#include "radio_core/math/kernel/ema_agc.h"
+#include "radio_core/math/math.h"
+
+namespace radio_core::benchmark {
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+class EMAAGCBenchmark : public Benchmark {
+ public:
+  using Benchmark::Benchmark;
+
+ protected:
+  auto GetBenchmarkName() -> std::string override {
+    return "EMAAGC<float>()";
+  }
+
+  void Initialize() override {
+    const int num_samples = GetNumSamples();
+
+    samples_.resize(num_samples);
+    output_.resize(num_samples);
+
+    std::random_device random_device;
+    std::mt19937 random_engine(random_device());
+    std::uniform_real_distribution<float> distribution(-1, 1);
+
+    for (float& sample : samples_) {
+      sample = distribution(random_engine);
+    }
+
+    cout << endl;
+    cout << "Configuration" << endl;
+    cout << "=============" << endl;
+
+    cout << "Number of samples    : " << GetNumSamples() << endl;
+    cout << "Number of iterations : " << GetNumIterations() << endl;
+  }
+
+  void Iteration() override {
+    kernel::EMAAGC<float>(samples_, output_, 0.007f, 0.00003f, charge_);
+  }
+
+  void Finalize() override {
+    // Sanity check and endurance that the evaluation is not optimized out.
+    for (const float sample : output_) {
+      if (!IsFinite(sample)) {
+        cerr << "Result has non-finite values" << endl;
+        ::exit(1);
+      }
+    }
+  }
+
+ private:
+  auto GetNumSamples() const -> int { return 65536; }
+
+  std::vector<float> samples_;
+  std::vector<float> output_;
+
+  float charge_{0};
+};
+
+}  // namespace radio_core::benchmark
+
+auto main(int argc, char** argv) -> int {
+  radio_core::benchmark::EMAAGCBenchmark app;
+  return app.Run(argc, argv);
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/math/kernel/ema_agc.h"
+
+#include <array>
+#include <vector>
+
+#include "radio_core/unittest/test.h"
+
+namespace radio_core {
+
+TEST(EMAAGC, Double) {
+  const auto samples = std::to_array<double>({0, 1, 2, -4, 0.5});
+  std::array<double, 5> output;
+
+  double charge = 0;
+  kernel::EMAAGC<double>(samples, output, 0.5, 0.25, charge);
+
+  // Charge: 0, 0.5, 1.25, 2.625, 2.09375.
+  EXPECT_EQ(output[0], 0.0);
+  EXPECT_NEAR(output[1], 1 / 0.5, 1e-12);
+  EXPECT_NEAR(output[2], 2 / 1.25, 1e-12);
+  EXPECT_NEAR(output[3], -4 / 2.625, 1e-12);
+  EXPECT_NEAR(output[4], 0.5 / 2.09375, 1e-12);
+
+  EXPECT_NEAR(charge, 2.09375, 1e-12);
+}
+
+// Compare the vectorized float implementation with the scalar one, for
+// different number of samples to cover all the code paths.
+TEST(EMAAGC, Float) {
+  for (size_t num_samples = 0; num_samples < 200; num_samples += 7) {
+    std::vector<float> samples(num_samples);
+    for (size_t i = 0; i < num_samples; ++i) {
+      // Start with silence to cover the zero charge.
+      samples[i] = i < 3 ? 0.0f : float(int(i * 37 % 11) - 5) * 0.1f;
+    }
+
+    std::vector<double> samples_double(samples.begin(), samples.end());
+    std::vector<double> expected(num_samples);
+    double expected_charge = 0;
+    kernel::EMAAGC<double>(
+        samples_double, expected, 0.1, 0.01, expected_charge);
+
+    // In-place processing.
+    std::vector<float> actual = samples;
+    float actual_charge = 0;
+    kernel::EMAAGC<float>(actual, actual, 0.1f, 0.01f, actual_charge);
+
+    for (size_t i = 0; i < num_samples; ++i) {
+      EXPECT_NEAR(actual[i], float(expected[i]), 1e-4f)
+          << "num_samples=" << num_samples << " i=" << i;
+    }
+    EXPECT_NEAR(actual_charge, float(expected_charge), 1e-5f);
+  }
+}
+
+}  // namespace radio_core
@@ -0,0 +1,131 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of the EMA AGC kernel which uses the available vectorized
+// types on the current platform.
+//
+// The charge is a recursive filter of the sample magnitude, so it is calculated
+// sample-by-sample, and its dependency chain bounds the throughput of the
+// kernel. The division of the samples by the charge is moved out of this loop
+// and is performed for a chunk of samples at once using vectorized types. This
+// matters on platforms where the scalar division is slow and does not overlap
+// well with the recursion.
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <span>
+
+#include "radio_core/base/algorithm.h"
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/kernel/internal/kernel_common.h"
+#include "radio_core/math/math.h"
+
+namespace radio_core::kernel::ema_agc_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, bool SpecializationMarker>
+struct Kernel {
+  // Number of samples for which the charge is calculated prior to the
+  // normalization.
+  static constexpr size_t kChunkSize = 64;
+
+  static inline auto Execute(const std::span<const T> input_samples,
+                             const std::span<T> output_samples,
+                             const T charge_rate,
+                             const T discharge_rate,
+                             T& charge) -> std::span<T> {
+    using kernel_internal::VectorizedBase;
+
+    using Type4 = typename VectorizedBase<T>::template VectorizedType<4>;
+    using Type8 = typename VectorizedBase<T>::template VectorizedType<8>;
+
+    assert(input_samples.size() <= output_samples.size());
+
+    const size_t num_samples = input_samples.size();
+
+    std::array<T, kChunkSize> chunk_charge;
+
+    for (size_t chunk_begin = 0; chunk_begin < num_samples;
+         chunk_begin += kChunkSize) {
+      const size_t chunk_size = Min(kChunkSize, num_samples - chunk_begin);
+
+      const T* input_ptr = input_samples.data() + chunk_begin;
+      T* output_ptr = output_samples.data() + chunk_begin;
+
+      // Calculate the charge for every sample of the chunk.
+      //
+      // Keep the branch: the charge follows the envelope of the signal, so the
+      // comparison is well predicted, and the speculation takes the comparison
+      // out of the dependency chain between the samples.
+      T current_charge = charge;
+      for (size_t i = 0; i < chunk_size; ++i) {
+        const T abs_sample = radio_core::Abs(input_ptr[i]);
+        if (abs_sample > current_charge) {
+          current_charge = Lerp(current_charge, abs_sample, charge_rate);
+        } else {
+          current_charge = Lerp(current_charge, abs_sample, discharge_rate);
+        }
+        chunk_charge[i] = current_charge;
+      }
+      charge = current_charge;
+
+      // Normalize the samples.
+      //
+      // The charge is never negative, and the samples with zero charge are
+      // output as zero to avoid division by zero.
+      const T* charge_ptr = chunk_charge.data();
+      const T* chunk_end = input_ptr + chunk_size;
+
+      if constexpr (Type8::kIsVectorized) {
+        const T* aligned_chunk_end = input_ptr + (chunk_size & ~size_t(7));
+
+        const Type8 zero8(T(0));
+
+        while (input_ptr < aligned_chunk_end) {
+          const Type8 samples8(input_ptr);
+          const Type8 charge8(charge_ptr);
+
+          Select(charge8 > zero8, samples8 / charge8, zero8).Store(output_ptr);
+
+          input_ptr += 8;
+          charge_ptr += 8;
+          output_ptr += 8;
+        }
+      }
+
+      if constexpr (Type4::kIsVectorized) {
+        const T* aligned_chunk_end =
+            chunk_end - (size_t(chunk_end - input_ptr) & size_t(3));
+
+        const Type4 zero4(T(0));
+
+        while (input_ptr < aligned_chunk_end) {
+          const Type4 samples4(input_ptr);
+          const Type4 charge4(charge_ptr);
+
+          Select(charge4 > zero4, samples4 / charge4, zero4).Store(output_ptr);
+
+          input_ptr += 4;
+          charge_ptr += 4;
+          output_ptr += 4;
+        }
+      }
+
+      while (input_ptr < chunk_end) {
+        *output_ptr = (*charge_ptr == 0) ? T(0) : *input_ptr / *charge_ptr;
+
+        ++input_ptr;
+        ++charge_ptr;
+        ++output_ptr;
+      }
+    }
+
+    return output_samples.subspan(0, num_samples);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core::kernel::ema_agc_internal
@@ -19,6 +19,7 @@
 #  include "radio_core/math/math.h"
 
 namespace radio_core::kernel::fast_abs_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T, bool SpecializationMarker>
 struct Kernel;
@@ -125,6 +126,7 @@ struct Kernel<HalfComplex, HalfComplex8::kIsVectorized> {
 
 #  endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::fast_abs_internal
 
 #endif  // ISA_CPU_ARM_NEON
@@ -26,6 +26,7 @@
 #  endif
 
 namespace radio_core::kernel::fast_arg_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class Real, bool SpecializationMarker>
 struct Kernel;
@@ -133,6 +134,7 @@ struct Kernel<Half, true> {
 
 #  endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::fast_arg_internal
 
 #endif  // ISA_CPU_ARM_NEON
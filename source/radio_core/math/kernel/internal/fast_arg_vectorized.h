@@ -11,10 +11,12 @@
 #include <cassert>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/kernel/internal/kernel_common.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core::kernel::fast_arg_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class Real, bool SpecializationMarker>
 struct Kernel {
@@ -91,4 +93,5 @@ struct Kernel {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::fast_arg_internal
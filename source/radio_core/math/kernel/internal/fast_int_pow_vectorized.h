@@ -11,11 +11,13 @@
 #include <cassert>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/base_complex.h"
 #include "radio_core/math/kernel/internal/kernel_common.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core::kernel::fast_int_pow_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class RealType, bool SpecializationMarker>
 struct Kernel {
@@ -89,4 +91,5 @@ struct Kernel {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::fast_int_pow_internal
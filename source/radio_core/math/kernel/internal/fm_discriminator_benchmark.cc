@@ -0,0 +1,148 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Benchmark of the FM discriminator.
+//
+// Compare the calculation of the phase angles followed by a scalar unwrap of
+// their difference with the FMDiscriminator() kernel:
+//
+//   ./radio_core_math_kernel_fm_discriminator_benchmark unwrap
+//   ./radio_core_math_kernel_fm_discriminator_benchmark discriminator
+
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "radio_core/benchmark/base_app.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/kernel/fast_arg.h"
+#include "radio_core/math/kernel/fm_discriminator.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal/frequency.h"
+
+namespace radio_core::benchmark {
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+class FMDiscriminatorBenchmark : public Benchmark {
+ public:
+  using Benchmark::Benchmark;
+
+ protected:
+  auto GetBenchmarkName() -> std::string override {
+    return "FMDiscriminator<T>()";
+  }
+
+  void ConfigureParser(argparse::ArgumentParser& parser) override {
+    parser.add_argument("implementation")
+        .help("Implementation of the discriminator: " +
+              std::string(kSupportedImplementationsListString));
+  }
+
+  auto HandleArguments(argparse::ArgumentParser& parser) -> bool override {
+    const auto implementation = parser.get<std::string>("implementation");
+    if (implementation == "unwrap") {
+      implementation_ = Implementation::kUnwrap;
+    } else if (implementation == "discriminator") {
+      implementation_ = Implementation::kDiscriminator;
+    } else {
+      cerr << "Unknown implementation " << implementation << endl;
+      cerr << "Supported: " << kSupportedImplementationsListString << endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  void Initialize() override {
+    cout << endl;
+    cout << "Configuration" << endl;
+    cout << "=============" << endl;
+
+    switch (implementation_) {
+      case Implementation::kUnwrap:
+        cout << "Implementation       : unwrap" << endl;
+        break;
+      case Implementation::kDiscriminator:
+        cout << "Implementation       : discriminator" << endl;
+        break;
+    }
+
+    const int num_samples = GetNumSamples();
+
+    samples_.resize(num_samples);
+    frequency_.resize(num_samples);
+
+    std::random_device random_device;
+    std::mt19937 random_engine(random_device());
+    std::uniform_real_distribution<float> distribution(-1, 1);
+
+    for (Complex& sample : samples_) {
+      sample =
+          Complex(distribution(random_engine), distribution(random_engine));
+    }
+
+    cout << "Number of samples    : " << GetNumSamples() << endl;
+    cout << "Number of iterations : " << GetNumIterations() << endl;
+  }
+
+  void Iteration() override {
+    switch (implementation_) {
+      case Implementation::kUnwrap: {
+        kernel::FastArg<float>(samples_, frequency_);
+        for (float& sample : frequency_) {
+          const float phase = sample;
+          sample = signal::WrapInstantFrequency(phase - prev_phase_) * kGain;
+          prev_phase_ = phase;
+        }
+        break;
+      }
+
+      case Implementation::kDiscriminator:
+        kernel::FMDiscriminator<float>(
+            samples_, frequency_, kGain, prev_sample_);
+        break;
+    }
+  }
+
+  void Finalize() override {
+    // Sanity check and endurance that the evaluation is not optimized out.
+    for (const float frequency : frequency_) {
+      if (!IsFinite(frequency)) {
+        cerr << "Result has non-finite values" << endl;
+        ::exit(1);
+      }
+    }
+  }
+
+ private:
+  enum class Implementation {
+    kUnwrap,
+    kDiscriminator,
+  };
+  static constexpr std::string_view kSupportedImplementationsListString =
+      "unwrap, discriminator";
+
+  static constexpr float kGain = 1.5f;
+
+  Implementation implementation_;
+
+  auto GetNumSamples() const -> int { return 65536; }
+
+  std::vector<Complex> samples_;
+  std::vector<float> frequency_;
+
+  float prev_phase_{0};
+  Complex prev_sample_{1, 0};
+};
+
+}  // namespace radio_core::benchmark
+
+auto main(int argc, char** argv) -> int {
+  radio_core::benchmark::FMDiscriminatorBenchmark app;
+  return app.Run(argc, argv);
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/math/kernel/fm_discriminator.h"
+
+#include <vector>
+
+#include "radio_core/base/half.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/unittest/mock.h"
+#include "radio_core/unittest/test.h"
+
+#if RADIO_CORE_HAVE_HALF
+#  include "radio_core/math/half_complex.h"
+#endif
+
+namespace radio_core::kernel {
+
+using testing::FloatNear;
+using testing::Pointwise;
+
+namespace {
+
+// Generate samples of a signal with the phase advancing by the given step
+// alternating its sign every 5 samples. The amplitude of the signal varies
+// around the given scale.
+template <class T>
+auto GenerateSamples(const size_t num_samples,
+                     const float phase_step,
+                     const float amplitude_scale = 1.0f)
+    -> std::vector<BaseComplex<T>> {
+  std::vector<BaseComplex<T>> samples(num_samples);
+  float phase = 0;
+  for (size_t i = 0; i < num_samples; ++i) {
+    phase += ((i / 5) & 1) ? -phase_step : phase_step;
+    const float amplitude = (0.5f + float(i % 3) * 0.25f) * amplitude_scale;
+    samples[i] = BaseComplex<T>(T(amplitude * Cos(phase)),
+                                T(amplitude * Sin(phase)));
+  }
+  return samples;
+}
+
+// Expected output for the samples generated by GenerateSamples().
+auto GenerateExpected(const size_t num_samples,
+                      const float phase_step,
+                      const float gain) -> std::vector<float> {
+  std::vector<float> expected(num_samples);
+  for (size_t i = 0; i < num_samples; ++i) {
+    expected[i] = (((i / 5) & 1) ? -phase_step : phase_step) * gain;
+  }
+  return expected;
+}
+
+}  // namespace
+
+TEST(FMDiscriminator, Complex) {
+  // Cover the vectorized loops and the tail, as well as the wrap-around of the
+  // phase.
+  for (const size_t num_samples : {1, 3, 4, 9, 13, 40, 41}) {
+    const std::vector<Complex> samples =
+        GenerateSamples<float>(num_samples, 2.5f);
+
+    std::vector<float> output(num_samples);
+    Complex prev_sample(1, 0);
+    FMDiscriminator<float>(samples, output, 2.0f, prev_sample);
+
+    EXPECT_THAT(output,
+                Pointwise(FloatNear(2e-2f),
+                          GenerateExpected(num_samples, 2.5f, 2.0f)))
+        << "num_samples=" << num_samples;
+    EXPECT_EQ(prev_sample, samples.back());
+  }
+}
+
+// Processing of samples in multiple blocks gives the same result as processing
+// them in one go.
+TEST(FMDiscriminator, MultipleBlocks) {
+  const std::vector<Complex> samples = GenerateSamples<float>(64, 0.3f);
+
+  std::vector<float> expected(samples.size());
+  {
+    Complex prev_sample(1, 0);
+    FMDiscriminator<float>(samples, expected, 1.0f, prev_sample);
+  }
+
+  std::vector<float> output(samples.size());
+  {
+    Complex prev_sample(1, 0);
+    const std::span<const Complex> samples_span(samples);
+    const std::span<float> output_span(output);
+    size_t offset = 0;
+    for (const size_t block_size : {1, 7, 20, 3, 33}) {
+      FMDiscriminator<float>(samples_span.subspan(offset, block_size),
+                             output_span.subspan(offset),
+                             1.0f,
+                             prev_sample);
+      offset += block_size;
+    }
+    ASSERT_EQ(offset, samples.size());
+  }
+
+  EXPECT_THAT(output, Pointwise(FloatNear(1e-6f), expected));
+}
+
+#if RADIO_CORE_HAVE_HALF
+
+TEST(FMDiscriminator, HalfComplex) {
+  for (const size_t num_samples : {1, 3, 4, 9, 13, 40, 41}) {
+    const std::vector<HalfComplex> samples =
+        GenerateSamples<Half>(num_samples, 2.5f);
+
+    std::vector<Half> output(num_samples);
+    HalfComplex prev_sample(1, 0);
+    FMDiscriminator<Half>(samples, output, Half(2.0f), prev_sample);
+
+    std::vector<float> output_float(output.begin(), output.end());
+    EXPECT_THAT(output_float,
+                Pointwise(FloatNear(5e-2f),
+                          GenerateExpected(num_samples, 2.5f, 2.0f)))
+        << "num_samples=" << num_samples;
+  }
+}
+
+// The samples of a typical magnitude of the IQ samples, for which the product
+// of the samples is below the normal range of the half precision values.
+TEST(FMDiscriminator, HalfComplexSmallMagnitude) {
+  for (const size_t num_samples : {41, 600}) {
+    const std::vector<HalfComplex> samples =
+        GenerateSamples<Half>(num_samples, 0.3f, 1e-3f);
+
+    std::vector<Half> output(num_samples);
+    HalfComplex prev_sample = samples.front();
+    FMDiscriminator<Half>(std::span(samples).subspan(1),
+                          std::span(output).subspan(1),
+                          Half(2.0f),
+                          prev_sample);
+
+    std::vector<float> output_float(output.begin() + 1, output.end());
+    const std::vector<float> expected =
+        GenerateExpected(num_samples, 0.3f, 2.0f);
+    EXPECT_THAT(output_float,
+                Pointwise(FloatNear(2e-2f), std::span(expected).subspan(1)))
+        << "num_samples=" << num_samples;
+    EXPECT_EQ(prev_sample, samples.back());
+  }
+}
+
+#endif
+
+}  // namespace radio_core::kernel
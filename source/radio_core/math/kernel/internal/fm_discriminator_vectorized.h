@@ -0,0 +1,109 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of the FMDiscriminator() kernel which uses the available
+// vectorized types on the current platform.
+//
+// The previous samples are loaded from the input buffer with an offset of one
+// sample, so that there is no dependency between the lanes.
+
+#pragma once
+
+#include <cassert>
+#include <span>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/kernel/internal/kernel_common.h"
+#include "radio_core/math/math.h"
+
+namespace radio_core::kernel::fm_discriminator_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class Real, bool SpecializationMarker>
+struct Kernel {
+  using RealComplex = BaseComplex<Real>;
+
+  static inline auto Execute(const std::span<const RealComplex>& input_samples,
+                             const std::span<Real>& output_samples,
+                             const Real gain,
+                             RealComplex& prev_sample) -> std::span<Real> {
+    using kernel_internal::VectorizedBase;
+
+    using RealComplex4 =
+        typename VectorizedBase<RealComplex>::template VectorizedType<4>;
+    using RealComplex8 =
+        typename VectorizedBase<RealComplex>::template VectorizedType<8>;
+
+    using Real4 = typename VectorizedBase<Real>::template VectorizedType<4>;
+    using Real8 = typename VectorizedBase<Real>::template VectorizedType<8>;
+
+    assert(input_samples.size() <= output_samples.size());
+
+    const size_t num_samples = input_samples.size();
+    if (num_samples == 0) {
+      return output_samples.subspan(0, 0);
+    }
+
+    const RealComplex* __restrict input_ptr = input_samples.data();
+    Real* __restrict output_ptr = output_samples.data();
+
+    const RealComplex* input_end = input_ptr + num_samples;
+
+    // The first sample uses the previous sample from the previous block.
+    *output_ptr = FastArg(*input_ptr * Conj(prev_sample)) * gain;
+    ++input_ptr;
+    ++output_ptr;
+
+    // Handle 8 elements at a time.
+    if constexpr (RealComplex8::kIsVectorized) {
+      const size_t num_remaining_samples = input_end - input_ptr;
+      const RealComplex* aligned_input_end =
+          input_ptr + (num_remaining_samples & ~size_t(7));
+
+      while (input_ptr < aligned_input_end) {
+        const RealComplex8 samples8(input_ptr);
+        const RealComplex8 prev_samples8(input_ptr - 1);
+
+        const Real8 frequency8 = FastArg(samples8 * Conj(prev_samples8)) * gain;
+        frequency8.Store(output_ptr);
+
+        input_ptr += 8;
+        output_ptr += 8;
+      }
+    }
+
+    // Handle 4 elements at a time.
+    if constexpr (RealComplex4::kIsVectorized) {
+      const size_t num_remaining_samples = input_end - input_ptr;
+      const RealComplex* aligned_input_end =
+          input_ptr + (num_remaining_samples & ~size_t(3));
+
+      while (input_ptr < aligned_input_end) {
+        const RealComplex4 samples4(input_ptr);
+        const RealComplex4 prev_samples4(input_ptr - 1);
+
+        const Real4 frequency4 = FastArg(samples4 * Conj(prev_samples4)) * gain;
+        frequency4.Store(output_ptr);
+
+        input_ptr += 4;
+        output_ptr += 4;
+      }
+    }
+
+    // Handle the remaining tail.
+    while (input_ptr < input_end) {
+      *output_ptr = FastArg(*input_ptr * Conj(*(input_ptr - 1))) * gain;
+
+      ++input_ptr;
+      ++output_ptr;
+    }
+
+    prev_sample = input_samples.back();
+
+    return output_samples.subspan(0, num_samples);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core::kernel::fm_discriminator_internal
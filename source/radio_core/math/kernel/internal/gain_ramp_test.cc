@@ -0,0 +1,83 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/math/kernel/gain_ramp.h"
+
+#include <array>
+#include <vector>
+
+#include "radio_core/base/algorithm.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core {
+
+TEST(GainRamp, Double) {
+  const auto samples = std::to_array<double>({1, 2, 3, -4, -5});
+  std::array<double, 5> output;
+
+  double gain = 0.25;
+  kernel::GainRamp<double>(samples, output, gain, 0.25, 1.0);
+
+  EXPECT_NEAR(output[0], 0.25, 1e-12);
+  EXPECT_NEAR(output[1], 1.0, 1e-12);
+  EXPECT_NEAR(output[2], 2.25, 1e-12);
+  EXPECT_NEAR(output[3], -4.0, 1e-12);
+  EXPECT_NEAR(output[4], -5.0, 1e-12);
+
+  EXPECT_EQ(gain, 1.0);
+}
+
+// Compare the vectorized float implementation with the scalar one, for
+// different number of samples to cover all the code paths.
+TEST(GainRamp, Float) {
+  for (size_t num_samples = 0; num_samples < 40; ++num_samples) {
+    std::vector<float> samples(num_samples);
+    for (size_t i = 0; i < num_samples; ++i) {
+      samples[i] = float(i % 7) - 3.0f;
+    }
+
+    std::vector<double> samples_double(samples.begin(), samples.end());
+    std::vector<double> expected(num_samples);
+    double expected_gain = 0.1;
+    kernel::GainRamp<double>(
+        samples_double, expected, expected_gain, 0.03, 1.0);
+
+    // In-place processing.
+    std::vector<float> actual = samples;
+    float actual_gain = 0.1f;
+    kernel::GainRamp<float>(actual, actual, actual_gain, 0.03f, 1.0f);
+
+    for (size_t i = 0; i < num_samples; ++i) {
+      EXPECT_NEAR(actual[i], float(expected[i]), 1e-5f)
+          << "num_samples=" << num_samples << " i=" << i;
+    }
+    EXPECT_NEAR(actual_gain, float(expected_gain), 1e-5f);
+  }
+}
+
+// Continue the ramp over multiple blocks.
+TEST(GainRamp, Continuation) {
+  const std::vector<float> samples(100, 1.0f);
+
+  std::vector<float> output(samples.size());
+  float gain = 0;
+
+  const std::span<const float> samples_span(samples);
+  const std::span<float> output_span(output);
+  for (size_t i = 0; i < samples.size(); i += 13) {
+    const size_t num_samples = Min(size_t(13), samples.size() - i);
+    kernel::GainRamp<float>(samples_span.subspan(i, num_samples),
+                            output_span.subspan(i, num_samples),
+                            gain,
+                            0.02f,
+                            1.0f);
+  }
+
+  for (size_t i = 0; i < samples.size(); ++i) {
+    EXPECT_NEAR(output[i], Min(1.0f, float(i) * 0.02f), 1e-5f) << "i=" << i;
+  }
+  EXPECT_EQ(gain, 1.0f);
+}
+
+}  // namespace radio_core
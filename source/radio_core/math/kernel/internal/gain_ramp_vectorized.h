@@ -0,0 +1,107 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Implementation of the gain ramp kernel which uses the available vectorized
+// types on the current platform.
+//
+// The gain of the k-th sample of the block is calculated directly as
+// Min(max_gain, gain + k * gain_increment) rather than accumulated, which
+// removes the dependency between the lanes. The result is the same as the
+// scalar accumulation, up to the floating point round-off.
+
+#pragma once
+
+#include <cassert>
+#include <span>
+
+#include "radio_core/base/algorithm.h"
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/kernel/internal/kernel_common.h"
+#include "radio_core/math/math.h"
+
+namespace radio_core::kernel::gain_ramp_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+template <class T, bool SpecializationMarker>
+struct Kernel {
+  static inline auto Execute(const std::span<const T> input_samples,
+                             const std::span<T> output_samples,
+                             T& gain,
+                             const T gain_increment,
+                             const T max_gain) -> std::span<T> {
+    using kernel_internal::VectorizedBase;
+
+    using Type4 = typename VectorizedBase<T>::template VectorizedType<4>;
+    using Type8 = typename VectorizedBase<T>::template VectorizedType<8>;
+
+    assert(input_samples.size() <= output_samples.size());
+    assert(gain_increment >= 0);
+
+    const size_t num_samples = input_samples.size();
+
+    const T* input_ptr = input_samples.data();
+    T* output_ptr = output_samples.data();
+
+    const T* input_begin = input_ptr;
+    const T* input_end = input_ptr + num_samples;
+
+    if constexpr (Type8::kIsVectorized) {
+      const size_t num_samples_aligned = num_samples & ~size_t(7);
+      const T* aligned_input_end = input_begin + num_samples_aligned;
+
+      const Type8 max_gain8(max_gain);
+      const Type8 lane_increment8 =
+          Type8(T(0), T(1), T(2), T(3), T(4), T(5), T(6), T(7)) *
+          gain_increment;
+      const T block_increment = gain_increment * 8;
+
+      while (input_ptr < aligned_input_end) {
+        const Type8 gain8 = Min(max_gain8, Type8(gain) + lane_increment8);
+        const Type8 samples8(input_ptr);
+
+        (samples8 * gain8).Store(output_ptr);
+
+        gain = Min(max_gain, gain + block_increment);
+
+        input_ptr += 8;
+        output_ptr += 8;
+      }
+    }
+
+    if constexpr (Type4::kIsVectorized) {
+      const size_t num_samples_aligned = num_samples & ~size_t(3);
+      const T* aligned_input_end = input_begin + num_samples_aligned;
+
+      const Type4 max_gain4(max_gain);
+      const Type4 lane_increment4 =
+          Type4(T(0), T(1), T(2), T(3)) * gain_increment;
+      const T block_increment = gain_increment * 4;
+
+      while (input_ptr < aligned_input_end) {
+        const Type4 gain4 = Min(max_gain4, Type4(gain) + lane_increment4);
+        const Type4 samples4(input_ptr);
+
+        (samples4 * gain4).Store(output_ptr);
+
+        gain = Min(max_gain, gain + block_increment);
+
+        input_ptr += 4;
+        output_ptr += 4;
+      }
+    }
+
+    while (input_ptr < input_end) {
+      *output_ptr = *input_ptr * gain;
+      gain = Min(max_gain, gain + gain_increment);
+
+      ++input_ptr;
+      ++output_ptr;
+    }
+
+    return output_samples.subspan(0, num_samples);
+  }
+};
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core::kernel::gain_ramp_internal
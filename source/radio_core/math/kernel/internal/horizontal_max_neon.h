@@ -21,6 +21,7 @@
 #  endif
 
 namespace radio_core::kernel::horizontal_max_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Specialization for HorizontalMax<float>
 template <>
@@ -180,6 +181,7 @@ struct Kernel<Half, Half8::kIsVectorized> {
 
 #  endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::horizontal_max_internal
 
 #endif  // ISA_CPU_ARM_NEON
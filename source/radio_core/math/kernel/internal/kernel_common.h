@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/vectorized_complex_type.h"
@@ -22,6 +23,7 @@
 #endif
 
 namespace radio_core::kernel::kernel_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Accessor to a vectorized type for the type T.
 //
@@ -62,4 +64,5 @@ struct VectorizedBase<BaseComplex<Half>> {
 };
 #endif
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::kernel_internal
@@ -11,10 +11,12 @@
 #include <cassert>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/kernel/internal/kernel_common.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core::kernel::power_spectral_density_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class Real, bool SpecializationMarker>
 struct Kernel {
@@ -84,4 +86,5 @@ struct Kernel {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::power_spectral_density_internal
@@ -26,7 +26,7 @@ using std::cerr;
 using std::cout;
 using std::endl;
 
-class FastAbsBenchmark : public Benchmark {
+class RotatorBenchmark : public Benchmark {
  public:
   using Benchmark::Benchmark;
 
@@ -38,6 +38,11 @@ class FastAbsBenchmark : public Benchmark {
         .help("Type of arguments: " +
               std::string(kSupportedInputSampleTypesListString));
 
+    parser.add_argument("--num-samples")
+        .default_value(65536)
+        .help("The number of samples rotated in a single kernel invocation")
+        .scan<'i', int>();
+
 #if defined(WITH_BENCHMARKS_VOLK)
     parser.add_argument("--use-volk")
         .help("Benchmark using implementation from the Volk library: ")
@@ -47,6 +52,8 @@ class FastAbsBenchmark : public Benchmark {
   }
 
   auto HandleArguments(argparse::ArgumentParser& parser) -> bool override {
+    num_samples_ = parser.get<int>("--num-samples");
+
     const auto input_sample_type = parser.get<std::string>("input_sample_type");
     if (input_sample_type == "complex") {
       input_sample_type_ = InputSampleType::kComplex;
@@ -126,9 +133,8 @@ class FastAbsBenchmark : public Benchmark {
         } else
 #endif
         {
-          Complex phase(1.0f, 0.0f);
           kernel::Rotator<float>(complex_data_.samples,
-                                 phase,
+                                 complex_data_.phase,
                                  Complex(Cos(-0.1f), Sin(-0.1f)),
                                  complex_data_.samples);
         }
@@ -137,9 +143,8 @@ class FastAbsBenchmark : public Benchmark {
 
 #if RADIO_CORE_HAVE_HALF
       case InputSampleType::kHalfComplex:
-        HalfComplex phase(1.0f, 0.0f);
         kernel::Rotator<Half>(half_complex_data_.samples,
-                              phase,
+                              half_complex_data_.phase,
                               HalfComplex(Cos(-0.1f), Sin(-0.1f)),
                               half_complex_data_.samples);
         break;
@@ -152,6 +157,10 @@ class FastAbsBenchmark : public Benchmark {
 
     bool has_non_finite = false;
 
+    // The rotator re-normalizes the phase, so its magnitude is expected to stay
+    // close to 1 regardless of the number of iterations.
+    float phase_magnitude_error = 0;
+
     switch (input_sample_type_) {
       case InputSampleType::kComplex:
         for (const Complex& sample : complex_data_.samples) {
@@ -159,6 +168,7 @@ class FastAbsBenchmark : public Benchmark {
             has_non_finite = true;
           }
         }
+        phase_magnitude_error = Abs(Abs(complex_data_.phase) - 1.0f);
         break;
 
 #if RADIO_CORE_HAVE_HALF
@@ -168,6 +178,8 @@ class FastAbsBenchmark : public Benchmark {
             has_non_finite = true;
           }
         }
+        phase_magnitude_error =
+            Abs(float(Abs(half_complex_data_.phase)) - 1.0f);
         break;
 #endif
     }
@@ -176,6 +188,12 @@ class FastAbsBenchmark : public Benchmark {
       std::cerr << "Result has non-finite values" << std::endl;
       ::exit(1);
     }
+
+    if (phase_magnitude_error > 1e-2f) {
+      std::cerr << "Phase magnitude drifted by " << phase_magnitude_error
+                << std::endl;
+      ::exit(1);
+    }
   }
 
  private:
@@ -193,13 +211,18 @@ class FastAbsBenchmark : public Benchmark {
       ;
 
   InputSampleType input_sample_type_;
+  int num_samples_{65536};
 
   template <class T>
   struct Data {
     std::vector<BaseComplex<T>> samples;
+
+    // The phase is carried over between iterations, simulating a rotator
+    // which runs continuously on a stream of samples.
+    BaseComplex<T> phase{T(1), T(0)};
   };
 
-  auto GetNumSamples() const -> int { return 65536; }
+  auto GetNumSamples() const -> int { return num_samples_; }
 
   template <class T>
   void InitializeData(Data<T>& data) {
@@ -231,6 +254,6 @@ class FastAbsBenchmark : public Benchmark {
 }  // namespace radio_core::benchmark
 
 auto main(int argc, char** argv) -> int {
-  radio_core::benchmark::FastAbsBenchmark app;
+  radio_core::benchmark::RotatorBenchmark app;
   return app.Run(argc, argv);
 }
@@ -5,6 +5,7 @@
 #include "radio_core/math/kernel/rotator.h"
 
 #include <array>
+#include <vector>
 
 #include "radio_core/base/half.h"
 #include "radio_core/math/complex.h"
@@ -37,6 +38,42 @@ TEST(Rotator, Complex) {
   }
 }
 
+// Number of samples which is not a multiple of the vector size, so that the
+// phase is to be carried over from the vectorized loops to the scalar tail.
+TEST(Rotator, ComplexUnaligned) {
+  std::array<Complex, 45> samples{};
+  for (int i = 0; i < samples.size(); ++i) {
+    samples[i].real = Cos(0.1f * float(i));
+    samples[i].imag = Sin(0.1f * float(i));
+  }
+
+  Complex phase(1.0f, 0.0f);
+  kernel::Rotator<float>(
+      samples, phase, Complex(Cos(-0.1f), Sin(-0.1f)), samples);
+
+  for (Complex& sample : samples) {
+    EXPECT_THAT(sample, ComplexNear(Complex(1, 0.0f), 1e-5f));
+  }
+
+  EXPECT_THAT(phase, ComplexNear(Complex(Cos(-4.5f), Sin(-4.5f)), 1e-5f));
+}
+
+// Rotate a long signal and make sure the magnitude of the rotated samples does
+// not drift away.
+TEST(Rotator, ComplexLongRun) {
+  std::vector<Complex> samples(100003, Complex(1, 0));
+
+  Complex phase(1.0f, 0.0f);
+  kernel::Rotator<float>(
+      samples, phase, Complex(Cos(0.1f), Sin(0.1f)), samples);
+
+  for (size_t i = 0; i < samples.size(); ++i) {
+    ASSERT_NEAR(Abs(samples[i]), 1.0f, 1e-5f) << "i=" << i;
+  }
+
+  EXPECT_NEAR(Abs(phase), 1.0f, 1e-6f);
+}
+
 #if RADIO_CORE_HAVE_HALF
 
 TEST(Rotator, HalfComplex) {
@@ -56,6 +93,28 @@ TEST(Rotator, HalfComplex) {
   }
 }
 
+// Rotate half precision samples with the phase tracked in single precision.
+// The number of samples is bigger than the internal chunk size, and the error
+// is only caused by the rounding of the samples to half precision.
+TEST(Rotator, HalfComplexSinglePrecisionPhase) {
+  std::vector<HalfComplex> samples(1003);
+  for (int i = 0; i < samples.size(); ++i) {
+    samples[i].real = Half(Cos(0.1f * float(i)));
+    samples[i].imag = Half(Sin(0.1f * float(i)));
+  }
+
+  Complex phase(1.0f, 0.0f);
+  kernel::Rotator(samples, phase, Complex(Cos(-0.1f), Sin(-0.1f)), samples);
+
+  for (HalfComplex& sample : samples) {
+    const Complex complex_sample(float(sample.real), float(sample.imag));
+    EXPECT_THAT(complex_sample, ComplexNear(Complex(1, 0.0f), 2e-3f));
+  }
+
+  EXPECT_THAT(phase,
+              ComplexNear(Complex(Cos(-100.3f), Sin(-100.3f)), 1e-4f));
+}
+
 #endif  // RADIO_CORE_HAVE_HALF
 
 }  // namespace radio_core::signal
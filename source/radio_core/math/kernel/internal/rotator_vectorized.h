@@ -3,18 +3,147 @@
 // SPDX-License-Identifier: MIT
 
 // Implementation of the rotator kernel which uses the available vectorized
-// types on the current platform. It does not perform any more specific
-// optimizations like utilization of multiple registers.
+// types on the current platform.
+//
+// The phases of the N consecutive samples are kept in the N lanes of a
+// vectorized register: phase, phase*inc, phase*inc^2, and so on. The lanes are
+// advanced by inc^N per step, which removes the per-sample dependency on the
+// phase update. Two such registers are advanced independently to hide latency
+// of the complex multiplication.
+//
+// The magnitude of the phase slowly drifts away from 1 due to the rounding
+// errors, so the lanes are renormalized once per block of samples.
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/kernel/internal/kernel_common.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core::kernel::rotator_internal {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+// Number of samples between renormalizations of the phase lanes.
+//
+// Must be a multiple of the number of samples processed by a single step of
+// the widest vectorized loop.
+inline constexpr size_t kRenormalizationInterval = 512;
+
+// Bring the magnitude of every lane of the phase back to 1.
+//
+// Uses single Newton-Raphson iteration of 1/sqrt(x) around x=1. The magnitude
+// only deviates from 1 by a few ULPs between the renormalizations, which makes
+// the single iteration to be as accurate as the division by the magnitude.
+template <class Real, int N>
+inline auto Renormalize(
+    const typename kernel_internal::VectorizedBase<
+        BaseComplex<Real>>::template VectorizedType<N>& phase) {
+  using kernel_internal::VectorizedBase;
+  using RealN = typename VectorizedBase<Real>::template VectorizedType<N>;
+
+  const RealN norm = Norm(phase);
+  const RealN scale = RealN(Real(1.5f)) - norm * Real(0.5f);
+
+  return phase * scale;
+}
+
+// Rotate given number of samples using N-lane registers.
+//
+// The number of samples is expected to be a multiple of N. The pointers are
+// advanced past the processed samples, and the phase is updated to the phase
+// of the sample which follows the last processed one.
+template <class Real, int N>
+inline void RotateVectorized(
+    const BaseComplex<Real>*& samples_ptr,
+    BaseComplex<Real>*& output_ptr,
+    const size_t num_samples,
+    BaseComplex<Real>& phase,
+    const BaseComplex<Real> phase_increment_per_sample) {
+  using kernel_internal::VectorizedBase;
+
+  using RealComplex = BaseComplex<Real>;
+  using RealComplexN =
+      typename VectorizedBase<RealComplex>::template VectorizedType<N>;
+
+  static_assert(kRenormalizationInterval % (2 * N) == 0);
+
+  assert(num_samples % N == 0);
+
+  using ComputeComplex = BaseComplex<ComputeType<Real>>;
+
+  // Phases of the 2*N consecutive samples starting from the current one, and
+  // the increment of the phase by 2*N samples.
+  //
+  // They are calculated in the compute type, and the increment is normalized
+  // to a unit magnitude. Otherwise the rounding error of the increment in
+  // half precision grows the magnitude of the lanes by percents on every block
+  // of samples.
+  using ComputeReal = ComputeType<Real>;
+  const ComputeComplex compute_phase(ComputeReal(phase.real),
+                                     ComputeReal(phase.imag));
+  const ComputeComplex compute_phase_increment(
+      ComputeReal(phase_increment_per_sample.real),
+      ComputeReal(phase_increment_per_sample.imag));
+
+  RealComplex lane_phase[2 * N];
+  ComputeComplex lane_increment(1, 0);
+  for (int i = 0; i < 2 * N; ++i) {
+    const ComputeComplex p = compute_phase * lane_increment;
+    lane_phase[i] = RealComplex(Real(p.real), Real(p.imag));
+    lane_increment *= compute_phase_increment;
+  }
+  lane_increment /= Abs(lane_increment);
+
+  RealComplexN phase_a(lane_phase);
+  RealComplexN phase_b(lane_phase + N);
+  const RealComplexN phase_increment(
+      RealComplex(Real(lane_increment.real), Real(lane_increment.imag)));
+
+  const RealComplex* samples_end = samples_ptr + num_samples;
+  const RealComplex* samples_pairs_end =
+      samples_ptr + (num_samples & ~size_t(2 * N - 1));
+
+  while (samples_ptr < samples_pairs_end) {
+    const size_t block_size =
+        std::min(kRenormalizationInterval,
+                 size_t(samples_pairs_end - samples_ptr));
+    const RealComplex* block_end = samples_ptr + block_size;
+
+    while (samples_ptr < block_end) {
+      const RealComplexN samples_a(samples_ptr);
+      const RealComplexN samples_b(samples_ptr + N);
+
+      (samples_a * phase_a).Store(output_ptr);
+      (samples_b * phase_b).Store(output_ptr + N);
+
+      phase_a *= phase_increment;
+      phase_b *= phase_increment;
+
+      samples_ptr += 2 * N;
+      output_ptr += 2 * N;
+    }
+
+    phase_a = Renormalize<Real, N>(phase_a);
+    phase_b = Renormalize<Real, N>(phase_b);
+  }
+
+  if (samples_ptr < samples_end) {
+    // Single register worth of samples remains.
+    const RealComplexN samples_a(samples_ptr);
+    (samples_a * phase_a).Store(output_ptr);
+
+    samples_ptr += N;
+    output_ptr += N;
+
+    phase = phase_b.template Extract<0>();
+  } else {
+    phase = phase_a.template Extract<0>();
+  }
+}
 
 template <class Real, bool SpecializationMarker>
 struct Kernel {
@@ -38,81 +167,25 @@ struct Kernel {
     const RealComplex* samples_ptr = samples.data();
     RealComplex* output_ptr = output.data();
 
-    const RealComplex* samples_begin = samples_ptr;
     const RealComplex* samples_end = samples_ptr + num_samples;
 
     if constexpr (RealComplex8::kIsVectorized) {
-      RealComplex phase_local_increment(1, 0);
-      RealComplex phase_data8[8] = {
-          phase, phase, phase, phase, phase, phase, phase, phase};
-      for (int i = 0; i < 8; ++i) {
-        phase_data8[i] *= phase_local_increment;
-        phase_local_increment *= phase_increment_per_sample;
-      }
-
-      // Per-element increment in phase by 8 samples.
-      const RealComplex8 phase_increment8(phase_local_increment);
-
-      // Nth element of the phase is advanced from N-1th by the phase increment
-      // per sample.
-      RealComplex8 phase8(phase_data8);
-
       const size_t num_samples_aligned = num_samples & ~size_t(7);
-      const RealComplex* aligned_samples_end =
-          samples_begin + num_samples_aligned;
-
-      while (samples_ptr < aligned_samples_end) {
-        // TODO(sergey): Investigate prefetching.
-
-        const RealComplex8 samples8(samples_ptr);
-        const RealComplex8 rotated8 = samples8 * phase8;
-
-        phase8 = phase8 * phase_increment8;
-
-        rotated8.Store(output_ptr);
-
-        samples_ptr += 8;
-        output_ptr += 8;
-      }
+      RotateVectorized<Real, 8>(samples_ptr,
+                                output_ptr,
+                                num_samples_aligned,
+                                phase,
+                                phase_increment_per_sample);
     }
 
-    // TODO(sergey): Investigate if auto-vectorization helps for non-explicitly
-    // vectorized complex4.
     if constexpr (RealComplex4::kIsVectorized) {
-      RealComplex phase_local_increment(1, 0);
-      RealComplex phase_data4[4] = {phase, phase, phase, phase};
-      for (int i = 0; i < 4; ++i) {
-        phase_data4[i] *= phase_local_increment;
-        phase_local_increment *= phase_increment_per_sample;
-      }
-
-      // Per-element increment in phase by 4 samples.
-      const RealComplex4 phase_increment4(phase_local_increment);
-
-      // Nth element of the phase is advanced from N-1th by the phase increment
-      // per sample.
-      RealComplex4 phase4(phase_data4);
-
-      const size_t num_samples_aligned = num_samples & ~size_t(3);
-      const RealComplex* aligned_samples_end =
-          samples_begin + num_samples_aligned;
-
-      while (samples_ptr < aligned_samples_end) {
-        // TODO(sergey): Investigate prefetching.
-
-        const RealComplex4 samples4(samples_ptr);
-
-        const RealComplex4 rotated4 = samples4 * phase4;
-
-        rotated4.Store(output_ptr);
-
-        phase4 = phase4 * phase_increment4;
-
-        samples_ptr += 4;
-        output_ptr += 4;
-      }
-
-      phase = phase4.template Extract<0>();
+      const size_t num_samples_aligned =
+          size_t(samples_end - samples_ptr) & ~size_t(3);
+      RotateVectorized<Real, 4>(samples_ptr,
+                                output_ptr,
+                                num_samples_aligned,
+                                phase,
+                                phase_increment_per_sample);
     }
 
     while (samples_ptr < samples_end) {
@@ -131,4 +204,5 @@ struct Kernel {
   }
 };
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel::rotator_internal
@@ -8,6 +8,7 @@
 
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/kernel/internal/norm_vectorized.h"
@@ -18,7 +19,12 @@
 
 #include "radio_core/math/kernel/internal/norm_neon.h"
 
+#if defined(WITH_KERNEL_DISPATCH)
+#  include "radio_core/math/kernel/dispatch.h"
+#endif
+
 namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // The output buffer must have at least same number of elements as the input
 // samples buffer. It is possible to have the output buffer bigger than input
@@ -53,7 +59,11 @@ inline auto Norm(const std::span<const BaseComplex<T>>& samples,
 template <>
 inline auto Norm(const std::span<const Complex>& samples,
                  const std::span<float>& arg) -> std::span<float> {
+#if defined(WITH_KERNEL_DISPATCH)
+  return dispatch::Norm(samples, arg);
+#else
   return norm_internal::Kernel<float, true>::Execute(samples, arg);
+#endif
 }
 
 #if RADIO_CORE_HAVE_HALF
@@ -65,4 +75,5 @@ inline auto Norm(const std::span<const HalfComplex>& samples,
 }
 #endif
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel
@@ -9,11 +9,17 @@
 #include <cassert>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 #include "radio_core/math/kernel/internal/peak_detector_vectorized.h"
 #include "radio_core/math/math.h"
 
+#if defined(WITH_KERNEL_DISPATCH)
+#  include "radio_core/math/kernel/dispatch.h"
+#endif
+
 namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Detect peaks using linear interpolation between current state of the peak
 // detector (stored in the `peak`) and the new samples. The peak is detected
@@ -66,8 +72,13 @@ inline auto PerPointLerpPeakDetector(const std::span<const float> samples,
                                      const float charge_rate,
                                      const float discharge_rate)
     -> std::span<float> {
+#if defined(WITH_KERNEL_DISPATCH)
+  return dispatch::PerPointLerpPeakDetector(
+      samples, peak, charge_rate, discharge_rate);
+#else
   return peak_detector_internal::Kernel<float, true>::Execute(
       samples, peak, charge_rate, discharge_rate);
+#endif
 }
 
 #if RADIO_CORE_HAVE_HALF
@@ -85,4 +96,5 @@ inline auto PerPointLerpPeakDetector(const std::span<const Half> samples,
 
 #endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel
@@ -16,6 +16,7 @@
 #include <cmath>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/kernel/internal/power_spectral_density_vectorized.h"
@@ -25,7 +26,12 @@
 #  include "radio_core/math/half_complex.h"
 #endif
 
+#if defined(WITH_KERNEL_DISPATCH)
+#  include "radio_core/math/kernel/dispatch.h"
+#endif
+
 namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // The output buffer must have at least same number of elements as the input
 // samples buffer. It is possible to have the output buffer bigger than input
@@ -38,8 +44,12 @@ namespace radio_core::kernel {
 inline auto PowerSpectralDensity(const std::span<const Complex> samples,
                                  const std::span<float> power)
     -> std::span<float> {
+#if defined(WITH_KERNEL_DISPATCH)
+  return dispatch::PowerSpectralDensity(samples, power);
+#else
   return power_spectral_density_internal::Kernel<float, true>::Execute(samples,
                                                                        power);
+#endif
 }
 
 #if RADIO_CORE_HAVE_HALF
@@ -53,4 +63,5 @@ inline auto PowerSpectralDensity(const std::span<const HalfComplex> samples,
 
 #endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel
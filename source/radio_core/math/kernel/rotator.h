@@ -9,8 +9,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <span>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/half.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/kernel/internal/rotator_vectorized.h"
@@ -19,7 +22,12 @@
 #  include "radio_core/math/half_complex.h"
 #endif
 
+#if defined(WITH_KERNEL_DISPATCH)
+#  include "radio_core/math/kernel/dispatch.h"
+#endif
+
 namespace radio_core::kernel {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Rotate input samples at a fixed rate per sample, staring from the given
 // phase.
@@ -71,8 +79,12 @@ inline auto Rotator(const std::span<const Complex> samples,
                     Complex& phase,
                     const Complex phase_increment_per_sample,
                     const std::span<Complex> output) -> std::span<Complex> {
+#if defined(WITH_KERNEL_DISPATCH)
+  return dispatch::Rotator(samples, phase, phase_increment_per_sample, output);
+#else
   return rotator_internal::Kernel<float, true>::Execute(
       samples, phase, phase_increment_per_sample, output);
+#endif
 }
 
 #if RADIO_CORE_HAVE_HALF
@@ -88,6 +100,48 @@ inline auto Rotator(const std::span<const HalfComplex> samples,
       samples, phase, phase_increment_per_sample, output);
 }
 
+// Rotation of half floating point precision complex values with the phase
+// tracked in single floating point precision.
+//
+// The half precision phase increment is only accurate to about 1e-3 radians,
+// which at high sample rates shifts the frequency by hundreds of Hz. Tracking
+// the phase in single precision avoids this. The samples are converted to
+// single precision in chunks, rotated, and rounded back to half precision.
+inline auto Rotator(const std::span<const HalfComplex> samples,
+                    Complex& phase,
+                    const Complex phase_increment_per_sample,
+                    const std::span<HalfComplex> output)
+    -> std::span<HalfComplex> {
+  assert(samples.size() <= output.size());
+
+  constexpr size_t kChunkSize = 256;
+
+  const size_t num_samples = samples.size();
+
+  Complex chunk[kChunkSize];
+
+  for (size_t offset = 0; offset < num_samples; offset += kChunkSize) {
+    const size_t chunk_size = std::min(kChunkSize, num_samples - offset);
+
+    const HalfComplex* samples_ptr = samples.data() + offset;
+    for (size_t i = 0; i < chunk_size; ++i) {
+      chunk[i] =
+          Complex(float(samples_ptr[i].real), float(samples_ptr[i].imag));
+    }
+
+    const std::span<Complex> chunk_span(chunk, chunk_size);
+    Rotator<float>(chunk_span, phase, phase_increment_per_sample, chunk_span);
+
+    HalfComplex* output_ptr = output.data() + offset;
+    for (size_t i = 0; i < chunk_size; ++i) {
+      output_ptr[i] = HalfComplex(Half(chunk[i].real), Half(chunk[i].imag));
+    }
+  }
+
+  return output.subspan(0, num_samples);
+}
+
 #endif  // RADIO_CORE_HAVE_HALF
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core::kernel
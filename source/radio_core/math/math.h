@@ -11,12 +11,36 @@
 #include <type_traits>
 
 #include "radio_core/base/bit_cast.h"
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/constants.h"
 
 // Polymorphic functions for the half-precision floating point values.
 #include "radio_core/math/internal/half_math.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+// Type in which calculations on values of the given type are performed when
+// they need more range or precision than the type itself provides. For
+// example, design of filter kernels and configuration which involves sample
+// rates.
+//
+// The half precision floating point values are used for storage, and such
+// calculations are performed in single precision.
+template <class T>
+struct ComputeTypeForType {
+  using Type = T;
+};
+
+#if RADIO_CORE_HAVE_HALF
+template <>
+struct ComputeTypeForType<Half> {
+  using Type = float;
+};
+#endif
+
+template <class T>
+using ComputeType = typename ComputeTypeForType<T>::Type;
 
 // Computes the smallest integer value not less than arg.
 inline auto Ceil(const float arg) -> float { return std::ceil(arg); }
@@ -360,4 +384,5 @@ inline void SinCos(const T arg, T& sine, T& cosine) {
   cosine = Cos(arg);
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -13,7 +13,10 @@
 #include <limits>
 #include <type_traits>
 
+#include "radio_core/base/build_config.h"
+
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 template <class T>
 constexpr auto NumDigits(T arg) -> int {
@@ -143,4 +146,5 @@ constexpr auto NumDigits(const int32_t arg) -> int {
   return 1;
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -7,7 +7,10 @@
 #include <limits>
 #include <type_traits>
 
+#include "radio_core/base/build_config.h"
+
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Convert floating point value from range [0 .. 1] to the full range of an
 // unsigned integral type.
@@ -27,4 +30,5 @@ auto PositiveUnitFloatToUnsigned(const RealType value) -> UnsignedIntegerType {
   return value * std::numeric_limits<UnsignedIntegerType>::max();
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -6,7 +6,10 @@
 
 #include <span>
 
+#include "radio_core/base/build_config.h"
+
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 namespace resample_internal {
 
@@ -83,4 +86,5 @@ void ForeachResampledValue(const std::span<const T> samples,
       samples, num_output_samples, callback);
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -6,7 +6,10 @@
 
 #include <cassert>
 
+#include "radio_core/base/build_config.h"
+
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Convert time measured in milliseconds to number of samples with given
 // samples per second rate. Uses rounding behavior: if fractional part of the
@@ -31,4 +34,5 @@ constexpr auto NumSamplesToMilliseconds(const T sample_rate,
   return num_samples * 1000 / sample_rate;
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
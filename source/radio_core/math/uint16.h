@@ -0,0 +1,30 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Vectorized data type which holds 16 32 bit unsigned integer values.
+
+#pragma once
+
+#include <cstdint>
+
+#include "radio_core/base/build_config.h"
+#include "radio_core/math/internal/vectorized_int_scalar.h"
+#include "radio_core/math/vectorized_int_type.h"
+
+// Types for extracting lower and upper parts, and constructing from 2 parts.
+#include "radio_core/math/uint8.h"
+
+#include "radio_core/math/internal/uint16_uint8x2.h"
+#include "radio_core/math/internal/uint16_x86.h"
+
+namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
+
+using UInt16 = VectorizedIntType<uint32_t, 16>;
+
+static_assert(alignof(UInt16) == alignof(UInt16::RegisterType));
+static_assert(sizeof(UInt16) == sizeof(UInt16::RegisterType));
+
+}  // namespace RADIO_CORE_ISA_NAMESPACE
+}  // namespace radio_core
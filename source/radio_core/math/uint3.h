@@ -8,14 +8,17 @@
 
 #include <cstdint>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_int_scalar.h"
 #include "radio_core/math/vectorized_int_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using UInt3 = VectorizedIntType<uint32_t, 3>;
 
 static_assert(alignof(UInt3) == alignof(UInt3::RegisterType));
 static_assert(sizeof(UInt3) == sizeof(UInt3::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
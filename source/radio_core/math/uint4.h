@@ -8,6 +8,7 @@
 
 #include <cstdint>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_int_scalar.h"
 #include "radio_core/math/vectorized_int_type.h"
 
@@ -15,10 +16,12 @@
 #include "radio_core/math/internal/uint4_x86.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using UInt4 = VectorizedIntType<uint32_t, 4>;
 
 static_assert(alignof(UInt4) == alignof(UInt4::RegisterType));
 static_assert(sizeof(UInt4) == sizeof(UInt4::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -8,6 +8,7 @@
 
 #include <cstdint>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_int_scalar.h"
 #include "radio_core/math/vectorized_int_type.h"
 
@@ -15,12 +16,15 @@
 #include "radio_core/math/uint4.h"
 
 #include "radio_core/math/internal/uint8_uint4x2.h"
+#include "radio_core/math/internal/uint8_x86.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using UInt8 = VectorizedIntType<uint32_t, 8>;
 
 static_assert(alignof(UInt8) == alignof(UInt8::RegisterType));
 static_assert(sizeof(UInt8) == sizeof(UInt8::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
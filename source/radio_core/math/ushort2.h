@@ -8,14 +8,17 @@
 
 #include <cstdint>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_int_scalar.h"
 #include "radio_core/math/vectorized_int_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using UShort2 = VectorizedIntType<uint16_t, 2>;
 
 static_assert(alignof(UShort2) == alignof(UShort2::RegisterType));
 static_assert(sizeof(UShort2) == sizeof(UShort2::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
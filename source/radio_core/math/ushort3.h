@@ -8,14 +8,17 @@
 
 #include <cstdint>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_int_scalar.h"
 #include "radio_core/math/vectorized_int_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using UShort3 = VectorizedIntType<uint16_t, 3>;
 
 static_assert(alignof(UShort3) == alignof(UShort3::RegisterType));
 static_assert(sizeof(UShort3) == sizeof(UShort3::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
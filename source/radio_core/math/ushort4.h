@@ -8,16 +8,19 @@
 
 #include <cstdint>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_int_scalar.h"
 #include "radio_core/math/vectorized_int_type.h"
 
 #include "radio_core/math/internal/ushort4_neon.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using UShort4 = VectorizedIntType<uint16_t, 4>;
 
 static_assert(alignof(UShort4) == alignof(UShort4::RegisterType));
 static_assert(sizeof(UShort4) == sizeof(UShort4::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -8,6 +8,7 @@
 
 #include <cstdint>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_int_scalar.h"
 #include "radio_core/math/vectorized_int_type.h"
 
@@ -18,10 +19,12 @@
 #include "radio_core/math/internal/ushort8_ushort4x2.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 using UShort8 = VectorizedIntType<uint16_t, 8>;
 
 static_assert(alignof(UShort8) == alignof(UShort8::RegisterType));
 static_assert(sizeof(UShort8) == sizeof(UShort8::RegisterType));
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
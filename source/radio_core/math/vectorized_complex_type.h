@@ -15,11 +15,13 @@
 #include <cassert>
 #include <ostream>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/internal/vectorized_type.h"
 #include "radio_core/math/vectorized_float_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Type information of a vectorized type of N elements of floating point type
 // BaseComplex<T>.
@@ -398,6 +400,29 @@ inline auto MultiplyAdd(const VectorizedComplexType<T, N>& a,
           a.GetRegister(), b.GetRegister(), c.GetRegister()));
 }
 
+// Per-element complex multiply-add to accumulator:
+//   RESULT[i] = a[i] + (b[i] * c[i]) for i = 0 to N
+//
+// Operates on the real and imaginary parts separately, so that the complex
+// multiplication and the accumulation map to 4 per-element multiply-adds.
+template <class T, int N>
+inline auto MultiplyAdd(const VectorizedComplexType<T, N>& a,
+                        const VectorizedComplexType<T, N>& b,
+                        const VectorizedComplexType<T, N>& c)
+    -> VectorizedComplexType<T, N> {
+  const VectorizedFloatType<T, N> b_real = b.ExtractReal();
+  const VectorizedFloatType<T, N> b_imag = b.ExtractImag();
+  const VectorizedFloatType<T, N> c_real = c.ExtractReal();
+  const VectorizedFloatType<T, N> c_imag = c.ExtractImag();
+
+  const VectorizedFloatType<T, N> real = MultiplyAdd(
+      MultiplyAdd(a.ExtractReal(), b_real, c_real), -b_imag, c_imag);
+  const VectorizedFloatType<T, N> imag = MultiplyAdd(
+      MultiplyAdd(a.ExtractImag(), b_real, c_imag), b_imag, c_real);
+
+  return VectorizedComplexType<T, N>(real, imag);
+}
+
 // Calculates per-element phase angle (in radians) of the complex values:
 //   RESULT[i] = FastArg(a[i]) for i = 0 to N
 template <class T, int N>
@@ -444,4 +469,5 @@ inline auto Reverse(const VectorizedComplexType<T, N>& a)
       VectorizedComplexType<T, N>::TypeInfo::Reverse(a.GetRegister()));
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
@@ -15,9 +15,11 @@
 #include <ostream>
 #include <type_traits>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Type information of a vectorized type of N elements of floating point type T.
 //
@@ -499,6 +501,10 @@ inline auto Cos(const VectorizedFloatType<T, N>& arg)
 // Per-element sine and cosine calculation.
 //   sin[i] = Sin(arg[i]) for i = 0 to N
 //   cos[i] = Cos(arg[i]) for i = 0 to N
+//
+// The absolute error of the single precision floating point implementations of
+// Sin(), Cos(), and SinCos() does not exceed 2^-23 for the arguments within
+// [-8192, 8192].
 template <class T, int N>
 inline void SinCos(const VectorizedFloatType<T, N>& arg,
                    VectorizedFloatType<T, N>& sin,
@@ -512,6 +518,9 @@ inline void SinCos(const VectorizedFloatType<T, N>& arg,
 // Computes Per-element e (Euler's number, 2.7182818...) raised to the given
 // power arg.
 //   RESULT[i] = Exp(arg[i]) for i = 0 to N
+//
+// The error of the single precision floating point implementations does not
+// exceed 1 ULP for the arguments within [-87, 88].
 template <class T, int N>
 inline auto Exp(const VectorizedFloatType<T, N>& arg)
     -> VectorizedFloatType<T, N> {
@@ -519,6 +528,107 @@ inline auto Exp(const VectorizedFloatType<T, N>& arg)
       VectorizedFloatType<T, N>::TypeInfo::Exp(arg.GetRegister()));
 }
 
+// Per-element natural (base e) logarithm.
+//   RESULT[i] = Log(arg[i]) for i = 0 to N
+//
+// The error of the single precision floating point implementations does not
+// exceed 1 ULP for the positive normal arguments. The result for non-positive
+// arguments is NaN.
+template <class T, int N>
+inline auto Log(const VectorizedFloatType<T, N>& arg)
+    -> VectorizedFloatType<T, N> {
+  return VectorizedFloatType<T, N>(
+      VectorizedFloatType<T, N>::TypeInfo::Log(arg.GetRegister()));
+}
+
+// Per-element square root.
+//   RESULT[i] = Sqrt(arg[i]) for i = 0 to N
+//
+// Correctly rounded on the platforms which have a native square root
+// instruction (x86 and 64 bit Arm).
+template <class T, int N>
+inline auto Sqrt(const VectorizedFloatType<T, N>& arg)
+    -> VectorizedFloatType<T, N> {
+  return VectorizedFloatType<T, N>(
+      VectorizedFloatType<T, N>::TypeInfo::Sqrt(arg.GetRegister()));
+}
+
+// Per-element reciprocal square root.
+//   RESULT[i] = 1 / Sqrt(arg[i]) for i = 0 to N
+//
+// Uses the hardware approximation refined by Newton-Raphson iterations where
+// it is available. The error of the single precision floating point
+// implementations does not exceed 4 ULP for the positive normal arguments.
+template <class T, int N>
+inline auto RSqrt(const VectorizedFloatType<T, N>& arg)
+    -> VectorizedFloatType<T, N> {
+  return VectorizedFloatType<T, N>(
+      VectorizedFloatType<T, N>::TypeInfo::RSqrt(arg.GetRegister()));
+}
+
+// Per-element arc tangent of y/x using the signs of the arguments to determine
+// the correct quadrant.
+//   RESULT[i] = ArcTan2(y[i], x[i]) for i = 0 to N
+//
+// The result is within the [-pi, pi] range, and ArcTan2(0, 0) is 0.
+//
+// The argument is reduced to the [0, tan(pi/8)] range where the arc tangent is
+// approximated with the polynomial from the Cephes library. The error of the
+// single precision floating point implementations does not exceed 4 ULP for
+// the finite arguments.
+template <class T, int N>
+inline auto ArcTan2(const VectorizedFloatType<T, N>& y,
+                    const VectorizedFloatType<T, N>& x)
+    -> VectorizedFloatType<T, N> {
+  using VectorType = VectorizedFloatType<T, N>;
+
+  const VectorType zero(T(0));
+  const VectorType one(T(1));
+  const VectorType pi(T(3.14159265358979323846));
+  const VectorType half_pi(T(1.57079632679489661923));
+  const VectorType quarter_pi(T(0.78539816339744830962));
+
+  const VectorType abs_x = Abs(x);
+  const VectorType abs_y = Abs(y);
+
+  // Arc tangent of the ratio within [0, 1].
+  const VectorType den = Max(abs_x, abs_y);
+  VectorType a = Select(den > zero, Min(abs_x, abs_y) / den, zero);
+
+  // Reduce the argument to [0, tan(pi/8)]:
+  //   atan(a) = pi/4 + atan((a - 1) / (a + 1)).
+  const auto is_reduced = a > VectorType(T(0.41421356237309504880));
+  const VectorType offset = Select(is_reduced, quarter_pi, zero);
+  a = Select(is_reduced, (a - one) / (a + one), a);
+
+  const VectorType z = a * a;
+  VectorType p(T(8.05374449538e-2));
+  p = MultiplyAdd(VectorType(T(-1.38776856032e-1)), p, z);
+  p = MultiplyAdd(VectorType(T(1.99777106478e-1)), p, z);
+  p = MultiplyAdd(VectorType(T(-3.33329491539e-1)), p, z);
+
+  VectorType result = offset + MultiplyAdd(a, p * z, a);
+
+  // Restore the octant and the quadrant.
+  result = Select(abs_y > abs_x, half_pi - result, result);
+  result = Select(x < zero, pi - result, result);
+
+  return CopySign(result, y);
+}
+
+// Per-element base raised to the power exp.
+//   RESULT[i] = Pow(base[i], exp[i]) for i = 0 to N
+//
+// Calculated as Exp(exp * Log(base)), so is only defined for the positive
+// base. The error grows with the magnitude of exp * Log(base), and does not
+// exceed 32 ULP for the results within [2^-24, 2^24].
+template <class T, int N>
+inline auto Pow(const VectorizedFloatType<T, N>& base,
+                const VectorizedFloatType<T, N>& exp)
+    -> VectorizedFloatType<T, N> {
+  return Exp(exp * Log(base));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Linear algebra.
 
@@ -561,4 +671,5 @@ inline auto Normalize(const VectorizedFloatType<T, N>& a)
 
 }  // namespace linalg
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
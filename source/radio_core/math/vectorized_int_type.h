@@ -15,9 +15,11 @@
 #include <ostream>
 #include <type_traits>
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/math/internal/vectorized_type.h"
 
 namespace radio_core {
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 
 // Type information of a vectorized type of N elements of integer type T.
 //
@@ -286,4 +288,5 @@ inline auto Reverse(const VectorizedIntType<T, N>& a)
       VectorizedIntType<T, N>::TypeInfo::Reverse(a.GetRegister()));
 }
 
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 }  // namespace radio_core
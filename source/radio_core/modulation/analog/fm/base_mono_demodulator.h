@@ -5,12 +5,19 @@
 // Implementation of a mono-channel frequency demodulator.
 // Takes care of implementing common parts of demodulating NFM and a mono
 // channel of WFM.
+//
+// The instantaneous frequency is calculated as the phase angle of the product
+// of the sample and the complex conjugate of the previous sample, which does
+// not need phase unwrapping and is vectorized for the block processing. The
+// product is calculated in the ComputeType of the sample type, as for the half
+// precision samples it easily falls below the normal range of the type.
 
 #pragma once
 
 #include <span>
 
-#include "radio_core/math/kernel/fast_arg.h"
+#include "radio_core/math/kernel/fm_discriminator.h"
+#include "radio_core/math/math.h"
 #include "radio_core/modulation/analog/iq_demodulator.h"
 #include "radio_core/signal/frequency.h"
 
@@ -44,11 +51,16 @@ class BaseMonoDemodulator : public IQDemodulator<T> {
   inline auto GetAngularDeviation() const -> T { return angular_deviation_; }
 
   inline auto operator()(const BaseComplex<T> sample) -> T override {
-    const T phase = FastArg(sample);
-    const T instant_frequency =
-        signal::WrapInstantFrequency(phase - prev_phase_);
+    using RealType = ComputeType<T>;
+    using RealComplex = BaseComplex<RealType>;
+
+    const RealComplex product =
+        RealComplex(RealType(sample.real), RealType(sample.imag)) *
+        Conj(RealComplex(RealType(prev_sample_.real),
+                         RealType(prev_sample_.imag)));
+    const T instant_frequency = T(FastArg(product));
 
-    prev_phase_ = phase;
+    prev_sample_ = sample;
 
     return instant_frequency * angular_deviation_inv_;
   }
@@ -58,28 +70,10 @@ class BaseMonoDemodulator : public IQDemodulator<T> {
       -> std::span<T> override {
     assert(input_samples.size() <= output_samples.size());
 
-    // Calculate phase angle.
-    // The phase is written to the output buffer.
-    const std::span<T> written_samples =
-        kernel::FastArg(input_samples, output_samples);
-
-    // Calculate and unwrap instant frequency, and divide by deviation to get
-    // amplitude of the output signal. Uses phase stored in the output buffer
-    // from the previous algorithm step.
-    //
-    // Scalar multiplication is faster to happen here (as opposite of attempting
-    // to use vectorization). At least on Raspberry Pi 4. where the current code
-    // is 15% faster than multiplication performed as separate vectorized pass.
-    // This is likely due to better memory access pattern, and the fact that
-    // there are no additional load and store to/from registers.
-    for (T& output_sample : written_samples) {
-      const T phase = output_sample;
-      output_sample = signal::WrapInstantFrequency(phase - prev_phase_) *
-                      angular_deviation_inv_;
-      prev_phase_ = phase;
-    }
-
-    return written_samples;
+    // Calculate instant frequency and divide it by deviation to get amplitude
+    // of the output signal in a single pass.
+    return kernel::FMDiscriminator(
+        input_samples, output_samples, angular_deviation_inv_, prev_sample_);
   }
 
  protected:
@@ -91,7 +85,9 @@ class BaseMonoDemodulator : public IQDemodulator<T> {
   T angular_deviation_{1};
   T angular_deviation_inv_{T(1) / angular_deviation_};
 
-  T prev_phase_{0};
+  // The previous sample is initialized to a phase of 0, so that the first
+  // sample gives its own phase angle.
+  BaseComplex<T> prev_sample_{T(1), T(0)};
 };
 
 }  // namespace radio_core::modulation::analog::fm
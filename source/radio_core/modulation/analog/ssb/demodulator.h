@@ -73,6 +73,7 @@ class Demodulator : public IQDemodulator<T> {
     GenerateWindowedHilbertTransformer(
         hilbert_transformer_.GetKernel(),
         signal::WindowEquation<T, signal::Window::kHamming>());
+    hilbert_transformer_.UpdateKernelSymmetry();
   }
 
   inline auto operator()(const BaseComplex<T> sample) -> T override {
@@ -26,7 +26,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <span>
+#include <vector>
 
 #include "radio_core/base/algorithm.h"
 #include "radio_core/base/result.h"
@@ -90,6 +93,14 @@ class Demodulator {
     RealType symbol_agc_charge_rate{0.6};
     RealType symbol_agc_discharge_rate{0.0005};
 
+    // Gain applied to the space symbol amplitude before it is compared with the
+    // mark symbol amplitude.
+    //
+    // Values different from 1 compensate for the emphasis of the transmission
+    // which the AGC did not fully normalize: the decision is biased towards the
+    // symbol which was received with a lower amplitude.
+    RealType space_gain{1};
+
     // Hysteresis threshold which is used on a difference between mark and
     // space magnitudes. Avoids ringing issues.
     RealType hysteresis_threshold{0.02};
@@ -136,6 +147,7 @@ class Demodulator {
         min_symbol_frequency - options.prefilter_frequency_extent,
         max_symbol_frequency + options.prefilter_frequency_extent,
         options.sample_rate);
+    prefilter_.UpdateKernelSymmetry();
 
     // Configure symbols.
 
@@ -158,6 +170,8 @@ class Demodulator {
     space_options.tone_frequency = RealType(options.tones.space);
     space_demodulator_.Configure(space_options);
 
+    space_gain_ = options.space_gain;
+
     // Configure hysteresis.
     hysteresis_.SetThreshold(0, options.hysteresis_threshold);
 
@@ -169,6 +183,11 @@ class Demodulator {
     pll_options.inertia = options.pll_inertia;
 
     pll_.Configure(pll_options);
+
+    // Configure buffers of the block processing.
+    prefiltered_buffer_.resize(kBlockSize);
+    mark_buffer_.resize(kBlockSize);
+    space_buffer_.resize(kBlockSize);
   }
 
   // Process sample of an input signal.
@@ -181,14 +200,7 @@ class Demodulator {
     const RealType mark_amplitude = mark_demodulator_(prefiltered_sample);
     const RealType space_amplitude = space_demodulator_(prefiltered_sample);
 
-    const RealType demodulated_sample = mark_amplitude - space_amplitude;
-    const bool demodulated_bit = hysteresis_(demodulated_sample);
-
-    if (pll_(demodulated_bit)) {
-      return Result(demodulated_bit);
-    }
-
-    return Result(Error::kUnavailable);
+    return SliceSymbol(mark_amplitude, space_amplitude);
   }
 
   // Process sample of an input signal, and invoke the callback with the
@@ -209,14 +221,118 @@ class Demodulator {
     }
   }
 
+  // Process multiple samples of an input signal, and invoke the callback with
+  // every demodulated bit.
+  //
+  // The pre-filter and the symbol demodulators process the whole block of
+  // samples at once, and only the bit decision and the clock recovery happen
+  // on a per-sample basis.
+  //
+  // The given list of args... is passed to the callback first. This makes the
+  // required callback signature to be:
+  //
+  //   callback(<optional arguments>, const bool demodulated_bit)
+  template <class F, class... Args>
+  void operator()(const std::span<const RealType> samples,
+                  F&& callback,
+                  Args&&... args) {
+    const size_t num_samples = samples.size();
+
+    for (size_t offset = 0; offset < num_samples; offset += kBlockSize) {
+      const size_t block_size = std::min(kBlockSize, num_samples - offset);
+
+      const std::span<const RealType> prefiltered_samples =
+          Prefilter(samples.subspan(offset, block_size),
+                    std::span(prefiltered_buffer_).subspan(0, block_size));
+
+      const std::span<RealType> mark_amplitudes =
+          std::span(mark_buffer_).subspan(0, block_size);
+      const std::span<RealType> space_amplitudes =
+          std::span(space_buffer_).subspan(0, block_size);
+
+      DemodulateSymbols(
+          prefiltered_samples, mark_amplitudes, space_amplitudes);
+
+      for (size_t i = 0; i < block_size; ++i) {
+        const Result result =
+            SliceSymbol(mark_amplitudes[i], space_amplitudes[i]);
+        if (result.Ok()) {
+          std::invoke(callback, args..., result.GetValue());
+        }
+      }
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Individual stages of the demodulator.
+  //
+  // They allow multiple demodulators to share the results of the stages which
+  // are configured the same way. For example, the demodulators which only
+  // differ in the bit decision and clock recovery configuration can share the
+  // pre-filtered signal and the symbol amplitudes.
+  //
+  // The stages are to be invoked in the order they are declared in. Invoking
+  // the stages of the same demodulator is equivalent to the block processing.
+
+  // Pre-filter multiple samples of an input signal.
+  //
+  // The caller must ensure the output samples buffer is big enough: it should
+  // have at least the size of the input samples.
+  //
+  // Returns subspan of output where samples were actually written.
+  auto Prefilter(const std::span<const RealType> samples,
+                 const std::span<RealType> prefiltered_samples)
+      -> std::span<RealType> {
+    return prefilter_(samples, prefiltered_samples);
+  }
+
+  // Calculate amplitudes of the mark and space symbols of multiple pre-filtered
+  // samples.
+  //
+  // The output buffers are to have at least the size of the input samples.
+  void DemodulateSymbols(const std::span<const RealType> prefiltered_samples,
+                         const std::span<RealType> mark_amplitudes,
+                         const std::span<RealType> space_amplitudes) {
+    mark_demodulator_(prefiltered_samples, mark_amplitudes);
+    space_demodulator_(prefiltered_samples, space_amplitudes);
+  }
+
+  // Decide which symbol is being received from the amplitudes of the mark and
+  // space symbols, and recover the clock.
+  //
+  // Returns value of a newly demodulated bit when it is available.
+  // Otherwise returns an error code.
+  auto SliceSymbol(const RealType mark_amplitude,
+                   const RealType space_amplitude) -> Result {
+    const RealType demodulated_sample =
+        mark_amplitude - space_amplitude * space_gain_;
+    const bool demodulated_bit = hysteresis_(demodulated_sample);
+
+    if (pll_(demodulated_bit)) {
+      return Result(demodulated_bit);
+    }
+
+    return Result(Error::kUnavailable);
+  }
+
  private:
+  // The maximum number of samples processed by the block stages at once.
+  static constexpr size_t kBlockSize = 4096;
+
   signal::SimpleFIRFilter<RealType, RealType, Allocator> prefilter_;
 
   internal::SymbolDemodulator<RealType, Allocator> mark_demodulator_;
   internal::SymbolDemodulator<RealType, Allocator> space_demodulator_;
 
+  RealType space_gain_{1};
+
   signal::DigitalHysteresis<RealType> hysteresis_;
   comm::DigitalPLL<RealType> pll_;
+
+  // Buffers for the intermediate results of the block processing.
+  std::vector<RealType, Allocator<RealType>> prefiltered_buffer_;
+  std::vector<RealType, Allocator<RealType>> mark_buffer_;
+  std::vector<RealType, Allocator<RealType>> space_buffer_;
 };
 
 }  // namespace radio_core::modulation::digital::fsk
@@ -56,4 +56,34 @@ TEST(fsk, Demodulator) {
           std::to_array({true, false, true, false, true, false, true, false})));
 }
 
+TEST(fsk, DemodulatorBlock) {
+  Demodulator<float>::Options options;
+  options.tones = kBell202Tones;
+  options.sample_rate = 11025;
+  options.data_baud = 1200;
+
+  Demodulator<float> demodulator(options);
+
+  signal::Generator<float> generator(options.sample_rate);
+
+  std::vector<float> samples;
+
+  const float bit_duration_ms = 1000.0f / float(options.data_baud);
+  for (int i = 0; i < 4; ++i) {
+    generator(FrequencyDuration(kBell202Tones.mark, bit_duration_ms),
+              [&](const float sample) { samples.push_back(sample); });
+    generator(FrequencyDuration(kBell202Tones.space, bit_duration_ms),
+              [&](const float sample) { samples.push_back(sample); });
+  }
+
+  BitReceiver receiver;
+  demodulator(std::span<const float>(samples), receiver);
+
+  EXPECT_THAT(
+      receiver.bits,
+      Pointwise(
+          Eq(),
+          std::to_array({true, false, true, false, true, false, true, false})));
+}
+
 }  // namespace radio_core::modulation::digital::fsk
@@ -100,14 +100,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
+#include <span>
+#include <vector>
 
 #include "radio_core/math/complex.h"
+#include "radio_core/math/kernel/abs.h"
 #include "radio_core/math/math.h"
 #include "radio_core/signal/ema_agc.h"
 #include "radio_core/signal/filter.h"
 #include "radio_core/signal/filter_window_heuristic.h"
-#include "radio_core/signal/local_oscillator.h"
+#include "radio_core/signal/numerically_controlled_oscillator.h"
 #include "radio_core/signal/root_raised_cosine.h"
 #include "radio_core/signal/simple_fir_filter.h"
 
@@ -171,6 +176,7 @@ class SymbolDemodulator {
     low_pass_filter_.SetKernelSize(num_taps);
     signal::DesignLowpassRRCFilter(
         low_pass_filter_.GetKernel(), samples_per_symbol, options.rrc_beta);
+    low_pass_filter_.UpdateKernelSymmetry();
 
     // Configure the AGC.
     //
@@ -178,6 +184,8 @@ class SymbolDemodulator {
     // But in practice these values works good for both 11025 and 44100 sample
     // rates.
     agc_.Configure(options.agc_charge_rate, options.agc_discharge_rate);
+
+    iq_buffer_.resize(kBlockSize);
   }
 
   // Process (possibly pre-filtered) sample of the input signal.
@@ -191,14 +199,63 @@ class SymbolDemodulator {
     return agc_(symbol_amplitude);
   }
 
+  // Process multiple (possibly pre-filtered) samples of the input signal.
+  // Outputs magnitudes of the demodulated symbol.
+  //
+  // Every stage processes the whole block of samples at once, which allows
+  // the use of the vectorized kernels. The result matches the per-sample
+  // processing up to the floating point rounding.
+  //
+  // The caller must ensure the output samples buffer is big enough: it should
+  // have at least the size of the input samples.
+  //
+  // Returns subspan of output where samples were actually written.
+  auto operator()(const std::span<const RealType> input_samples,
+                  const std::span<RealType> output_samples)
+      -> std::span<RealType> {
+    assert(input_samples.size() <= output_samples.size());
+
+    const size_t num_samples = input_samples.size();
+
+    for (size_t offset = 0; offset < num_samples; offset += kBlockSize) {
+      const size_t block_size = std::min(kBlockSize, num_samples - offset);
+
+      const std::span<const RealType> block_samples =
+          input_samples.subspan(offset, block_size);
+      const std::span<RealType> block_output =
+          output_samples.subspan(offset, block_size);
+
+      const std::span<IQComplex> iq(iq_buffer_.data(), block_size);
+
+      local_oscillator_.IQ(iq);
+      for (size_t i = 0; i < block_size; ++i) {
+        iq[i] *= block_samples[i];
+      }
+
+      low_pass_filter_(iq);
+
+      kernel::Abs(std::span<const IQComplex>(iq), block_output);
+
+      agc_(block_output);
+    }
+
+    return output_samples.subspan(0, num_samples);
+  }
+
  private:
-  using IQLocalOscillator = signal::LocalOscillator<RealType>;
+  using IQLocalOscillator = signal::NumericallyControlledOscillator<RealType>;
   using IQComplex = BaseComplex<RealType>;
   using IQFilter = signal::SimpleFIRFilter<IQComplex, RealType, Allocator>;
 
+  // The maximum number of samples processed by the block stages at once.
+  static constexpr size_t kBlockSize = 4096;
+
   IQLocalOscillator local_oscillator_;
   IQFilter low_pass_filter_;
   signal::EMAAGC<RealType> agc_;
+
+  // Buffer for the quadrature samples of the block processing.
+  std::vector<IQComplex, Allocator<IQComplex>> iq_buffer_;
 };
 
 }  // namespace radio_core::modulation::digital::fsk::internal
@@ -9,6 +9,8 @@
 
 #include "radio_core/modulation/digital/fsk/internal/symbol_demodulator.h"
 
+#include <vector>
+
 #include "radio_core/base/frequency_duration.h"
 #include "radio_core/signal/generator.h"
 #include "radio_core/signal/local_oscillator.h"
@@ -67,4 +69,33 @@ TEST(SymbolDemodulator, OtherSymbol) {
             });
 }
 
+// The block processing is expected to give the same result as the per-sample
+// processing, up to the floating point rounding.
+TEST(SymbolDemodulator, Block) {
+  SymbolDemodulator<float>::Options options;
+  options.tone_frequency = 1200;
+  options.sample_rate = 11025;
+  options.data_baud = 1200;
+
+  SymbolDemodulator<float> demodulator(options);
+  SymbolDemodulator<float> block_demodulator(options);
+
+  signal::Generator<float> generator(options.sample_rate);
+
+  std::vector<float> samples;
+  for (int i = 0; i < 1000; ++i) {
+    const float frequency = (i % 3) ? 1200.0f : 2200.0f;
+    generator(FrequencyDuration(frequency, 1000.0f / 1200.0f),
+              [&samples](const float sample) { samples.push_back(sample); });
+  }
+
+  std::vector<float> block_amplitudes(samples.size());
+  block_demodulator(samples, block_amplitudes);
+
+  for (size_t i = 0; i < samples.size(); ++i) {
+    ASSERT_NEAR(block_amplitudes[i], demodulator(samples[i]), 1e-4f)
+        << "i=" << i;
+  }
+}
+
 }  // namespace radio_core::modulation::digital::fsk::internal
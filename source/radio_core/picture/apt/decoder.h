@@ -155,6 +155,7 @@ class Decoder {
         RealType(Info::kSubCarrierFrequency) - Info::kBaudRate / 2,
         RealType(Info::kSubCarrierFrequency) + Info::kBaudRate / 2,
         options.sample_rate);
+    prefilter_.UpdateKernelSymmetry();
   }
 
   void ConfigureAnalyticalSignal(const Options& options) {
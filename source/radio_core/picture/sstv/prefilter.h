@@ -120,6 +120,7 @@ class Prefilter {
         min_image_frequency - options.prefilter_frequency_extent,
         max_image_frequency + options.prefilter_frequency_extent,
         options.sample_rate);
+    prefilter_.UpdateKernelSymmetry();
   }
 
   inline void ConfigureAnalyticalSignal(const Options& options) {
@@ -149,6 +150,7 @@ class Prefilter {
         signal::WindowEquation<RealType, signal::Window::kHamming>(),
         options.frequency_filter_cutoff,
         options.sample_rate);
+    frequency_filter_.UpdateKernelSymmetry();
   }
 
   signal::SimpleFIRFilter<RealType, RealType, Allocator> prefilter_;
@@ -134,6 +134,7 @@ class VISDecoder {
         signal::WindowEquation<RealType, signal::Window::kHamming>(),
         options.prefilter_frequency_cutoff,
         options.sample_rate);
+    prefilter_.UpdateKernelSymmetry();
   }
 
   inline void ConfigureMatchingTolerances(const Options& options) {
@@ -12,6 +12,11 @@
 // entire frame provided as a span. The latter one is merely a wrapper around
 // per-byte decoder API.
 //
+// Optionally, frames which did not pass the FCS check are attempted to be
+// repaired by correcting a small number of bit errors (see `frame_repair.h`).
+// The repaired frames are decoded the same way as the received ones, and the
+// decoder reports that the frame has been repaired.
+//
 // Protocol specification:
 //
 //   https://www.tapr.org/pdf/AX25.2.2.pdf
@@ -27,6 +32,7 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <optional>
 #include <span>
@@ -34,6 +40,7 @@
 #include "radio_core/base/result.h"
 #include "radio_core/base/unreachable.h"
 #include "radio_core/crypto/crc-16-ccitt.h"
+#include "radio_core/protocol/datalink/ax25/frame_repair.h"
 #include "radio_core/protocol/datalink/ax25/message.h"
 #include "radio_core/protocol/datalink/frame.h"
 
@@ -60,9 +67,18 @@ class Decoder {
     kResourceExhausted,
   };
 
+  struct Options {
+    // Repair of frames which did not pass the FCS check.
+    // The repair is disabled by default.
+    FrameRepairOptions repair;
+  };
+
   using Result = radio_core::Result<std::reference_wrapper<Message>, Error>;
 
   Decoder() { ResetIfNeeded(); }
+  explicit Decoder(const Options& options) : Decoder() { Configure(options); }
+
+  void Configure(const Options& options) { options_ = options; }
 
   // Process frame marker.
   //
@@ -123,6 +139,7 @@ class Decoder {
     // frame and hence all the data bytes are ignored.
     if (field_state_ != FieldState::kFrameSkip) {
       AppendByteToFCS(byte_value);
+      AppendByteToFrame(new_byte);
     }
 
     switch (field_state_) {
@@ -188,6 +205,23 @@ class Decoder {
     Unreachable();
   }
 
+  // Get the frame check sequence of the last frame which was decoded.
+  //
+  // It is only valid after a processing function returned a decoded message
+  // or the Error::kChecksumMismatch code, until the next processing function
+  // call. For a decoded message it equals to the FCS field of the frame, so it
+  // can be used to tell frames apart without comparing all their fields.
+  inline auto GetFrameFCS() const -> uint16_t {
+    return fcs_state_.actual_frame_fcs;
+  }
+
+  // Check whether the last decoded frame has been repaired.
+  //
+  // Follows the same validity rules as the GetFrameFCS(). The repaired frame
+  // passed the FCS check after a few bits of the received frame have been
+  // corrected.
+  inline auto IsFrameRepaired() const -> bool { return is_frame_repaired_; }
+
  private:
   inline void ResetIfNeeded() {
     if (is_reset_) {
@@ -202,6 +236,9 @@ class Decoder {
     fcs_field_state_.Clear();
     fcs_state_.Clear();
 
+    num_frame_bytes_ = 0;
+    is_frame_repaired_ = false;
+
     message_.Clear();
   }
 
@@ -447,7 +484,7 @@ class Decoder {
     const uint16_t received_fcs = information_state_.data;
 
     if (received_fcs != fcs_state_.actual_frame_fcs) {
-      return {message_, Error::kChecksumMismatch};
+      return TryRepairFrame();
     }
 
     return Result(message_);
@@ -500,15 +537,80 @@ class Decoder {
     field_state_ = FieldState::kFrameSkip;
 
     if (fcs_field_state_.data != fcs_state_.actual_frame_fcs) {
-      return Result(message_, Error::kChecksumMismatch);
+      return TryRepairFrame();
     }
 
     return Result(message_);
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  // Frame repair.
+
+  // Append byte to the frame storage used for the repair.
+  //
+  // Bytes which do not fit into the storage are ignored: such frame does not
+  // fit into the message either.
+  inline void AppendByteToFrame(const std::byte byte) {
+    if (num_frame_bytes_ < frame_bytes_.size()) {
+      frame_bytes_[num_frame_bytes_] = byte;
+    }
+    ++num_frame_bytes_;
+  }
+
+  // Attempt to repair the frame which did not pass the FCS check.
+  //
+  // If the frame has been repaired it is decoded from scratch, and the result
+  // of its decoding is returned. Otherwise the checksum mismatch result with
+  // the current state of the message is returned.
+  auto TryRepairFrame() -> Result {
+    if (is_repairing_frame_ || !options_.repair.IsEnabled() ||
+        num_frame_bytes_ > frame_bytes_.size()) {
+      return Result(message_, Error::kChecksumMismatch);
+    }
+
+    const std::span<const std::byte> repaired_frame =
+        ax25::RepairFrame(options_.repair,
+                          std::span(frame_bytes_).first(num_frame_bytes_),
+                          repaired_frame_bytes_);
+    if (repaired_frame.empty()) {
+      return Result(message_, Error::kChecksumMismatch);
+    }
+
+    // The repaired frame passes the FCS check, so the repair is not attempted
+    // again while it is decoded.
+    is_repairing_frame_ = true;
+
+    is_reset_ = false;
+    ResetIfNeeded();
+
+    Result result(Error::kUnavailable);
+    for (const std::byte byte : repaired_frame) {
+      const Result byte_result = (*this)(byte);
+      if (byte_result.Ok() || byte_result.GetError() != Error::kUnavailable) {
+        result = byte_result;
+      }
+    }
+    if (field_state_ == FieldState::kInformation) {
+      FinalizeFCS();
+      result = FlushInformationBytes();
+    }
+
+    is_repairing_frame_ = false;
+
+    if (!result.Ok()) {
+      return Result(message_, Error::kChecksumMismatch);
+    }
+
+    is_frame_repaired_ = true;
+
+    return result;
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   // Properties.
 
+  Options options_;
+
   // Denotes whether the state is in reset state.
   // Used to avoid unneeded redundant resets.
   bool is_reset_{false};
@@ -609,6 +711,21 @@ class Decoder {
     int num_data_bytes;
   } fcs_state_;
 
+  // Bytes of the currently decoding frame, stored for the repair.
+  // The number of bytes might exceed the size of the storage, in which case
+  // the frame can not be repaired.
+  std::array<std::byte, ax25_internal::kMaxFrameSize> frame_bytes_;
+  size_t num_frame_bytes_{0};
+
+  // Storage of the repaired frame.
+  std::array<std::byte, ax25_internal::kMaxFrameSize> repaired_frame_bytes_;
+
+  // True while the repaired frame is being decoded.
+  bool is_repairing_frame_{false};
+
+  // True if the last decoded frame has been repaired.
+  bool is_frame_repaired_{false};
+
   // Partially decoded message.
   Message message_;
 };
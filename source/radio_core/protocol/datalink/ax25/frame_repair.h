@@ -0,0 +1,525 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Repair of AX.25 frames which did not pass the frame check sequence (FCS).
+//
+// The repair looks for a small error in the frame which makes the FCS match:
+//
+//  - A single flipped bit.
+//
+//  - Two flipped bits which are close to each other. With the NRZS coding a
+//    single wrongly sliced symbol flips two adjacent bits of the data.
+//
+//  - A single flipped bit which changed the bit-stuffing decision. A one which
+//    is flipped to zero within five ones, or a flipped stuffed zero leave the
+//    stuffed bit in the data, and a zero which is flipped to one and completes
+//    five ones causes the next data bit to be removed. The frame is one bit
+//    longer or shorter in this case, and the first bits of the closing frame
+//    marker appear in the data, so that the frame received from the HDLC
+//    decoder still contains all the data bits.
+//
+// The CRC is linear: flipping a bit of the frame changes the CRC register at
+// the end of the frame by a syndrome which only depends on the distance of the
+// bit from the end of the frame. The syndromes are tabulated, together with a
+// reverse lookup from a syndrome to the distance. This allows to check all
+// repair candidates of a kind in a single pass over the frame, without
+// re-calculating the CRC of every candidate.
+//
+// The FCS is only 16 bits, so a frame with more errors than the repair can
+// correct might be "repaired" into a wrong frame. The chance of this grows
+// with the length of the frame and the number of the checked candidates, so
+// the repaired frame is also required to have well-formed addresses.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "radio_core/crypto/crc-16-ccitt.h"
+#include "radio_core/protocol/datalink/ax25/message.h"
+#include "radio_core/protocol/datalink/hdlc/spec.h"
+
+namespace radio_core::protocol::datalink::ax25 {
+
+struct FrameRepairOptions {
+  // Correct a single flipped bit.
+  bool single_bit{false};
+
+  // Correct two flipped bits which are at most this many bits apart.
+  // The distance of 1 corresponds to adjacent bits, and 0 disables the
+  // correction of two bits.
+  int max_two_bits_distance{0};
+
+  // Correct a single flipped bit which changed the bit-stuffing decision.
+  bool bit_stuffing{false};
+
+  inline auto IsEnabled() const -> bool {
+    return single_bit || max_two_bits_distance > 0 || bit_stuffing;
+  }
+};
+
+namespace ax25_internal {
+
+using FCSSpec = crypto::crc16ccitt::FCS;
+
+// The number of bytes in an address of the address field.
+inline constexpr size_t kAddressSize = 7;
+
+// The minimum size of a frame: destination and source addresses, control
+// field, and FCS.
+inline constexpr size_t kMinFrameSize = 2 * kAddressSize + 1 + 2;
+
+// The maximum size of a frame which fits into the message: all addresses,
+// control and PID fields, information and FCS.
+//
+// A frame with a bit-stuffing error is one byte longer, as it contains the
+// beginning of the closing frame marker.
+inline constexpr size_t kMaxFrameSize =
+    (2 + Repeaters::kMaxNumRepeaters) * kAddressSize + 2 +
+    Information::static_capacity + 2 + 1;
+
+inline constexpr int kMaxFrameBits = kMaxFrameSize * 8;
+
+// Generator polynomial in the reflected form, as used by the CRC register.
+inline constexpr uint16_t kReflectedPolynomial = []() {
+  uint16_t polynomial = 0;
+  for (int i = 0; i < 16; ++i) {
+    if (FCSSpec::kPolynomial & (1 << i)) {
+      polynomial |= uint16_t(1 << (15 - i));
+    }
+  }
+  return polynomial;
+}();
+
+// Update the CRC register with a single bit of the frame.
+constexpr auto UpdateCRCBit(const uint16_t crc, const bool bit) -> uint16_t {
+  const uint16_t value = crc ^ uint16_t(bit);
+  return (value & 1) ? (value >> 1) ^ kReflectedPolynomial : (value >> 1);
+}
+
+// Value of the CRC register after it has been updated with all bytes of a
+// correct frame, including its FCS.
+inline constexpr uint16_t kGoodFrameCRC = []() {
+  uint16_t crc = FCSSpec::kInitialValue;
+  const uint16_t fcs = crc ^ FCSSpec::kFinalXorValue;
+  for (int i = 0; i < 16; ++i) {
+    crc = UpdateCRCBit(crc, fcs & (1 << i));
+  }
+  return crc;
+}();
+
+// Syndromes of the bit flips: change of the CRC register at the end of the
+// frame caused by flipping a bit at the given distance from the end of the
+// frame. The distance of 0 corresponds to the last bit of the frame.
+inline constexpr auto kBitSyndromes = []() {
+  std::array<uint16_t, kMaxFrameBits> syndromes{};
+  uint16_t syndrome = UpdateCRCBit(0, true);
+  for (int distance = 0; distance < kMaxFrameBits; ++distance) {
+    syndromes[distance] = syndrome;
+    syndrome = UpdateCRCBit(syndrome, false);
+  }
+  return syndromes;
+}();
+
+// Reverse lookup of the bit syndromes: the distance of the bit from the end of
+// the frame plus one, or 0 if no bit of a frame has the syndrome.
+//
+// The syndromes of bits are unique within the frame, as the period of the
+// polynomial is longer than the maximum number of bits in the frame.
+//
+// The table covers all 16 bit values, so it is built on the first use rather
+// than at compile time in every translation unit which uses the frame repair.
+class SyndromeBitDistances {
+ public:
+  SyndromeBitDistances() {
+    for (int distance = 0; distance < kMaxFrameBits; ++distance) {
+      distances_[kBitSyndromes[distance]] = uint16_t(distance + 1);
+    }
+  }
+
+  inline auto operator[](const uint16_t syndrome) const -> uint16_t {
+    return distances_[syndrome];
+  }
+
+ private:
+  std::array<uint16_t, 65536> distances_{};
+};
+
+// Get distance from the end of the frame of a bit which flip has the given
+// syndrome. Returns -1 if there is no such bit.
+inline auto GetSyndromeBitDistance(const uint16_t syndrome) -> int {
+  static const SyndromeBitDistances distances;
+  return int(distances[syndrome]) - 1;
+}
+
+// Get the value of the CRC register after the frame is processed.
+inline auto CalculateFrameCRC(const std::span<const std::byte> frame)
+    -> uint16_t {
+  return crypto::crc16ccitt::Update<FCSSpec>(FCSSpec::kInitialValue, frame);
+}
+
+// Get the value of the CRC register after a frame of the given number of zero
+// bits is processed. The number of bits is expected to be a multiple of 8.
+inline auto CalculateZeroFrameCRC(const int num_bits) -> uint16_t {
+  uint16_t crc = FCSSpec::kInitialValue;
+  for (int i = 0; i < num_bits / 8; ++i) {
+    crc = crypto::crc16ccitt::Update<FCSSpec>(crc, uint8_t(0));
+  }
+  return crc;
+}
+
+// Access to bits of the frame in the order of transmission: the bytes are
+// transmitted starting from the least significant bit.
+inline auto GetBit(const std::span<const std::byte> frame, const int index)
+    -> bool {
+  return std::to_integer<int>(frame[index >> 3] >> (index & 7)) & 1;
+}
+inline void FlipBit(const std::span<std::byte> frame, const int index) {
+  frame[index >> 3] ^= std::byte(1 << (index & 7));
+}
+inline void SetBit(const std::span<std::byte> frame,
+                   const int index,
+                   const bool bit) {
+  const std::byte mask = std::byte(1 << (index & 7));
+  frame[index >> 3] = bit ? (frame[index >> 3] | mask)
+                          : (frame[index >> 3] & ~mask);
+}
+
+// Check whether the character is allowed in a callsign: upper case letters,
+// digits, and the space padding.
+inline auto IsCallsignCharacter(const char ch) -> bool {
+  return (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == ' ';
+}
+
+// Check that the address field of the frame is well-formed: the frame has the
+// destination and source addresses and possibly repeaters, and all callsigns
+// consist of allowed characters.
+inline auto HasValidAddresses(const std::span<const std::byte> frame) -> bool {
+  size_t num_addresses = 0;
+  size_t offset = 0;
+
+  while (true) {
+    if (num_addresses == 2 + Repeaters::kMaxNumRepeaters ||
+        offset + kAddressSize > frame.size()) {
+      return false;
+    }
+
+    for (size_t i = 0; i < kAddressSize - 1; ++i) {
+      const auto byte = std::to_integer<uint8_t>(frame[offset + i]);
+      if ((byte & 1) || !IsCallsignCharacter(char(byte >> 1))) {
+        return false;
+      }
+    }
+
+    const auto ssid = std::to_integer<uint8_t>(frame[offset + 6]);
+
+    offset += kAddressSize;
+    ++num_addresses;
+
+    // The address extension bit is set to one in the last address.
+    if (ssid & 1) {
+      break;
+    }
+  }
+
+  // Control field and FCS are to follow the address field.
+  return num_addresses >= 2 && offset + 1 + 2 <= frame.size();
+}
+
+// Attempt to repair the frame by flipping a single bit.
+inline auto RepairSingleBit(const std::span<const std::byte> frame,
+                            const uint16_t syndrome,
+                            const std::span<std::byte> repaired_frame)
+    -> bool {
+  const int num_bits = int(frame.size() * 8);
+
+  const int distance = GetSyndromeBitDistance(syndrome);
+  if (distance < 0 || distance >= num_bits) {
+    return false;
+  }
+
+  std::copy(frame.begin(), frame.end(), repaired_frame.begin());
+  FlipBit(repaired_frame, num_bits - 1 - distance);
+
+  return HasValidAddresses(repaired_frame.first(frame.size()));
+}
+
+// Attempt to repair the frame by flipping two bits which are at most
+// max_distance bits apart.
+//
+// For every bit the syndrome of the other bit is known, so that its position
+// is found using the reverse lookup.
+inline auto RepairTwoBits(const std::span<const std::byte> frame,
+                          const uint16_t syndrome,
+                          const int max_distance,
+                          const std::span<std::byte> repaired_frame) -> bool {
+  const int num_bits = int(frame.size() * 8);
+
+  for (int distance = 0; distance < num_bits - 1; ++distance) {
+    const int other_distance =
+        GetSyndromeBitDistance(syndrome ^ kBitSyndromes[distance]);
+    if (other_distance <= distance || other_distance >= num_bits ||
+        other_distance - distance > max_distance) {
+      continue;
+    }
+
+    std::copy(frame.begin(), frame.end(), repaired_frame.begin());
+    FlipBit(repaired_frame, num_bits - 1 - distance);
+    FlipBit(repaired_frame, num_bits - 1 - other_distance);
+
+    if (HasValidAddresses(repaired_frame.first(frame.size()))) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Attempt to repair the frame in which a data bit has been removed as a
+// stuffed bit after five or more ones, while one of the ones was a flipped
+// zero.
+//
+// The candidate frame is created by flipping one of the ones and inserting
+// zero after them. The HDLC decoder keeps ones after the fifth one as data, so
+// the insertion is checked after every one which follows at least four ones.
+// The candidate frame has the same number of bytes as the received frame: the
+// last received bit belongs to the closing frame marker.
+//
+// The CRC of a frame is the CRC of a frame of zeros combined with the
+// syndromes of its one bits. The sums of the syndromes of the bits before the
+// inserted bit and the ones after it are accumulated while the frame is
+// scanned, so the CRC of every candidate is known without processing the
+// frame again.
+inline auto RepairRemovedStuffedBit(const std::span<const std::byte> frame,
+                                    const std::span<std::byte> repaired_frame)
+    -> bool {
+  const int num_bits = int(frame.size() * 8);
+
+  // Sum of syndromes of the bits of the frame, if they keep their position and
+  // if they are shifted by one bit towards the end of the frame.
+  // The last bit is not a part of the shifted frame.
+  uint16_t shifted_sum = 0;
+  for (int i = 0; i < num_bits - 1; ++i) {
+    if (GetBit(frame, i)) {
+      shifted_sum ^= kBitSyndromes[num_bits - 1 - (i + 1)];
+    }
+  }
+
+  const uint16_t zero_frame_crc = CalculateZeroFrameCRC(num_bits);
+
+  uint16_t prefix_sum = 0;
+  uint16_t shifted_prefix_sum = 0;
+  int num_ones = 0;
+
+  for (int i = 0; i < num_bits - 1; ++i) {
+    if (!GetBit(frame, i)) {
+      num_ones = 0;
+      continue;
+    }
+
+    prefix_sum ^= kBitSyndromes[num_bits - 1 - i];
+    shifted_prefix_sum ^= kBitSyndromes[num_bits - 1 - (i + 1)];
+
+    if (++num_ones < hdlc::Spec::kMaxConsecutiveOnes) {
+      continue;
+    }
+
+    // The zero is inserted after the current bit. Find one of the ones before
+    // it which flip makes the CRC to match.
+    const int insert_index = i + 1;
+    const uint16_t crc =
+        zero_frame_crc ^ prefix_sum ^ shifted_sum ^ shifted_prefix_sum;
+    const int flip_index =
+        num_bits - 1 - GetSyndromeBitDistance(crc ^ kGoodFrameCRC);
+    if (flip_index < insert_index - num_ones || flip_index >= insert_index) {
+      continue;
+    }
+
+    for (int j = 0; j < num_bits; ++j) {
+      if (j < insert_index) {
+        SetBit(repaired_frame, j, GetBit(frame, j));
+      } else if (j == insert_index) {
+        SetBit(repaired_frame, j, false);
+      } else {
+        SetBit(repaired_frame, j, GetBit(frame, j - 1));
+      }
+    }
+    FlipBit(repaired_frame, flip_index);
+
+    if (HasValidAddresses(repaired_frame.first(frame.size()))) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Attempt to repair the frame in which a stuffed zero has been kept as a data
+// bit. This happens when one of the five ones before it was flipped to zero,
+// or when the stuffed zero itself was flipped to one.
+//
+// The candidate frame is created by setting the five bits to ones and
+// removing the stuffed bit. It is one byte shorter than the received frame:
+// the last received byte contains the last bit of the frame followed by the
+// beginning of the closing frame marker.
+//
+// Similar to the RepairRemovedStuffedBit() the CRC of the candidates is found
+// from the syndrome sums of the bits before and after the removed bit.
+inline auto RepairKeptStuffedBit(const std::span<const std::byte> frame,
+                                 const std::span<std::byte> repaired_frame)
+    -> bool {
+  constexpr int kNumOnes = hdlc::Spec::kMaxConsecutiveOnes;
+
+  if (frame.size() <= kMinFrameSize) {
+    return false;
+  }
+
+  const int num_bits = int(frame.size() * 8);
+  const int num_repaired_bits = num_bits - 8;
+
+  // Sum of syndromes of the bits of the repaired frame, if they are shifted by
+  // one bit towards the beginning of the frame.
+  uint16_t shifted_sum = 0;
+  for (int i = 0; i <= num_repaired_bits; ++i) {
+    if (GetBit(frame, i)) {
+      shifted_sum ^= kBitSyndromes[num_repaired_bits - i];
+    }
+  }
+
+  const uint16_t zero_frame_crc = CalculateZeroFrameCRC(num_repaired_bits);
+
+  uint16_t prefix_sum = 0;
+  uint16_t shifted_prefix_sum = 0;
+
+  // The number of ones since the last zero or stuffed bit.
+  int num_ones = 0;
+
+  // The number of ones since the last zero.
+  int run_length = 0;
+
+  // Bit mask of the recent positions at which the number of ones since the
+  // last zero or stuffed bit has been zero. The least significant bit
+  // corresponds to the current bit.
+  uint32_t ones_reset_history = 0;
+
+  for (int i = 0; i <= num_repaired_bits; ++i) {
+    ones_reset_history = (ones_reset_history << 1) | (num_ones == 0);
+
+    const bool bit = GetBit(frame, i);
+
+    // CRC of the frame with the current bit removed.
+    uint16_t crc = zero_frame_crc ^ prefix_sum ^ shifted_sum ^
+                   shifted_prefix_sum ^
+                   (bit ? kBitSyndromes[num_repaired_bits - i] : 0);
+
+    // Index of the zero among the five bits before the stuffed bit which is
+    // to be set to one.
+    int zero_index = -1;
+
+    bool is_candidate = false;
+    if (bit) {
+      // A sixth one is the stuffed zero which has been flipped.
+      is_candidate = (run_length == kNumOnes);
+    } else if (i >= kNumOnes && (ones_reset_history & (1 << kNumOnes))) {
+      // The five bits before the stuffed zero start a run of ones, and have a
+      // single zero among them.
+      int num_zeros = 0;
+      for (int j = i - kNumOnes; j < i; ++j) {
+        if (!GetBit(frame, j)) {
+          ++num_zeros;
+          zero_index = j;
+        }
+      }
+      if (num_zeros == 1) {
+        crc ^= kBitSyndromes[num_repaired_bits - 1 - zero_index];
+        is_candidate = true;
+      }
+    }
+
+    if (is_candidate && crc == kGoodFrameCRC) {
+      for (int j = 0; j < num_repaired_bits; ++j) {
+        SetBit(repaired_frame, j, GetBit(frame, j < i ? j : j + 1));
+      }
+      if (zero_index != -1) {
+        SetBit(repaired_frame, zero_index, true);
+      }
+
+      if (HasValidAddresses(repaired_frame.first(frame.size() - 1))) {
+        return true;
+      }
+    }
+
+    if (bit) {
+      if (i < num_repaired_bits) {
+        prefix_sum ^= kBitSyndromes[num_repaired_bits - 1 - i];
+      }
+      shifted_prefix_sum ^= kBitSyndromes[num_repaired_bits - i];
+
+      if (++num_ones == kNumOnes) {
+        num_ones = 0;
+      }
+      ++run_length;
+    } else {
+      num_ones = 0;
+      run_length = 0;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace ax25_internal
+
+// Attempt to repair the frame which did not pass the FCS check.
+//
+// The frame is given as it is received from the HDLC decoder, including the
+// FCS field. The repaired frame is written to the repaired_frame which is
+// expected to have at least the size of the frame.
+//
+// Returns the span of the repaired frame within the repaired_frame, or an
+// empty span if the frame could not be repaired with the given options.
+inline auto RepairFrame(const FrameRepairOptions& options,
+                        const std::span<const std::byte> frame,
+                        const std::span<std::byte> repaired_frame)
+    -> std::span<std::byte> {
+  using namespace ax25_internal;
+
+  if (frame.size() < kMinFrameSize || frame.size() > kMaxFrameSize ||
+      repaired_frame.size() < frame.size()) {
+    return {};
+  }
+
+  const uint16_t syndrome = CalculateFrameCRC(frame) ^ kGoodFrameCRC;
+  if (syndrome == 0) {
+    std::copy(frame.begin(), frame.end(), repaired_frame.begin());
+    return repaired_frame.first(frame.size());
+  }
+
+  if (options.single_bit &&
+      RepairSingleBit(frame, syndrome, repaired_frame)) {
+    return repaired_frame.first(frame.size());
+  }
+
+  if (options.max_two_bits_distance > 0 &&
+      RepairTwoBits(
+          frame, syndrome, options.max_two_bits_distance, repaired_frame)) {
+    return repaired_frame.first(frame.size());
+  }
+
+  if (options.bit_stuffing) {
+    if (RepairRemovedStuffedBit(frame, repaired_frame)) {
+      return repaired_frame.first(frame.size());
+    }
+    if (RepairKeptStuffedBit(frame, repaired_frame)) {
+      return repaired_frame.first(frame.size() - 1);
+    }
+  }
+
+  return {};
+}
+
+}  // namespace radio_core::protocol::datalink::ax25
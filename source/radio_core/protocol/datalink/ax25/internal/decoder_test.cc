@@ -56,6 +56,57 @@ TEST(Decoder, WrongFCS) {
   EXPECT_EQ(message.information, "Hello, World!");
 }
 
+TEST(Decoder, RepairFrame) {
+  // The first character of the information has one bit flipped.
+  constexpr auto kDamagedMessage = ToBytesArray({
+      0x9c, 0x94, 0x6e, 0xa0, 0x40, 0x40, 0x60,  // Destination.
+      0x9c, 0x6e, 0x98, 0x8a, 0x9a, 0x40, 0x61,  // Source.
+      0x03,                                      // Control.
+      0xf0,                                      // PID.
+      0x49, 0x65, 0x6c, 0x6c, 0x6f, 0x2c, 0x20,
+      0x57, 0x6f, 0x72, 0x6c, 0x64, 0x21,  // Information
+      0xff, 0x31,                          // FCS.
+  });
+
+  {
+    Decoder decoder;
+
+    const Decoder::Result result = decoder(kDamagedMessage);
+    EXPECT_FALSE(result.Ok());
+    EXPECT_EQ(result.GetError(), Decoder::Error::kChecksumMismatch);
+  }
+
+  Decoder decoder({.repair = {.single_bit = true}});
+
+  const Decoder::Result result = decoder(kDamagedMessage);
+  EXPECT_TRUE(result.Ok());
+  EXPECT_TRUE(decoder.IsFrameRepaired());
+  EXPECT_EQ(decoder.GetFrameFCS(), 0x31ff);
+
+  const Message& message = result.GetValue();
+
+  EXPECT_EQ(message.address.source, Address("N7LEM"));
+  EXPECT_EQ(message.address.destination, Address("NJ7P"));
+  EXPECT_TRUE(message.address.repeaters.IsEmpty());
+  EXPECT_EQ(message.control, ControlBits::Unnumbered::kUI);
+  EXPECT_EQ(message.pid, PID::kNoLayer3);
+  EXPECT_EQ(message.information, "Hello, World!");
+
+  // The frame which passes the FCS check is not flagged as repaired.
+  constexpr auto kEncodedMessage = ToBytesArray({
+      0x9c, 0x94, 0x6e, 0xa0, 0x40, 0x40, 0x60,  // Destination.
+      0x9c, 0x6e, 0x98, 0x8a, 0x9a, 0x40, 0x61,  // Source.
+      0x03,                                      // Control.
+      0xf0,                                      // PID.
+      0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x2c, 0x20,
+      0x57, 0x6f, 0x72, 0x6c, 0x64, 0x21,  // Information
+      0xff, 0x31,                          // FCS.
+  });
+
+  EXPECT_TRUE(decoder(kEncodedMessage).Ok());
+  EXPECT_FALSE(decoder.IsFrameRepaired());
+}
+
 TEST(Decoder, SimpleFrameAPI) {
   constexpr auto kEncodedMessage = ToBytesArray({
       0x9c, 0x94, 0x6e, 0xa0, 0x40, 0x40, 0x60,  // Destination.
@@ -71,6 +122,7 @@ TEST(Decoder, SimpleFrameAPI) {
 
   const Decoder::Result result = decoder(kEncodedMessage);
   EXPECT_TRUE(result.Ok());
+  EXPECT_EQ(decoder.GetFrameFCS(), 0x31ff);
 
   const Message& message = result.GetValue();
 
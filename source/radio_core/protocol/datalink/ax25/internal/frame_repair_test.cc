@@ -0,0 +1,212 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/protocol/datalink/ax25/frame_repair.h"
+
+#include <array>
+#include <vector>
+
+#include "radio_core/protocol/datalink/ax25/encoder.h"
+#include "radio_core/protocol/datalink/hdlc/decoder.h"
+#include "radio_core/protocol/datalink/hdlc/encoder.h"
+#include "radio_core/unittest/mock.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::protocol::datalink::ax25 {
+
+using testing::Eq;
+using testing::Pointwise;
+
+namespace {
+
+// Encode the message into bytes of the frame, including the FCS.
+auto EncodeFrame(const Message& message) -> std::vector<std::byte> {
+  std::vector<std::byte> frame;
+
+  Encoder encoder;
+  encoder(message, [&](const FrameByte& frame_byte) {
+    if (frame_byte.IsData()) {
+      frame.push_back(frame_byte.GetData());
+    }
+  });
+
+  return frame;
+}
+
+// Get bits of the HDLC transmission of the frame.
+auto TransmitFrame(const std::span<const std::byte> frame)
+    -> std::vector<bool> {
+  std::vector<bool> bits;
+
+  const auto push_bit = [&](const bool bit) { bits.push_back(bit); };
+
+  hdlc::Encoder encoder;
+  encoder(FrameMarker::kBegin, push_bit);
+  for (const std::byte byte : frame) {
+    encoder(byte, push_bit);
+  }
+  encoder(FrameMarker::kEnd, push_bit);
+
+  return bits;
+}
+
+// Get frames received from the HDLC transmission.
+auto ReceiveFrames(const std::vector<bool>& bits)
+    -> std::vector<std::vector<std::byte>> {
+  std::vector<std::vector<std::byte>> frames;
+
+  hdlc::Decoder decoder;
+  for (const bool bit : bits) {
+    const hdlc::Decoder::Result result = decoder(bit);
+    for (const FrameByte& frame_byte : result.GetValue()) {
+      if (frame_byte.IsMarker()) {
+        if (frame_byte.GetMarker() == FrameMarker::kBegin) {
+          frames.emplace_back();
+        }
+      } else if (!frames.empty()) {
+        frames.back().push_back(frame_byte.GetData());
+      }
+    }
+  }
+
+  return frames;
+}
+
+auto MakeMessage(const std::string_view information) -> Message {
+  Message message;
+  message.address.destination = Address("APRS");
+  message.address.source = Address("N0CALL", 7);
+  message.control = ControlBits::Unnumbered::kUI;
+  message.pid = PID::kNoLayer3;
+  message.information = Information(information);
+  return message;
+}
+
+// Repair the frame, and return the repaired frame. An empty frame is returned
+// if the frame could not be repaired.
+auto Repair(const FrameRepairOptions& options,
+            const std::span<const std::byte> frame) -> std::vector<std::byte> {
+  std::array<std::byte, ax25_internal::kMaxFrameSize> repaired_frame;
+  const std::span<const std::byte> repaired =
+      RepairFrame(options, frame, repaired_frame);
+  return {repaired.begin(), repaired.end()};
+}
+
+}  // namespace
+
+TEST(FrameRepair, CorrectFrame) {
+  const std::vector<std::byte> frame = EncodeFrame(MakeMessage("Hello!"));
+
+  EXPECT_THAT(Repair({}, frame), Pointwise(Eq(), frame));
+}
+
+TEST(FrameRepair, SingleBit) {
+  const std::vector<std::byte> frame =
+      EncodeFrame(MakeMessage("Hello, World!"));
+
+  for (size_t i = 0; i < frame.size() * 8; ++i) {
+    std::vector<std::byte> damaged_frame = frame;
+    damaged_frame[i / 8] ^= std::byte(1 << (i % 8));
+
+    EXPECT_TRUE(Repair({}, damaged_frame).empty());
+
+    EXPECT_THAT(Repair({.single_bit = true}, damaged_frame),
+                Pointwise(Eq(), frame))
+        << "Bit " << i;
+  }
+}
+
+TEST(FrameRepair, TwoBits) {
+  const std::vector<std::byte> frame =
+      EncodeFrame(MakeMessage("Hello, World!"));
+
+  for (size_t i = 0; i < frame.size() * 8 - 3; ++i) {
+    for (size_t distance = 1; distance <= 3; ++distance) {
+      const size_t j = i + distance;
+
+      std::vector<std::byte> damaged_frame = frame;
+      damaged_frame[i / 8] ^= std::byte(1 << (i % 8));
+      damaged_frame[j / 8] ^= std::byte(1 << (j % 8));
+
+      EXPECT_TRUE(Repair({.single_bit = true}, damaged_frame).empty());
+
+      EXPECT_THAT(Repair({.max_two_bits_distance = 3}, damaged_frame),
+                  Pointwise(Eq(), frame))
+          << "Bits " << i << " " << j;
+    }
+  }
+}
+
+TEST(FrameRepair, BitStuffing) {
+  // The information contains long runs of ones, so that many bits of the
+  // transmission are involved in the bit-stuffing.
+  const std::vector<std::byte> frame =
+      EncodeFrame(MakeMessage("?~>|}{ Hello, World! \x7f\x7f"));
+
+  const std::vector<bool> bits = TransmitFrame(frame);
+
+  int num_shorter_frames = 0;
+  int num_longer_frames = 0;
+
+  // Flip every bit of the transmission between the frame markers.
+  for (size_t i = 8; i < bits.size() - 8; ++i) {
+    std::vector<bool> damaged_bits = bits;
+    damaged_bits[i] = !damaged_bits[i];
+
+    const std::vector<std::vector<std::byte>> received_frames =
+        ReceiveFrames(damaged_bits);
+
+    // Flipping bits of the stuffed zeros aborts the frame.
+    if (received_frames.size() != 1) {
+      continue;
+    }
+
+    const std::vector<std::byte>& received_frame = received_frames[0];
+
+    const int num_received_bits = int(received_frame.size() * 8);
+    if (num_received_bits == int(frame.size() * 8)) {
+      // Either the bit-stuffing decision did not change and the received frame
+      // has a single flipped bit, or a data bit has been removed.
+      bool is_single_bit_flip = false;
+      for (int j = 0; j < num_received_bits; ++j) {
+        std::vector<std::byte> flipped_frame = received_frame;
+        flipped_frame[j / 8] ^= std::byte(1 << (j % 8));
+        is_single_bit_flip |= (flipped_frame == frame);
+      }
+      if (is_single_bit_flip) {
+        continue;
+      }
+      ++num_shorter_frames;
+    } else {
+      ++num_longer_frames;
+    }
+
+    EXPECT_TRUE(Repair({.single_bit = true}, received_frame).empty());
+
+    EXPECT_THAT(Repair({.bit_stuffing = true}, received_frame),
+                Pointwise(Eq(), frame))
+        << "Bit " << i;
+  }
+
+  EXPECT_GT(num_shorter_frames, 0);
+  EXPECT_GT(num_longer_frames, 0);
+}
+
+TEST(FrameRepair, InvalidAddress) {
+  // The frame has a correct FCS, but its destination callsign has characters
+  // which are not allowed in callsigns.
+  Message message = MakeMessage("Hello, World!");
+  message.address.destination = Address("aprs");
+  const std::vector<std::byte> frame = EncodeFrame(message);
+
+  EXPECT_THAT(Repair({}, frame), Pointwise(Eq(), frame));
+
+  // The repaired frame is required to have valid addresses.
+  std::vector<std::byte> damaged_frame = frame;
+  damaged_frame[20] ^= std::byte{0b00000100};
+
+  EXPECT_TRUE(Repair({.single_bit = true}, damaged_frame).empty());
+}
+
+}  // namespace radio_core::protocol::datalink::ax25
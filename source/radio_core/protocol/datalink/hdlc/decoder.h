@@ -21,11 +21,23 @@
 // The HDLC specification allows he 0-bit at the end of a frame delimiter to be
 // shared with the start of the next frame delimiter, i.e. "011111101111110".
 // This is not implemented by this decoder.
+//
+// Bytes of a bit stream are decoded by a table-driven decoder which processes
+// 4 bits at a time. The table is indexed by the state
+// of the raw bit stream (the number of trailing ones) and the next 4 bits, and
+// it provides the frame marker detection, the un-stuffed data bits, and the
+// next state of the raw bit stream. The table-driven decoder shares the state
+// with the bit-wise decoder, so the APIs can be mixed on the same stream.
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <span>
 
 #include "radio_core/base/result.h"
 #include "radio_core/protocol/datalink/frame.h"
@@ -33,6 +45,106 @@
 
 namespace radio_core::protocol::datalink::hdlc {
 
+namespace hdlc_internal {
+
+// The number of ones in the raw bit stream after which a zero is either a part
+// of the frame marker or a stuffed bit.
+inline constexpr int kMaxConsecutiveOnes = Spec::kMaxConsecutiveOnes;
+inline constexpr int kMarkerOnes = kMaxConsecutiveOnes + 1;
+
+// State of the raw bit stream as seen by the table-driven decoder.
+//
+// The states [0 .. kNumOnesStates) denote the number of trailing ones in the
+// raw bit stream which are preceded by a zero, with the last state meaning
+// that there are more ones than in the frame marker.
+//
+// The states starting from kInitialState are used until the first zero is
+// received. There could be no frame marker in this case, and the state stores
+// the number of received ones, saturated at kMaxConsecutiveOnes.
+inline constexpr int kNumOnesStates = kMarkerOnes + 2;
+inline constexpr int kInitialState = kNumOnesStates;
+inline constexpr int kNumStates = kInitialState + kMaxConsecutiveOnes + 1;
+
+// Transition of the decoder state caused by 4 bits of the raw bit stream.
+struct NibbleTransition {
+  // The state of the raw bit stream after the bits are processed.
+  uint8_t next_state{0};
+
+  // True if the frame marker ends within the bits.
+  bool has_marker{false};
+
+  // Un-stuffed data bits before the marker, or all of them if there is no
+  // marker. The first bit is stored in the least significant bit.
+  uint8_t num_data_bits{0};
+  uint8_t data_bits{0};
+
+  // Un-stuffed data bits after the marker.
+  uint8_t num_data_bits_after_marker{0};
+  uint8_t data_bits_after_marker{0};
+};
+
+constexpr auto MakeNibbleTransition(int state, const int nibble)
+    -> NibbleTransition {
+  NibbleTransition transition;
+
+  for (int i = 0; i < 4; ++i) {
+    const bool bit = nibble & (1 << i);
+    bool is_data_bit = true;
+
+    if (state >= kInitialState) {
+      const int num_ones = state - kInitialState;
+      if (bit) {
+        state = kInitialState + std::min(num_ones + 1, kMaxConsecutiveOnes);
+      } else {
+        is_data_bit = (num_ones != kMaxConsecutiveOnes);
+        state = 0;
+      }
+    } else {
+      if (bit) {
+        state = std::min(state + 1, kNumOnesStates - 1);
+      } else {
+        if (state == kMarkerOnes) {
+          transition.has_marker = true;
+          is_data_bit = false;
+        } else if (state >= kMaxConsecutiveOnes) {
+          is_data_bit = false;
+        }
+        state = 0;
+      }
+    }
+
+    if (!is_data_bit) {
+      continue;
+    }
+
+    if (transition.has_marker) {
+      transition.data_bits_after_marker |=
+          (bit << transition.num_data_bits_after_marker);
+      ++transition.num_data_bits_after_marker;
+    } else {
+      transition.data_bits |= (bit << transition.num_data_bits);
+      ++transition.num_data_bits;
+    }
+  }
+
+  transition.next_state = state;
+
+  return transition;
+}
+
+// Table of transitions indexed by (state << 4) | nibble.
+inline constexpr auto kNibbleTransitions = []() {
+  std::array<NibbleTransition, kNumStates * 16> transitions;
+  for (int state = 0; state < kNumStates; ++state) {
+    for (int nibble = 0; nibble < 16; ++nibble) {
+      transitions[(state << 4) | nibble] = MakeNibbleTransition(state, nibble);
+    }
+  }
+  return transitions;
+}();
+
+}  // namespace hdlc_internal
+
 class Decoder {
  public:
   enum class Error {
@@ -42,12 +154,16 @@ class Decoder {
 
   // Statically sized storage of frame bytes in the result.
   //
-  // The result can never have more than 2 frame bytes. The 2 bytes are seen in
-  // the output when a first byte of data has been decoded. At that point it
-  // becomes obvious that the frame actually contains data (and it is not just
-  // a stream of frame markers in the media which is required by some protocols
-  // or which is seem in the beginning of many transmissions from the air).
-  static constexpr int kMaxFrameBytes = 2;
+  // The per-bit processing can never have more than 2 frame bytes in the
+  // result. The 2 bytes are seen in the output when a first byte of data has
+  // been decoded. At that point it becomes obvious that the frame actually
+  // contains data (and it is not just a stream of frame markers in the media
+  // which is required by some protocols or which is seem in the beginning of
+  // many transmissions from the air).
+  //
+  // The per-byte processing can also have the frame end marker after the first
+  // byte of data, as the marker could end within the same byte.
+  static constexpr int kMaxFrameBytes = 3;
   using FrameBytes = datalink::FrameBytes<kMaxFrameBytes>;
 
   using Result = radio_core::Result<FrameBytes, Error>;
@@ -92,27 +208,153 @@ class Decoder {
   }
 
   // Process single byte of an incoming transmission.
+  //
+  // The bits are processed starting from the least significant one. The result
+  // contains all frame bytes decoded from the bits of the byte.
   auto operator()(const std::byte new_byte) -> Result {
     Result result{FrameBytes{}};
 
-    const auto byte_value = std::to_integer<uint8_t>(new_byte);
+    (*this)(std::span<const std::byte>(&new_byte, 1),
+            [&result](const FrameByte& frame_byte) {
+              result.GetValue().emplace_back(frame_byte);
+            });
 
-    for (int i = 0; i < 8; ++i) {
-      const bool bit = byte_value & (1 << i);
+    return result;
+  }
 
-      const Result bit_result = (*this)(bit);
+  // Process multiple bytes of an incoming transmission, and invoke the
+  // callback with every decoded frame byte.
+  //
+  // The bits of every byte are processed starting from the least significant
+  // one, same as the per-byte processing. The bytes are processed 4 bits at a
+  // time using the transition table, without going through the per-bit
+  // processing.
+  //
+  // The given list of args... is passed to the callback first. This makes the
+  // required callback signature to be:
+  //
+  //   callback(<optional arguments>, const FrameByte& frame_byte)
+  template <class F, class... Args>
+  void operator()(const std::span<const std::byte> bytes,
+                  F&& callback,
+                  Args&&... args) {
+    using hdlc_internal::kNibbleTransitions;
+    using hdlc_internal::NibbleTransition;
+
+    if (bytes.empty()) {
+      return;
+    }
+
+    int state = GetRawBitsState();
+
+    // Data bits which are not yet forming a byte, with the first bit in the
+    // least significant bit.
+    uint32_t data_bits = 0;
+    int num_data_bits = num_bits_in_data_buffer_;
+    if (num_data_bits) {
+      data_bits = std::to_integer<uint32_t>(data_bit_buffer_) >>
+                  (8 - num_data_bits);
+    }
+
+    for (const std::byte byte : bytes) {
+      uint32_t nibbles = std::to_integer<uint32_t>(byte);
+
+      for (int i = 0; i < 2; ++i, nibbles >>= 4) {
+        const NibbleTransition& transition =
+            kNibbleTransitions[(state << 4) | (nibbles & 0xf)];
+
+        state = transition.next_state;
+
+        data_bits |= uint32_t(transition.data_bits) << num_data_bits;
+        num_data_bits += transition.num_data_bits;
 
-      if (!bit_result.Ok()) {
-        return bit_result;
+        if (num_data_bits >= 8) {
+          ProcessDataByte(std::byte(data_bits & 0xff), callback, args...);
+          data_bits >>= 8;
+          num_data_bits -= 8;
+        }
+
+        if (transition.has_marker) [[unlikely]] {
+          ProcessFrameMarker(callback, args...);
+
+          // The data bits after the marker never form a full byte.
+          data_bits = transition.data_bits_after_marker;
+          num_data_bits = transition.num_data_bits_after_marker;
+        }
       }
 
-      result = bit_result;
+      // Unless all bits of the byte are ones the state only depends on the
+      // byte itself. Calculating it from the byte breaks the dependency chain
+      // of the table lookups, which allows to overlap processing of
+      // consecutive bytes.
+      if (byte != std::byte{0b11111111}) {
+        state = std::countl_one(std::to_integer<uint8_t>(byte));
+      }
     }
 
-    return result;
+    // Store the state in the form used by the per-bit processing.
+    //
+    // After 8 bits are pushed to the raw bit buffer it equals to the last byte.
+    raw_bit_buffer_ = bytes.back();
+    if (state >= hdlc_internal::kInitialState) {
+      num_raw_sequential_ones_ = state - hdlc_internal::kInitialState;
+    } else {
+      num_raw_sequential_ones_ = std::min(state, Spec::kMaxConsecutiveOnes);
+    }
+
+    data_bit_buffer_ = std::byte((data_bits << (8 - num_data_bits)) & 0xff);
+    num_bits_in_data_buffer_ = num_data_bits;
   }
 
  private:
+  // Get state of the raw bit stream as seen by the table-driven decoder from
+  // the state of the per-bit processing.
+  inline auto GetRawBitsState() const -> int {
+    // The buffer is initialized with ones, and it stays this way until a zero
+    // is received. This can not be told apart from receiving at least 8 ones,
+    // but the decoding of both cases is the same.
+    if (raw_bit_buffer_ == std::byte{0b11111111}) {
+      return hdlc_internal::kInitialState + num_raw_sequential_ones_;
+    }
+
+    // The newest bit is stored in the most significant bit.
+    const int num_trailing_ones =
+        std::countl_one(std::to_integer<uint8_t>(raw_bit_buffer_));
+
+    return std::min(num_trailing_ones, hdlc_internal::kNumOnesStates - 1);
+  }
+
+  // Handle the frame marker found by the table-driven decoder.
+  // Matches the frame marker handling of the per-bit processing.
+  template <class F, class... Args>
+  inline void ProcessFrameMarker(F& callback, Args&... args) {
+    if (is_inside_frame_) {
+      is_inside_frame_ = false;
+
+      std::invoke(callback, args..., FrameByte(FrameMarker::kEnd));
+    }
+
+    need_open_frame_on_next_data_bit_ = true;
+  }
+
+  // Handle the data byte decoded by the table-driven decoder.
+  // Matches the data byte handling of the per-bit processing.
+  template <class F, class... Args>
+  inline void ProcessDataByte(const std::byte byte,
+                              F& callback,
+                              Args&... args) {
+    if (need_open_frame_on_next_data_bit_) {
+      need_open_frame_on_next_data_bit_ = false;
+      is_inside_frame_ = true;
+
+      std::invoke(callback, args..., FrameByte(FrameMarker::kBegin));
+    }
+
+    if (is_inside_frame_) {
+      std::invoke(callback, args..., FrameByte(byte));
+    }
+  }
+
   inline auto ProcessDataBit(const bool bit) -> Result {
     Result result{FrameBytes{}};
 
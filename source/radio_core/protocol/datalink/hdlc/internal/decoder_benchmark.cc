@@ -0,0 +1,202 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Benchmark of the HDLC decoder on a stored bit stream.
+//
+// Compare the per-bit, per-byte, and table-driven processing of multiple
+// bytes:
+//
+//   ./radio_core_protocol_datalink_hdlc_decoder_benchmark bit
+//   ./radio_core_protocol_datalink_hdlc_decoder_benchmark byte
+//   ./radio_core_protocol_datalink_hdlc_decoder_benchmark table
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "radio_core/benchmark/base_app.h"
+#include "radio_core/protocol/datalink/hdlc/decoder.h"
+#include "radio_core/protocol/datalink/hdlc/encoder.h"
+
+namespace radio_core::benchmark {
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+using protocol::datalink::FrameByte;
+using protocol::datalink::FrameMarker;
+
+class HDLCDecoderBenchmark : public Benchmark {
+ public:
+  using Benchmark::Benchmark;
+
+ protected:
+  auto GetBenchmarkName() -> std::string override { return "HDLC decoder"; }
+
+  void ConfigureParser(argparse::ArgumentParser& parser) override {
+    parser.add_argument("implementation")
+        .help("Implementation of the decoder: " +
+              std::string(kSupportedImplementationsListString));
+
+    parser.add_argument("--num-frames")
+        .default_value(10)
+        .help("The number of frames in the decoded bit stream")
+        .scan<'i', int>();
+  }
+
+  auto HandleArguments(argparse::ArgumentParser& parser) -> bool override {
+    const auto implementation = parser.get<std::string>("implementation");
+    if (implementation == "bit") {
+      implementation_ = Implementation::kBit;
+    } else if (implementation == "byte") {
+      implementation_ = Implementation::kByte;
+    } else if (implementation == "table") {
+      implementation_ = Implementation::kTable;
+    } else {
+      cerr << "Unknown implementation " << implementation << endl;
+      cerr << "Supported: " << kSupportedImplementationsListString << endl;
+      return false;
+    }
+
+    num_frames_ = parser.get<int>("--num-frames");
+
+    return true;
+  }
+
+  void Initialize() override {
+    GenerateBitStream();
+
+    cout << endl;
+    cout << "Configuration" << endl;
+    cout << "=============" << endl;
+
+    switch (implementation_) {
+      case Implementation::kBit:
+        cout << "Implementation       : bit" << endl;
+        break;
+      case Implementation::kByte:
+        cout << "Implementation       : byte" << endl;
+        break;
+      case Implementation::kTable:
+        cout << "Implementation       : table" << endl;
+        break;
+    }
+    cout << "Number of frames     : " << num_frames_ << endl;
+    cout << "Number of bytes      : " << bytes_.size() << endl;
+    cout << "Number of iterations : " << GetNumIterations() << endl;
+  }
+
+  void Iteration() override {
+    switch (implementation_) {
+      case Implementation::kBit:
+        for (const std::byte byte : bytes_) {
+          const auto byte_value = std::to_integer<uint8_t>(byte);
+          for (int i = 0; i < 8; ++i) {
+            const bool bit = byte_value & (1 << i);
+            const Decoder::Result result = decoder_(bit);
+            for (const FrameByte& frame_byte : result.GetValue()) {
+              CountFrameByte(frame_byte);
+            }
+          }
+        }
+        break;
+
+      case Implementation::kByte:
+        for (const std::byte byte : bytes_) {
+          const Decoder::Result result = decoder_(byte);
+          for (const FrameByte& frame_byte : result.GetValue()) {
+            CountFrameByte(frame_byte);
+          }
+        }
+        break;
+
+      case Implementation::kTable:
+        decoder_(std::span<const std::byte>(bytes_),
+                 [&](const FrameByte& frame_byte) {
+                   CountFrameByte(frame_byte);
+                 });
+        break;
+    }
+  }
+
+  void Finalize() override {
+    // Sanity check and endurance that the decoding is not optimized out.
+    cout << "Number of decoded frames per iteration : "
+         << num_decoded_frames_ / GetNumIterations() << endl;
+
+    if (num_decoded_frames_ == 0) {
+      cerr << "No frames have been decoded" << endl;
+      ::exit(1);
+    }
+  }
+
+ private:
+  using Decoder = protocol::datalink::hdlc::Decoder;
+  using Encoder = protocol::datalink::hdlc::Encoder;
+
+  enum class Implementation {
+    kBit,
+    kByte,
+    kTable,
+  };
+
+  static constexpr std::string_view kSupportedImplementationsListString =
+      "bit, byte, table";
+
+  // Generate bit stream of frames with random data, packed into bytes.
+  void GenerateBitStream() {
+    std::mt19937 random_engine(0);
+    std::uniform_int_distribution<int> byte_distribution(0, 255);
+    std::uniform_int_distribution<int> length_distribution(16, 256);
+
+    std::vector<bool> bits;
+    auto push_bit = [&bits](const bool bit) { bits.push_back(bit); };
+
+    Encoder encoder;
+
+    for (int i = 0; i < num_frames_; ++i) {
+      encoder(FrameMarker::kBegin, push_bit);
+
+      const int num_frame_bytes = length_distribution(random_engine);
+      for (int j = 0; j < num_frame_bytes; ++j) {
+        encoder(std::byte(byte_distribution(random_engine)), push_bit);
+      }
+
+      encoder(FrameMarker::kEnd, push_bit);
+    }
+
+    bytes_.resize(bits.size() / 8);
+    for (size_t i = 0; i < bytes_.size() * 8; ++i) {
+      if (bits[i]) {
+        bytes_[i / 8] |= std::byte(1 << (i % 8));
+      }
+    }
+  }
+
+  inline void CountFrameByte(const FrameByte& frame_byte) {
+    if (frame_byte.IsMarker() && frame_byte.GetMarker() == FrameMarker::kEnd) {
+      ++num_decoded_frames_;
+    }
+  }
+
+  Implementation implementation_{Implementation::kTable};
+
+  int num_frames_{10};
+
+  std::vector<std::byte> bytes_;
+
+  Decoder decoder_;
+  int64_t num_decoded_frames_{0};
+};
+
+}  // namespace radio_core::benchmark
+
+auto main(int argc, char** argv) -> int {
+  radio_core::benchmark::HDLCDecoderBenchmark app;
+  return app.Run(argc, argv);
+}
@@ -4,6 +4,12 @@
 
 #include "radio_core/protocol/datalink/hdlc/decoder.h"
 
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "radio_core/protocol/datalink/hdlc/encoder.h"
 #include "radio_core/unittest/test.h"
 
 namespace radio_core::protocol::datalink::hdlc {
@@ -139,4 +145,221 @@ TEST(Decoder, BitStuffing) {
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Table-driven processing of multiple bytes.
+
+// Generate bit stream of HDLC encoded frames with random data, mixed with
+// random bits and with streams of ones.
+static auto GenerateBitStream(const int seed) -> std::vector<uint8_t> {
+  std::mt19937 random_engine(seed);
+  std::uniform_int_distribution<int> byte_distribution(0, 255);
+  std::uniform_int_distribution<int> length_distribution(0, 40);
+
+  std::vector<uint8_t> bits;
+  auto push_bit = [&bits](const bool bit) { bits.push_back(bit); };
+
+  Encoder encoder;
+
+  for (int i = 0; i < 100; ++i) {
+    // Random bits in-between of frames. They might contain sequences which
+    // look like frame markers and stuffed bits.
+    const int num_noise_bits = length_distribution(random_engine);
+    for (int j = 0; j < num_noise_bits; ++j) {
+      push_bit(byte_distribution(random_engine) & 1);
+    }
+
+    // Long sequences of ones, with more than 6 of them.
+    if (i % 7 == 0) {
+      for (int j = 0; j < 9; ++j) {
+        push_bit(true);
+      }
+    }
+
+    encoder(FrameMarker::kBegin, push_bit);
+
+    const int num_frame_bytes = length_distribution(random_engine);
+    for (int j = 0; j < num_frame_bytes; ++j) {
+      // Use many ones to cause more bit stuffing.
+      encoder(std::byte(byte_distribution(random_engine) |
+                        byte_distribution(random_engine)),
+              push_bit);
+    }
+
+    encoder(FrameMarker::kEnd, push_bit);
+  }
+
+  return bits;
+}
+
+// Pack bits (stored as 0 and 1 values) into bytes, starting from the least
+// significant bit.
+// The bits which do not form a full byte are ignored.
+static auto PackBits(const std::span<const uint8_t> bits)
+    -> std::vector<std::byte> {
+  std::vector<std::byte> bytes(bits.size() / 8);
+  for (size_t i = 0; i < bytes.size() * 8; ++i) {
+    if (bits[i]) {
+      bytes[i / 8] |= std::byte(1 << (i % 8));
+    }
+  }
+  return bytes;
+}
+
+// Decode bits (stored as 0 and 1 values) one by one, and append the decoded
+// frame bytes to the output.
+static void DecodeBits(Decoder& decoder,
+                       const std::span<const uint8_t> bits,
+                       std::vector<FrameByte>& frame_bytes) {
+  for (const uint8_t bit : bits) {
+    const Result result = decoder(bool(bit));
+    ASSERT_TRUE(result.Ok());
+    for (const FrameByte& frame_byte : result.GetValue()) {
+      frame_bytes.push_back(frame_byte);
+    }
+  }
+}
+
+// Decode bytes using the table-driven decoder, and append the decoded frame
+// bytes to the output.
+static void DecodeBytes(Decoder& decoder,
+                        const std::span<const std::byte> bytes,
+                        std::vector<FrameByte>& frame_bytes) {
+  decoder(bytes, [&frame_bytes](const FrameByte& frame_byte) {
+    frame_bytes.push_back(frame_byte);
+  });
+}
+
+TEST(Decoder, MultipleBytes) {
+  {
+    Decoder decoder;
+
+    std::vector<FrameByte> frame_bytes;
+    DecodeBytes(decoder,
+                std::vector<std::byte>{
+                    Spec::kFrameMarker,
+                    std::byte{0b01011010},
+                    std::byte{0b01111000},
+                    Spec::kFrameMarker,
+                },
+                frame_bytes);
+
+    EXPECT_EQ(frame_bytes,
+              std::vector<FrameByte>({
+                  FrameByte(FrameMarker::kBegin),
+                  FrameByte(std::byte{0b01011010}),
+                  FrameByte(std::byte{0b01111000}),
+                  FrameByte(FrameMarker::kEnd),
+              }));
+  }
+
+  // Bit stuffing: every data byte has five ones in a row, so every byte is
+  // encoded using 9 bits.
+  {
+    std::vector<uint8_t> bits;
+    auto push_bit = [&bits](const bool bit) { bits.push_back(bit); };
+
+    Encoder encoder;
+    encoder(FrameMarker::kBegin, push_bit);
+    for (int i = 0; i < 8; ++i) {
+      encoder(std::byte{0b00011111}, push_bit);
+    }
+    encoder(FrameMarker::kEnd, push_bit);
+
+    ASSERT_EQ(bits.size(), 8 + 8 * 9 + 8);
+
+    Decoder decoder;
+
+    std::vector<FrameByte> frame_bytes;
+    DecodeBytes(decoder, PackBits(bits), frame_bytes);
+
+    std::vector<FrameByte> expected_frame_bytes;
+    expected_frame_bytes.push_back(FrameByte(FrameMarker::kBegin));
+    for (int i = 0; i < 8; ++i) {
+      expected_frame_bytes.push_back(FrameByte(std::byte{0b00011111}));
+    }
+    expected_frame_bytes.push_back(FrameByte(FrameMarker::kEnd));
+
+    EXPECT_EQ(frame_bytes, expected_frame_bytes);
+  }
+}
+
+TEST(Decoder, MultipleBytesMatchesBits) {
+  for (int seed = 0; seed < 10; ++seed) {
+    const std::vector<uint8_t> bits = GenerateBitStream(seed);
+    const std::vector<std::byte> bytes = PackBits(bits);
+
+    std::vector<FrameByte> expected_frame_bytes;
+    {
+      Decoder decoder;
+      DecodeBits(decoder,
+                 std::span<const uint8_t>(bits).subspan(0, bytes.size() * 8),
+                 expected_frame_bytes);
+    }
+    EXPECT_FALSE(expected_frame_bytes.empty());
+
+    // Decode all bytes at once.
+    {
+      Decoder decoder;
+      std::vector<FrameByte> frame_bytes;
+      DecodeBytes(decoder, bytes, frame_bytes);
+      EXPECT_EQ(frame_bytes, expected_frame_bytes);
+    }
+
+    // Decode bytes in chunks of different sizes.
+    {
+      Decoder decoder;
+      std::vector<FrameByte> frame_bytes;
+      size_t chunk_size = 1;
+      for (size_t i = 0; i < bytes.size(); i += chunk_size, ++chunk_size) {
+        DecodeBytes(
+            decoder,
+            std::span(bytes).subspan(i, std::min(chunk_size, bytes.size() - i)),
+            frame_bytes);
+      }
+      EXPECT_EQ(frame_bytes, expected_frame_bytes);
+    }
+
+    // Decode bytes one by one.
+    {
+      Decoder decoder;
+      std::vector<FrameByte> frame_bytes;
+      for (const std::byte byte : bytes) {
+        const Result result = decoder(byte);
+        ASSERT_TRUE(result.Ok());
+        for (const FrameByte& frame_byte : result.GetValue()) {
+          frame_bytes.push_back(frame_byte);
+        }
+      }
+      EXPECT_EQ(frame_bytes, expected_frame_bytes);
+    }
+  }
+}
+
+// Mix per-bit and table-driven processing on the same decoder.
+TEST(Decoder, MultipleBytesAfterBits) {
+  const std::vector<uint8_t> bits = GenerateBitStream(0);
+
+  for (size_t num_bits = 0; num_bits < 500; num_bits += 7) {
+    std::vector<FrameByte> expected_frame_bytes;
+    {
+      Decoder decoder;
+      DecodeBits(decoder, bits, expected_frame_bytes);
+    }
+
+    const std::span<const uint8_t> tail_bits =
+        std::span<const uint8_t>(bits).subspan(num_bits);
+    const std::vector<std::byte> tail_bytes = PackBits(tail_bits);
+
+    Decoder decoder;
+    std::vector<FrameByte> frame_bytes;
+    DecodeBits(decoder,
+               std::span<const uint8_t>(bits).subspan(0, num_bits),
+               frame_bytes);
+    DecodeBytes(decoder, tail_bytes, frame_bytes);
+    DecodeBits(decoder, tail_bits.subspan(tail_bytes.size() * 8), frame_bytes);
+
+    EXPECT_EQ(frame_bytes, expected_frame_bytes) << "num_bits=" << num_bits;
+  }
+}
+
 }  // namespace radio_core::protocol::datalink::hdlc
@@ -10,14 +10,21 @@
 // The input of the decoder is IF samples in an amplitude domain, and the output
 // is decoded AX.25 messages in either Result form or passed to a given
 // callback.
+//
+// The samples can be processed one at a time, or as a block. The block
+// processing runs the demodulator stages over the whole block using the
+// vectorized kernels, and only the demodulated bits go through the bit-level
+// stages one by one.
 
 #pragma once
 
+#include <functional>
+#include <span>
+
 #include "radio_core/modulation/digital/fsk/demodulator.h"
 #include "radio_core/modulation/digital/fsk/tones.h"
-#include "radio_core/protocol/binary/nrzs/decoder.h"
 #include "radio_core/protocol/datalink/ax25/decoder.h"
-#include "radio_core/protocol/datalink/hdlc/decoder.h"
+#include "radio_core/protocol/packet/aprs/internal/frame_decoder.h"
 
 namespace radio_core::protocol::packet::aprs {
 
@@ -33,10 +40,15 @@ class Decoder {
 
     // Baud rate: symbols per second in the data stream.
     int data_baud{0};
+
+    // Repair of frames which did not pass the FCS check.
+    // The repair is disabled by default.
+    protocol::datalink::ax25::FrameRepairOptions repair;
   };
 
   using Error = protocol::datalink::ax25::Decoder::Error;
   using Result = protocol::datalink::ax25::Decoder::Result;
+  using Message = protocol::datalink::ax25::Message;
 
   Decoder() = default;
   explicit Decoder(const Options& options) { Configure(options); }
@@ -47,53 +59,61 @@ class Decoder {
     fsk_options.sample_rate = options.sample_rate;
     fsk_options.data_baud = options.data_baud;
     fsk_demodulator_.Configure(fsk_options);
+
+    frame_decoder_.ConfigureRepair(options.repair);
   }
 
   // Process sample of input signal.
   //
   // The result follows semantic of the AX.25 decoder.
   auto operator()(const RealType sample) -> Result {
-    Result result(Error::kUnavailable);
-
     const typename FSKDemodulator::Result fsk_result = fsk_demodulator_(sample);
     if (!fsk_result.Ok()) {
-      return result;
-    }
-
-    const bool demodulated_bit = fsk_result.GetValue();
-    const bool decoded_bit = nrzs_decoder_(demodulated_bit);
-
-    const HDLCDecoder::Result hdlc_result = hdlc_decoder_(decoded_bit);
-    if (!hdlc_result.Ok()) {
-      return result;
+      return Result(Error::kUnavailable);
     }
 
-    // Process all possible frame markers and data bits.
-    for (const auto& frame_byte : hdlc_result.GetValue()) {
-      const AX25Decoder::Result ax25_result = ax25_decoder_(frame_byte);
-      if (ax25_result.Ok()) {
-        // Processing happens on a per-bit level, so it is not expected to have
-        // multiple messages decoded.
-        assert(!result.Ok());
+    return frame_decoder_(fsk_result.GetValue());
+  }
 
-        result = ax25_result;
+  // Process multiple samples of input signal, and invoke the callback with
+  // every decoded message.
+  //
+  // The given list of args... is passed to the callback first. This makes the
+  // required callback signature to be:
+  //
+  //   callback(<optional arguments>, const Message& message)
+  //
+  // The message is owned by the decoder and is only valid for the duration of
+  // the callback.
+  template <class F, class... Args>
+  void operator()(const std::span<const RealType> samples,
+                  F&& callback,
+                  Args&&... args) {
+    fsk_demodulator_(samples, [&](const bool demodulated_bit) {
+      const Result result = frame_decoder_(demodulated_bit);
+      if (result.Ok()) {
+        const Message& message = result.GetValue();
+        std::invoke(callback, args..., message);
       }
-    }
+    });
+  }
 
-    return result;
+  // Check whether the last decoded message did not pass the FCS check and has
+  // been repaired.
+  //
+  // Is only valid right after the processing of a sample returned a decoded
+  // message, or from within the callback of the processing of multiple
+  // samples.
+  inline auto IsFrameRepaired() const -> bool {
+    return frame_decoder_.IsFrameRepaired();
   }
 
  private:
   using FSKDemodulator =
       modulation::digital::fsk::Demodulator<RealType, Allocator>;
-  using NRZSDecoder = protocol::binary::nrzs::Decoder;
-  using HDLCDecoder = protocol::datalink::hdlc::Decoder;
-  using AX25Decoder = protocol::datalink::ax25::Decoder;
 
   FSKDemodulator fsk_demodulator_;
-  NRZSDecoder nrzs_decoder_;
-  HDLCDecoder hdlc_decoder_;
-  AX25Decoder ax25_decoder_;
+  internal::FrameDecoder frame_decoder_;
 };
 
 }  // namespace radio_core::protocol::packet::aprs
@@ -0,0 +1,411 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Decoder of APRS transmissions which runs multiple differently configured
+// demodulators on the same input signal.
+//
+// A weak or distorted transmission which fails to be decoded by one demodulator
+// configuration could often be decoded by a slightly different one: a different
+// hysteresis threshold, PLL inertia, symbol filter roll-off, or a different
+// gain of the space symbol which compensates for the emphasis. This decoder
+// runs all the configured variants, and reports every decoded frame once.
+//
+// The variants share the work where possible:
+//
+//   - All variants use the same pre-filter, so the input signal is pre-filtered
+//     only once.
+//
+//   - The variants which use the same symbol demodulator configuration share
+//     the mark and space symbol amplitudes, and only run their own bit
+//     decision, clock recovery and de-framing.
+//
+// Decoded frames are de-duplicated using their frame check sequence: a frame
+// with the same FCS decoded by another variant within a short interval is
+// considered to be the same frame. Only frames which passed the FCS check are
+// reported, so the FCS is a reliable identifier of the frame contents.
+//
+// When the repair is enabled a repaired frame is held back until the end of
+// the de-duplication interval: if another variant decodes the same frame
+// without a repair within the interval, the frame is reported as unrepaired.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "radio_core/base/verify.h"
+#include "radio_core/modulation/digital/fsk/demodulator.h"
+#include "radio_core/modulation/digital/fsk/tones.h"
+#include "radio_core/protocol/datalink/ax25/decoder.h"
+#include "radio_core/protocol/packet/aprs/internal/frame_decoder.h"
+
+namespace radio_core::protocol::packet::aprs {
+
+template <class RealType, template <class> class Allocator = std::allocator>
+class DiversityDecoder {
+  using FSKDemodulator =
+      modulation::digital::fsk::Demodulator<RealType, Allocator>;
+
+ public:
+  struct Options {
+    // Tones of modulated mark and space symbols.
+    modulation::digital::fsk::Tones tones{0, 0};
+
+    // Sample rate of the incoming samples (samples per second).
+    RealType sample_rate{0};
+
+    // Baud rate: symbols per second in the data stream.
+    int data_baud{0};
+
+    // Configuration of the pre-filter shared by all variants.
+    // Follows the semantic of the FSK demodulator options.
+    RealType prefilter_transition_bandwidth{70};
+    RealType prefilter_frequency_extent{190};
+
+    // Interval in seconds within which frames with the same FCS are considered
+    // to be the same frame decoded by different variants.
+    //
+    // The variants report the same frame with a delay of a few bits from each
+    // other. The interval is to be shorter than the shortest frame, so that a
+    // re-transmission of the same frame is not discarded.
+    RealType deduplication_interval{0.05};
+
+    // Repair of frames which did not pass the FCS check.
+    // The repair is disabled by default.
+    protocol::datalink::ax25::FrameRepairOptions repair;
+  };
+
+  // Configuration of a demodulator variant.
+  //
+  // The tones, sample rate, baud rate and the pre-filter configuration of the
+  // variant are ignored, they are taken from the decoder options.
+  using VariantOptions = typename FSKDemodulator::Options;
+
+  using Message = protocol::datalink::ax25::Message;
+
+  DiversityDecoder() = default;
+
+  DiversityDecoder(const Options& options,
+                   const std::span<const VariantOptions> variants) {
+    Configure(options, variants);
+  }
+
+  void Configure(const Options& options,
+                 const std::span<const VariantOptions> variants) {
+    Verify(!variants.empty(), "At least one decoder variant is required");
+
+    variants_.clear();
+    variants_.resize(variants.size());
+
+    symbol_demodulators_.clear();
+
+    for (size_t i = 0; i < variants.size(); ++i) {
+      VariantOptions fsk_options = variants[i];
+      fsk_options.tones = options.tones;
+      fsk_options.sample_rate = options.sample_rate;
+      fsk_options.data_baud = options.data_baud;
+      fsk_options.prefilter_transition_bandwidth =
+          options.prefilter_transition_bandwidth;
+      fsk_options.prefilter_frequency_extent =
+          options.prefilter_frequency_extent;
+
+      Variant& variant = variants_[i];
+      variant.fsk_demodulator.Configure(fsk_options);
+      variant.frame_decoder.ConfigureRepair(options.repair);
+
+      // Find an earlier variant with the same symbol demodulator
+      // configuration. If there is none, the symbol amplitudes are calculated
+      // by the demodulator of this variant.
+      variant.symbol_demodulator_index = symbol_demodulators_.size();
+      for (size_t j = 0; j < i; ++j) {
+        if (HaveSameSymbolDemodulators(variants[i], variants[j])) {
+          variant.symbol_demodulator_index =
+              variants_[j].symbol_demodulator_index;
+          break;
+        }
+      }
+      if (variant.symbol_demodulator_index == symbol_demodulators_.size()) {
+        symbol_demodulators_.push_back(i);
+      }
+    }
+
+    prefiltered_buffer_.resize(kBlockSize);
+    mark_buffer_.resize(kBlockSize * symbol_demodulators_.size());
+    space_buffer_.resize(kBlockSize * symbol_demodulators_.size());
+
+    deduplication_interval_ =
+        uint64_t(options.deduplication_interval * options.sample_rate);
+
+    sample_index_ = 0;
+    recent_frames_.fill(RecentFrame());
+    recent_frame_index_ = 0;
+    num_held_frames_ = 0;
+  }
+
+  // Get the number of configured variants.
+  inline auto GetNumVariants() const -> size_t { return variants_.size(); }
+
+  // Get the number of distinct symbol demodulator configurations among the
+  // variants. The symbol amplitudes are calculated this many times for every
+  // input sample.
+  inline auto GetNumSymbolDemodulators() const -> size_t {
+    return symbol_demodulators_.size();
+  }
+
+  // Process multiple samples of input signal, and invoke the callback with
+  // every decoded message.
+  //
+  // The given list of args... is passed to the callback first. This makes the
+  // required callback signature to be:
+  //
+  //   callback(<optional arguments>,
+  //            const Message& message,
+  //            size_t variant_index)
+  //
+  // The variant index is the index of the variant in the span passed to the
+  // Configure() which decoded the reported message.
+  //
+  // The message is owned by the decoder and is only valid for the duration of
+  // the callback.
+  template <class F, class... Args>
+  void operator()(const std::span<const RealType> samples,
+                  F&& callback,
+                  Args&&... args) {
+    const size_t num_samples = samples.size();
+
+    for (size_t offset = 0; offset < num_samples; offset += kBlockSize) {
+      const size_t block_size = std::min(kBlockSize, num_samples - offset);
+
+      // The pre-filter is the same for all variants, so the one from the first
+      // variant is used.
+      const std::span<const RealType> prefiltered_samples =
+          variants_[0].fsk_demodulator.Prefilter(
+              samples.subspan(offset, block_size),
+              std::span(prefiltered_buffer_).subspan(0, block_size));
+
+      for (size_t i = 0; i < symbol_demodulators_.size(); ++i) {
+        Variant& variant = variants_[symbol_demodulators_[i]];
+        variant.fsk_demodulator.DemodulateSymbols(
+            prefiltered_samples,
+            std::span(mark_buffer_).subspan(i * kBlockSize, block_size),
+            std::span(space_buffer_).subspan(i * kBlockSize, block_size));
+      }
+
+      for (size_t j = 0; j < block_size; ++j) {
+        for (size_t i = 0; i < variants_.size(); ++i) {
+          Variant& variant = variants_[i];
+
+          const size_t amplitude_index =
+              variant.symbol_demodulator_index * kBlockSize + j;
+
+          const typename FSKDemodulator::Result fsk_result =
+              variant.fsk_demodulator.SliceSymbol(
+                  mark_buffer_[amplitude_index],
+                  space_buffer_[amplitude_index]);
+          if (!fsk_result.Ok()) {
+            continue;
+          }
+
+          const internal::FrameDecoder::Result result =
+              variant.frame_decoder(fsk_result.GetValue());
+          if (!result.Ok()) {
+            continue;
+          }
+
+          HandleDecodedFrame(result.GetValue(),
+                             variant.frame_decoder.GetFrameFCS(),
+                             variant.frame_decoder.IsFrameRepaired(),
+                             i,
+                             callback,
+                             args...);
+        }
+
+        ++sample_index_;
+
+        if (num_held_frames_ != 0) {
+          ReportExpiredHeldFrames(callback, args...);
+        }
+      }
+    }
+  }
+
+  // Check whether the reported message has been repaired: none of the variants
+  // decoded the frame without a repair within the de-duplication interval.
+  //
+  // Is only valid from within the callback.
+  inline auto IsFrameRepaired() const -> bool {
+    return is_reported_frame_repaired_;
+  }
+
+  // Report all the repaired frames which are held back waiting for an
+  // unrepaired copy from another variant.
+  //
+  // Is to be called at the end of the input signal, so that the repaired
+  // frames decoded at its very end are not lost. Follows the same callback
+  // semantic as the processing of samples.
+  template <class F, class... Args>
+  void Flush(F&& callback, Args&&... args) {
+    for (RecentFrame& frame : recent_frames_) {
+      if (frame.is_held) {
+        ReportHeldFrame(frame, callback, args...);
+      }
+    }
+  }
+
+ private:
+  // The maximum number of samples processed by the block stages at once.
+  static constexpr size_t kBlockSize = 4096;
+
+  // The maximum number of recently decoded frames which are remembered for the
+  // de-duplication. Only frames decoded within the de-duplication interval are
+  // to be remembered, so only a few of them are needed.
+  static constexpr size_t kMaxNumRecentFrames = 8;
+
+  struct Variant {
+    FSKDemodulator fsk_demodulator;
+    internal::FrameDecoder frame_decoder;
+
+    // Index of the symbol demodulator which calculates amplitudes of the mark
+    // and space symbols for this variant.
+    size_t symbol_demodulator_index{0};
+  };
+
+  struct RecentFrame {
+    // FCS of the frame.
+    uint16_t fcs{0};
+
+    // Index of the input sample at which the frame has been decoded.
+    // The value of 0 denotes an unused entry.
+    uint64_t sample_index{0};
+
+    // True if the frame has been repaired and is not reported yet.
+    // The message and the variant index are only valid for the held frames.
+    bool is_held{false};
+    Message message;
+    size_t variant_index{0};
+  };
+
+  // Check whether the symbol demodulators of the two variants are configured
+  // the same way.
+  static auto HaveSameSymbolDemodulators(const VariantOptions& a,
+                                         const VariantOptions& b) -> bool {
+    return a.symbol_rrc_filter_transition_bandwidth_ ==
+               b.symbol_rrc_filter_transition_bandwidth_ &&
+           a.symbol_rrc_beta == b.symbol_rrc_beta &&
+           a.symbol_agc_charge_rate == b.symbol_agc_charge_rate &&
+           a.symbol_agc_discharge_rate == b.symbol_agc_discharge_rate;
+  }
+
+  // De-duplicate the frame decoded by the given variant.
+  //
+  // A frame which has not been decoded recently is remembered, and is either
+  // reported right away or, if it has been repaired, is held back. An
+  // unrepaired copy of a held frame is reported instead of it.
+  template <class F, class... Args>
+  void HandleDecodedFrame(const Message& message,
+                          const uint16_t fcs,
+                          const bool is_repaired,
+                          const size_t variant_index,
+                          F& callback,
+                          Args&... args) {
+    // Offset the sample index by one so that 0 denotes an unused entry.
+    const uint64_t sample_index = sample_index_ + 1;
+
+    for (RecentFrame& frame : recent_frames_) {
+      if (frame.sample_index != 0 && frame.fcs == fcs &&
+          sample_index - frame.sample_index <= deduplication_interval_) {
+        if (frame.is_held && !is_repaired) {
+          frame.is_held = false;
+          --num_held_frames_;
+          ReportFrame(message, false, variant_index, callback, args...);
+        }
+        return;
+      }
+    }
+
+    // Report the frame which is being evicted, so that it is not lost when
+    // many frames are decoded within the de-duplication interval.
+    RecentFrame& frame = recent_frames_[recent_frame_index_];
+    if (frame.is_held) {
+      ReportHeldFrame(frame, callback, args...);
+    }
+
+    recent_frame_index_ = (recent_frame_index_ + 1) % kMaxNumRecentFrames;
+
+    frame.fcs = fcs;
+    frame.sample_index = sample_index;
+
+    if (is_repaired) {
+      frame.is_held = true;
+      frame.message = message;
+      frame.variant_index = variant_index;
+      ++num_held_frames_;
+      return;
+    }
+
+    ReportFrame(message, false, variant_index, callback, args...);
+  }
+
+  // Report the held frames whose de-duplication interval has passed.
+  template <class F, class... Args>
+  void ReportExpiredHeldFrames(F& callback, Args&... args) {
+    const uint64_t sample_index = sample_index_ + 1;
+
+    for (RecentFrame& frame : recent_frames_) {
+      if (frame.is_held &&
+          sample_index - frame.sample_index > deduplication_interval_) {
+        ReportHeldFrame(frame, callback, args...);
+      }
+    }
+  }
+
+  template <class F, class... Args>
+  void ReportHeldFrame(RecentFrame& frame, F& callback, Args&... args) {
+    assert(frame.is_held);
+
+    frame.is_held = false;
+    --num_held_frames_;
+    ReportFrame(frame.message, true, frame.variant_index, callback, args...);
+  }
+
+  template <class F, class... Args>
+  void ReportFrame(const Message& message,
+                   const bool is_repaired,
+                   const size_t variant_index,
+                   F& callback,
+                   Args&... args) {
+    is_reported_frame_repaired_ = is_repaired;
+    std::invoke(callback, args..., message, variant_index);
+  }
+
+  std::vector<Variant, Allocator<Variant>> variants_;
+
+  // Indices of variants whose demodulators calculate the symbol amplitudes.
+  std::vector<size_t, Allocator<size_t>> symbol_demodulators_;
+
+  // Buffers for the intermediate results of the block processing.
+  //
+  // The mark and space buffers store kBlockSize amplitudes for every symbol
+  // demodulator.
+  std::vector<RealType, Allocator<RealType>> prefiltered_buffer_;
+  std::vector<RealType, Allocator<RealType>> mark_buffer_;
+  std::vector<RealType, Allocator<RealType>> space_buffer_;
+
+  // State of the de-duplication.
+  uint64_t deduplication_interval_{0};
+  uint64_t sample_index_{0};
+  std::array<RecentFrame, kMaxNumRecentFrames> recent_frames_;
+  size_t recent_frame_index_{0};
+  size_t num_held_frames_{0};
+
+  // Whether the frame which is being reported to the callback is repaired.
+  bool is_reported_frame_repaired_{false};
+};
+
+}  // namespace radio_core::protocol::packet::aprs
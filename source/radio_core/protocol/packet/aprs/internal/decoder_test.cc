@@ -30,6 +30,15 @@ using Path = std::filesystem::path;
 // samples to it.
 class BaseAX25Test : public ::testing::Test {
  protected:
+  // The way the samples are passed to the decoder.
+  enum class Processing {
+    // Samples are passed to the decoder one by one.
+    kPerSample,
+
+    // Samples are passed to the decoder in blocks.
+    kBlock,
+  };
+
   // Get path to a file from the data folder of this test suit.
   static auto GetDataFilepath(const Path& filename) -> Path {
     return testing::TestFileAbsolutePath(Path("aprs") / filename);
@@ -44,7 +53,9 @@ class BaseAX25Test : public ::testing::Test {
   //
   // Returns an ordered collection of all decoded messages.
   auto DecodeAllMessagesFromFile(
-      const Decoder<float>::Options& options_template, const Path& filename)
+      const Decoder<float>::Options& options_template,
+      const Path& filename,
+      const Processing processing = Processing::kPerSample)
       -> std::vector<Message> {
     using tiny_lib::io_file::File;
     using WAVReader = tiny_lib::audio_wav_reader::Reader<File>;
@@ -65,16 +76,39 @@ class BaseAX25Test : public ::testing::Test {
 
     std::vector<Message> messages;
 
+    if (processing == Processing::kPerSample) {
+      const bool read_result = wav_reader.ReadAllSamples<float, 2>(
+          [&messages, &decoder](const std::span<float> sample) {
+            const Decoder<float>::Result result = decoder(sample[0]);
+            if (result.Ok()) {
+              const Message& message = result.GetValue();
+              messages.push_back(message);
+            }
+          });
+      EXPECT_TRUE(read_result);
+
+      return messages;
+    }
+
+    // Use block size which is not a multiple of the internal block size of
+    // the decoder to cover the remainder handling.
+    constexpr size_t kBlockSize = 1500;
+
+    std::vector<float> samples;
     const bool read_result = wav_reader.ReadAllSamples<float, 2>(
-        [&messages, &decoder](const std::span<float> sample) {
-          const Decoder<float>::Result result = decoder(sample[0]);
-          if (result.Ok()) {
-            const Message& message = result.GetValue();
-            messages.push_back(message);
-          }
+        [&samples](const std::span<float> sample) {
+          samples.push_back(sample[0]);
         });
     EXPECT_TRUE(read_result);
 
+    for (size_t i = 0; i < samples.size(); i += kBlockSize) {
+      decoder(std::span<const float>(samples).subspan(
+                  i, std::min(kBlockSize, samples.size() - i)),
+              [&messages](const Message& message) {
+                messages.push_back(message);
+              });
+    }
+
     return messages;
   }
 };
@@ -82,13 +116,17 @@ class BaseAX25Test : public ::testing::Test {
 // Base class for APRS protocol which uses Bell 202 tone and 1200 baud.
 class BaseAX25Bell202Tone1200bdTest : public BaseAX25Test {
  protected:
-  auto DecodeAllMessagesFromFile(const Path& filename) -> std::vector<Message> {
+  auto DecodeAllMessagesFromFile(
+      const Path& filename,
+      const Processing processing = Processing::kPerSample)
+      -> std::vector<Message> {
     Decoder<float>::Options options;
     options.tones = modulation::digital::fsk::kBell202Tones;
     options.sample_rate = 0;
     options.data_baud = 1200;
 
-    return BaseAX25Test::DecodeAllMessagesFromFile(options, filename);
+    return BaseAX25Test::DecodeAllMessagesFromFile(
+        options, filename, processing);
   }
 };
 
@@ -247,6 +285,42 @@ TEST_F(AX25Bell202Tone1200bdTest, Supervisory) {
   EXPECT_EQ(message->pid, 0);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Block processing.
+//
+// The block processing is expected to decode the same messages as the
+// per-sample processing.
+
+class AX25Bell202Tone1200bdBlockTest : public BaseAX25Bell202Tone1200bdTest {
+ protected:
+  void Run(const Path& filename) {
+    const std::vector<Message> messages =
+        DecodeAllMessagesFromFile(filename, Processing::kPerSample);
+    const std::vector<Message> block_messages =
+        DecodeAllMessagesFromFile(filename, Processing::kBlock);
+
+    EXPECT_FALSE(messages.empty());
+    ASSERT_EQ(block_messages.size(), messages.size());
+
+    for (size_t i = 0; i < messages.size(); ++i) {
+      EXPECT_EQ(block_messages[i].address.source, messages[i].address.source);
+      EXPECT_EQ(block_messages[i].address.destination,
+                messages[i].address.destination);
+      EXPECT_EQ(block_messages[i].information.GetCleanView(),
+                messages[i].information.GetCleanView());
+    }
+  }
+};
+
+TEST_F(AX25Bell202Tone1200bdBlockTest, Lorem) {
+  Run("ax25_bell202_1200bd_lorem_11025.wav");
+  Run("ax25_bell202_1200bd_lorem_44100.wav");
+}
+
+TEST_F(AX25Bell202Tone1200bdBlockTest, DireWolf) {
+  Run("ax25_bell202_1200bd_dw_11025.wav");
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // TNC Test CD.
 
@@ -0,0 +1,231 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/protocol/packet/aprs/diversity_decoder.h"
+
+#include <filesystem>
+#include <set>
+#include <span>
+#include <vector>
+
+#include "gflags/gflags.h"
+#include "tl_audio_wav/tl_audio_wav_reader.h"
+#include "tl_io/tl_io_file.h"
+
+#include "radio_core/base/convert.h"
+#include "radio_core/modulation/digital/fsk/tones_bell.h"
+#include "radio_core/protocol/packet/aprs/decoder.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::protocol::packet::aprs {
+
+using datalink::ax25::Address;
+using datalink::ax25::Message;
+using Path = std::filesystem::path;
+
+using VariantOptions = DiversityDecoder<float>::VariantOptions;
+
+// Message decoded by the diversity decoder.
+struct DecodedMessage {
+  Message message;
+  bool is_repaired;
+  size_t variant_index;
+};
+
+// Read samples of the first channel of the given file from the data folder of
+// the APRS tests.
+static auto ReadSamples(const Path& filename, float& sample_rate)
+    -> std::vector<float> {
+  using tiny_lib::io_file::File;
+  using WAVReader = tiny_lib::audio_wav_reader::Reader<File>;
+
+  File file;
+  EXPECT_TRUE(file.Open(testing::TestFileAbsolutePath(Path("aprs") / filename),
+                        File::kRead));
+
+  WAVReader wav_reader;
+  EXPECT_TRUE(wav_reader.Open(file));
+
+  sample_rate = float(wav_reader.GetFormatSpec().sample_rate);
+
+  std::vector<float> samples;
+  const bool read_result = wav_reader.ReadAllSamples<float, 2>(
+      [&samples](const std::span<float> sample) {
+        samples.push_back(sample[0]);
+      });
+  EXPECT_TRUE(read_result);
+
+  return samples;
+}
+
+// Decode all messages from the given file using the diversity decoder with the
+// given variants, using Bell 202 tones and 1200 baud.
+static auto DecodeAllMessagesFromFile(
+    const Path& filename, const std::span<const VariantOptions> variants)
+    -> std::vector<DecodedMessage> {
+  float sample_rate;
+  const std::vector<float> samples = ReadSamples(filename, sample_rate);
+
+  DiversityDecoder<float>::Options options;
+  options.tones = modulation::digital::fsk::kBell202Tones;
+  options.sample_rate = sample_rate;
+  options.data_baud = 1200;
+
+  DiversityDecoder<float> decoder(options, variants);
+
+  std::vector<DecodedMessage> messages;
+
+  // Use block size which is not a multiple of the internal block size of the
+  // decoder to cover the remainder handling.
+  constexpr size_t kBlockSize = 1500;
+
+  auto add_message = [&messages, &decoder](const Message& message,
+                                           const size_t variant_index) {
+    messages.push_back({message, decoder.IsFrameRepaired(), variant_index});
+  };
+
+  for (size_t i = 0; i < samples.size(); i += kBlockSize) {
+    decoder(std::span<const float>(samples).subspan(
+                i, std::min(kBlockSize, samples.size() - i)),
+            add_message);
+  }
+  decoder.Flush(add_message);
+
+  return messages;
+}
+
+// Decode all messages from the given file using the regular decoder configured
+// the same way as the given variant.
+static auto DecodeAllMessagesFromFile(const Path& filename,
+                                      const VariantOptions& variant)
+    -> std::vector<Message> {
+  float sample_rate;
+  const std::vector<float> samples = ReadSamples(filename, sample_rate);
+
+  // The regular decoder does not expose all the demodulator options, so use
+  // a diversity decoder with a single variant.
+  std::vector<Message> messages;
+  for (const DecodedMessage& decoded_message :
+       DecodeAllMessagesFromFile(filename, {{variant}})) {
+    messages.push_back(decoded_message.message);
+  }
+
+  return messages;
+}
+
+// Get index of the message generated by the `gen_packets` tool from DireWolf.
+static auto GetDireWolfMessageIndex(const Message& message) -> int {
+  const std::string_view info = message.information.GetCleanView();
+  const std::string_view info_suffix = info.substr(info.size() - 12);
+  const std::string_view index_str = info_suffix.substr(0, 4);
+
+  return StringToInt<int>(index_str);
+}
+
+// Variants with the default demodulator configuration and a different bit
+// decision and clock recovery, sharing the symbol demodulators.
+static auto GetSlicerVariants() -> std::vector<VariantOptions> {
+  std::vector<VariantOptions> variants(4);
+
+  variants[1].space_gain = 0.7f;
+  variants[2].space_gain = 1.4f;
+  variants[3].pll_inertia = 0.6f;
+
+  return variants;
+}
+
+TEST(DiversityDecoder, SingleVariantMatchesDecoder) {
+  const Path filename = "ax25_bell202_1200bd_dw_11025.wav";
+
+  float sample_rate;
+  const std::vector<float> samples = ReadSamples(filename, sample_rate);
+
+  Decoder<float> decoder({
+      .tones = modulation::digital::fsk::kBell202Tones,
+      .sample_rate = sample_rate,
+      .data_baud = 1200,
+  });
+
+  std::vector<Message> expected_messages;
+  decoder(std::span<const float>(samples),
+          [&expected_messages](const Message& message) {
+            expected_messages.push_back(message);
+          });
+
+  const std::vector<Message> messages =
+      DecodeAllMessagesFromFile(filename, VariantOptions());
+
+  EXPECT_FALSE(expected_messages.empty());
+  ASSERT_EQ(messages.size(), expected_messages.size());
+
+  for (size_t i = 0; i < messages.size(); ++i) {
+    EXPECT_EQ(messages[i].information.GetCleanView(),
+              expected_messages[i].information.GetCleanView());
+  }
+}
+
+TEST(DiversityDecoder, SharedSymbolDemodulators) {
+  DiversityDecoder<float>::Options options;
+  options.tones = modulation::digital::fsk::kBell202Tones;
+  options.sample_rate = 11025;
+  options.data_baud = 1200;
+
+  std::vector<VariantOptions> variants = GetSlicerVariants();
+  variants.push_back(VariantOptions());
+  variants.back().symbol_rrc_beta = 0.3f;
+
+  const DiversityDecoder<float> decoder(options, variants);
+
+  EXPECT_EQ(decoder.GetNumVariants(), 5);
+  EXPECT_EQ(decoder.GetNumSymbolDemodulators(), 2);
+}
+
+TEST(DiversityDecoder, Deduplicate) {
+  const std::vector<VariantOptions> variants = GetSlicerVariants();
+
+  const std::vector<DecodedMessage> messages = DecodeAllMessagesFromFile(
+      "ax25_bell202_1200bd_lorem_11025.wav", variants);
+
+  ASSERT_EQ(messages.size(), 1);
+
+  EXPECT_EQ(messages[0].message.address.source, Address("SRC"));
+  EXPECT_EQ(messages[0].message.address.destination, Address("DST"));
+  EXPECT_FALSE(messages[0].is_repaired);
+  EXPECT_LT(messages[0].variant_index, variants.size());
+}
+
+TEST(DiversityDecoder, DecodesMoreThanSingleVariant) {
+  const Path filename = "ax25_bell202_1200bd_dw_11025.wav";
+
+  std::vector<VariantOptions> variants = GetSlicerVariants();
+  variants.push_back(VariantOptions());
+  variants.back().symbol_rrc_beta = 0.3f;
+
+  std::set<int> single_variant_indices;
+  for (const Message& message :
+       DecodeAllMessagesFromFile(filename, variants[0])) {
+    single_variant_indices.insert(GetDireWolfMessageIndex(message));
+  }
+
+  std::set<int> indices;
+  for (const DecodedMessage& decoded_message :
+       DecodeAllMessagesFromFile(filename, variants)) {
+    EXPECT_LT(decoded_message.variant_index, variants.size());
+
+    const int index = GetDireWolfMessageIndex(decoded_message.message);
+    EXPECT_FALSE(indices.contains(index))
+        << "Message with index " << index << " is reported multiple times";
+    indices.insert(index);
+  }
+
+  // All the messages decoded by the default configuration are to be decoded
+  // by the diversity decoder, plus some more.
+  for (const int index : single_variant_indices) {
+    EXPECT_TRUE(indices.contains(index))
+        << "Did not decode message with index " << index;
+  }
+  EXPECT_GT(indices.size(), single_variant_indices.size());
+}
+
+}  // namespace radio_core::protocol::packet::aprs
@@ -0,0 +1,86 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Decoder of AX.25 frames from the bits demodulated from APRS transmission.
+//
+// Performs the NRZS decoding, HDLC de-framing and AX.25 decoding of the bits
+// which are coming from the FSK demodulator.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#include "radio_core/protocol/binary/nrzs/decoder.h"
+#include "radio_core/protocol/datalink/ax25/decoder.h"
+#include "radio_core/protocol/datalink/hdlc/decoder.h"
+
+namespace radio_core::protocol::packet::aprs::internal {
+
+class FrameDecoder {
+ public:
+  using Error = protocol::datalink::ax25::Decoder::Error;
+  using Result = protocol::datalink::ax25::Decoder::Result;
+  using RepairOptions = protocol::datalink::ax25::FrameRepairOptions;
+
+  // Configure repair of frames which did not pass the FCS check.
+  void ConfigureRepair(const RepairOptions& repair_options) {
+    ax25_decoder_.Configure({.repair = repair_options});
+  }
+
+  // Process bit demodulated from the input signal.
+  //
+  // The result follows semantic of the AX.25 decoder.
+  auto operator()(const bool demodulated_bit) -> Result {
+    Result result(Error::kUnavailable);
+
+    const bool decoded_bit = nrzs_decoder_(demodulated_bit);
+
+    const HDLCDecoder::Result hdlc_result = hdlc_decoder_(decoded_bit);
+    if (!hdlc_result.Ok()) {
+      return result;
+    }
+
+    // Process all possible frame markers and data bits.
+    for (const auto& frame_byte : hdlc_result.GetValue()) {
+      const AX25Decoder::Result ax25_result = ax25_decoder_(frame_byte);
+      if (ax25_result.Ok()) {
+        // Processing happens on a per-bit level, so it is not expected to have
+        // multiple messages decoded.
+        assert(!result.Ok());
+
+        result = ax25_result;
+      }
+    }
+
+    return result;
+  }
+
+  // Get the frame check sequence of the last decoded frame.
+  //
+  // Follows the semantic of the AX.25 decoder: is only valid when the last
+  // processing returned a decoded message.
+  inline auto GetFrameFCS() const -> uint16_t {
+    return ax25_decoder_.GetFrameFCS();
+  }
+
+  // Check whether the last decoded frame has been repaired.
+  //
+  // Follows the semantic of the AX.25 decoder: is only valid when the last
+  // processing returned a decoded message.
+  inline auto IsFrameRepaired() const -> bool {
+    return ax25_decoder_.IsFrameRepaired();
+  }
+
+ private:
+  using NRZSDecoder = protocol::binary::nrzs::Decoder;
+  using HDLCDecoder = protocol::datalink::hdlc::Decoder;
+  using AX25Decoder = protocol::datalink::ax25::Decoder;
+
+  NRZSDecoder nrzs_decoder_;
+  HDLCDecoder hdlc_decoder_;
+  AX25Decoder ax25_decoder_;
+};
+
+}  // namespace radio_core::protocol::packet::aprs::internal
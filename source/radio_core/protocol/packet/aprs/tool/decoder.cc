@@ -15,8 +15,10 @@
 #include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <argparse/argparse.hpp>
 
@@ -46,11 +48,14 @@ namespace audio_wav_reader = tiny_lib::audio_wav_reader;
 struct CLIOptions {
   inline static constexpr int kDefaultChannel{1};
   inline static constexpr bool kDefaultTerse{false};
+  inline static constexpr bool kDefaultRepair{false};
 
   std::filesystem::path input_audio_filepath;
   int audio_channel{kDefaultChannel};
 
   bool terse{kDefaultTerse};
+
+  bool repair{kDefaultRepair};
 };
 
 // Parse command line arguments and return parsed result.
@@ -74,6 +79,12 @@ auto ParseCLIAndGetOptions(const int argc, char** argv) -> CLIOptions {
       .implicit_value(true)
       .help("Terse output: only summary");
 
+  program.add_argument("--repair")
+      .default_value(CLIOptions::kDefaultRepair)
+      .implicit_value(true)
+      .help("Repair frames with a bit error, two adjacent bit errors, or a "
+            "bit-stuffing error");
+
   try {
     program.parse_args(argc, argv);
   } catch (const std::runtime_error& err) {
@@ -87,6 +98,7 @@ auto ParseCLIAndGetOptions(const int argc, char** argv) -> CLIOptions {
   options.input_audio_filepath = program.get<std::string>("input_audio");
   options.audio_channel = program.get<int>("--channel");
   options.terse = program.get<bool>("--terse");
+  options.repair = program.get<bool>("--repair");
 
   return options;
 }
@@ -113,7 +125,7 @@ inline void AX25AddressToString(const Address& address,
            ssid);
 }
 
-void PrintMessage(const Message& message) {
+void PrintMessage(const Message& message, const bool is_repaired) {
   static constexpr int kAddressStrSize = 10;
 
   std::array<char, kAddressStrSize> src_address;
@@ -125,10 +137,11 @@ void PrintMessage(const Message& message) {
   std::array<char, 32> encoded_indo;
   datalink::ax25::EncodeMessageInfo(message, encoded_indo);
 
-  printf("\nFm:%s To:%s <%s>\n",
+  printf("\nFm:%s To:%s <%s>%s\n",
          src_address.data(),
          dst_address.data(),
-         encoded_indo.data());
+         encoded_indo.data(),
+         is_repaired ? " [repaired]" : "");
 
   for (const Address& address : message.address.repeaters) {
     std::array<char, kAddressStrSize> repeater_address;
@@ -142,23 +155,36 @@ void PrintMessage(const Message& message) {
   printf("%*s\n\n", int(information.size()), information.data());
 }
 
+// Number of samples which are decoded at once.
+inline constexpr size_t kBlockSize = 4096;
+
 class AX25MessagePrinter {
  public:
   explicit AX25MessagePrinter(bool terse) : terse_(terse) {}
 
-  void operator()(const Message& message) {
+  void operator()(const Message& message, const bool is_repaired) {
     if (!terse_) {
-      PrintMessage(message);
+      PrintMessage(message, is_repaired);
     }
 
     ++num_messages_;
+    if (is_repaired) {
+      ++num_repaired_messages_;
+    }
   }
 
   inline auto GetNumMessages() const -> int { return num_messages_; }
 
+  // Get the number of messages which did not pass the FCS check and have been
+  // repaired.
+  inline auto GetNumRepairedMessages() const -> int {
+    return num_repaired_messages_;
+  }
+
  private:
   bool terse_ = true;
   int num_messages_ = 0;
+  int num_repaired_messages_ = 0;
 };
 
 auto Main(int argc, char** argv) -> int {
@@ -205,6 +231,9 @@ auto Main(int argc, char** argv) -> int {
       .tones = modulation::digital::fsk::kBell202Tones,
       .sample_rate = float(format_spec.sample_rate),
       .data_baud = 1200,
+      .repair = {.single_bit = cli_options.repair,
+                 .max_two_bits_distance = cli_options.repair ? 1 : 0,
+                 .bit_stuffing = cli_options.repair},
   };
 
   // Decoding pipeline.
@@ -215,23 +244,30 @@ auto Main(int argc, char** argv) -> int {
 
   const ScopedTimer scoped_timer;
 
-  auto processor = [&](const float sample) {
-    const Decoder<float>::Result result = decoder(sample);
-    if (result.Ok()) {
-      message_printer(result.GetValue());
-    }
+  // The samples of the requested channel are accumulated into a buffer and
+  // are decoded block by block.
+  std::vector<float> samples;
+  samples.reserve(kBlockSize);
+
+  auto flush_samples = [&]() {
+    decoder(std::span<const float>(samples), [&](const Message& message) {
+      message_printer(message, decoder.IsFrameRepaired());
+    });
+    samples.clear();
   };
 
   wav_file_reader.ReadAllSamples<float, 16>(
       [&](const std::span<const float> sample) {
-        processor(sample[cli_options.audio_channel - 1]);
+        samples.push_back(sample[cli_options.audio_channel - 1]);
+        if (samples.size() == kBlockSize) {
+          flush_samples();
+        }
       });
 
   // Make sure all samples from file are processed and are not being stuck in
   // the filter delays.
-  for (int i = 0; i < 1000; ++i) {
-    processor(0.0f);
-  }
+  samples.resize(samples.size() + 1000, 0.0f);
+  flush_samples();
 
   const float decode_time_in_seconds = scoped_timer.GetElapsedTimeInSeconds();
   cout << endl;
@@ -239,6 +275,10 @@ auto Main(int argc, char** argv) -> int {
        << tool::LogTimeWithRealtimeComparison(decode_time_in_seconds,
                                               file_duration_in_seconds)
        << endl;
+  if (cli_options.repair) {
+    cout << message_printer.GetNumRepairedMessages() << " packets repaired"
+         << endl;
+  }
 
   return EXIT_SUCCESS;
 }
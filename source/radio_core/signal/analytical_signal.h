@@ -42,6 +42,7 @@ class AnalyticalSignal {
     hilbert_transformer_.SetKernelSize(num_taps);
     GenerateWindowedHilbertTransformer(hilbert_transformer_.GetKernel(),
                                        window_equation);
+    hilbert_transformer_.UpdateKernelSymmetry();
   }
 
   auto operator()(const RealType sample) -> Complex {
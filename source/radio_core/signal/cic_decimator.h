@@ -0,0 +1,321 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Cascaded integrator-comb (CIC) decimator with an optional compensation
+// filter.
+//
+// The CIC filter of order N and decimation ratio R has the transfer function
+//
+//   H(z) = ((1 - z^-R) / (1 - z^-1))^N = (1 + z^-1 + ... + z^-(R-1))^N
+//
+// which is a cascade of N moving sum filters. It has a very cheap to evaluate
+// impulse response with good rejection of the frequencies which alias into the
+// band around DC at the output sample rate. This makes it a good first stage
+// of a multi-stage decimation with a large ratio.
+//
+// The classic Hogenauer implementation uses N integrators running at the input
+// sample rate followed by N combs running at the output sample rate. It relies
+// on the wrap-around integer arithmetic and can not be used for floating point
+// samples: the integrators accumulate rounding error without a bound. Instead
+// the equivalent non-recursive form is used: the impulse response of the CIC
+// filter is evaluated as a FIR filter only for the samples which are kept by
+// the decimation. The filter has N * (R - 1) + 1 taps, so that the cost is
+// about N multiplications per input sample.
+//
+// The passband of the CIC filter is not flat, it has sin(x)/x-like droop. The
+// decimator optionally applies a compensation FIR filter at the output sample
+// rate which flattens the response up to the given cutoff frequency.
+//
+// References:
+//
+//   E. Hogenauer, "An economical class of digital filters for decimation and
+//   interpolation", IEEE Transactions on Acoustics, Speech, and Signal
+//   Processing, vol. 29, no. 2, pp. 155-162, 1981.
+//
+//   Understanding cascaded integrator-comb filters
+//   https://www.embedded.com/understanding-cascaded-integrator-comb-filters/
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "radio_core/base/constants.h"
+#include "radio_core/base/verify.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal/decimator.h"
+#include "radio_core/signal/filter_gain.h"
+#include "radio_core/signal/simple_fir_filter.h"
+#include "radio_core/signal/window.h"
+
+namespace radio_core::signal {
+
+// Calculate the number of taps of the impulse response of the CIC filter with
+// the given decimation ratio and order.
+inline constexpr auto CICFilterSize(const int ratio, const int order)
+    -> size_t {
+  return size_t(order) * (ratio - 1) + 1;
+}
+
+// Design impulse response of the CIC filter of the given decimation ratio and
+// order.
+//
+// The number of taps is expected to be CICFilterSize(ratio, order). This is
+// Verify()-ed.
+//
+// The filter is normalized to have unity gain at DC.
+template <class T>
+inline void DesignCICFilter(const std::span<T> h,
+                            const int ratio,
+                            const int order) {
+  Verify(ratio > 0, "CIC ratio must be positive");
+  Verify(order > 0, "CIC order must be positive");
+  Verify(h.size() == CICFilterSize(ratio, order), "Invalid CIC filter size");
+
+  // Calculate the coefficients of the polynomial (1 + z^-1 + ... + z^-(R-1))^N
+  // by convolving the moving sum N times. Use double precision, as the integer
+  // coefficients quickly become large.
+  std::vector<double> coefficients(h.size(), 0.0);
+  std::vector<double> previous(h.size(), 0.0);
+  coefficients[0] = 1;
+  size_t size = 1;
+  for (int i = 0; i < order; ++i) {
+    std::copy(
+        coefficients.begin(), coefficients.begin() + size, previous.begin());
+
+    const size_t new_size = size + ratio - 1;
+    for (size_t n = 0; n < new_size; ++n) {
+      double sum = 0;
+      for (int k = 0; k < ratio; ++k) {
+        if (n >= size_t(k) && n - k < size) {
+          sum += previous[n - k];
+        }
+      }
+      coefficients[n] = sum;
+    }
+
+    size = new_size;
+  }
+
+  const double gain = Pow(double(ratio), double(order));
+  for (size_t n = 0; n < h.size(); ++n) {
+    h[n] = T(coefficients[n] / gain);
+  }
+}
+
+// Calculate magnitude response of the CIC filter of the given decimation ratio
+// and order normalized to unity gain at DC.
+//
+// The frequency is normalized to the sample rate of the filter output.
+template <class T>
+inline auto CalculateCICGain(const int ratio,
+                             const int order,
+                             const T frequency) -> T {
+  const T x = T(constants::pi) * frequency;
+
+  if (Abs(x) < T(1e-12)) {
+    return T(1);
+  }
+
+  const T gain = Sin(x) / (ratio * Sin(x / ratio));
+
+  return Pow(Abs(gain), T(order));
+}
+
+// Design compensation filter for the CIC filter of the given decimation ratio
+// and order.
+//
+// The compensation filter runs at the output sample rate of the CIC filter,
+// and its response is the inverse of the CIC response in the passband, up to
+// the cutoff frequency. Above the cutoff frequency the response is zero. The
+// cutoff frequency is normalized to the output sample rate of the CIC filter
+// and is expected to be within the (0 .. 0.5] range. This is Verify()-ed.
+//
+// The filter is designed using windowed frequency sampling method: the ideal
+// impulse response is calculated by numerically integrating the desired
+// frequency response, and is then windowed by the given window equation.
+//
+// The filter is normalized to have unity gain at DC.
+template <class T, class WindowPredicateType>
+inline void DesignCICCompensationFilter(
+    const std::span<T> h,
+    const WindowPredicateType& window_equation,
+    const int ratio,
+    const int order,
+    const ComputeType<T> cutoff_frequency) {
+  using RealType = ComputeType<T>;
+
+  Verify(cutoff_frequency > 0 && cutoff_frequency <= RealType(0.5),
+         "CIC compensation cutoff must be in (0 .. 0.5] range");
+
+  // The number of steps used for the numerical integration of the frequency
+  // response. Gives error well below of the precision of the float kernel.
+  constexpr int kNumIntegrationSteps = 512;
+
+  const int num_taps = int(h.size());
+  const int order_fir = num_taps - 1;
+  const double half_order = double(order_fir) / 2;
+  const double df = double(cutoff_frequency) / kNumIntegrationSteps;
+
+  for (int n = 0; n <= order_fir; ++n) {
+    const double t = n - half_order;
+
+    double sum = 0;
+    for (int i = 0; i < kNumIntegrationSteps; ++i) {
+      const double f = (i + 0.5) * df;
+      const double desired = 1.0 / CalculateCICGain<double>(ratio, order, f);
+      sum += desired * Cos(2 * constants::pi * f * t);
+    }
+
+    h[n] = T(RealType(2 * sum * df) *
+             RealType(window_equation(order_fir, n)));
+  }
+
+  // Scale the filter to have unity gain at the DC.
+  ScaleFilterToUnityGainAtFrequency<T>(h, 0);
+}
+
+template <class SampleType,
+          class KernelElementType = SampleType,
+          template <class> class Allocator = std::allocator>
+class CICDecimator {
+  // Pseudonym for real-typed scalar values which are used to design the
+  // kernels.
+  using RealType = ComputeType<KernelElementType>;
+
+  template <class T>
+  using Vector = std::vector<T, Allocator<T>>;
+
+ public:
+  struct Options {
+    // Decimation ratio R.
+    int ratio{1};
+
+    // The order N of the filter: the number of integrator and comb pairs.
+    int order{4};
+
+    // Cutoff frequency of the compensation filter, normalized to the output
+    // sample rate.
+    // Up to this frequency the CIC filter droop is compensated. The response
+    // is flat up to about the cutoff frequency minus half of the transition
+    // band of the compensation filter. The value of 0 disables the
+    // compensation filter.
+    RealType compensation_cutoff{0};
+
+    // Number of taps of the compensation filter.
+    int compensation_size{21};
+
+    constexpr auto operator<=>(const Options& other) const = default;
+  };
+
+  // Default constructor.
+  //
+  // Leaves object uninitialized. When this path is used an explicit call to
+  // `Configure()` is expected before performing downsampling, otherwise the
+  // object will have an undefined behavior.
+  CICDecimator() = default;
+
+  explicit CICDecimator(const Options& options) { Configure(options); }
+
+  // Configure the decimator.
+  // If the requested configuration matches the current one nothing happens.
+  void Configure(const Options& options) {
+    Verify(options.ratio > 0, "CIC ratio must be positive");
+    Verify(options.order > 0, "CIC order must be positive");
+
+    if (is_configured_ && options_ == options) {
+      return;
+    }
+
+    options_ = options;
+    is_configured_ = true;
+
+    if (options.ratio == 1) {
+      decimator_.SetRatio(1);
+    } else {
+      Vector<KernelElementType> kernel(
+          CICFilterSize(options.ratio, options.order));
+      DesignCICFilter<KernelElementType>(kernel, options.ratio, options.order);
+      decimator_.SetRatioAndKernel(options.ratio, kernel);
+    }
+
+    use_compensation_ = options.ratio != 1 && options.compensation_cutoff > 0;
+    if (use_compensation_) {
+      compensation_filter_.SetKernelSize(options.compensation_size | 1);
+      DesignCICCompensationFilter<KernelElementType>(
+          compensation_filter_.GetKernel(),
+          WindowEquation<RealType, Window::kHamming>(),
+          options.ratio,
+          options.order,
+          options.compensation_cutoff);
+      compensation_filter_.UpdateKernelSymmetry();
+    }
+  }
+
+  inline auto GetRatio() const -> int { return options_.ratio; }
+  inline auto GetOrder() const -> int { return options_.order; }
+
+  // Downsample multiple input samples.
+  //
+  // The output buffer must have enough elements to hold result of the
+  // downsampled samples. Use the `CalcNeededOutputBufferSize()` to calculate
+  // the needed buffer size.
+  //
+  // The input and output buffers might be the same.
+  //
+  // Returns a subspan of the output samples buffer which was written by this
+  // call.
+  auto operator()(const std::span<const SampleType> input_samples,
+                  const std::span<SampleType> output_samples)
+      -> std::span<SampleType> {
+    assert(is_configured_);
+
+    const std::span<SampleType> decimated_samples =
+        decimator_(input_samples, output_samples);
+
+    if (use_compensation_) {
+      compensation_filter_(decimated_samples);
+    }
+
+    return decimated_samples;
+  }
+
+  inline auto operator()(const std::span<SampleType> samples)
+      -> std::span<SampleType> {
+    return (*this)(samples, samples);
+  }
+
+  // Calculate required output buffer size for the given number of input
+  // samples.
+  inline auto CalcNeededOutputBufferSize(const size_t num_input_samples) const
+      -> size_t {
+    return decimator_.CalcNeededOutputBufferSize(num_input_samples);
+  }
+
+  // Pre-allocate work buffers for downsampling up to the given number of input
+  // samples at a time.
+  //
+  // Downsampling of input buffers which are not bigger than the reserved size
+  // does not allocate memory.
+  //
+  // The reservation is to be done after the decimator is configured.
+  void Reserve(const size_t max_num_input_samples) {
+    decimator_.Reserve(max_num_input_samples);
+  }
+
+ private:
+  Options options_;
+  bool is_configured_{false};
+
+  Decimator<SampleType, KernelElementType, Allocator> decimator_;
+
+  bool use_compensation_{false};
+  SimpleFIRFilter<SampleType, KernelElementType, Allocator>
+      compensation_filter_;
+};
+
+}  // namespace radio_core::signal
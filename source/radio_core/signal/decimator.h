@@ -12,7 +12,9 @@
 //
 // The implementation follows the naive implementation with a distinct blocks
 // for the filter and downsampler. The optimization is such that the filter is
-// only applied at the every Mth input sample.
+// only applied at the every Mth input sample. When the kernel is symmetric (as
+// it is for the designed anti-alias filter) the mirrored samples are pre-added,
+// halving the number of multiplications of the continuous samples processing.
 //
 // TODO(sergey):
 //
@@ -30,13 +32,16 @@
 #include <cassert>
 #include <memory>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include "radio_core/base/ring_buffer.h"
 #include "radio_core/math/kernel/dot.h"
+#include "radio_core/math/kernel/dot_symmetric.h"
 #include "radio_core/signal/filter.h"
 #include "radio_core/signal/filter_design.h"
 #include "radio_core/signal/frequency.h"
+#include "radio_core/signal/kernel_symmetry.h"
 #include "radio_core/signal/window.h"
 
 namespace radio_core::signal {
@@ -65,16 +70,17 @@ class Decimator {
     // TODO(sergey): Not really correct: the either or both of the sample type
     // and the kernel elements can be complex, and here it is required to have
     // a real type.
-    using RealType = KernelElementType;
+    using RealType = ComputeType<KernelElementType>;
 
     assert(ratio > 0);
 
-    if (ratio_ == ratio) {
+    if (ratio_ == ratio && !is_custom_kernel_) {
       // Avoid re-initialization if the ratio did not change.
       return;
     }
 
     ratio_ = ratio;
+    is_custom_kernel_ = false;
 
     // This follows calculation of the FIR kernel size used in scipy.decimate()
     // which is the 20 times the ratio (rounded to an odd number). The same
@@ -86,7 +92,6 @@ class Decimator {
     const int kernel_size = 20 * ratio + 1;
 
     kernel_.resize(kernel_size);
-    stored_samples_.resize(kernel_.size());
 
     // Low-pass filter, rejecting frequencies above of half of the destination
     // sample rate. Additionally subtract the transition bandwidth to ensure a
@@ -103,16 +108,33 @@ class Decimator {
         RealType(0.5) / ratio,
         RealType(1));
 
-    // Reverse the kernel as the samples are stored in the reverse order.
-    std::reverse(kernel_.begin(), kernel_.end());
+    InitializeForKernel();
+  }
 
-    // Reset the downsampling accumulation.
-    //
-    // There might be more graceful reset to avoid possible spike in the output,
-    // but with the current downsampling algorithm without reset lowering the
-    // decimation ratio without such reset will lead to empty output for all
-    // subsequent samples.
-    num_unprocessed_samples_ = 0;
+  // Set decimation ratio and an explicitly provided anti-alias filter kernel.
+  //
+  // This allows to use a filter which is designed for a specific application.
+  // For example, an intermediate stage of a multi-stage decimation only needs
+  // to reject frequencies which alias into the band of the final stage, so it
+  // can use a much wider transition band and a much shorter kernel.
+  //
+  // The kernel is copied into the decimator, so that the caller can dispose it
+  // from its side.
+  //
+  // NOTE: The state of the decimator is always reset, even if the ratio did
+  // not change.
+  void SetRatioAndKernel(const int ratio,
+                         const std::span<const KernelElementType> kernel) {
+    assert(ratio > 0);
+    assert(!kernel.empty());
+
+    ratio_ = ratio;
+    is_custom_kernel_ = true;
+
+    kernel_.resize(kernel.size());
+    std::copy(kernel.begin(), kernel.end(), kernel_.begin());
+
+    InitializeForKernel();
   }
 
   // Get currently configured decimation ratio.
@@ -198,7 +220,10 @@ class Decimator {
           input_samples.last(input_samples.size() - input_sample_index));
     }
 
-    num_unprocessed_samples_ = input_samples.size() - input_sample_index;
+    // Accumulate rather than assign: when the input is too short to complete
+    // the decimation period the samples from the previous calls are still
+    // unprocessed.
+    num_unprocessed_samples_ += input_samples.size() - input_sample_index;
 
     return output_samples.subspan(0, output_sample_index);
   }
@@ -227,6 +252,15 @@ class Decimator {
     return (num_input_samples + ratio_ - 1) / ratio_;
   }
 
+  // Pre-allocate work buffers for downsampling up to the given number of input
+  // samples at a time.
+  //
+  // The decimator only keeps the history of samples of the kernel size, which
+  // is allocated when the kernel is set. The downsampling never allocates
+  // memory, and this call is a no-op. It is provided for the API compatibility
+  // with other decimators.
+  void Reserve(const size_t /*max_num_input_samples*/) {}
+
  private:
   // Special handler of the decimation ratio of 1, which copies input samples
   // to the output buffer and returns span od the output buffer of a proper
@@ -243,6 +277,27 @@ class Decimator {
     return output_samples.subspan(0, input_samples.size());
   }
 
+  // Initialize the state of the decimator after the kernel_ has been designed
+  // or provided by the caller.
+  void InitializeForKernel() {
+    stored_samples_.resize(kernel_.size());
+    stored_samples_.fill(SampleType(0));
+
+    // Reverse the kernel as the samples are stored in the reverse order.
+    std::reverse(kernel_.begin(), kernel_.end());
+
+    kernel_symmetry_ =
+        DetectKernelSymmetry(std::span<const KernelElementType>(kernel_));
+
+    // Reset the downsampling accumulation.
+    //
+    // There might be more graceful reset to avoid possible spike in the output,
+    // but with the current downsampling algorithm without reset lowering the
+    // decimation ratio without such reset will lead to empty output for all
+    // subsequent samples.
+    num_unprocessed_samples_ = 0;
+  }
+
   // Process samples from both current ring buffer and the samples buffer.
   // Only the number of the new input samples is processed needed to give enough
   // head-room for in-place filtering done in the ProcessContinuousSamples().
@@ -303,13 +358,35 @@ class Decimator {
       assert(samples.begin() >= input_samples.begin());
       assert(samples.end() <= input_samples.end());
 
-      output_samples[output_sample_index++] =
-          kernel::Dot<SampleType, KernelElementType>(samples, kernel_);
+      output_samples[output_sample_index++] = DotProductContinuousSamples(
+          samples, std::span<const KernelElementType>(kernel_));
 
       input_sample_index += ratio_;
     }
   }
 
+  // Apply dot-product of the kernel and a continuous span of samples, taking
+  // advantage of the kernel symmetry.
+  inline auto DotProductContinuousSamples(
+      const std::span<const SampleType> samples,
+      const std::span<const KernelElementType> kernel) const -> SampleType {
+    switch (kernel_symmetry_) {
+      case KernelSymmetry::kNone:
+        return kernel::Dot<SampleType, KernelElementType>(samples, kernel);
+
+      case KernelSymmetry::kSymmetric:
+        return kernel::experimental::DotSymmetricG<SampleType,
+                                                   KernelElementType>(samples,
+                                                                      kernel);
+
+      case KernelSymmetry::kAntisymmetric:
+        return kernel::experimental::
+            DotAntisymmetricG<SampleType, KernelElementType>(samples, kernel);
+    }
+
+    return SampleType(0);
+  }
+
   // Apply dot-product of the kernel and the current samples buffer.
   auto DotProductSamplesAndKernel() const -> SampleType {
     // Create explicit span of the kernel, to make creation of sub-spans easier.
@@ -338,9 +415,16 @@ class Decimator {
   // Decimation ratio.
   int ratio_ = 0;
 
+  // True when the kernel has been provided by the caller, as opposite of being
+  // designed by the decimator.
+  bool is_custom_kernel_ = false;
+
   // Kernel of the low-pass filter.
   std::vector<KernelElementType, Allocator<KernelElementType>> kernel_;
 
+  // Symmetry of the kernel, detected when the kernel is initialized.
+  KernelSymmetry kernel_symmetry_ = KernelSymmetry::kNone;
+
   // Ring buffer with latest input samples of a size which matches the kernel
   // size.
   RingBuffer<SampleType, Allocator<SampleType>> stored_samples_;
@@ -16,7 +16,9 @@
 
 #include <cassert>
 #include <span>
+#include <type_traits>
 
+#include "radio_core/math/kernel/ema_agc.h"
 #include "radio_core/math/math.h"
 
 namespace radio_core::signal {
@@ -79,12 +81,20 @@ class EMAAGC {
       -> std::span<SampleType> {
     assert(input_samples.size() <= output_samples.size());
 
-    const size_t num_input_samples = input_samples.size();
-    for (size_t i = 0; i < num_input_samples; ++i) {
-      output_samples[i] = (*this)(input_samples[i]);
-    }
+    if constexpr (std::is_same_v<SampleType, RealType>) {
+      return kernel::EMAAGC<SampleType>(input_samples,
+                                        output_samples,
+                                        charge_rate_,
+                                        discharge_rate_,
+                                        current_charge_);
+    } else {
+      const size_t num_input_samples = input_samples.size();
+      for (size_t i = 0; i < num_input_samples; ++i) {
+        output_samples[i] = (*this)(input_samples[i]);
+      }
 
-    return output_samples.subspan(0, num_input_samples);
+      return output_samples.subspan(0, num_input_samples);
+    }
   }
 
   // In-place AGC.
@@ -3,6 +3,11 @@
 // SPDX-License-Identifier: MIT
 
 // Utility functions to design various filters.
+//
+// The coefficients are calculated using the ComputeType of the kernel element
+// type, and are rounded to the kernel element type when they are stored. This
+// allows to design kernels of half precision floating point values, which do
+// not have enough range and precision for the calculation itself.
 
 #pragma once
 
@@ -38,35 +43,66 @@ namespace radio_core::signal {
 template <class T, class WindowPredicateType>
 inline void DesignLowPassFilter(std::span<T> h,
                                 const WindowPredicateType& window_equation,
-                                const T cutoff_frequency,
-                                const T sampling_frequency = 2) {
+                                const ComputeType<T> cutoff_frequency,
+                                const ComputeType<T> sampling_frequency = 2) {
+  using RealType = ComputeType<T>;
+
   Verify(cutoff_frequency <= sampling_frequency / 2,
          "Nyquest requirement for cutoff_frequency");
 
   // Calculate filter coefficients.
-  const T ft = cutoff_frequency / sampling_frequency;
+  const RealType ft = cutoff_frequency / sampling_frequency;
   const int num_taps = int(h.size());
   const int order = num_taps - 1;
-  const T half_order = T(order) / 2;
+  const RealType half_order = RealType(order) / 2;
   const int half_order_int = int(half_order);
   for (int n = 0; n <= order; ++n) {
+    RealType h_n;
     if (n == half_order_int) {
-      h[n] = 2 * ft;
+      h_n = 2 * ft;
     } else {
-      const T pi_n_half_order = T(constants::pi) * (n - half_order);
-      const T pi_n_half_order2 = pi_n_half_order * 2;
-      const T denum_inv = T(1) / pi_n_half_order;
+      const RealType pi_n_half_order =
+          RealType(constants::pi) * (RealType(n) - half_order);
+      const RealType pi_n_half_order2 = pi_n_half_order * 2;
+      const RealType denum_inv = RealType(1) / pi_n_half_order;
 
-      h[n] = Sin(pi_n_half_order2 * ft) * denum_inv;
+      h_n = Sin(pi_n_half_order2 * ft) * denum_inv;
     }
 
-    h[n] *= window_equation(order, n);
+    h[n] = T(h_n * RealType(window_equation(order, n)));
   }
 
   // Scale the filter to have unity gain at the DC.
   ScaleFilterToUnityGainAtFrequency<T>(h, 0);
 }
 
+// Design a half-band low-pass filter: a filter with the cutoff frequency at the
+// quarter of the sampling frequency.
+//
+// Every other coefficient of such filter is zero, except of the central one.
+// This is what makes half-band filters attractive for decimation by 2: only
+// about half of the coefficients are to be multiplied with samples.
+//
+// The number of taps must be 4*k + 3. This way the first and the last taps of
+// the filter are non-zero. This is Verify()-ed.
+//
+// The coefficients which are expected to be zero are explicitly set to zero to
+// avoid any rounding errors of the windowed sinc calculation.
+template <class T, class WindowPredicateType>
+inline void DesignHalfBandFilter(std::span<T> h,
+                                 const WindowPredicateType& window_equation) {
+  Verify(h.size() % 4 == 3, "Half-band filter must have 4*k + 3 taps");
+
+  DesignLowPassFilter<T>(h, window_equation, 0.25f, 1.0f);
+
+  const int center = int(h.size() / 2);
+  for (int n = 0; n < int(h.size()); ++n) {
+    if (n != center && ((n - center) & 1) == 0) {
+      h[n] = T(0);
+    }
+  }
+}
+
 // Design filter which passes frequencies within the cutoff start/end range and
 // rejects filters outside of the range.
 //
@@ -88,19 +124,22 @@ inline void DesignLowPassFilter(std::span<T> h,
 //
 // TODO(sergey): Support kernels with complex element type.
 template <class T, class WindowPredicateType>
-inline void DesignBandPassFilter(std::span<T> h,
-                                 const WindowPredicateType& window_equation,
-                                 const T cutoff_frequency_start,
-                                 const T cutoff_frequency_end,
-                                 const T sampling_frequency = 2) {
+inline void DesignBandPassFilter(
+    std::span<T> h,
+    const WindowPredicateType& window_equation,
+    const ComputeType<T> cutoff_frequency_start,
+    const ComputeType<T> cutoff_frequency_end,
+    const ComputeType<T> sampling_frequency = 2) {
+  using RealType = ComputeType<T>;
+
   // Validate frequencies.
   Verify(cutoff_frequency_start <= sampling_frequency / 2,
          "Nyquest requirement for cutoff_frequency_start");
   Verify(cutoff_frequency_end <= sampling_frequency / 2,
          "Nyquest requirement for cutoff_frequency_end");
 
-  const T ft1 = cutoff_frequency_start / sampling_frequency;
-  const T ft2 = cutoff_frequency_end / sampling_frequency;
+  const RealType ft1 = cutoff_frequency_start / sampling_frequency;
+  const RealType ft2 = cutoff_frequency_end / sampling_frequency;
 
   const int num_taps = int(h.size());
   const int order = num_taps - 1;
@@ -109,26 +148,28 @@ inline void DesignBandPassFilter(std::span<T> h,
   Verify((order & 1) == 0, "Filter order is expected to be odd");
 
   // Calculate filter coefficients.
-  const T half_order = T(order) / 2;
-  const int half_order_int = half_order;
+  const RealType half_order = RealType(order) / 2;
+  const int half_order_int = int(half_order);
   for (int n = 0; n <= order; ++n) {
+    RealType h_n;
     if (n == half_order_int) {
-      h[n] = T(2) * (ft2 - ft1);
+      h_n = RealType(2) * (ft2 - ft1);
     } else {
-      const T pi_n_half_order = constants::pi_v<T> * (n - half_order);
-      const T pi_n_half_order2 = pi_n_half_order * T(2);
-      const T denum_inv = T(1) / pi_n_half_order;
+      const RealType pi_n_half_order =
+          constants::pi_v<RealType> * (RealType(n) - half_order);
+      const RealType pi_n_half_order2 = pi_n_half_order * RealType(2);
+      const RealType denum_inv = RealType(1) / pi_n_half_order;
 
-      h[n] = Sin(pi_n_half_order2 * ft2) * denum_inv -
-             Sin(pi_n_half_order2 * ft1) * denum_inv;
+      h_n = Sin(pi_n_half_order2 * ft2) * denum_inv -
+            Sin(pi_n_half_order2 * ft1) * denum_inv;
     }
 
-    h[n] *= window_equation(order, n);
+    h[n] = T(h_n * RealType(window_equation(order, n)));
   }
 
   // Scale the filter to have unity gain at the center frequency.
-  const T f_center = (ft1 + ft2) * T(0.5);
-  ScaleFilterToUnityGainAtFrequency(h, f_center);
+  const RealType f_center = (ft1 + ft2) * RealType(0.5);
+  ScaleFilterToUnityGainAtFrequency<T>(h, f_center);
 }
 
 // Design filter which delays signal by a fractional number of samples.
@@ -144,15 +185,17 @@ template <class T, class WindowPredicateType>
 inline void DesignFractionalDelayFilter(
     std::span<T> h,
     const WindowPredicateType& window_equation,
-    const T num_fractional_samples) {
+    const ComputeType<T> num_fractional_samples) {
+  using RealType = ComputeType<T>;
+
   const int num_taps = int(h.size());
   const int order = num_taps - 1;
-  const T half_order = T(order) / 2;
+  const RealType half_order = RealType(order) / 2;
 
   for (int n = 0; n <= order; ++n) {
-    const T n_center = T(n) - half_order;
-    h[n] = Sinc(n_center - num_fractional_samples);
-    h[n] *= window_equation(order, n);
+    const RealType n_center = RealType(n) - half_order;
+    h[n] = T(Sinc(n_center - num_fractional_samples) *
+             RealType(window_equation(order, n)));
   }
 
   // Scale the filter to have unity gain at the DC.
@@ -15,18 +15,22 @@ namespace radio_core::signal {
 
 // Calculate gain of the given filter at the DC.
 template <class T>
-inline auto CalculateFilterGainAtDC(const std::span<const T> h) -> T {
-  T gain(0);
-  for (const T h_k : h) {
-    gain += h_k;
+inline auto CalculateFilterGainAtDC(const std::span<const T> h)
+    -> ComputeType<T> {
+  ComputeType<T> gain(0);
+  for (const T& h_k : h) {
+    gain += ComputeType<T>(h_k);
   }
   return gain;
 }
 
 // Calculate gain of the given filter at the given frequency.
 template <class T>
-inline auto CalculateFilterGain(const std::span<const T> h, const T frequency)
-    -> T {
+inline auto CalculateFilterGain(const std::span<const T> h,
+                                const ComputeType<T> frequency)
+    -> ComputeType<T> {
+  using RealType = ComputeType<T>;
+
   if (frequency == 0) {
     // Early output for gain calculation at the DC: can use cheaper calculation.
     return CalculateFilterGainAtDC(h);
@@ -43,12 +47,12 @@ inline auto CalculateFilterGain(const std::span<const T> h, const T frequency)
 
   const int num_taps = int(h.size());
   const int order = num_taps - 1;
-  const T half_window = T(order) / 2;
-  const T angular_freq = 2 * T(constants::pi) * frequency;
+  const RealType half_window = RealType(order) / 2;
+  const RealType angular_freq = 2 * RealType(constants::pi) * frequency;
 
-  T gain(0);
+  RealType gain(0);
   for (int n = 0; n <= order; ++n) {
-    gain += h[n] * Cos(angular_freq * (n - half_window));
+    gain += RealType(h[n]) * Cos(angular_freq * (RealType(n) - half_window));
   }
 
   return gain;
@@ -56,12 +60,14 @@ inline auto CalculateFilterGain(const std::span<const T> h, const T frequency)
 
 // Scale filter to have unity gain at the given frequency.
 template <class T>
-inline void ScaleFilterToUnityGainAtFrequency(const std::span<T> h,
-                                              const T frequency) {
-  const T gain = CalculateFilterGain<T>(h, frequency);
-  const T gain_inv = T(1) / gain;
+inline void ScaleFilterToUnityGainAtFrequency(
+    const std::span<T> h, const ComputeType<T> frequency) {
+  using RealType = ComputeType<T>;
+
+  const RealType gain = CalculateFilterGain<T>(h, frequency);
+  const RealType gain_inv = RealType(1) / gain;
   for (T& h_k : h) {
-    h_k *= gain_inv;
+    h_k = T(RealType(h_k) * gain_inv);
   }
 }
 
@@ -65,7 +65,7 @@ inline constexpr auto CalculateKaiserBeta(const RealType alpha) -> RealType {
 template <class RealType>
 inline constexpr auto CalculateKaiserSize(const RealType alpha,
                                           const RealType dw) -> size_t {
-  return (alpha - RealType(8)) / (RealType(2.285) * dw) + RealType(1);
+  return size_t((alpha - RealType(8)) / (RealType(2.285) * dw) + RealType(1));
 }
 
 }  // namespace radio_core::signal
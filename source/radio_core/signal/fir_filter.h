@@ -5,6 +5,19 @@
 // FIR filter which applies filter kernel in an input stream of samples.
 // The filter stores its internal state needed do deal with a continuous stream
 // of new samples.
+//
+// Kernels of linear-phase filters are symmetric or antisymmetric. When the
+// filter is told about the symmetry of the kernel (either explicitly via the
+// `SetKernelSymmetry()` or by detecting it from the current kernel using the
+// `UpdateKernelSymmetry()`) the mirrored samples are pre-added, halving the
+// number of multiplications.
+//
+// When a large number of single precision samples is filtered at once, the
+// filter evaluates multiple consecutive outputs at once: every element of the
+// kernel is multiplied by a vectorized register of the consecutive input
+// samples. This avoids the per-output overhead of the dot product, which
+// dominates for short kernels. The kernel symmetry is used by this path as
+// well.
 
 #pragma once
 
@@ -12,12 +25,17 @@
 #include <cassert>
 #include <memory>
 #include <span>
+#include <type_traits>
 #include <vector>
 
-#include "radio_core/base/reverse_storage_ring_buffer.h"
 #include "radio_core/base/verify.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/float4.h"
+#include "radio_core/math/float8.h"
 #include "radio_core/math/kernel/dot.h"
 #include "radio_core/math/kernel/dot_flip.h"
+#include "radio_core/math/kernel/dot_symmetric.h"
+#include "radio_core/signal/kernel_symmetry.h"
 
 namespace radio_core::signal {
 
@@ -37,10 +55,22 @@ class FIRFilter {
 
   // NOTE: The kernel is referenced by this filter.
   // NOTE: The current samples storage is reset to zeroes.
+  // NOTE: The kernel symmetry is reset to KernelSymmetry::kNone, as the kernel
+  // is typically designed after it has been provided to the filter.
   inline void SetKernel(std::span<const KernelElementType> kernel) {
     kernel_ = kernel;
-
-    stored_samples_.resize(GetKernelSize());
+    kernel_symmetry_ = KernelSymmetry::kNone;
+
+    // The samples are stored twice, with an offset of the kernel size, so that
+    // the last kernel_.size() samples are always available as a continuous
+    // span.
+    stored_samples_.resize(GetKernelSize() * 2);
+    std::fill(stored_samples_.begin(), stored_samples_.end(), SampleType(0));
+    stored_samples_index_ = 0;
+
+    // Allocate the buffer upfront, so that processing of samples does not
+    // allocate memory.
+    temp_buffer_.resize(GetKernelSize() + 1);
   }
 
   inline auto GetKernel() const -> std::span<const KernelElementType> {
@@ -49,34 +79,48 @@ class FIRFilter {
 
   inline auto GetKernelSize() const -> size_t { return kernel_.size(); }
 
+  // Explicitly specify symmetry of the current kernel.
+  //
+  // The caller is responsible for the kernel to actually have the given
+  // symmetry: only the first half of the kernel is accessed by the symmetric
+  // evaluation.
+  inline void SetKernelSymmetry(const KernelSymmetry symmetry) {
+    kernel_symmetry_ = symmetry;
+  }
+
+  inline auto GetKernelSymmetry() const -> KernelSymmetry {
+    return kernel_symmetry_;
+  }
+
+  // Detect symmetry of the current kernel and use it for filtering.
+  //
+  // Is to be called after the kernel has been designed.
+  inline void UpdateKernelSymmetry() {
+    kernel_symmetry_ = DetectKernelSymmetry(kernel_);
+  }
+
   // NOTE: If the kernel was not yet provided and initialized this function will
   // have an undefined behavior.
   auto operator()(const SampleType sample) -> SampleType {
-    stored_samples_.push(sample);
-
-    SampleType output(0);
-
-    // TODO(sergey): Use double-buffer technique (where sample is pushed twice
-    // to a cyclic buffer with an offset of size of the kernel). This will allow
-    // to have a single Dot() kernel invocation.
-    //
-    // However, from quick experiments seems that it does not yeld noticeable
-    // performance improvement on Apple M2 Max and Raspberry Pi 4.
-
-    const std::span<const SampleType> new_samples =
-        stored_samples_.GetContinuousNewElements();
-    const size_t num_new_samples = new_samples.size();
-    if (num_new_samples) {
-      output += kernel::Dot(new_samples, kernel_.subspan(0, num_new_samples));
-    }
+    PushSample(sample);
+
+    // The stored samples are ordered from the newest to the oldest, so that
+    // the newest sample is multiplied by the first element of the kernel.
+    const std::span<const SampleType> samples(
+        stored_samples_.data() + stored_samples_index_, kernel_.size());
+
+    switch (kernel_symmetry_) {
+      case KernelSymmetry::kNone:
+        return kernel::Dot(samples, kernel_);
+
+      case KernelSymmetry::kSymmetric:
+        return kernel::experimental::DotSymmetricG(samples, kernel_);
 
-    const std::span<const SampleType> old_samples =
-        stored_samples_.GetContinuousOldElements();
-    if (!old_samples.empty()) {
-      output += kernel::Dot(old_samples, kernel_.subspan(num_new_samples));
+      case KernelSymmetry::kAntisymmetric:
+        return kernel::experimental::DotAntisymmetricG(samples, kernel_);
     }
 
-    return output;
+    return SampleType(0);
   }
 
   // Filter multiple input samples.
@@ -119,7 +163,7 @@ class FIRFilter {
     // processing of samples after this loop need the current samples intact.
     SampleType* prefix_buffer = nullptr;
     if (is_aliased) {
-      temp_buffer_.resize(kernel_size + 1);
+      assert(temp_buffer_.size() == kernel_size + 1);
       prefix_buffer = temp_buffer_.data();
     } else {
       prefix_buffer = output_samples.data();
@@ -131,16 +175,32 @@ class FIRFilter {
 
     if (i < num_input_samples) {
       // Push the last samples to the state machine.
-      stored_samples_.push_multiple(input_samples.last(num_input_samples - i));
-
-      size_t k = num_input_samples - 1;
-      while (k >= i) {
-        assert(k >= kernel_size);
+      for (const SampleType& sample : input_samples.subspan(
+               std::max(i, num_input_samples - kernel_size))) {
+        PushSample(sample);
+      }
 
-        output_samples[k] = kernel::experimental::DotFlipG(
-            input_samples.subspan(k - kernel_size + 1, kernel_size), kernel_);
+      // Outputs starting from k are calculated.
+      size_t k = num_input_samples;
+
+      if constexpr (kCanFilterMultipleOutputs) {
+        if constexpr (Float8::kIsVectorized) {
+          k = FilterMultipleOutputs<Float8>(
+              input_samples.data(), output_samples.data(), i, k);
+        }
+        if constexpr (Float4::kIsVectorized) {
+          k = FilterMultipleOutputs<Float4>(
+              input_samples.data(), output_samples.data(), i, k);
+        }
+      }
 
+      while (k > i) {
         --k;
+
+        assert(k >= kernel_size);
+
+        output_samples[k] = FilterContinuousSamples(
+            input_samples.subspan(k - kernel_size + 1, kernel_size));
       }
 
       if (is_aliased) {
@@ -158,17 +218,192 @@ class FIRFilter {
   }
 
  private:
+  // The samples are single precision real or complex values, and the kernel is
+  // real: the samples can be seen as an array of floats, and every output
+  // element is a weighted sum of the float elements of the same kind.
+  static constexpr bool kCanFilterMultipleOutputs =
+      std::is_same_v<KernelElementType, float> &&
+      (std::is_same_v<SampleType, float> ||
+       std::is_same_v<SampleType, Complex>);
+
+  // Calculate outputs in the range [begin, end) for which all the input samples
+  // are available in the input buffer, going from the newest to the oldest.
+  //
+  // Returns the index of the oldest calculated output. The outputs in the range
+  // [begin, <returned value>) are to be calculated by the caller.
+  template <class FloatN>
+  inline auto FilterMultipleOutputs(const SampleType* input,
+                                    SampleType* output,
+                                    const size_t begin,
+                                    const size_t end) -> size_t {
+    switch (kernel_symmetry_) {
+      case KernelSymmetry::kNone:
+        return FilterMultipleOutputs<FloatN, KernelSymmetry::kNone>(
+            input, output, begin, end);
+
+      case KernelSymmetry::kSymmetric:
+        return FilterMultipleOutputs<FloatN, KernelSymmetry::kSymmetric>(
+            input, output, begin, end);
+
+      case KernelSymmetry::kAntisymmetric:
+        return FilterMultipleOutputs<FloatN, KernelSymmetry::kAntisymmetric>(
+            input, output, begin, end);
+    }
+
+    return end;
+  }
+
+  // Implementation of the FilterMultipleOutputs() for the given kernel
+  // symmetry.
+  //
+  // For the symmetric and antisymmetric kernels the mirrored input samples are
+  // pre-added (or subtracted), and only the first half of the kernel is
+  // accessed, the same way as the DotSymmetricG() and DotAntisymmetricG() do.
+  //
+  // Every iteration calculates kNumRegisters registers of the consecutive
+  // output floats, using independent accumulators to hide the latency of the
+  // multiply-add.
+  //
+  // The input and output are allowed to be the same buffer: an output only
+  // overwrites the input sample with the same index, which is not used by the
+  // older outputs.
+  //
+  // Returns the index of the oldest calculated output. The outputs in the range
+  // [begin, <returned value>) are to be calculated by the caller.
+  template <class FloatN, KernelSymmetry kSymmetry>
+  auto FilterMultipleOutputs(const SampleType* input,
+                             SampleType* output,
+                             const size_t begin,
+                             size_t end) -> size_t {
+    constexpr size_t kNumRegisters = 4;
+    constexpr size_t kNumFloatsPerSample = sizeof(SampleType) / sizeof(float);
+    constexpr size_t kNumSamplesPerRegister =
+        FloatN::kSize / kNumFloatsPerSample;
+    constexpr size_t kNumSamplesPerStep =
+        kNumSamplesPerRegister * kNumRegisters;
+
+    const size_t kernel_size = kernel_.size();
+
+    const auto* input_floats = reinterpret_cast<const float*>(input);
+    auto* output_floats = reinterpret_cast<float*>(output);
+
+    while (end - begin >= kNumSamplesPerStep) {
+      end -= kNumSamplesPerStep;
+
+      FloatN acc[kNumRegisters];
+      for (size_t r = 0; r < kNumRegisters; ++r) {
+        acc[r] = FloatN(0.0f);
+      }
+
+      // output[k] = sum(kernel[j] * input[k - j]) for j = 0 to kernel_size.
+      const float* input_ptr = input_floats + end * kNumFloatsPerSample;
+
+      if constexpr (kSymmetry == KernelSymmetry::kNone) {
+        for (size_t j = 0; j < kernel_size; ++j) {
+          const FloatN h(kernel_[j]);
+          for (size_t r = 0; r < kNumRegisters; ++r) {
+            const FloatN samples(input_ptr + r * FloatN::kSize);
+            acc[r] = MultiplyAdd(acc[r], h, samples);
+          }
+          input_ptr -= kNumFloatsPerSample;
+        }
+      } else {
+        // Input sample which is multiplied by the mirrored kernel element:
+        // input[k - (kernel_size - 1 - j)].
+        const float* mirrored_input_ptr =
+            input_ptr - (kernel_size - 1) * kNumFloatsPerSample;
+
+        const size_t half_kernel_size = kernel_size / 2;
+        for (size_t j = 0; j < half_kernel_size; ++j) {
+          const FloatN h(kernel_[j]);
+          for (size_t r = 0; r < kNumRegisters; ++r) {
+            const FloatN samples(input_ptr + r * FloatN::kSize);
+            const FloatN mirrored_samples(mirrored_input_ptr +
+                                          r * FloatN::kSize);
+            if constexpr (kSymmetry == KernelSymmetry::kSymmetric) {
+              acc[r] = MultiplyAdd(acc[r], h, samples + mirrored_samples);
+            } else {
+              acc[r] = MultiplyAdd(acc[r], h, samples - mirrored_samples);
+            }
+          }
+          input_ptr -= kNumFloatsPerSample;
+          mirrored_input_ptr += kNumFloatsPerSample;
+        }
+
+        // The central element of an antisymmetric kernel of an odd size is
+        // zero.
+        if constexpr (kSymmetry == KernelSymmetry::kSymmetric) {
+          if (kernel_size & 1) {
+            const FloatN h(kernel_[half_kernel_size]);
+            for (size_t r = 0; r < kNumRegisters; ++r) {
+              const FloatN samples(input_ptr + r * FloatN::kSize);
+              acc[r] = MultiplyAdd(acc[r], h, samples);
+            }
+          }
+        }
+      }
+
+      float* output_ptr = output_floats + end * kNumFloatsPerSample;
+      for (size_t r = 0; r < kNumRegisters; ++r) {
+        acc[r].Store(output_ptr + r * FloatN::kSize);
+      }
+    }
+
+    return end;
+  }
+
+  // Push new sample to the storage of the last kernel_.size() samples.
+  inline void PushSample(const SampleType sample) {
+    const size_t kernel_size = kernel_.size();
+    assert(kernel_size != 0);
+
+    if (stored_samples_index_ == 0) {
+      stored_samples_index_ = kernel_size;
+    }
+    --stored_samples_index_;
+
+    stored_samples_[stored_samples_index_] = sample;
+    stored_samples_[stored_samples_index_ + kernel_size] = sample;
+  }
+
+  // Apply the kernel to the continuous span of samples ordered from the oldest
+  // to the newest.
+  inline auto FilterContinuousSamples(const std::span<const SampleType> samples)
+      -> SampleType {
+    switch (kernel_symmetry_) {
+      case KernelSymmetry::kNone:
+        return kernel::experimental::DotFlipG(samples, kernel_);
+
+      // Flipping of a symmetric kernel is a no-op.
+      case KernelSymmetry::kSymmetric:
+        return kernel::experimental::DotSymmetricG(samples, kernel_);
+
+      // Flipping of an antisymmetric kernel negates it.
+      case KernelSymmetry::kAntisymmetric:
+        return -kernel::experimental::DotAntisymmetricG(samples, kernel_);
+    }
+
+    return SampleType(0);
+  }
+
   std::span<const KernelElementType> kernel_;
 
+  KernelSymmetry kernel_symmetry_ = KernelSymmetry::kNone;
+
   // Buffer to store temporary result to avoid conflict caused by the input
   // and output aliasing.
   // This buffer is used when processing a large number of input samples when
   // it is possible to filter samples without copying all of them to the ring
   // buffer.
-  std::vector<SampleType> temp_buffer_;
+  std::vector<SampleType, Allocator<SampleType>> temp_buffer_;
 
-  // THe last kernel_.size() number of samples.
-  ReverseStorageRingBuffer<SampleType, Allocator<SampleType>> stored_samples_;
+  // The last kernel_.size() number of samples, stored twice.
+  //
+  // The newest sample is stored at the stored_samples_index_, and the last
+  // kernel_.size() samples starting from it are ordered from the newest to the
+  // oldest.
+  std::vector<SampleType, Allocator<SampleType>> stored_samples_;
+  size_t stored_samples_index_ = 0;
 };
 
 }  // namespace radio_core::signal
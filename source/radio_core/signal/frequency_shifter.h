@@ -18,11 +18,17 @@ namespace radio_core::signal {
 
 template <class T>
 class FrequencyShifter {
+  // The phase is tracked in the ComputeType: the rounding error of the half
+  // precision phase increment is big enough to noticeably offset the frequency
+  // of the shifted signal.
+  using RealType = ComputeType<T>;
+
  public:
   FrequencyShifter() = default;
 
   // The frequency is provided in Hz.
-  FrequencyShifter(const T frequency_shift, const T sample_rate) {
+  FrequencyShifter(const RealType frequency_shift,
+                   const RealType sample_rate) {
     Configure(frequency_shift, sample_rate);
   }
 
@@ -32,23 +38,29 @@ class FrequencyShifter {
   // If the input frequency is oscillating at frequency 100 Hz and the frequency
   // shift is 400 Hz then the output is an oscillating signal a frequency of
   // 500 Hz.
-  void Configure(const T frequency_shift, const T sample_rate) {
-    const T normalized_frequency_shift =
+  //
+  // The frequency and the sample rate are provided in the ComputeType, so that
+  // the shifter of the half precision samples can be configured for the sample
+  // rates which are outside of the half precision range.
+  void Configure(const RealType frequency_shift, const RealType sample_rate) {
+    const RealType normalized_frequency_shift =
         NormalizedAngularFrequency(frequency_shift, sample_rate);
 
-    phase_increment_per_sample_ = BaseComplex<T>(
+    phase_increment_per_sample_ = BaseComplex<RealType>(
         Cos(normalized_frequency_shift), Sin(normalized_frequency_shift));
   }
 
   // Shift frequency of a single sample.
   auto operator()(BaseComplex<T> sample) -> BaseComplex<T> {
-    const BaseComplex<T> shifted = sample * phase_;
+    const BaseComplex<RealType> shifted =
+        BaseComplex<RealType>(RealType(sample.real), RealType(sample.imag)) *
+        phase_;
     phase_ *= phase_increment_per_sample_;
 
     // TODO(sergey): Only do it every N samples.
     phase_ /= Abs(phase_);
 
-    return shifted;
+    return BaseComplex<T>(T(shifted.real), T(shifted.imag));
   }
 
   // Shift frequency of input samples.
@@ -74,10 +86,10 @@ class FrequencyShifter {
 
  private:
   // Current phase by which the input signal is rotated.
-  BaseComplex<T> phase_{1, 0};
+  BaseComplex<RealType> phase_{1, 0};
 
   // How much the phase is incremented per sample of the input signal.
-  BaseComplex<T> phase_increment_per_sample_{1, 0};
+  BaseComplex<RealType> phase_increment_per_sample_{1, 0};
 };
 
 }  // namespace radio_core::signal
@@ -15,15 +15,20 @@
 //    generator.pushSample(FrequencyDuration(1900, 300.0f));
 //    generator.pushSample(FrequencyDuration(1200, 10.0f));
 //    generator.pushSample(FrequencyDuration(1900, 300.0f));
+//
+// The phase is accumulated and the sine is calculated the same way as in the
+// NumericallyControlledOscillator, so that the frequency of the generated
+// signal does not drift over long transmissions.
 
 #pragma once
 
 #include <cassert>
+#include <cstdint>
 #include <functional>
 
-#include "radio_core/base/constants.h"
 #include "radio_core/base/frequency_duration.h"
 #include "radio_core/math/math.h"
+#include "radio_core/signal/numerically_controlled_oscillator.h"
 
 namespace radio_core::signal {
 
@@ -52,8 +57,6 @@ class Generator {
   void operator()(const FrequencyDuration<RealType>& frequency_duration,
                   F&& callback,
                   Args&&... args) {
-    constexpr RealType kPi = constants::pi_v<RealType>;
-
     assert(sample_rate_inv_ > 0);
     assert(frequency_duration.frequency >= 0);
     assert(frequency_duration.duration_ms >= 0);
@@ -62,8 +65,8 @@ class Generator {
     const RealType amplitude_sample_duration_in_ms = 1000 * sample_rate_inv_;
 
     // Advance of the phase per one amplitude sample.
-    const RealType phase_advance_per_sample =
-        2 * kPi * RealType(frequency_duration.frequency) * sample_rate_inv_;
+    const uint32_t phase_advance_per_sample = nco_internal::PhaseIncrement(
+        RealType(frequency_duration.frequency), sample_rate_);
 
     // For the very first frequency sample shift last phase back, so that the
     // next point after it lands at phase of 0.
@@ -72,7 +75,7 @@ class Generator {
       has_phase_ = true;
     }
 
-    RealType last_phase = prev_phase_;
+    uint32_t last_phase = prev_phase_;
     for (size_t index = 0;; ++index) {
       // Time within the frequency sample.
       const RealType time_ms =
@@ -85,12 +88,11 @@ class Generator {
         break;
       }
 
-      RealType phase = prev_phase_ + (index + 1) * phase_advance_per_sample;
+      // The phase wraps naturally on the integer overflow.
+      const uint32_t phase =
+          prev_phase_ + uint32_t(index + 1) * phase_advance_per_sample;
 
-      // Wrap the phase, to keep it small, avoiding possible numeric issues.
-      phase = Modulo(phase, 2 * kPi);
-
-      const RealType amplitude_sample = Sin(phase);
+      const RealType amplitude_sample = nco_internal::TableSine(table_, phase);
       last_phase = phase;
 
       std::invoke(std::forward<F>(callback),
@@ -122,14 +124,13 @@ class Generator {
   //   callback(RealType sample, <optional arguments>)
   template <class F, class... Args>
   void FadeToZero(F&& callback, Args&&... args) {
-    constexpr RealType kPi = constants::pi_v<RealType>;
-
     assert(sample_rate_inv_ > 0);
 
-    const RealType phase_advance_per_sample =
-        2 * kPi * previous_frequency_ * sample_rate_inv_;
+    const uint32_t phase_advance_per_sample =
+        nco_internal::PhaseIncrement(previous_frequency_, sample_rate_);
 
-    RealType last_amplitude_sample = Sin(prev_phase_);
+    RealType last_amplitude_sample =
+        nco_internal::TableSine(table_, prev_phase_);
 
     // Check whether output already stopped at the zero value.
     if (Abs(last_amplitude_sample) < RealType(1e-6)) {
@@ -137,12 +138,10 @@ class Generator {
     }
 
     for (size_t index = 1; index <= sample_rate_; ++index) {
-      RealType phase = prev_phase_ + (index + 1) * phase_advance_per_sample;
+      const uint32_t phase =
+          prev_phase_ + uint32_t(index + 1) * phase_advance_per_sample;
 
-      // Wrap the phase, to keep it small, avoiding possible numeric issues.
-      phase = Modulo(phase, 2 * kPi);
-
-      const RealType amplitude_sample = Sin(phase);
+      const RealType amplitude_sample = nco_internal::TableSine(table_, phase);
 
       if (index && last_amplitude_sample * amplitude_sample < 0.0f) {
         std::invoke(std::forward<F>(callback),
@@ -176,11 +175,17 @@ class Generator {
   // sample in seconds.
   RealType sample_rate_inv_{0};
 
+  // Sine table of the numerically controlled oscillator.
+  const RealType* table_{nco_internal::GetSineTable<RealType>().data()};
+
   // Phase at which the previous `pushSample()` left the signal.
   //
   // This phase will be used by a consecutive call to `pushSample()` in order
   // to keep signal as continuous as possible (without doing filtering).
-  RealType prev_phase_{0};
+  //
+  // Measured in the units of 2^-32 of the full turn, as the phase of the
+  // numerically controlled oscillator.
+  uint32_t prev_phase_{0};
 
   // Indicates whether the previous phase is known.
   // It is unknown for until after first call of `pushSample()`. Can not rely
@@ -0,0 +1,230 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Filter and downsample signal by a factor of 2 using half-band filter.
+//
+// Every other coefficient of a half-band filter is zero, except of the central
+// one. The decimator uses polyphase decomposition of the filter which allows
+// to skip multiplication by those zero coefficients:
+//
+//   - The odd input samples are convolved with the non-zero side coefficients
+//     of the filter. These samples are stored continuously, which allows to
+//     use the vectorized dot product.
+//
+//   - The even input samples are only multiplied by the central coefficient.
+//
+// This gives roughly 4x less multiplications per input sample compared to the
+// regular decimator with the same kernel size.
+//
+// The filter is expected to be designed by DesignHalfBandFilter().
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "radio_core/base/container.h"
+#include "radio_core/base/verify.h"
+#include "radio_core/math/kernel/dot.h"
+
+namespace radio_core::signal {
+
+template <class SampleType,
+          class KernelElementType = SampleType,
+          template <class> class Allocator = std::allocator>
+class HalfBandDecimator {
+  template <class T>
+  using Vector = std::vector<T, Allocator<T>>;
+
+ public:
+  // Default constructor.
+  //
+  // Leaves object uninitialized. When this path is used an explicit call to
+  // `SetKernel()` is expected before performing downsampling, otherwise the
+  // object will have an undefined behavior.
+  HalfBandDecimator() = default;
+
+  explicit HalfBandDecimator(const std::span<const KernelElementType> kernel) {
+    SetKernel(kernel);
+  }
+
+  // Set the half-band filter kernel.
+  //
+  // The kernel must have 4*k + 3 taps, and it is assumed that all its
+  // coefficients with a non-zero even offset from the center are zero.
+  //
+  // The non-zero coefficients are copied into the decimator, so that the
+  // caller can dispose kernel from its side.
+  //
+  // NOTE: The current samples storage is reset to zeroes.
+  void SetKernel(const std::span<const KernelElementType> kernel) {
+    Verify(kernel.size() % 4 == 3, "Half-band filter must have 4*k + 3 taps");
+
+    const size_t num_side_taps = (kernel.size() + 1) / 2;
+
+    // Store the coefficients in the reverse order, so that the dot product can
+    // be applied on the odd samples stored in the chronological order.
+    side_taps_.resize(num_side_taps);
+    for (size_t i = 0; i < num_side_taps; ++i) {
+      side_taps_[num_side_taps - i - 1] = kernel[i * 2];
+    }
+
+    center_tap_ = kernel[kernel.size() / 2];
+
+    kernel_size_ = kernel.size();
+
+    num_odd_history_samples_ = num_side_taps - 1;
+    num_even_history_samples_ = (kernel.size() - 3) / 4;
+
+    odd_samples_.resize(num_odd_history_samples_);
+    even_samples_.resize(num_even_history_samples_);
+    std::fill(odd_samples_.begin(), odd_samples_.end(), SampleType(0));
+    std::fill(even_samples_.begin(), even_samples_.end(), SampleType(0));
+
+    has_pending_sample_ = false;
+  }
+
+  // Get the size of the full kernel, including the zero coefficients.
+  inline auto GetKernelSize() const -> size_t { return kernel_size_; }
+
+  // Get the number of multiplications needed to calculate one output sample.
+  inline auto GetNumMultiplicationsPerOutput() const -> size_t {
+    return side_taps_.size() + 1;
+  }
+
+  inline auto GetRatio() const -> int { return 2; }
+
+  // Downsample multiple input samples.
+  //
+  // The output buffer must have enough elements to hold result of the
+  // downsampled samples. Use the `CalcNeededOutputBufferSize()` to calculate
+  // the needed buffer size.
+  //
+  // The input and output buffers might be the same.
+  //
+  // Returns a subspan of the output samples buffer which was written by this
+  // call.
+  auto operator()(const std::span<const SampleType> input_samples,
+                  const std::span<SampleType> output_samples)
+      -> std::span<SampleType> {
+    assert(kernel_size_ != 0);
+
+    const size_t num_input_samples = input_samples.size();
+    const size_t num_output_samples =
+        (num_input_samples + (has_pending_sample_ ? 1 : 0)) / 2;
+
+    assert(num_output_samples <= output_samples.size());
+
+    EnsureSizeAtLeast(odd_samples_,
+                      num_odd_history_samples_ + num_output_samples);
+    EnsureSizeAtLeast(even_samples_,
+                      num_even_history_samples_ + num_output_samples);
+
+    // Split the input samples into polyphase components.
+    //
+    // This is done prior to writing anything to the output, which makes it
+    // possible for the input and output buffers to alias.
+    SampleType* odd = odd_samples_.data() + num_odd_history_samples_;
+    SampleType* even = even_samples_.data() + num_even_history_samples_;
+    size_t i = 0;
+    if (has_pending_sample_ && num_input_samples != 0) {
+      *even++ = pending_sample_;
+      *odd++ = input_samples[0];
+      has_pending_sample_ = false;
+      i = 1;
+    }
+    for (; i + 1 < num_input_samples; i += 2) {
+      *even++ = input_samples[i];
+      *odd++ = input_samples[i + 1];
+    }
+    if (i < num_input_samples) {
+      pending_sample_ = input_samples[i];
+      has_pending_sample_ = true;
+    }
+
+    const std::span<const KernelElementType> side_taps(side_taps_);
+    const size_t num_side_taps = side_taps.size();
+    const std::span<const SampleType> odd_samples(odd_samples_);
+
+    for (size_t j = 0; j < num_output_samples; ++j) {
+      output_samples[j] =
+          kernel::Dot<SampleType, KernelElementType>(
+              odd_samples.subspan(j, num_side_taps), side_taps) +
+          even_samples_[j] * center_tap_;
+    }
+
+    // Keep the history needed for the next call.
+    std::copy(odd_samples_.begin() + num_output_samples,
+              odd_samples_.begin() + num_output_samples +
+                  num_odd_history_samples_,
+              odd_samples_.begin());
+    std::copy(even_samples_.begin() + num_output_samples,
+              even_samples_.begin() + num_output_samples +
+                  num_even_history_samples_,
+              even_samples_.begin());
+
+    return output_samples.subspan(0, num_output_samples);
+  }
+
+  inline auto operator()(const std::span<SampleType> samples)
+      -> std::span<SampleType> {
+    return (*this)(samples, samples);
+  }
+
+  // Calculate required output buffer size for the given number of input
+  // samples.
+  //
+  // The calculation gives the worst case scenario, which means that the output
+  // buffer size can only be calculated once if the downsampling happens for a
+  // fixed input buffer size.
+  inline auto CalcNeededOutputBufferSize(const size_t num_input_samples) const
+      -> size_t {
+    return (num_input_samples + 1) / 2;
+  }
+
+  // Pre-allocate work buffers for downsampling up to the given number of input
+  // samples at a time.
+  //
+  // Downsampling of input buffers which are not bigger than the reserved size
+  // does not allocate memory.
+  //
+  // The reservation is to be done after the kernel is set.
+  void Reserve(const size_t max_num_input_samples) {
+    const size_t num_output_samples =
+        CalcNeededOutputBufferSize(max_num_input_samples);
+
+    EnsureSizeAtLeast(odd_samples_,
+                      num_odd_history_samples_ + num_output_samples);
+    EnsureSizeAtLeast(even_samples_,
+                      num_even_history_samples_ + num_output_samples);
+  }
+
+ private:
+  // Size of the full half-band kernel.
+  size_t kernel_size_{0};
+
+  // Non-zero coefficients of the kernel, except of the central one, stored in
+  // the reverse order.
+  Vector<KernelElementType> side_taps_;
+  KernelElementType center_tap_{0};
+
+  // Polyphase components of the input signal.
+  //
+  // The buffers start with the history samples needed to calculate the first
+  // output sample, followed by the samples of the current input buffer.
+  size_t num_odd_history_samples_{0};
+  size_t num_even_history_samples_{0};
+  Vector<SampleType> odd_samples_;
+  Vector<SampleType> even_samples_;
+
+  // An even sample which did not yet have its odd pair at the end of the
+  // previous input buffer.
+  bool has_pending_sample_{false};
+  SampleType pending_sample_{0};
+};
+
+}  // namespace radio_core::signal
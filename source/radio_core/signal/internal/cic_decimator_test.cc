@@ -0,0 +1,94 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal/cic_decimator.h"
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include "radio_core/signal/filter_gain.h"
+#include "radio_core/signal/window.h"
+#include "radio_core/unittest/mock.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal {
+
+using testing::FloatNear;
+using testing::Pointwise;
+
+TEST(CICDecimator, DesignCICFilter) {
+  EXPECT_EQ(CICFilterSize(3, 2), 5);
+
+  // (1 + z^-1 + z^-2)^2 = 1 + 2z^-1 + 3z^-2 + 2z^-3 + z^-4
+  std::array<float, 5> kernel;
+  DesignCICFilter<float>(kernel, 3, 2);
+  EXPECT_THAT(kernel,
+              Pointwise(FloatNear(1e-6f),
+                        std::to_array({1.0f / 9.0f,
+                                       2.0f / 9.0f,
+                                       3.0f / 9.0f,
+                                       2.0f / 9.0f,
+                                       1.0f / 9.0f})));
+}
+
+TEST(CICDecimator, CalculateCICGain) {
+  EXPECT_NEAR(CalculateCICGain<float>(5, 4, 0.0f), 1.0f, 1e-6f);
+
+  // The response has zeros at the multiples of the output sample rate.
+  EXPECT_NEAR(CalculateCICGain<float>(5, 4, 1.0f), 0.0f, 1e-6f);
+  EXPECT_NEAR(CalculateCICGain<float>(5, 4, 2.0f), 0.0f, 1e-6f);
+
+  // The response matches the response of the FIR form of the filter.
+  std::vector<float> kernel(CICFilterSize(5, 3));
+  DesignCICFilter<float>(kernel, 5, 3);
+  EXPECT_NEAR(CalculateCICGain<float>(5, 3, 0.3f),
+              Abs(CalculateFilterGain<float>(kernel, 0.3f / 5)),
+              1e-5f);
+}
+
+TEST(CICDecimator, CompensationFilter) {
+  constexpr int kRatio = 8;
+  constexpr int kOrder = 4;
+  constexpr float kCutoff = 0.2f;
+
+  std::array<float, 21> kernel;
+  DesignCICCompensationFilter<float>(kernel,
+                                     WindowEquation<float, Window::kHamming>(),
+                                     kRatio,
+                                     kOrder,
+                                     kCutoff);
+
+  // The droop of the CIC filter is compensated in the passband, which ends
+  // about half of the transition band prior to the cutoff frequency.
+  for (float f = 0; f < kCutoff * 0.5f; f += 0.01f) {
+    const float cic_gain = CalculateCICGain(kRatio, kOrder, f);
+    const float compensation_gain = CalculateFilterGain<float>(kernel, f);
+    EXPECT_NEAR(cic_gain * compensation_gain, 1.0f, 0.02f) << "at " << f;
+  }
+}
+
+TEST(CICDecimator, Basic) {
+  CICDecimator<float> decimator({
+      .ratio = 5,
+      .order = 3,
+      .compensation_cutoff = 0.2f,
+  });
+  EXPECT_EQ(decimator.GetRatio(), 5);
+
+  // Constant input signal is expected to be passed through with the unity
+  // gain once the filter is stabilized.
+  std::vector<float> samples(500, 1.0f);
+  const std::span<float> output = decimator(samples);
+  ASSERT_EQ(output.size(), 100);
+  EXPECT_NEAR(output.back(), 1.0f, 1e-5f);
+}
+
+TEST(CICDecimator, CalcNeededOutputBufferSize) {
+  CICDecimator<float> decimator({.ratio = 10});
+  EXPECT_EQ(decimator.CalcNeededOutputBufferSize(20), 2);
+  EXPECT_EQ(decimator.CalcNeededOutputBufferSize(21), 3);
+}
+
+}  // namespace radio_core::signal
@@ -4,6 +4,7 @@
 
 #include "radio_core/signal/decimator.h"
 
+#include <algorithm>
 #include <array>
 #include <span>
 
@@ -51,6 +52,37 @@ TEST(Decimator, Basic) {
   }
 }
 
+TEST(Decimator, BlocksShorterThanRatio) {
+  constexpr int kNumSamples = 1000;
+
+  std::array<float, kNumSamples> samples;
+  for (int i = 0; i < kNumSamples; ++i) {
+    samples[i] = float(i % 7);
+  }
+
+  Decimator<float> reference_decimator(5);
+  std::array<float, kNumSamples> expected;
+  const std::span<float> expected_decimated =
+      reference_decimator(samples, expected);
+  ASSERT_EQ(expected_decimated.size(), kNumSamples / 5);
+
+  // Push the samples in blocks which are shorter than the decimation ratio.
+  Decimator<float> decimator(5);
+  std::array<float, kNumSamples> actual;
+  size_t num_decimated = 0;
+  for (int i = 0; i < kNumSamples; i += 3) {
+    const std::span<const float> block =
+        std::span(samples).subspan(i, std::min(3, kNumSamples - i));
+    num_decimated +=
+        decimator(block, std::span(actual).subspan(num_decimated)).size();
+  }
+
+  ASSERT_EQ(num_decimated, expected_decimated.size());
+  for (size_t i = 0; i < num_decimated; ++i) {
+    EXPECT_NEAR(actual[i], expected[i], 1e-6f) << "i=" << i;
+  }
+}
+
 TEST(Decimator, CalcNeededOutputBufferSize) {
   Decimator<float> decimator(10);
   EXPECT_EQ(decimator.CalcNeededOutputBufferSize(20), 2);
@@ -0,0 +1,122 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Benchmark of the FIR filter using the direct form and the fast convolution.
+//
+// Run the benchmark for different kernel sizes to find the crossover point at
+// which the fast convolution becomes faster than the direct form:
+//
+//   for size in 16 32 48 64 96 128 256 512; do
+//     ./radio_core_signal_fast_fir_filter_benchmark direct --kernel-size $size
+//     ./radio_core_signal_fast_fir_filter_benchmark fast --kernel-size $size
+//   done
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "radio_core/benchmark/base_app.h"
+#include "radio_core/math/fft_api_pffft.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal/fast_fir_filter.h"
+
+namespace radio_core::benchmark {
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+class FastFIRFilterBenchmark : public Benchmark {
+ public:
+  using Benchmark::Benchmark;
+
+ protected:
+  auto GetBenchmarkName() -> std::string override { return "FastFIRFilter"; }
+
+  void ConfigureParser(argparse::ArgumentParser& parser) override {
+    parser.add_argument("implementation")
+        .help("Implementation of the convolution: direct, fast, auto");
+
+    parser.add_argument("--kernel-size")
+        .default_value(128)
+        .help("Number of taps of the filter kernel")
+        .scan<'i', int>();
+  }
+
+  auto HandleArguments(argparse::ArgumentParser& parser) -> bool override {
+    implementation_ = parser.get<std::string>("implementation");
+    if (implementation_ != "direct" && implementation_ != "fast" &&
+        implementation_ != "auto") {
+      cerr << "Unknown implementation " << implementation_ << endl;
+      cerr << "Supported: direct, fast, auto" << endl;
+      return false;
+    }
+
+    kernel_size_ = parser.get<int>("--kernel-size");
+    if (kernel_size_ <= 0) {
+      cerr << "Invalid kernel size" << endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  void Initialize() override {
+    std::random_device random_device;
+    std::mt19937 random_engine(random_device());
+    std::uniform_real_distribution<float> distribution(-1, 1);
+
+    kernel_.resize(kernel_size_);
+    for (float& coefficient : kernel_) {
+      coefficient = distribution(random_engine) / float(kernel_size_);
+    }
+
+    samples_.resize(16384);
+    for (float& sample : samples_) {
+      sample = distribution(random_engine);
+    }
+
+    if (implementation_ == "direct") {
+      filter_.SetFastConvolutionKernelSize(size_t(kernel_size_) + 1);
+    } else if (implementation_ == "fast") {
+      filter_.SetFastConvolutionKernelSize(2);
+    }
+    filter_.SetKernel(kernel_);
+
+    cout << endl;
+    cout << "Configuration" << endl;
+    cout << "=============" << endl;
+
+    cout << "Implementation       : "
+         << (filter_.IsFastConvolution() ? "fast" : "direct") << endl;
+    cout << "Kernel size          : " << kernel_size_ << endl;
+    cout << "Number of samples    : " << samples_.size() << endl;
+    cout << "Number of iterations : " << GetNumIterations() << endl;
+  }
+
+  void Iteration() override { filter_(samples_); }
+
+  void Finalize() override {
+    // Sanity check and endurance that the evaluation is not optimized out.
+    if (!IsFinite(samples_[0])) {
+      std::cerr << "Result has non-finite values" << std::endl;
+      ::exit(1);
+    }
+  }
+
+ private:
+  std::string implementation_;
+  int kernel_size_{0};
+
+  signal::FastFIRFilter<float, float, fft::PFFFT<float>> filter_;
+  std::vector<float> kernel_;
+  std::vector<float> samples_;
+};
+
+}  // namespace radio_core::benchmark
+
+auto main(int argc, char** argv) -> int {
+  radio_core::benchmark::FastFIRFilterBenchmark app;
+  return app.Run(argc, argv);
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal/fast_fir_filter.h"
+
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "radio_core/base/algorithm.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/fft_api_pffft.h"
+#include "radio_core/math/unittest/complex_matchers.h"
+#include "radio_core/signal/fir_filter.h"
+#include "radio_core/unittest/mock.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal {
+
+using testing::ComplexNear;
+using testing::FloatNear;
+using testing::Pointwise;
+
+namespace {
+
+auto GenerateRandomKernel(const size_t size) -> std::vector<float> {
+  std::mt19937 random_engine(size);
+  std::uniform_real_distribution<float> distribution(-1, 1);
+
+  std::vector<float> kernel(size);
+  for (float& coefficient : kernel) {
+    coefficient = distribution(random_engine) / float(size);
+  }
+  return kernel;
+}
+
+template <class SampleType>
+auto GenerateRandomSamples(const size_t size) -> std::vector<SampleType> {
+  std::mt19937 random_engine(size);
+  std::uniform_real_distribution<float> distribution(-1, 1);
+
+  std::vector<SampleType> samples(size);
+  for (SampleType& sample : samples) {
+    if constexpr (std::is_same_v<SampleType, float>) {
+      sample = distribution(random_engine);
+    } else {
+      sample = SampleType(distribution(random_engine),
+                          distribution(random_engine));
+    }
+  }
+  return samples;
+}
+
+// Filter the samples using the direct form, and using the fast filter which
+// receives the samples in blocks of various sizes, and return both results.
+template <class SampleType, class FFTType>
+void FilterDirectAndFast(const size_t kernel_size,
+                         std::vector<SampleType>& direct_samples,
+                         std::vector<SampleType>& fast_samples) {
+  constexpr size_t kNumSamples = 20000;
+
+  const std::vector<float> kernel = GenerateRandomKernel(kernel_size);
+  const std::vector<SampleType> input_samples =
+      GenerateRandomSamples<SampleType>(kNumSamples);
+
+  FIRFilter<SampleType, float> direct_filter(kernel);
+  direct_samples.resize(kNumSamples);
+  direct_filter(input_samples, direct_samples);
+
+  FastFIRFilter<SampleType, float, FFTType> fast_filter(kernel);
+  EXPECT_TRUE(fast_filter.IsFastConvolution());
+
+  // In-place processing, with blocks which are both smaller and bigger than
+  // the FFT block size.
+  fast_samples = input_samples;
+  size_t offset = 0;
+  for (size_t block_size = 7; offset < kNumSamples; block_size *= 3) {
+    const size_t num_samples = Min(block_size, kNumSamples - offset);
+    fast_filter(std::span(fast_samples).subspan(offset, num_samples));
+    offset += num_samples;
+  }
+}
+
+}  // namespace
+
+TEST(FastFIRFilter, Direct) {
+  const std::vector<float> kernel = GenerateRandomKernel(5);
+
+  FastFIRFilter<float, float, fft::PFFFT<float>> filter(kernel);
+  EXPECT_FALSE(filter.IsFastConvolution());
+
+  std::vector<float> samples = {0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+  filter(samples);
+
+  EXPECT_THAT(samples,
+              Pointwise(FloatNear(1e-6f),
+                        std::to_array<float>({0.0f,
+                                              0.0f,
+                                              kernel[0],
+                                              kernel[1],
+                                              kernel[2],
+                                              kernel[3],
+                                              kernel[4]})));
+}
+
+TEST(FastFIRFilter, Real) {
+  for (const size_t kernel_size : {64, 127, 500}) {
+    std::vector<float> direct_samples, fast_samples;
+    FilterDirectAndFast<float, fft::PFFFT<float>>(
+        kernel_size, direct_samples, fast_samples);
+    EXPECT_THAT(fast_samples, Pointwise(FloatNear(1e-5f), direct_samples));
+  }
+}
+
+TEST(FastFIRFilter, Complex) {
+  for (const size_t kernel_size : {64, 127, 500}) {
+    std::vector<Complex> direct_samples, fast_samples;
+    FilterDirectAndFast<Complex, fft::PFFFT<Complex>>(
+        kernel_size, direct_samples, fast_samples);
+    EXPECT_THAT(fast_samples, Pointwise(ComplexNear(1e-5f), direct_samples));
+  }
+}
+
+}  // namespace radio_core::signal
@@ -65,6 +65,37 @@ TEST(FilterDesign, BandPass) {
                 })));
 }
 
+TEST(FilterDesign, HalfBand) {
+  std::array<float, 11> actual_kernel;
+  DesignHalfBandFilter<float>(actual_kernel,
+                              WindowEquation<float, Window::kBoxcar>());
+
+  // The expected kernel is generated with:
+  //   h = scipy.signal.firwin(11, 0.25, window="boxcar", fs=1, pass_zero=True)
+  //
+  // with the h[1::2] coefficients except of the central one set to 0.
+
+  EXPECT_THAT(actual_kernel,
+              Pointwise(FloatNear(1e-6f),
+                        std::to_array({0.06053031f,
+                                       0.0f,
+                                       -0.10088385f,
+                                       0.0f,
+                                       0.30265156f,
+                                       0.47540396f,
+                                       0.30265156f,
+                                       0.0f,
+                                       -0.10088385f,
+                                       0.0f,
+                                       0.06053031f})));
+
+  // Exactly zero coefficients.
+  EXPECT_EQ(actual_kernel[1], 0.0f);
+  EXPECT_EQ(actual_kernel[3], 0.0f);
+  EXPECT_EQ(actual_kernel[7], 0.0f);
+  EXPECT_EQ(actual_kernel[9], 0.0f);
+}
+
 TEST(FilterDesign, FractionalDelay) {
   std::array<float, 31> actual_kernel;
   DesignFractionalDelayFilter<float>(
@@ -5,12 +5,16 @@
 #include "radio_core/signal/fir_filter.h"
 
 #include <array>
+#include <vector>
 
+#include "radio_core/math/complex.h"
+#include "radio_core/math/unittest/complex_matchers.h"
 #include "radio_core/unittest/mock.h"
 #include "radio_core/unittest/test.h"
 
 namespace radio_core::signal {
 
+using testing::ComplexNear;
 using testing::FloatNear;
 using testing::Pointwise;
 
@@ -71,4 +75,160 @@ TEST(FIRFilter, ImpulseResponse_Block) {
   EXPECT_NEAR(filter(0.0f), 0.0f, 1e-6f);
 }
 
+// Filter the same input with and without the kernel symmetry information, using
+// both single sample and block processing, and compare the result.
+static void TestKernelSymmetry(const std::span<const float> kernel,
+                               const KernelSymmetry expected_symmetry) {
+  std::vector<float> input_samples(kernel.size() * 9 + 3);
+  for (size_t i = 0; i < input_samples.size(); ++i) {
+    input_samples[i] = float(int(i * 7 % 11) - 5) / 5;
+  }
+
+  FIRFilter<float, float> reference_filter(kernel);
+  EXPECT_EQ(reference_filter.GetKernelSymmetry(), KernelSymmetry::kNone);
+
+  std::vector<float> expected_samples(input_samples.size());
+  for (size_t i = 0; i < input_samples.size(); ++i) {
+    expected_samples[i] = reference_filter(input_samples[i]);
+  }
+
+  FIRFilter<float, float> filter(kernel);
+  filter.UpdateKernelSymmetry();
+  EXPECT_EQ(filter.GetKernelSymmetry(), expected_symmetry);
+
+  // Single sample.
+  {
+    std::vector<float> output_samples(input_samples.size());
+    for (size_t i = 0; i < input_samples.size(); ++i) {
+      output_samples[i] = filter(input_samples[i]);
+    }
+    EXPECT_THAT(output_samples, Pointwise(FloatNear(1e-6f), expected_samples));
+  }
+
+  // Block, followed by single samples to verify the state of the filter.
+  {
+    filter.SetKernel(kernel);
+    filter.SetKernelSymmetry(expected_symmetry);
+
+    const size_t num_block_samples = input_samples.size() - 3;
+
+    std::vector<float> output_samples(input_samples.size());
+    filter(std::span<const float>(input_samples).first(num_block_samples),
+           output_samples);
+    for (size_t i = num_block_samples; i < input_samples.size(); ++i) {
+      output_samples[i] = filter(input_samples[i]);
+    }
+    EXPECT_THAT(output_samples, Pointwise(FloatNear(1e-6f), expected_samples));
+  }
+}
+
+TEST(FIRFilter, KernelSymmetry) {
+  TestKernelSymmetry(std::to_array<float>({0.1f, 0.2f, 0.3f, 0.2f, 0.1f}),
+                     KernelSymmetry::kSymmetric);
+  TestKernelSymmetry(
+      std::to_array<float>({0.1f, 0.2f, 0.3f, 0.4f, 0.4f, 0.3f, 0.2f, 0.1f}),
+      KernelSymmetry::kSymmetric);
+
+  TestKernelSymmetry(std::to_array<float>({0.1f, 0.2f, 0.0f, -0.2f, -0.1f}),
+                     KernelSymmetry::kAntisymmetric);
+  TestKernelSymmetry(std::to_array<float>(
+                         {0.1f, 0.2f, 0.3f, 0.4f, -0.4f, -0.3f, -0.2f, -0.1f}),
+                     KernelSymmetry::kAntisymmetric);
+
+  TestKernelSymmetry(std::to_array<float>({0.1f, 0.2f, 0.3f, 0.25f, 0.15f}),
+                     KernelSymmetry::kNone);
+}
+
+namespace {
+
+// Filter a large number of samples in blocks of different sizes, which covers
+// the evaluation of multiple outputs at once and the remainder of the block,
+// and compare the result with the single sample processing.
+//
+// The filters use the kernel symmetry detected from the kernel, and the
+// reference filter ignores the symmetry.
+template <size_t N>
+void CheckLargeBlocks(const std::array<float, N>& kernel) {
+  std::vector<float> input_samples(2000);
+  std::vector<Complex> complex_input_samples(input_samples.size());
+  for (size_t i = 0; i < input_samples.size(); ++i) {
+    input_samples[i] = float(int(i * 7 % 11) - 5) / 5;
+    complex_input_samples[i] =
+        Complex(input_samples[i], float(int(i * 5 % 13) - 6) / 6);
+  }
+
+  FIRFilter<float, float> reference_filter(kernel);
+  FIRFilter<Complex, float> complex_reference_filter(kernel);
+
+  std::vector<float> expected_samples(input_samples.size());
+  std::vector<Complex> complex_expected_samples(input_samples.size());
+  for (size_t i = 0; i < input_samples.size(); ++i) {
+    expected_samples[i] = reference_filter(input_samples[i]);
+    complex_expected_samples[i] =
+        complex_reference_filter(complex_input_samples[i]);
+  }
+
+  for (const bool in_place : {false, true}) {
+    FIRFilter<float, float> filter(kernel);
+    FIRFilter<Complex, float> complex_filter(kernel);
+    filter.UpdateKernelSymmetry();
+    complex_filter.UpdateKernelSymmetry();
+
+    std::vector<float> output_samples = input_samples;
+    std::vector<Complex> complex_output_samples = complex_input_samples;
+
+    size_t offset = 0;
+    for (const size_t block_size : {100, 1, 333, 64, 1000, 502}) {
+      const std::span<float> output =
+          std::span(output_samples).subspan(offset, block_size);
+      const std::span<Complex> complex_output =
+          std::span(complex_output_samples).subspan(offset, block_size);
+
+      if (in_place) {
+        filter(output);
+        complex_filter(complex_output);
+      } else {
+        filter(std::span<const float>(input_samples)
+                   .subspan(offset, block_size),
+               output);
+        complex_filter(std::span<const Complex>(complex_input_samples)
+                           .subspan(offset, block_size),
+                       complex_output);
+      }
+
+      offset += block_size;
+    }
+    ASSERT_EQ(offset, input_samples.size());
+
+    EXPECT_THAT(output_samples, Pointwise(FloatNear(1e-6f), expected_samples))
+        << "in_place=" << in_place;
+    EXPECT_THAT(complex_output_samples,
+                Pointwise(ComplexNear(1e-6f), complex_expected_samples))
+        << "in_place=" << in_place;
+  }
+}
+
+}  // namespace
+
+TEST(FIRFilter, LargeBlocks) {
+  CheckLargeBlocks(
+      std::to_array<float>({0.1f, -0.2f, 0.3f, 0.25f, 0.15f, -0.05f, 0.02f}));
+}
+
+TEST(FIRFilter, LargeBlocksSymmetric) {
+  // Odd and even number of taps.
+  CheckLargeBlocks(
+      std::to_array<float>({0.1f, -0.2f, 0.3f, 0.5f, 0.3f, -0.2f, 0.1f}));
+  CheckLargeBlocks(
+      std::to_array<float>({0.1f, -0.2f, 0.3f, 0.3f, -0.2f, 0.1f}));
+}
+
+TEST(FIRFilter, LargeBlocksAntisymmetric) {
+  // Odd and even number of taps.
+  CheckLargeBlocks(
+      std::to_array<float>({0.1f, -0.2f, 0.3f, 0.0f, -0.3f, 0.2f, -0.1f}));
+  CheckLargeBlocks(
+      std::to_array<float>({0.1f, -0.2f, 0.3f, -0.3f, 0.2f, -0.1f}));
+}
+
 }  // namespace radio_core::signal
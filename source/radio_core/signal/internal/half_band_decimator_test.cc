@@ -0,0 +1,86 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal/half_band_decimator.h"
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include "radio_core/math/math.h"
+#include "radio_core/signal/decimator.h"
+#include "radio_core/signal/filter_design.h"
+#include "radio_core/signal/window.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal {
+
+// Compare the half-band decimator with the regular decimator which uses the
+// same kernel. The result is expected to be the same, regardless of how the
+// input is split into buffers.
+TEST(HalfBandDecimator, MatchesDecimator) {
+  constexpr int kNumSamples = 1000;
+
+  std::array<float, 23> kernel;
+  DesignHalfBandFilter<float>(kernel,
+                              WindowEquation<float, Window::kBlackman>());
+
+  std::vector<float> input_samples(kNumSamples);
+  for (int i = 0; i < kNumSamples; ++i) {
+    input_samples[i] = Sin(float(i) * 0.1f) + Cos(float(i) * 1.3f) * 0.5f;
+  }
+
+  Decimator<float> decimator;
+  decimator.SetRatioAndKernel(2, kernel);
+  std::vector<float> expected_samples(kNumSamples);
+  const std::span<float> expected =
+      decimator(input_samples, std::span<float>(expected_samples));
+  ASSERT_EQ(expected.size(), kNumSamples / 2);
+
+  HalfBandDecimator<float> half_band_decimator(kernel);
+  std::vector<float> actual_samples;
+  std::vector<float> output_buffer(kNumSamples);
+  size_t offset = 0;
+  for (size_t block_size = 1; offset < kNumSamples; ++block_size) {
+    const size_t num_samples = Min(block_size, kNumSamples - offset);
+    const std::span<float> output = half_band_decimator(
+        std::span<const float>(input_samples).subspan(offset, num_samples),
+        output_buffer);
+    actual_samples.insert(actual_samples.end(), output.begin(), output.end());
+    offset += num_samples;
+  }
+
+  ASSERT_EQ(actual_samples.size(), expected.size());
+  for (size_t i = 0; i < actual_samples.size(); ++i) {
+    EXPECT_NEAR(actual_samples[i], expected[i], 1e-5f) << "at index " << i;
+  }
+}
+
+TEST(HalfBandDecimator, InPlace) {
+  std::array<float, 11> kernel;
+  DesignHalfBandFilter<float>(kernel,
+                              WindowEquation<float, Window::kHamming>());
+
+  HalfBandDecimator<float> decimator(kernel);
+
+  // Constant input signal is expected to be passed through with the unity
+  // gain once the filter is stabilized.
+  std::array<float, 64> samples;
+  samples.fill(1.0f);
+  const std::span<float> output = decimator(samples);
+  ASSERT_EQ(output.size(), 32);
+  EXPECT_NEAR(output.back(), 1.0f, 1e-6f);
+}
+
+TEST(HalfBandDecimator, CalcNeededOutputBufferSize) {
+  std::array<float, 7> kernel;
+  DesignHalfBandFilter<float>(kernel,
+                              WindowEquation<float, Window::kHamming>());
+
+  HalfBandDecimator<float> decimator(kernel);
+  EXPECT_EQ(decimator.CalcNeededOutputBufferSize(20), 10);
+  EXPECT_EQ(decimator.CalcNeededOutputBufferSize(21), 11);
+}
+
+}  // namespace radio_core::signal
@@ -0,0 +1,90 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal/kernel_symmetry.h"
+
+#include <array>
+#include <vector>
+
+#include "radio_core/signal/filter_design.h"
+#include "radio_core/signal/hilbert.h"
+#include "radio_core/signal/window.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal {
+
+TEST(DetectKernelSymmetry, Basic) {
+  EXPECT_EQ(DetectKernelSymmetry(std::span<const float>()),
+            KernelSymmetry::kNone);
+
+  {
+    const auto kernel = std::to_array<float>({0, 0, 0});
+    EXPECT_EQ(DetectKernelSymmetry<float>(kernel), KernelSymmetry::kNone);
+  }
+
+  {
+    const auto kernel = std::to_array<float>({1});
+    EXPECT_EQ(DetectKernelSymmetry<float>(kernel), KernelSymmetry::kSymmetric);
+  }
+
+  {
+    const auto kernel = std::to_array<float>({1, 2, 3, 2, 1});
+    EXPECT_EQ(DetectKernelSymmetry<float>(kernel), KernelSymmetry::kSymmetric);
+  }
+
+  {
+    const auto kernel = std::to_array<float>({1, 2, 2, 1});
+    EXPECT_EQ(DetectKernelSymmetry<float>(kernel), KernelSymmetry::kSymmetric);
+  }
+
+  {
+    const auto kernel = std::to_array<float>({1, 2, 0, -2, -1});
+    EXPECT_EQ(DetectKernelSymmetry<float>(kernel),
+              KernelSymmetry::kAntisymmetric);
+  }
+
+  {
+    const auto kernel = std::to_array<float>({1, 2, -2, -1});
+    EXPECT_EQ(DetectKernelSymmetry<float>(kernel),
+              KernelSymmetry::kAntisymmetric);
+  }
+
+  // Non-zero central element of an odd-sized kernel breaks antisymmetry.
+  {
+    const auto kernel = std::to_array<float>({1, 2, 3, -2, -1});
+    EXPECT_EQ(DetectKernelSymmetry<float>(kernel), KernelSymmetry::kNone);
+  }
+
+  {
+    const auto kernel = std::to_array<float>({1, 2, 3, 4, 5});
+    EXPECT_EQ(DetectKernelSymmetry<float>(kernel), KernelSymmetry::kNone);
+  }
+}
+
+TEST(DetectKernelSymmetry, Tolerance) {
+  const auto kernel = std::to_array<float>({1, 2, 3, 2.0001f, 1});
+
+  EXPECT_EQ(DetectKernelSymmetry<float>(kernel), KernelSymmetry::kNone);
+  EXPECT_EQ(DetectKernelSymmetry<float>(kernel, 1e-4f),
+            KernelSymmetry::kSymmetric);
+}
+
+TEST(DetectKernelSymmetry, DesignedFilters) {
+  {
+    std::vector<float> kernel(101);
+    DesignLowPassFilter<float>(
+        kernel, WindowEquation<float, Window::kHamming>(), 1000, 11025);
+    EXPECT_EQ(DetectKernelSymmetry<float>(kernel), KernelSymmetry::kSymmetric);
+  }
+
+  {
+    std::vector<float> kernel(101);
+    GenerateWindowedHilbertTransformer<float>(
+        kernel, WindowEquation<float, Window::kHamming>());
+    EXPECT_EQ(DetectKernelSymmetry<float>(kernel),
+              KernelSymmetry::kAntisymmetric);
+  }
+}
+
+}  // namespace radio_core::signal
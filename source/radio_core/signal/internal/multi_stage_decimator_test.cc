@@ -0,0 +1,162 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal/multi_stage_decimator.h"
+
+#include <span>
+#include <vector>
+
+#include "radio_core/base/arena_allocator.h"
+#include "radio_core/base/no_allocation_scope.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal/local_oscillator.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal {
+
+namespace {
+
+// Decimate sinewave of the given frequency and return the peak amplitude of
+// the output signal after the filters have stabilized.
+//
+// The frequency is expected to be chosen in a way that the output samples
+// cover all phases of the output sinewave, so that the peak of the samples is
+// close to the actual amplitude.
+template <class DecimatorType>
+auto DecimateSineAndGetAmplitude(DecimatorType& decimator,
+                                 const float frequency,
+                                 const float sample_rate) -> float {
+  constexpr int kNumSamples = 50000;
+
+  LocalOscillator<float> oscillator(frequency, sample_rate);
+  std::vector<float> samples(kNumSamples);
+  for (float& sample : samples) {
+    sample = oscillator.Sine();
+  }
+
+  const std::span<float> output = decimator(samples);
+
+  float amplitude = 0;
+  for (const float sample : output.subspan(output.size() / 2)) {
+    amplitude = Max(amplitude, Abs(sample));
+  }
+
+  return amplitude;
+}
+
+}  // namespace
+
+TEST(MultiStageDecimator, Stages) {
+  EXPECT_EQ(MultiStageDecimator<float>(1).GetNumStages(), 0);
+  EXPECT_EQ(MultiStageDecimator<float>(2).GetNumStages(), 1);
+  EXPECT_EQ(MultiStageDecimator<float>(5).GetNumStages(), 1);
+  EXPECT_EQ(MultiStageDecimator<float>(8).GetNumStages(), 3);
+  EXPECT_EQ(MultiStageDecimator<float>(25).GetNumStages(), 2);
+  EXPECT_EQ(MultiStageDecimator<float>(60).GetNumStages(), 4);
+
+  EXPECT_EQ(MultiStageDecimator<float>({.ratio = 12, .cic = {.ratio = 3}})
+                .GetNumStages(),
+            3);
+}
+
+TEST(MultiStageDecimator, Passband) {
+  MultiStageDecimator<float> decimator(25);
+  EXPECT_NEAR(DecimateSineAndGetAmplitude(decimator, 1234, 250000), 1, 1e-2f);
+}
+
+TEST(MultiStageDecimator, AliasRejection) {
+  // Frequencies which alias to 1234 Hz at the output sample rate of 10000 Hz.
+  {
+    MultiStageDecimator<float> decimator(25);
+    EXPECT_LT(DecimateSineAndGetAmplitude(decimator, 8766, 250000), 1e-3f);
+  }
+  {
+    MultiStageDecimator<float> decimator(25);
+    EXPECT_LT(DecimateSineAndGetAmplitude(decimator, 48766, 250000), 1e-3f);
+  }
+  {
+    MultiStageDecimator<float> decimator(16);
+    EXPECT_LT(DecimateSineAndGetAmplitude(decimator, 41234, 160000), 1e-3f);
+  }
+}
+
+TEST(MultiStageDecimator, CIC) {
+  MultiStageDecimator<float> decimator({.ratio = 20, .cic = {.ratio = 5}});
+  EXPECT_NEAR(DecimateSineAndGetAmplitude(decimator, 1234, 200000), 1, 1e-2f);
+
+  decimator.Configure({.ratio = 20, .cic = {.ratio = 5}});
+  EXPECT_LT(DecimateSineAndGetAmplitude(decimator, 41234, 200000), 1e-3f);
+}
+
+// The result must not depend on how the input is split into buffers.
+TEST(MultiStageDecimator, Streaming) {
+  constexpr int kNumSamples = 6000;
+
+  std::vector<Complex> input_samples(kNumSamples);
+  for (int i = 0; i < kNumSamples; ++i) {
+    input_samples[i] = Complex(Sin(float(i) * 0.01f), Cos(float(i) * 0.02f));
+  }
+
+  MultiStageDecimator<Complex, float> reference_decimator(12);
+  std::vector<Complex> expected_samples(kNumSamples);
+  const std::span<Complex> expected = reference_decimator(
+      input_samples, std::span<Complex>(expected_samples));
+  ASSERT_EQ(expected.size(), kNumSamples / 12);
+
+  MultiStageDecimator<Complex, float> decimator(12);
+  std::vector<Complex> actual_samples;
+  std::vector<Complex> output_buffer(kNumSamples);
+  size_t offset = 0;
+  for (size_t block_size = 1; offset < kNumSamples; block_size += 7) {
+    const size_t num_samples = Min(block_size, kNumSamples - offset);
+    const std::span<const Complex> input =
+        std::span<const Complex>(input_samples).subspan(offset, num_samples);
+    ASSERT_LE(decimator.CalcNeededOutputBufferSize(num_samples),
+              output_buffer.size());
+    const std::span<Complex> output = decimator(input, output_buffer);
+    EXPECT_LE(output.size(), decimator.CalcNeededOutputBufferSize(num_samples));
+    actual_samples.insert(actual_samples.end(), output.begin(), output.end());
+    offset += num_samples;
+  }
+
+  ASSERT_EQ(actual_samples.size(), expected.size());
+  for (size_t i = 0; i < actual_samples.size(); ++i) {
+    EXPECT_NEAR(actual_samples[i].real, expected[i].real, 1e-5f);
+    EXPECT_NEAR(actual_samples[i].imag, expected[i].imag, 1e-5f);
+  }
+}
+
+TEST(MultiStageDecimator, CalcNeededOutputBufferSize) {
+  MultiStageDecimator<float> decimator(10);
+  EXPECT_EQ(decimator.CalcNeededOutputBufferSize(20), 2);
+  EXPECT_EQ(decimator.CalcNeededOutputBufferSize(21), 3);
+}
+
+TEST(MultiStageDecimator, Reserve) {
+  // The ratio gives CIC, half-band, and regular decimator stages.
+  using Decimator = MultiStageDecimator<Complex, float, ArenaAllocator>;
+
+  Arena arena(1024 * 1024);
+  Arena::Scope arena_scope(arena);
+
+  Decimator decimator({.ratio = 60, .cic = {.ratio = 3}});
+  ASSERT_EQ(decimator.GetNumStages(), 4);
+  decimator.Reserve(10000);
+
+  // Any allocation done by the processing would increase the arena usage.
+  // Additionally, debug builds assert that there are no allocations.
+  const size_t num_used_bytes = arena.GetNumUsedBytes();
+
+  const std::vector<Complex> samples(10000, Complex(1, 0));
+  std::vector<Complex> output(decimator.CalcNeededOutputBufferSize(10000));
+  for (const size_t num_samples : {10000, 1, 5001, 9999, 10000}) {
+    const NoAllocationScope no_allocation_scope;
+    decimator(std::span(samples).subspan(0, num_samples), output);
+  }
+
+  EXPECT_EQ(arena.GetNumUsedBytes(), num_used_bytes);
+}
+
+}  // namespace radio_core::signal
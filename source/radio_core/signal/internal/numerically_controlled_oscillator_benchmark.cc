@@ -0,0 +1,155 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Benchmark of the quadrature signal generation.
+//
+// Compare the LocalOscillator with the per-sample and block generation of the
+// NumericallyControlledOscillator:
+//
+//   ./radio_core_signal_numerically_controlled_oscillator_benchmark local
+//   ./radio_core_signal_numerically_controlled_oscillator_benchmark nco
+//   ./radio_core_signal_numerically_controlled_oscillator_benchmark nco_block
+
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+#include "radio_core/benchmark/base_app.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/signal/local_oscillator.h"
+#include "radio_core/signal/numerically_controlled_oscillator.h"
+
+namespace radio_core::benchmark {
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+class NumericallyControlledOscillatorBenchmark : public Benchmark {
+ public:
+  using Benchmark::Benchmark;
+
+ protected:
+  auto GetBenchmarkName() -> std::string override {
+    return "Quadrature oscillator";
+  }
+
+  void ConfigureParser(argparse::ArgumentParser& parser) override {
+    parser.add_argument("implementation")
+        .help("Implementation of the oscillator: " +
+              std::string(kSupportedImplementationsListString));
+
+    parser.add_argument("--num-samples")
+        .default_value(65536)
+        .help("The number of samples generated in each iteration")
+        .scan<'i', int>();
+  }
+
+  auto HandleArguments(argparse::ArgumentParser& parser) -> bool override {
+    const auto implementation = parser.get<std::string>("implementation");
+    if (implementation == "local") {
+      implementation_ = Implementation::kLocalOscillator;
+    } else if (implementation == "nco") {
+      implementation_ = Implementation::kNCO;
+    } else if (implementation == "nco_block") {
+      implementation_ = Implementation::kNCOBlock;
+    } else {
+      cerr << "Unknown implementation " << implementation << endl;
+      cerr << "Supported: " << kSupportedImplementationsListString << endl;
+      return false;
+    }
+
+    num_samples_ = parser.get<int>("--num-samples");
+
+    return true;
+  }
+
+  void Initialize() override {
+    cout << endl;
+    cout << "Configuration" << endl;
+    cout << "=============" << endl;
+
+    switch (implementation_) {
+      case Implementation::kLocalOscillator:
+        cout << "Implementation       : local" << endl;
+        break;
+      case Implementation::kNCO:
+        cout << "Implementation       : nco" << endl;
+        break;
+      case Implementation::kNCOBlock:
+        cout << "Implementation       : nco_block" << endl;
+        break;
+    }
+    cout << "Number of samples    : " << num_samples_ << endl;
+    cout << "Number of iterations : " << GetNumIterations() << endl;
+
+    iq_.resize(num_samples_);
+
+    local_oscillator_.Configure(kFrequency, kSampleRate);
+    nco_.Configure(kFrequency, kSampleRate);
+  }
+
+  void Iteration() override {
+    switch (implementation_) {
+      case Implementation::kLocalOscillator:
+        for (Complex& iq : iq_) {
+          iq = local_oscillator_.IQ();
+        }
+        break;
+
+      case Implementation::kNCO:
+        for (Complex& iq : iq_) {
+          iq = nco_.IQ();
+        }
+        break;
+
+      case Implementation::kNCOBlock: nco_.IQ(iq_); break;
+    }
+  }
+
+  void Finalize() override {
+    // Sanity check and endurance that the evaluation is not optimized out.
+    bool has_non_finite = false;
+    for (const Complex& iq : iq_) {
+      if (!IsFinite(iq)) {
+        has_non_finite = true;
+      }
+    }
+    if (has_non_finite) {
+      cerr << "Result has non-finite values" << endl;
+      ::exit(1);
+    }
+  }
+
+ private:
+  enum class Implementation {
+    kLocalOscillator,
+    kNCO,
+    kNCOBlock,
+  };
+
+  static constexpr std::string_view kSupportedImplementationsListString =
+      "local, nco, nco_block";
+
+  // Mark tone of the Bell 202 modem at the sample rate used by the APRS
+  // decoder.
+  static constexpr float kFrequency = 1200;
+  static constexpr float kSampleRate = 11025;
+
+  Implementation implementation_{Implementation::kNCO};
+
+  int num_samples_{65536};
+
+  signal::LocalOscillator<float> local_oscillator_;
+  signal::NumericallyControlledOscillator<float> nco_;
+
+  std::vector<Complex> iq_;
+};
+
+}  // namespace radio_core::benchmark
+
+auto main(int argc, char** argv) -> int {
+  radio_core::benchmark::NumericallyControlledOscillatorBenchmark app;
+  return app.Run(argc, argv);
+}
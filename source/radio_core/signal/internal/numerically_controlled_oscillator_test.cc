@@ -0,0 +1,130 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal/numerically_controlled_oscillator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "radio_core/base/constants.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/math.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal {
+
+// Compare the generated sine and cosine waves against the double precision
+// reference over many periods.
+//
+// The frequency is chosen to be not a multiple of the sample rate, so that all
+// parts of the table are used.
+TEST(NumericallyControlledOscillator, SineCosine) {
+  constexpr double kFrequency = 1234.5;
+  constexpr double kSampleRate = 44100;
+  constexpr int kNumSamples = 1000000;
+
+  NumericallyControlledOscillator<float> sine_oscillator(kFrequency,
+                                                         kSampleRate);
+  NumericallyControlledOscillator<float> cosine_oscillator(kFrequency,
+                                                           kSampleRate);
+
+  // Frequency of the oscillator is quantized to sample_rate / 2^32. Over the
+  // long run it causes a noticeable phase difference from the requested
+  // frequency, so the reference uses the quantized phase increment.
+  const uint32_t phase_increment =
+      nco_internal::PhaseIncrement<double>(kFrequency, kSampleRate);
+
+  double max_error = 0;
+
+  for (int i = 0; i < kNumSamples; ++i) {
+    const double phase =
+        2 * constants::pi * double(uint32_t(phase_increment * uint32_t(i))) /
+        4294967296.0;
+
+    const double sine = sine_oscillator.Sine();
+    const double cosine = cosine_oscillator.Cosine();
+
+    max_error = std::max(max_error, std::fabs(sine - std::sin(phase)));
+    max_error = std::max(max_error, std::fabs(cosine - std::cos(phase)));
+  }
+
+  EXPECT_LT(max_error, 5e-6);
+}
+
+TEST(NumericallyControlledOscillator, IQ) {
+  NumericallyControlledOscillator<float> oscillator(5, 100);
+
+  NumericallyControlledOscillator<float> oscillator_i(5, 100);
+  NumericallyControlledOscillator<float> oscillator_q(5, 100);
+
+  for (int i = 0; i < 1000; ++i) {
+    const Complex iq = oscillator.IQ();
+    EXPECT_EQ(iq.real, oscillator_i.Cosine());
+    EXPECT_EQ(iq.imag, oscillator_q.Sine());
+  }
+}
+
+TEST(NumericallyControlledOscillator, BlockIQ) {
+  // Sizes which cover the vectorized and the remainder parts of the block.
+  for (const size_t size : {1, 3, 4, 7, 8, 9, 31, 64, 1000}) {
+    NumericallyControlledOscillator<float> oscillator(1234.5f, 44100);
+    NumericallyControlledOscillator<float> reference_oscillator(1234.5f,
+                                                                44100);
+
+    std::vector<Complex> iq(size);
+
+    // Multiple blocks to check that the phase is continuous between them.
+    for (int block = 0; block < 3; ++block) {
+      oscillator.IQ(iq);
+
+      for (size_t i = 0; i < size; ++i) {
+        const Complex expected = reference_oscillator.IQ();
+        EXPECT_NEAR(iq[i].real, expected.real, 1e-5f)
+            << "size=" << size << " i=" << i;
+        EXPECT_NEAR(iq[i].imag, expected.imag, 1e-5f)
+            << "size=" << size << " i=" << i;
+      }
+    }
+  }
+}
+
+// The phase accumulator is exact, so the phase returns to the initial value
+// after the whole number of periods.
+//
+// The frequency is chosen so that its phase increment is exactly representable
+// in the units of 2^-32 of the full turn.
+TEST(NumericallyControlledOscillator, NoPhaseDrift) {
+  NumericallyControlledOscillator<float> oscillator(48000.0f / 64, 48000);
+
+  for (int i = 0; i < 64 * 100000; ++i) {
+    oscillator.Phase();
+  }
+
+  EXPECT_EQ(oscillator.Phase(), 0.0f);
+}
+
+TEST(NumericallyControlledOscillator, NegativeFrequency) {
+  NumericallyControlledOscillator<float> oscillator(-5, 100);
+
+  NumericallyControlledOscillator<float> reference_oscillator(5, 100);
+
+  for (int i = 0; i < 1000; ++i) {
+    const Complex iq = oscillator.IQ();
+    const Complex expected = Conj(reference_oscillator.IQ());
+    EXPECT_NEAR(iq.real, expected.real, 1e-6f);
+    EXPECT_NEAR(iq.imag, expected.imag, 1e-6f);
+  }
+}
+
+TEST(NumericallyControlledOscillator, OffsetPhase) {
+  NumericallyControlledOscillator<float> oscillator(5, 100);
+
+  oscillator.OffsetPhase(float(constants::pi) / 2);
+
+  EXPECT_NEAR(oscillator.Sine(), 1.0f, 1e-6f);
+}
+
+}  // namespace radio_core::signal
@@ -0,0 +1,122 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal/rational_resampler.h"
+
+#include <span>
+#include <vector>
+
+#include "radio_core/base/algorithm.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal/local_oscillator.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal {
+
+namespace {
+
+// Resample sinewave of the given frequency and return the peak amplitude of
+// the output signal after the filter has stabilized.
+//
+// The frequency is expected to be chosen in a way that the output samples
+// cover all phases of the output sinewave, so that the peak of the samples is
+// close to the actual amplitude.
+auto ResampleSineAndGetAmplitude(RationalResampler<float>& resampler,
+                                 const float frequency,
+                                 const float sample_rate) -> float {
+  constexpr int kNumSamples = 48000;
+
+  LocalOscillator<float> oscillator(frequency, sample_rate);
+  std::vector<float> samples(kNumSamples);
+  for (float& sample : samples) {
+    sample = oscillator.Sine();
+  }
+
+  const std::span<float> output = resampler(samples);
+
+  float amplitude = 0;
+  for (const float sample : output.subspan(output.size() / 2)) {
+    amplitude = Max(amplitude, Abs(sample));
+  }
+
+  return amplitude;
+}
+
+}  // namespace
+
+TEST(RationalResampler, SetRatio) {
+  RationalResampler<float> resampler(6, 4);
+  EXPECT_EQ(resampler.GetInterpolation(), 3);
+  EXPECT_EQ(resampler.GetDecimation(), 2);
+
+  // 48000 -> 44100.
+  resampler.SetRatio(44100, 48000);
+  EXPECT_EQ(resampler.GetInterpolation(), 147);
+  EXPECT_EQ(resampler.GetDecimation(), 160);
+}
+
+TEST(RationalResampler, NumOutputSamples) {
+  RationalResampler<float> resampler(147, 160);
+
+  std::vector<float> samples(48000, 1.0f);
+  const std::span<float> output = resampler(samples);
+  EXPECT_EQ(output.size(), 44100);
+
+  // Constant signal is expected to pass with unity gain.
+  EXPECT_NEAR(output.back(), 1.0f, 1e-4f);
+}
+
+TEST(RationalResampler, Passband) {
+  RationalResampler<float> resampler(147, 160);
+  EXPECT_NEAR(ResampleSineAndGetAmplitude(resampler, 1234, 48000), 1, 1e-2f);
+}
+
+TEST(RationalResampler, AliasRejection) {
+  // 48000 -> 20571.4: frequency which is above the Nyquist frequency of the
+  // output, but below the Nyquist frequency of the input.
+  RationalResampler<float> resampler(3, 7);
+  EXPECT_LT(ResampleSineAndGetAmplitude(resampler, 18000, 48000), 1e-3f);
+}
+
+// The result must not depend on how the input is split into buffers.
+TEST(RationalResampler, Streaming) {
+  constexpr int kNumSamples = 5000;
+
+  std::vector<float> input_samples(kNumSamples);
+  for (int i = 0; i < kNumSamples; ++i) {
+    input_samples[i] = Sin(float(i) * 0.01f) + Cos(float(i) * 0.3f);
+  }
+
+  RationalResampler<float> reference_resampler(3, 7);
+  std::vector<float> expected_samples(kNumSamples);
+  const std::span<float> expected = reference_resampler(
+      input_samples, std::span<float>(expected_samples));
+
+  RationalResampler<float> resampler(3, 7);
+  std::vector<float> actual_samples;
+  std::vector<float> output_buffer(kNumSamples);
+  size_t offset = 0;
+  for (size_t block_size = 1; offset < kNumSamples; block_size += 5) {
+    const size_t num_samples = Min(block_size, kNumSamples - offset);
+    const std::span<const float> input =
+        std::span<const float>(input_samples).subspan(offset, num_samples);
+    const std::span<float> output = resampler(input, output_buffer);
+    EXPECT_LE(output.size(), resampler.CalcNeededOutputBufferSize(num_samples));
+    actual_samples.insert(actual_samples.end(), output.begin(), output.end());
+    offset += num_samples;
+  }
+
+  ASSERT_EQ(actual_samples.size(), expected.size());
+  for (size_t i = 0; i < actual_samples.size(); ++i) {
+    EXPECT_NEAR(actual_samples[i], expected[i], 1e-5f);
+  }
+}
+
+TEST(RationalResampler, CalcNeededOutputBufferSize) {
+  RationalResampler<float> resampler(3, 2);
+  EXPECT_EQ(resampler.CalcNeededOutputBufferSize(20), 30);
+  EXPECT_EQ(resampler.CalcNeededOutputBufferSize(21), 32);
+}
+
+}  // namespace radio_core::signal
@@ -0,0 +1,163 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Benchmark of the frequency shift followed by the decimation, as it happens
+// in the input stage of the signal path.
+//
+// Compare the separate shift and decimation, which goes through a work buffer
+// of the input block size, with the fused one which goes through a chunk buffer
+// which fits into the CPU cache:
+//
+//   ./radio_core_signal_shift_decimate_benchmark separate
+//   ./radio_core_signal_shift_decimate_benchmark fused
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "radio_core/benchmark/base_app.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal/frequency_shifter.h"
+#include "radio_core/signal/multi_stage_decimator.h"
+#include "radio_core/signal/shift_decimate.h"
+
+namespace radio_core::benchmark {
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+class ShiftDecimateBenchmark : public Benchmark {
+ public:
+  using Benchmark::Benchmark;
+
+ protected:
+  auto GetBenchmarkName() -> std::string override { return "ShiftDecimate"; }
+
+  void ConfigureParser(argparse::ArgumentParser& parser) override {
+    parser.add_argument("implementation")
+        .help("Implementation of the input stage: separate, fused");
+
+    parser.add_argument("--num-samples")
+        .default_value(1048576)
+        .help("Number of input samples processed by a single iteration")
+        .scan<'i', int>();
+
+    parser.add_argument("--ratio")
+        .default_value(25)
+        .help("Decimation ratio")
+        .scan<'i', int>();
+
+    parser.add_argument("--chunk-size")
+        .default_value(int(signal::kShiftDecimateChunkSize))
+        .help("Number of samples in a chunk of the fused implementation")
+        .scan<'i', int>();
+  }
+
+  auto HandleArguments(argparse::ArgumentParser& parser) -> bool override {
+    implementation_ = parser.get<std::string>("implementation");
+    if (implementation_ != "separate" && implementation_ != "fused") {
+      cerr << "Unknown implementation " << implementation_ << endl;
+      cerr << "Supported: separate, fused" << endl;
+      return false;
+    }
+
+    num_samples_ = parser.get<int>("--num-samples");
+    if (num_samples_ <= 0) {
+      cerr << "Invalid number of samples" << endl;
+      return false;
+    }
+
+    ratio_ = parser.get<int>("--ratio");
+    if (ratio_ <= 0) {
+      cerr << "Invalid decimation ratio" << endl;
+      return false;
+    }
+
+    chunk_size_ = parser.get<int>("--chunk-size");
+    if (chunk_size_ <= 0) {
+      cerr << "Invalid chunk size" << endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  void Initialize() override {
+    shifter_.Configure(100000, 6000000);
+    decimator_.SetRatio(ratio_);
+
+    input_samples_.resize(num_samples_);
+    output_samples_.resize(
+        decimator_.CalcNeededOutputBufferSize(input_samples_.size()));
+
+    if (implementation_ == "separate") {
+      work_buffer_.resize(num_samples_);
+    } else {
+      work_buffer_.resize(chunk_size_);
+    }
+
+    std::random_device random_device;
+    std::mt19937 random_engine(random_device());
+    std::uniform_real_distribution<float> distribution(-1, 1);
+    for (Complex& input_sample : input_samples_) {
+      input_sample = Complex(distribution(random_engine),
+                             distribution(random_engine));
+    }
+
+    cout << endl;
+    cout << "Configuration" << endl;
+    cout << "=============" << endl;
+
+    cout << "Implementation          : " << implementation_ << endl;
+    cout << "Number of input samples : " << input_samples_.size() << endl;
+    cout << "Work buffer size        : " << work_buffer_.size() << endl;
+    cout << "Decimation ratio        : " << decimator_.GetRatio() << endl;
+    cout << "Number of stages        : " << decimator_.GetNumStages() << endl;
+    cout << "Number of iterations    : " << GetNumIterations() << endl;
+  }
+
+  void Iteration() override {
+    if (implementation_ == "separate") {
+      const std::span<Complex> shifted_samples =
+          shifter_(input_samples_, work_buffer_);
+      decimator_(std::span<const Complex>(shifted_samples), output_samples_);
+    } else {
+      signal::ShiftAndDecimate<float>(shifter_,
+                                      decimator_,
+                                      input_samples_,
+                                      work_buffer_,
+                                      output_samples_);
+    }
+  }
+
+  void Finalize() override {
+    // Sanity check and endurance that the evaluation is not optimized out.
+    if (!IsFinite(output_samples_[0])) {
+      std::cerr << "Result has non-finite values" << std::endl;
+      ::exit(1);
+    }
+  }
+
+ private:
+  std::string implementation_;
+  int num_samples_{0};
+  int ratio_{0};
+  int chunk_size_{0};
+
+  signal::FrequencyShifter<float> shifter_;
+  signal::MultiStageDecimator<Complex, float> decimator_;
+
+  std::vector<Complex> input_samples_;
+  std::vector<Complex> work_buffer_;
+  std::vector<Complex> output_samples_;
+};
+
+}  // namespace radio_core::benchmark
+
+auto main(int argc, char** argv) -> int {
+  radio_core::benchmark::ShiftDecimateBenchmark app;
+  return app.Run(argc, argv);
+}
@@ -0,0 +1,100 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal/shift_decimate.h"
+
+#include <array>
+#include <vector>
+
+#include "radio_core/math/complex.h"
+#include "radio_core/math/math.h"
+#include "radio_core/math/unittest/complex_matchers.h"
+#include "radio_core/signal/multi_stage_decimator.h"
+#include "radio_core/unittest/mock.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal {
+
+using testing::ComplexNear;
+
+namespace {
+
+auto GenerateSamples(const size_t num_samples) -> std::vector<Complex> {
+  std::vector<Complex> samples(num_samples);
+  for (size_t i = 0; i < num_samples; ++i) {
+    const float x = float(i);
+    samples[i] = Complex(Cos(x * 0.011f) + Sin(x * 0.37f) * 0.5f,
+                         Sin(x * 0.013f) - Cos(x * 0.29f) * 0.25f);
+  }
+  return samples;
+}
+
+}  // namespace
+
+TEST(ShiftAndDecimate, MatchesSeparateShiftAndDecimation) {
+  const std::vector<Complex> samples = GenerateSamples(5003);
+
+  // Reference: shift the whole input and decimate the shifted samples.
+  std::vector<Complex> expected;
+  {
+    FrequencyShifter<float> shifter(-1200, 48000);
+    MultiStageDecimator<Complex, float> decimator(10);
+
+    std::vector<Complex> shifted(samples.size());
+    expected.resize(decimator.CalcNeededOutputBufferSize(samples.size()));
+
+    shifter(samples, shifted);
+    expected.resize(
+        decimator(std::span<const Complex>(shifted), expected).size());
+  }
+
+  // Feed the samples in blocks of different sizes, with a chunk buffer which
+  // is smaller than some of the blocks and does not divide them.
+  FrequencyShifter<float> shifter(-1200, 48000);
+  MultiStageDecimator<Complex, float> decimator(10);
+
+  constexpr size_t kBlockSizes[] = {1, 7, 100, 1000, 2500};
+
+  std::array<Complex, 97> chunk_buffer;
+  std::vector<Complex> actual;
+
+  size_t offset = 0;
+  for (size_t i = 0; offset < samples.size(); ++i) {
+    const size_t block_size = Min(kBlockSizes[i % std::size(kBlockSizes)],
+                                  samples.size() - offset);
+    const std::span<const Complex> block =
+        std::span(samples).subspan(offset, block_size);
+
+    std::vector<Complex> output(
+        decimator.CalcNeededOutputBufferSize(block.size()));
+    const std::span<Complex> decimated = ShiftAndDecimate<float>(
+        shifter, decimator, block, chunk_buffer, output);
+
+    actual.insert(actual.end(), decimated.begin(), decimated.end());
+
+    offset += block_size;
+  }
+
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_THAT(actual[i], ComplexNear(expected[i], 1e-4f)) << "i=" << i;
+  }
+}
+
+TEST(ShiftAndDecimate, Empty) {
+  FrequencyShifter<float> shifter(-1200, 48000);
+  MultiStageDecimator<Complex, float> decimator(10);
+
+  std::array<Complex, 16> chunk_buffer;
+  std::array<Complex, 1> output;
+
+  EXPECT_TRUE(ShiftAndDecimate<float>(shifter,
+                                      decimator,
+                                      std::span<const Complex>(),
+                                      chunk_buffer,
+                                      output)
+                  .empty());
+}
+
+}  // namespace radio_core::signal
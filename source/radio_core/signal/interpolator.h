@@ -60,7 +60,7 @@ class Interpolator {
     // TODO(sergey): Not really correct: the either or both of the sample type
     // and the kernel elements can be complex, and here it is required to have
     // a real type.
-    using RealType = KernelElementType;
+    using RealType = ComputeType<KernelElementType>;
 
     assert(ratio > 0);
 
@@ -0,0 +1,88 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Symmetry of a FIR filter kernel.
+//
+// Linear-phase filters have kernels which are symmetric (h[i] == h[N - 1 - i])
+// or antisymmetric (h[i] == -h[N - 1 - i]). Low-pass, band-pass, raised cosine
+// filters are symmetric, Hilbert transformers and differentiators are
+// antisymmetric.
+//
+// Filters can take advantage of the symmetry by adding mirrored samples prior
+// to the multiplication with the kernel, halving the number of multiplications.
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+
+#include "radio_core/math/math.h"
+
+namespace radio_core::signal {
+
+enum class KernelSymmetry {
+  // The kernel has no symmetry, or it is unknown.
+  kNone,
+
+  // h[i] == h[N - 1 - i].
+  kSymmetric,
+
+  // h[i] == -h[N - 1 - i].
+  kAntisymmetric,
+};
+
+// Detect symmetry of the given kernel.
+//
+// The kernels designed using the floating point arithmetic are symmetric up to
+// the rounding errors. The kernel is considered symmetric when the difference
+// between the mirrored elements does not exceed the given tolerance relative to
+// the largest magnitude of the kernel elements.
+//
+// A kernel which is all zeros, as well as an empty kernel, is reported to have
+// no symmetry: this is typically a kernel which is not yet designed.
+template <class T>
+auto DetectKernelSymmetry(const std::span<const T> kernel,
+                          const float relative_tolerance = 1e-6f)
+    -> KernelSymmetry {
+  const size_t num_taps = kernel.size();
+
+  float max_magnitude = 0;
+  for (const T& h : kernel) {
+    max_magnitude = std::max(max_magnitude, float(Abs(h)));
+  }
+  if (max_magnitude == 0) {
+    return KernelSymmetry::kNone;
+  }
+
+  const float tolerance = max_magnitude * relative_tolerance;
+
+  bool is_symmetric = true;
+  bool is_antisymmetric = true;
+
+  for (size_t i = 0, j = num_taps - 1; i < j; ++i, --j) {
+    if (float(Abs(kernel[i] - kernel[j])) > tolerance) {
+      is_symmetric = false;
+    }
+    if (float(Abs(kernel[i] + kernel[j])) > tolerance) {
+      is_antisymmetric = false;
+    }
+    if (!is_symmetric && !is_antisymmetric) {
+      return KernelSymmetry::kNone;
+    }
+  }
+
+  // The central element of an odd-sized antisymmetric kernel is zero.
+  if ((num_taps & 1) && float(Abs(kernel[num_taps / 2])) > tolerance) {
+    is_antisymmetric = false;
+  }
+
+  if (!is_symmetric && !is_antisymmetric) {
+    return KernelSymmetry::kNone;
+  }
+
+  return is_symmetric ? KernelSymmetry::kSymmetric
+                      : KernelSymmetry::kAntisymmetric;
+}
+
+}  // namespace radio_core::signal
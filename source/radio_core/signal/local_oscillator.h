@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "radio_core/base/build_config.h"
 #include "radio_core/base/constants.h"
 #include "radio_core/math/math.h"
 
@@ -23,9 +24,12 @@ namespace radio_core {
 // Forward declaration of complex numbers.
 //
 // Avoids pulling many headers when the local oscillator is only needed for
-// floating point signals.
+// floating point signals. Declared in the same namespace as the definition
+// from the math/base_complex.h.
+inline namespace RADIO_CORE_ISA_NAMESPACE {
 template <class T>
 class BaseComplex;
+}  // namespace RADIO_CORE_ISA_NAMESPACE
 
 namespace signal {
 
@@ -0,0 +1,420 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Filter and downsample signal by an integer ratio using a cascade of stages.
+//
+// The decimator has the same API as the Decimator, but instead of designing a
+// single anti-alias filter with the cutoff at the output Nyquist frequency it
+// factors the ratio into a cascade of smaller decimation stages:
+//
+//   - An optional CIC stage with a droop compensation filter in the front.
+//
+//   - Half-band stages for every factor of 2 of the ratio. Half-band filters
+//     have every other coefficient zero, and these zero taps are skipped.
+//
+//   - Regular decimator stages for the odd prime factors of the ratio.
+//
+// Only the last stage needs to have the sharp cutoff at the Nyquist frequency
+// of the output sample rate, and it runs at the lowest input sample rate. The
+// intermediate stages only need to reject frequencies which alias into the
+// passband of the final output, so they use wide transition band and short
+// kernels.
+//
+// For example, decimation of 6 Msps by 25 with the single stage decimator uses
+// 501 taps kernel, which costs about 20 multiplications per input sample. The
+// multi-stage decimator uses 2 stages of decimation by 5, costing less than 10
+// multiplications per input sample.
+//
+// References:
+//
+//   [1] R. Crochiere, L. Rabiner, "Optimum FIR digital filter implementations
+//       for decimation, interpolation, and narrow-band filtering", IEEE
+//       Transactions on Acoustics, Speech, and Signal Processing, vol. 23,
+//       no. 5, pp. 444-456, 1975.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "radio_core/base/container.h"
+#include "radio_core/base/verify.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal/cic_decimator.h"
+#include "radio_core/signal/decimator.h"
+#include "radio_core/signal/filter_design.h"
+#include "radio_core/signal/filter_window_heuristic.h"
+#include "radio_core/signal/frequency.h"
+#include "radio_core/signal/half_band_decimator.h"
+#include "radio_core/signal/window.h"
+
+namespace radio_core::signal {
+
+template <class SampleType,
+          class KernelElementType = SampleType,
+          template <class> class Allocator = std::allocator>
+class MultiStageDecimator {
+  // Pseudonym for real-typed scalar values which are used to design the
+  // kernels.
+  using RealType = ComputeType<KernelElementType>;
+
+  template <class T>
+  using Vector = std::vector<T, Allocator<T>>;
+
+  using CICStage = CICDecimator<SampleType, KernelElementType, Allocator>;
+  using HalfBandStage =
+      HalfBandDecimator<SampleType, KernelElementType, Allocator>;
+  using DecimatorStage = Decimator<SampleType, KernelElementType, Allocator>;
+
+ public:
+  struct Options {
+    // Overall decimation ratio.
+    int ratio{1};
+
+    // Configuration of the front CIC stage.
+    //
+    // The ratio of the CIC stage must be a divisor of the overall decimation
+    // ratio. The ratio of 1 disables the CIC stage.
+    //
+    // The CIC stage is cheap, but it has rather poor aliasing rejection in the
+    // band of the final output when its output sample rate is not much higher
+    // than the final output sample rate. It is up to the caller to ensure the
+    // rejection is good enough for the application.
+    struct CICOptions {
+      int ratio{1};
+      int order{4};
+
+      constexpr auto operator<=>(const CICOptions& other) const = default;
+    };
+    CICOptions cic;
+
+    constexpr auto operator<=>(const Options& other) const = default;
+  };
+
+  // Default constructor.
+  //
+  // Leaves object uninitialized. When this path is used an explicit call to
+  // `SetRatio()` or `Configure()` is expected before performing downsampling,
+  // otherwise the object will have an undefined behavior.
+  MultiStageDecimator() = default;
+
+  // Construct decimator with pre-defined ratio.
+  explicit MultiStageDecimator(const int ratio) { SetRatio(ratio); }
+
+  explicit MultiStageDecimator(const Options& options) { Configure(options); }
+
+  // Set decimation ratio, without the CIC stage.
+  // If the current ratio is the same as the new one then nothing happens.
+  inline void SetRatio(const int ratio) { Configure({.ratio = ratio}); }
+
+  // Configure the decimator.
+  // If the requested configuration matches the current one nothing happens.
+  void Configure(const Options& options) {
+    assert(options.ratio > 0);
+
+    Verify(options.cic.ratio > 0 && options.ratio % options.cic.ratio == 0,
+           "CIC ratio must be a divisor of the decimation ratio");
+
+    if (options_.ratio != 0 && options_ == options) {
+      return;
+    }
+
+    options_ = options;
+
+    ConfigureStages();
+  }
+
+  // Get currently configured decimation ratio.
+  inline auto GetRatio() const -> int { return options_.ratio; }
+
+  // Get the number of stages the decimation is performed with.
+  inline auto GetNumStages() const -> int { return num_stages_; }
+
+  // Downsample multiple input samples.
+  //
+  // The output buffer must have enough elements to hold result of the
+  // downsampled samples. Use the `CalcNeededOutputBufferSize()` to calculate
+  // the needed buffer size.
+  //
+  // The input and output buffers might be the same.
+  //
+  // Returns a subspan of the output samples buffer which was written by this
+  // call.
+  auto operator()(const std::span<const SampleType> input_samples,
+                  const std::span<SampleType> output_samples)
+      -> std::span<SampleType> {
+    assert(options_.ratio != 0);
+
+    if (num_stages_ == 0) {
+      assert(output_samples.size() >= input_samples.size());
+      std::copy(
+          input_samples.begin(), input_samples.end(), output_samples.begin());
+      return output_samples.subspan(0, input_samples.size());
+    }
+
+    // The first stage reads from the input and writes to the work buffer, the
+    // intermediate stages operate in-place in the work buffer, and the last
+    // stage writes the final result to the output.
+    if (num_stages_ > 1) {
+      EnsureSizeAtLeast(buffer_,
+                        CalcFirstStageOutputBufferSize(input_samples.size()));
+    }
+
+    std::span<const SampleType> samples = input_samples;
+    std::span<SampleType> result;
+    int num_remaining_stages = num_stages_;
+
+    auto process_stage = [&](auto& stage) {
+      --num_remaining_stages;
+      const std::span<SampleType> destination =
+          num_remaining_stages ? std::span<SampleType>(buffer_)
+                               : output_samples;
+      result = stage(samples, destination);
+      samples = result;
+    };
+
+    if (use_cic_) {
+      process_stage(cic_stage_);
+    }
+    for (HalfBandStage& stage : half_band_stages_) {
+      process_stage(stage);
+    }
+    for (DecimatorStage& stage : decimator_stages_) {
+      process_stage(stage);
+    }
+
+    assert(num_remaining_stages == 0);
+
+    return result;
+  }
+
+  inline auto operator()(const std::span<SampleType> samples)
+      -> std::span<SampleType> {
+    return (*this)(samples, samples);
+  }
+
+  // Calculate required output buffer size for the given number of input
+  // samples.
+  //
+  // The calculation takes care of the rounding, giving the smallest size of the
+  // output buffer needed for downsampling input buffer size of the given size.
+  // The calculation gives the worst case scenario, which means that the output
+  // buffer size can only be calculated once if the downsampling happens for a
+  // fixed input buffer size.
+  inline auto CalcNeededOutputBufferSize(const size_t num_input_samples) const
+      -> size_t {
+    assert(options_.ratio != 0);
+
+    return (num_input_samples + options_.ratio - 1) / options_.ratio;
+  }
+
+  // Pre-allocate work buffers for downsampling up to the given number of input
+  // samples at a time.
+  //
+  // Downsampling of input buffers which are not bigger than the reserved size
+  // does not allocate memory.
+  //
+  // The reservation is to be done after the decimator is configured.
+  void Reserve(const size_t max_num_input_samples) {
+    if (num_stages_ > 1) {
+      EnsureSizeAtLeast(buffer_,
+                        CalcFirstStageOutputBufferSize(max_num_input_samples));
+    }
+
+    size_t num_stage_input_samples = max_num_input_samples;
+
+    auto reserve_stage = [&](auto& stage) {
+      stage.Reserve(num_stage_input_samples);
+      num_stage_input_samples =
+          stage.CalcNeededOutputBufferSize(num_stage_input_samples);
+    };
+
+    if (use_cic_) {
+      reserve_stage(cic_stage_);
+    }
+    for (HalfBandStage& stage : half_band_stages_) {
+      reserve_stage(stage);
+    }
+    for (DecimatorStage& stage : decimator_stages_) {
+      reserve_stage(stage);
+    }
+  }
+
+ private:
+  // Stopband attenuation of the intermediate stages, in dB.
+  static constexpr RealType kIntermediateStageAttenuation = 70;
+
+  // Build the cascade of stages for the current options.
+  void ConfigureStages() {
+    const int ratio = options_.ratio;
+    const int cic_ratio = options_.cic.ratio;
+
+    // Factor the ratio after the CIC stage into the half-band stages and the
+    // odd prime factors. The odd factors are processed from the largest to the
+    // smallest, so that the last stage which has the sharp cutoff and hence
+    // the longest kernel has the smallest possible ratio.
+    int remaining_ratio = ratio / cic_ratio;
+    int num_half_band_stages = 0;
+    while (remaining_ratio % 2 == 0) {
+      remaining_ratio /= 2;
+      ++num_half_band_stages;
+    }
+    Vector<int> odd_factors;
+    for (int factor = 3; factor * factor <= remaining_ratio; factor += 2) {
+      while (remaining_ratio % factor == 0) {
+        odd_factors.push_back(factor);
+        remaining_ratio /= factor;
+      }
+    }
+    if (remaining_ratio > 1) {
+      odd_factors.push_back(remaining_ratio);
+    }
+    std::sort(odd_factors.begin(), odd_factors.end(), std::greater<int>());
+
+    use_cic_ = cic_ratio != 1;
+    num_stages_ = (use_cic_ ? 1 : 0) + num_half_band_stages +
+                  int(odd_factors.size());
+
+    half_band_stages_.resize(num_half_band_stages);
+    decimator_stages_.resize(odd_factors.size());
+
+    // Sample rate of the input of the current stage, relative to the sample
+    // rate of the final output.
+    int stage_input_rate = ratio;
+    int stage_index = 0;
+
+    if (use_cic_) {
+      // Compensate the CIC droop up to the Nyquist frequency of the final
+      // output. Use twice higher cutoff frequency, so that the transition band
+      // of the compensation filter is outside of the final passband. The
+      // frequencies above the final passband are rejected by the next stages.
+      const int cic_output_rate = stage_input_rate / cic_ratio;
+      cic_stage_.Configure({
+          .ratio = cic_ratio,
+          .order = options_.cic.order,
+          .compensation_cutoff = Min(RealType(1) / cic_output_rate,
+                                     RealType(0.5)),
+      });
+      stage_input_rate = cic_output_rate;
+      ++stage_index;
+    }
+
+    for (HalfBandStage& stage : half_band_stages_) {
+      const bool is_last = (++stage_index == num_stages_);
+      ConfigureHalfBandStage(stage, stage_input_rate, is_last);
+      stage_input_rate /= 2;
+    }
+
+    for (size_t i = 0; i < odd_factors.size(); ++i) {
+      const int factor = odd_factors[i];
+      const bool is_last = (++stage_index == num_stages_);
+      ConfigureDecimatorStage(
+          decimator_stages_[i], factor, stage_input_rate, is_last);
+      stage_input_rate /= factor;
+    }
+
+    assert(stage_input_rate == 1);
+  }
+
+  // Calculate size of the intermediate stage kernel which only rejects
+  // frequencies aliasing into the final passband.
+  //
+  // The passband of the stage ends at the Nyquist frequency of the final
+  // output, and the stopband starts at the frequency which aliases to it after
+  // the decimation of this stage.
+  static auto CalculateIntermediateStageKernelSize(const int stage_input_rate,
+                                                   const int stage_ratio)
+      -> size_t {
+    const RealType stage_output_rate = RealType(stage_input_rate) / stage_ratio;
+    const RealType transition_band = stage_output_rate - RealType(1);
+    const RealType dw =
+        NormalizedAngularFrequency(transition_band, RealType(stage_input_rate));
+
+    return CalculateKaiserSize(kIntermediateStageAttenuation, dw);
+  }
+
+  void ConfigureHalfBandStage(HalfBandStage& stage,
+                              const int stage_input_rate,
+                              const bool is_last) {
+    size_t kernel_size;
+    Vector<KernelElementType> kernel;
+
+    if (is_last) {
+      // Match the kernel size of the regular decimator by 2, rounded up to the
+      // half-band filter size.
+      kernel_size = 20 * 2 + 3;
+      kernel.resize(kernel_size);
+      DesignHalfBandFilter<KernelElementType>(
+          kernel, WindowEquation<RealType, Window::kBlackman>());
+    } else {
+      kernel_size =
+          CalculateIntermediateStageKernelSize(stage_input_rate, 2) | 3;
+      kernel.resize(kernel_size);
+      DesignHalfBandFilter<KernelElementType>(
+          kernel,
+          WindowEquation<RealType, Window::kKaiser>(
+              CalculateKaiserBeta(kIntermediateStageAttenuation)));
+    }
+
+    stage.SetKernel(kernel);
+  }
+
+  void ConfigureDecimatorStage(DecimatorStage& stage,
+                               const int stage_ratio,
+                               const int stage_input_rate,
+                               const bool is_last) {
+    if (is_last) {
+      stage.SetRatio(stage_ratio);
+      return;
+    }
+
+    const size_t kernel_size =
+        CalculateIntermediateStageKernelSize(stage_input_rate, stage_ratio) | 1;
+
+    Vector<KernelElementType> kernel(Max(kernel_size, size_t(stage_ratio)));
+    DesignLowPassFilter<KernelElementType>(
+        kernel,
+        WindowEquation<RealType, Window::kKaiser>(
+            CalculateKaiserBeta(kIntermediateStageAttenuation)),
+        RealType(0.5) / stage_ratio,
+        RealType(1));
+
+    stage.SetRatioAndKernel(stage_ratio, kernel);
+  }
+
+  // Calculate size of the work buffer needed for the output of the first
+  // stage.
+  auto CalcFirstStageOutputBufferSize(const size_t num_input_samples) const
+      -> size_t {
+    if (use_cic_) {
+      return cic_stage_.CalcNeededOutputBufferSize(num_input_samples);
+    }
+    if (!half_band_stages_.empty()) {
+      return half_band_stages_.front().CalcNeededOutputBufferSize(
+          num_input_samples);
+    }
+    return decimator_stages_.front().CalcNeededOutputBufferSize(
+        num_input_samples);
+  }
+
+  Options options_{.ratio = 0};
+
+  int num_stages_{0};
+
+  bool use_cic_{false};
+  CICStage cic_stage_;
+
+  Vector<HalfBandStage> half_band_stages_;
+  Vector<DecimatorStage> decimator_stages_;
+
+  // Work buffer for the output of the first stage and in-place processing of
+  // the intermediate stages.
+  Vector<SampleType> buffer_;
+};
+
+}  // namespace radio_core::signal
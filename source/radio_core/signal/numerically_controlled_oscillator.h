@@ -0,0 +1,238 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Numerically controlled oscillator (NCO) of a given frequency with given
+// sample rate.
+//
+// Provides the same interface as the LocalOscillator, but keeps the phase in a
+// 32-bit fixed point accumulator and calculates the sine and cosine using a
+// lookup table with linear interpolation. This avoids the evaluation of the
+// trigonometric functions and the branching on the phase wrap for every
+// sample: the phase wraps naturally on the integer overflow.
+//
+// The phase is measured in the units of 2^-32 of the full turn. The frequency
+// is quantized to sample_rate / 2^32, and the phase accumulation is exact, so
+// the phase does not drift with time.
+//
+// The sine table has 1024 entries per full turn. The worst-case amplitude error
+// of the linear interpolation is (2 * pi / 1024)^2 / 8 ~= 4.7e-6, which limits
+// the level of the spurs and the phase noise caused by the table to -106 dBc.
+// Together with the single precision rounding the error of the generated
+// samples does not exceed 5e-6.
+//
+// The block API generates multiple samples at once. When the platform has wide
+// enough vector registers it uses the vectorized sine and cosine instead of the
+// table, with the error within the same bound.
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "radio_core/base/constants.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/complex8.h"
+#include "radio_core/math/float8.h"
+#include "radio_core/math/math.h"
+
+namespace radio_core::signal {
+
+namespace nco_internal {
+
+// Number of bits of the phase used to index the sine table.
+inline constexpr int kTableSizeBits = 10;
+inline constexpr int kTableSize = 1 << kTableSizeBits;
+
+// Number of bits of the phase used for the linear interpolation between the
+// table entries.
+inline constexpr int kFractionBits = 32 - kTableSizeBits;
+
+// Sine of the full turn, with an extra entry which equals to the first one, so
+// that the interpolation does not need to wrap the index.
+template <class RealType>
+auto GetSineTable() -> const std::array<RealType, kTableSize + 1>& {
+  static const std::array<RealType, kTableSize + 1> table = []() {
+    std::array<RealType, kTableSize + 1> result;
+    for (int i = 0; i <= kTableSize; ++i) {
+      result[i] = RealType(Sin(2 * constants::pi * double(i) / kTableSize));
+    }
+    return result;
+  }();
+  return table;
+}
+
+// Phase increment per sample of the given frequency, in the units of 2^-32 of
+// the full turn.
+//
+// Negative frequencies wrap around and correspond to the clockwise rotation.
+template <class RealType>
+inline auto PhaseIncrement(const RealType frequency,
+                           const RealType sample_rate) -> uint32_t {
+  assert(sample_rate > 0);
+
+  const double turns_per_sample = double(frequency) / double(sample_rate);
+  const double fraction = turns_per_sample - Floor(turns_per_sample);
+
+  return uint32_t(uint64_t(fraction * 4294967296.0 + 0.5));
+}
+
+// Phase in radians within the [0 .. 2*pi) range.
+template <class RealType>
+inline auto PhaseToRadians(const uint32_t phase) -> RealType {
+  return RealType(phase) * RealType(2 * constants::pi / 4294967296.0);
+}
+
+// Phase in radians, in the [-pi .. pi) range.
+template <class RealType>
+inline auto PhaseToSignedRadians(const uint32_t phase) -> RealType {
+  return RealType(int32_t(phase)) * RealType(constants::pi / 2147483648.0);
+}
+
+// Phase of the given angle in radians.
+template <class RealType>
+inline auto RadiansToPhase(const RealType radians) -> uint32_t {
+  const double turns = double(radians) / (2 * constants::pi);
+  const double fraction = turns - Floor(turns);
+  return uint32_t(uint64_t(fraction * 4294967296.0 + 0.5));
+}
+
+// Sine of the phase using the table and the linear interpolation.
+template <class RealType>
+inline auto TableSine(const RealType* table, const uint32_t phase)
+    -> RealType {
+  constexpr RealType kFractionScale = RealType(1) / (1 << kFractionBits);
+
+  const uint32_t index = phase >> kFractionBits;
+  const RealType fraction =
+      RealType(phase & ((uint32_t(1) << kFractionBits) - 1)) * kFractionScale;
+
+  return Lerp(table[index], table[index + 1], fraction);
+}
+
+// Cosine of the phase using the table and the linear interpolation.
+template <class RealType>
+inline auto TableCosine(const RealType* table, const uint32_t phase)
+    -> RealType {
+  return TableSine(table, phase + (uint32_t(1) << 30));
+}
+
+}  // namespace nco_internal
+
+template <class RealType>
+class NumericallyControlledOscillator {
+ public:
+  NumericallyControlledOscillator() = default;
+
+  NumericallyControlledOscillator(const RealType frequency,
+                                  const RealType sample_rate) {
+    Configure(frequency, sample_rate);
+  }
+
+  // Configure the frequency of the oscillator.
+  //
+  // The current phase is kept, so the oscillator can be re-configured to a
+  // different frequency without discontinuity of the generated signal.
+  void Configure(const RealType frequency, const RealType sample_rate) {
+    phase_increment_ =
+        nco_internal::PhaseIncrement<RealType>(frequency, sample_rate);
+  }
+
+  // Offset the phase from the current state by the given value.
+  // Phase is measured in radians.
+  inline void OffsetPhase(const RealType phase_offset) {
+    phase_ += nco_internal::RadiansToPhase<RealType>(phase_offset);
+  }
+
+  // Generate next value for phase.
+  // Phase is measured in the range of [0 .. 2*pi].
+  inline auto Phase() -> RealType {
+    const RealType phase = nco_internal::PhaseToRadians<RealType>(phase_);
+    phase_ += phase_increment_;
+    return phase;
+  }
+
+  // Generate next sample of sine or a cosine wave.
+  inline auto Sine() -> RealType {
+    const RealType sine = nco_internal::TableSine(table_, phase_);
+    phase_ += phase_increment_;
+    return sine;
+  }
+  inline auto Cosine() -> RealType {
+    const RealType cosine = nco_internal::TableCosine(table_, phase_);
+    phase_ += phase_increment_;
+    return cosine;
+  }
+
+  // Generate sample of a quadrature signal.
+  //
+  // The real part of the complex value corresponds to the in-phase signal,
+  // the imaginary part corresponds to the quadrature signal.
+  //
+  // The output value rotates counter-clockwise with an increase of the phase.
+  inline auto IQ() -> BaseComplex<RealType> {
+    const BaseComplex<RealType> iq(nco_internal::TableCosine(table_, phase_),
+                                   nco_internal::TableSine(table_, phase_));
+    phase_ += phase_increment_;
+    return iq;
+  }
+
+  // Generate samples of a quadrature signal and write them to the output.
+  //
+  // Equivalent to calling IQ() for every element of the output, but might
+  // process multiple samples at once using the vectorized sine and cosine.
+  void IQ(const std::span<BaseComplex<RealType>> output) {
+    BaseComplex<RealType>* output_ptr = output.data();
+    BaseComplex<RealType>* output_end = output_ptr + output.size();
+
+    // The 4-element vectorized sine and cosine are slower than the table
+    // lookup, so only the wider registers are used.
+    if constexpr (std::is_same_v<RealType, float> && Float8::kIsVectorized) {
+      output_ptr = GenerateVectorizedIQ<Float8, Complex8>(
+          output_ptr, output_ptr + (output.size() & ~size_t(7)));
+    }
+
+    while (output_ptr < output_end) {
+      *output_ptr++ = IQ();
+    }
+  }
+
+ private:
+  // Generate samples from the output_ptr until the output_end, which is
+  // expected to be aligned to the number of elements of the vectorized type.
+  // Returns the pointer past the last written sample.
+  template <class FloatN, class ComplexN>
+  auto GenerateVectorizedIQ(BaseComplex<RealType>* output_ptr,
+                            BaseComplex<RealType>* output_end)
+      -> BaseComplex<RealType>* {
+    constexpr int N = FloatN::kSize;
+
+    RealType radians[N];
+
+    while (output_ptr < output_end) {
+      for (int i = 0; i < N; ++i) {
+        radians[i] = nco_internal::PhaseToSignedRadians<RealType>(
+            phase_ + uint32_t(i) * phase_increment_);
+      }
+      phase_ += uint32_t(N) * phase_increment_;
+
+      FloatN sin, cos;
+      SinCos(FloatN(radians), sin, cos);
+      ComplexN(cos, sin).Store(output_ptr);
+
+      output_ptr += N;
+    }
+
+    return output_ptr;
+  }
+
+  const RealType* table_{nco_internal::GetSineTable<RealType>().data()};
+
+  uint32_t phase_increment_{0};
+  uint32_t phase_{0};
+};
+
+}  // namespace radio_core::signal
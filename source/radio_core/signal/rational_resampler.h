@@ -0,0 +1,246 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Resample signal by a rational factor L/M.
+//
+// Conceptually the resampler upsamples the input signal by the interpolation
+// factor L, applies an anti-alias and anti-imaging low-pass filter, and
+// downsamples the result by the decimation factor M.
+//
+// The implementation follows polyphase form of the resampler [1]: the filter
+// is decomposed into L polyphase components, and every output sample only
+// evaluates the single component which corresponds to its phase. Neither the
+// zero samples inserted by the upsampler, nor the samples discarded by the
+// downsampler are ever calculated.
+//
+// References:
+//
+//   [1] Orfanidis, Sophocles J. Introduction to Signal Processing.
+//       Upper Saddle River, NJ: Prentice-Hall, 1996.
+//
+//   [2] Polyphase decomposition
+//       https://www.dsprelated.com/freebooks/sasp/Polyphase_Decomposition.html
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "radio_core/base/algorithm.h"
+#include "radio_core/base/container.h"
+#include "radio_core/math/kernel/dot.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal/filter_design.h"
+#include "radio_core/signal/polyphase_filter.h"
+#include "radio_core/signal/window.h"
+
+namespace radio_core::signal {
+
+template <class SampleType,
+          class KernelElementType = SampleType,
+          template <class> class Allocator = std::allocator>
+class RationalResampler {
+  template <class T>
+  using Vector = std::vector<T, Allocator<T>>;
+
+ public:
+  // Default constructor.
+  //
+  // Leaves object uninitialized. When this path is used an explicit call to
+  // `SetRatio()` is expected before performing resampling, otherwise the
+  // object will have an undefined behavior.
+  RationalResampler() = default;
+
+  // Construct resampler with pre-defined interpolation and decimation factors.
+  RationalResampler(const int interpolation, const int decimation) {
+    SetRatio(interpolation, decimation);
+  }
+
+  // Set interpolation and decimation factors.
+  //
+  // The factors are reduced to their lowest terms, so that the resampling with
+  // the ratio of 6/4 is the same as the resampling with the ratio of 3/2.
+  //
+  // If the current ratio is the same as the new one then nothing happens.
+  void SetRatio(const int interpolation, const int decimation) {
+    // Pseudonym for real-typed scalar values. Depending on the kernel this is
+    // typically either float or double.
+    using RealType = ComputeType<KernelElementType>;
+
+    assert(interpolation > 0);
+    assert(decimation > 0);
+
+    const int divisor = std::gcd(interpolation, decimation);
+    const int new_interpolation = interpolation / divisor;
+    const int new_decimation = decimation / divisor;
+
+    if (interpolation_ == new_interpolation && decimation_ == new_decimation) {
+      // Avoid re-initialization if the ratio did not change.
+      return;
+    }
+
+    interpolation_ = new_interpolation;
+    decimation_ = new_decimation;
+
+    // Follow the same kernel size heuristic as the Decimator and Interpolator,
+    // which is 20 times the largest of the factors. Round the size up, so that
+    // every polyphase component has the same size.
+    const int max_factor = Max(interpolation_, decimation_);
+    const size_t num_taps_per_phase =
+        (20 * max_factor + 1 + interpolation_ - 1) / interpolation_;
+    const size_t kernel_size = num_taps_per_phase * interpolation_;
+
+    Vector<KernelElementType> kernel(kernel_size);
+
+    // Low-pass filter at the upsampled sample rate, rejecting frequencies above
+    // of the lowest of the input and output Nyquist frequencies.
+    DesignLowPassFilter<KernelElementType>(
+        kernel,
+        WindowEquation<RealType, Window::kBlackman>(),
+        RealType(0.5) / max_factor,
+        RealType(1));
+
+    // Compensate the energy lost by the upsampling.
+    for (KernelElementType& coefficient : kernel) {
+      coefficient *= interpolation_;
+    }
+
+    // Decompose the filter into components, and store every component in the
+    // reverse order, so that the dot product can be applied on the samples
+    // stored in the chronological order.
+    polyphase_kernels_.resize(interpolation_);
+    for (int l = 0; l < interpolation_; ++l) {
+      Vector<KernelElementType>& component = polyphase_kernels_[l];
+      component.resize(num_taps_per_phase);
+      PolyphaseComponentDecomposition<KernelElementType>(
+          kernel, interpolation_, l, component);
+      std::reverse(component.begin(), component.end());
+    }
+
+    // Reset the state.
+    num_history_samples_ = num_taps_per_phase - 1;
+    samples_.resize(num_history_samples_);
+    std::fill(samples_.begin(), samples_.end(), SampleType(0));
+    phase_ = 0;
+    input_index_ = 0;
+  }
+
+  inline auto GetInterpolation() const -> int { return interpolation_; }
+  inline auto GetDecimation() const -> int { return decimation_; }
+
+  // Resample multiple input samples.
+  //
+  // The output buffer must have enough elements to hold result of the
+  // resampled samples. Use the `CalcNeededOutputBufferSize()` to calculate
+  // the needed buffer size.
+  //
+  // The input and output buffers might be the same, as long as the buffer is
+  // big enough for the output.
+  //
+  // Returns a subspan of the output samples buffer which was written by this
+  // call.
+  auto operator()(const std::span<const SampleType> input_samples,
+                  const std::span<SampleType> output_samples)
+      -> std::span<SampleType> {
+    assert(interpolation_ != 0);
+
+    if (interpolation_ == 1 && decimation_ == 1) {
+      assert(output_samples.size() >= input_samples.size());
+      std::copy(
+          input_samples.begin(), input_samples.end(), output_samples.begin());
+      return output_samples.subspan(0, input_samples.size());
+    }
+
+    const size_t num_input_samples = input_samples.size();
+
+    // Append the input samples after the history.
+    //
+    // This is done prior to writing anything to the output, which makes it
+    // possible for the input and output buffers to alias.
+    EnsureSizeAtLeast(samples_, num_history_samples_ + num_input_samples);
+    std::copy(input_samples.begin(),
+              input_samples.end(),
+              samples_.begin() + num_history_samples_);
+
+    const std::span<const SampleType> samples(samples_);
+    const size_t num_taps_per_phase = num_history_samples_ + 1;
+
+    size_t num_output_samples = 0;
+    while (input_index_ < num_input_samples) {
+      assert(num_output_samples < output_samples.size());
+
+      output_samples[num_output_samples++] =
+          kernel::Dot<SampleType, KernelElementType>(
+              samples.subspan(input_index_, num_taps_per_phase),
+              polyphase_kernels_[phase_]);
+
+      // Advance the position in the upsampled signal by the decimation factor.
+      phase_ += decimation_;
+      input_index_ += phase_ / interpolation_;
+      phase_ %= interpolation_;
+    }
+
+    // Keep the history needed for the next call.
+    std::copy(samples_.begin() + num_input_samples,
+              samples_.begin() + num_input_samples + num_history_samples_,
+              samples_.begin());
+    input_index_ -= num_input_samples;
+
+    return output_samples.subspan(0, num_output_samples);
+  }
+
+  inline auto operator()(const std::span<SampleType> samples)
+      -> std::span<SampleType> {
+    return (*this)(samples, samples);
+  }
+
+  // Calculate required output buffer size for the given number of input
+  // samples.
+  //
+  // The calculation gives the worst case scenario, which means that the output
+  // buffer size can only be calculated once if the resampling happens for a
+  // fixed input buffer size.
+  inline auto CalcNeededOutputBufferSize(const size_t num_input_samples) const
+      -> size_t {
+    assert(interpolation_ != 0);
+
+    return (num_input_samples * interpolation_ + decimation_ - 1) /
+           decimation_;
+  }
+
+  // Pre-allocate work buffers for resampling up to the given number of input
+  // samples at a time.
+  //
+  // Resampling of input buffers which are not bigger than the reserved size
+  // does not allocate memory.
+  //
+  // The reservation is to be done after the ratio is set.
+  void Reserve(const size_t max_num_input_samples) {
+    EnsureSizeAtLeast(samples_, num_history_samples_ + max_num_input_samples);
+  }
+
+ private:
+  // Interpolation factor L and decimation factor M, in their lowest terms.
+  int interpolation_{0};
+  int decimation_{0};
+
+  // Polyphase components of the filter, each stored in the reverse order.
+  Vector<Vector<KernelElementType>> polyphase_kernels_;
+
+  // The history samples needed to calculate the first output sample, followed
+  // by the samples of the current input buffer.
+  size_t num_history_samples_{0};
+  Vector<SampleType> samples_;
+
+  // Position of the next output sample: the index of the latest input sample
+  // it depends on (relative to the input buffer) and its polyphase component.
+  size_t input_index_{0};
+  int phase_{0};
+};
+
+}  // namespace radio_core::signal
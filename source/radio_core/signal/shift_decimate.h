@@ -0,0 +1,97 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Shift frequency of a quadrature signal and decimate it in a single pass over
+// the memory.
+//
+// The straightforward way of shifting the signal prior to the decimation is to
+// rotate the whole input block into a work buffer, and then decimate the work
+// buffer. For the blocks of a high sample rate input the work buffer does not
+// fit into the CPU cache, so the shifted samples are written to the main memory
+// and then read back by the decimator.
+//
+// This function splits the input into chunks which fit into the CPU cache: a
+// chunk is rotated into a small chunk buffer and is immediately consumed by the
+// decimator, while it is still in the cache. The result is the same as of the
+// separate shift and decimation.
+//
+// Example:
+//
+//   signal::FrequencyShifter<float> shifter(100000, 6000000);
+//   signal::MultiStageDecimator<Complex, float> decimator(25);
+//
+//   std::array<Complex, signal::kShiftDecimateChunkSize> chunk_buffer;
+//
+//   const std::span<Complex> if_samples = signal::ShiftAndDecimate(
+//       shifter, decimator, iq_samples, chunk_buffer, if_buffer);
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <span>
+
+#include "radio_core/math/complex.h"
+#include "radio_core/signal/frequency_shifter.h"
+
+namespace radio_core::signal {
+
+// Default number of samples in the chunk buffer.
+//
+// Is chosen so that the chunk of single precision complex samples fits into
+// the L1 data cache of the most CPUs, and the overhead of the per-call state
+// handling of the decimator stays low.
+inline constexpr size_t kShiftDecimateChunkSize = 2048;
+
+// Shift the frequency of the input samples using the given shifter, and
+// decimate them using the given decimator.
+//
+// The decimator is to provide the same API as the Decimator: an operator()
+// which takes input and output spans, and CalcNeededOutputBufferSize().
+//
+// The chunk buffer is used to hold the shifted samples of a chunk. Its size
+// defines the size of the chunk, and it is not to alias neither input nor
+// output.
+//
+// The output buffer must have enough elements to hold result of the
+// downsampled samples: at least the decimator's CalcNeededOutputBufferSize()
+// for the number of input samples.
+//
+// Returns a subspan of the output samples buffer which was written by this
+// call.
+template <class T, class Decimator>
+inline auto ShiftAndDecimate(
+    FrequencyShifter<T>& shifter,
+    Decimator& decimator,
+    const std::span<const BaseComplex<T>> input_samples,
+    const std::span<BaseComplex<T>> chunk_buffer,
+    const std::span<BaseComplex<T>> output_samples)
+    -> std::span<BaseComplex<T>> {
+  assert(!chunk_buffer.empty());
+  assert(output_samples.size() >=
+         decimator.CalcNeededOutputBufferSize(input_samples.size()));
+
+  const size_t num_input_samples = input_samples.size();
+  const size_t chunk_size = chunk_buffer.size();
+
+  size_t num_output_samples = 0;
+
+  for (size_t offset = 0; offset < num_input_samples; offset += chunk_size) {
+    const size_t num_chunk_samples =
+        std::min(chunk_size, num_input_samples - offset);
+
+    const std::span<BaseComplex<T>> shifted_chunk = shifter(
+        input_samples.subspan(offset, num_chunk_samples), chunk_buffer);
+
+    const std::span<BaseComplex<T>> decimated_chunk = decimator(
+        std::span<const BaseComplex<T>>(shifted_chunk),
+        output_samples.subspan(num_output_samples));
+
+    num_output_samples += decimated_chunk.size();
+  }
+
+  return output_samples.subspan(0, num_output_samples);
+}
+
+}  // namespace radio_core::signal
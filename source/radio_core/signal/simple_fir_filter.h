@@ -20,9 +20,10 @@ namespace radio_core::signal {
 template <class SampleType,
           class KernelElementType,
           template <class> class Allocator = std::allocator>
-class SimpleFIRFilter : public FIRFilter<SampleType, KernelElementType> {
+class SimpleFIRFilter
+    : public FIRFilter<SampleType, KernelElementType, Allocator> {
  public:
-  using BaseClass = FIRFilter<SampleType, KernelElementType>;
+  using BaseClass = FIRFilter<SampleType, KernelElementType, Allocator>;
 
   using BaseClass::BaseClass;
 
@@ -53,6 +54,8 @@ class SimpleFIRFilter : public FIRFilter<SampleType, KernelElementType> {
     SetKernelSize(kernel.size());
 
     std::copy(kernel.begin(), kernel.end(), kernel_.begin());
+
+    BaseClass::UpdateKernelSymmetry();
   }
 
   using BaseClass::GetKernel;
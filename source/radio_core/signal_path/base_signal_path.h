@@ -13,19 +13,43 @@
 // does not perform any thread synchronization which makes it portable on
 // various devices, but requires manual thread synchronization: the signal path
 // is not to be modified or re-configured while it processes samples.
+//
+// The work buffers of the signal path grow on demand to fit the pushed blocks
+// of samples. The Reserve() allocates them upfront for the given maximum block
+// size, so that the processing does not allocate memory. This is important for
+// processing in real-time threads. Debug builds assert that the processing of
+// the reserved blocks does not allocate memory via the ArenaAllocator, which
+// also allows to allocate all buffers of the path from a single arena.
+//
+// The path can operate on half precision samples. In this case the samples of
+// the input and the intermediate frequency stages, as well as the kernels of
+// the filters of these stages are stored in half precision, which halves the
+// memory bandwidth of the processing at high sample rates. The configuration,
+// the design of the filters and the audio frequency stage use the ComputeType
+// of the sample type (single precision floating point).
+//
+// The FFT type is passed to the receive filter, which uses it for the fast
+// convolution of long kernels (see ReceiveFilter). The FFT of half precision
+// samples is not supported, so the void FFT type is to be used for them.
 
 #pragma once
 
+#include <cassert>
 #include <memory>
 #include <span>
+#include <type_traits>
 #include <vector>
 
 #include "radio_core/base/container.h"
+#include "radio_core/base/no_allocation_scope.h"
+#include "radio_core/math/kernel/gain_ramp.h"
 #include "radio_core/modulation/analog/bandwidth.h"
 #include "radio_core/modulation/analog/iq_demodulator.h"
-#include "radio_core/signal/decimator.h"
 #include "radio_core/signal/ema_agc.h"
 #include "radio_core/signal/frequency_shifter.h"
+#include "radio_core/signal/multi_stage_decimator.h"
+#include "radio_core/signal/rational_resampler.h"
+#include "radio_core/signal/shift_decimate.h"
 #include "radio_core/signal_path/internal/decimation_ratio.h"
 #include "radio_core/signal_path/internal/demodulator.h"
 #include "radio_core/signal_path/internal/receive_filter.h"
@@ -76,9 +100,12 @@ struct StageTraits<RealType, Stage::kIF> {
 };
 
 // Audio frequency stage.
+//
+// The demodulated signal uses the ComputeType: the audio is processed at a low
+// sample rate, and its processing is sensitive to the precision.
 template <class RealType>
 struct StageTraits<RealType, Stage::kAF> {
-  using SampleType = RealType;
+  using SampleType = ComputeType<RealType>;
   using SinkType = Sink<SampleType>;
 };
 
@@ -89,7 +116,7 @@ struct StageTraits<RealType, Stage::kAF> {
 template <class RealType, template <class> class Allocator = std::allocator>
 struct Sinks {
   SinkCollection<BaseComplex<RealType>, Allocator> if_sink;
-  SinkCollection<RealType, Allocator> af_sink;
+  SinkCollection<ComputeType<RealType>, Allocator> af_sink;
 };
 
 // Accessor to an attachable sink collection at the specified by the template
@@ -127,10 +154,15 @@ struct SinkAccessor<RealType, Allocator, Stage::kAF> {
 
 }  // namespace signal_path_internal
 
-template <class T, template <class> class Allocator = std::allocator>
+template <class T,
+          template <class> class Allocator = std::allocator,
+          class FFTType = void>
 class BaseSignalPath : public Sink<BaseComplex<T>> {
-  using Demodulator = internal::Demodulator<T, Allocator>;
-  using ReceiveFilter = internal::ReceiveFilter<T, Allocator>;
+  // Type used for the configuration and the audio frequency stage.
+  using RealType = ComputeType<T>;
+
+  using Demodulator = internal::Demodulator<RealType, Allocator>;
+  using ReceiveFilter = internal::ReceiveFilter<T, Allocator, FFTType>;
 
  public:
   struct Options {
@@ -143,7 +175,20 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
       //
       // If the IQ signal centered around 145.4 MHz and the radio station of
       // interest is at 145.3 MHz the shift is to be set to 100000.
-      T frequency_shift{0};
+      RealType frequency_shift{0};
+
+      // Shift the frequency and decimate the input samples in chunks which
+      // fit into the CPU cache (see signal::ShiftAndDecimate()).
+      //
+      // When disabled the whole input block is shifted into a work buffer
+      // prior to the decimation, which costs an extra round-trip of the block
+      // through the main memory at high input sample rates.
+      //
+      // The shift_decimate benchmark shows the fused processing being faster
+      // at all decimation ratios between 2 and 200 (by 6-22%, 1M samples,
+      // minimum of 15 interleaved runs pinned to one core), except for the
+      // ratio 25 where both are on par.
+      bool fused_shift_decimate{true};
     } input;
 
     // Receive filter.
@@ -152,7 +197,7 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
     // sample rate prior to sending the signal to the demodulator.
     struct {
       // Bandwidth of the receive filter, in hertz.
-      T bandwidth{1200};
+      RealType bandwidth{1200};
 
       // Accuracy of the bandwidth, should be equal or less than 1.
       //
@@ -165,10 +210,24 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
       // with the filter bandwidth being off by 4%. If the accuracy is 1 the IF
       // sample rate would to be 1200 kHz, and overall processing will be 4x
       // slower.
-      T bandwidth_accuracy{0.95};
+      RealType bandwidth_accuracy{0.95};
 
       // Width of the transition band measured as a factor of the bandwidth.
-      T transition_band_factor{0.05};
+      RealType transition_band_factor{0.05};
+
+      // Run the demodulator at the sample rate the receive filter operates at.
+      //
+      // For bandwidths which are narrow compared to the IF sample rate the
+      // receive filter decimates the signal prior to filtering, and then
+      // interpolates it back to the IF sample rate. When this option is
+      // enabled the interpolation is skipped, and the filtered signal is
+      // demodulated at the decimated sample rate and then resampled directly
+      // to the audio sample rate. This avoids interpolation which is followed
+      // by the decimation back again.
+      //
+      // The IF stage sink receives samples at the demodulator sample rate,
+      // which is reported by GetIFSampleRate().
+      bool demodulate_at_filter_rate{false};
     } receive_filter;
 
     // NOTE: Sample rates in the specific demodulator options are overwritten by
@@ -182,8 +241,8 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
       struct {
         bool enabled{true};
 
-        T charge_rate{0.007};
-        T discharge_rate{0.00003};
+        RealType charge_rate{0.007};
+        RealType discharge_rate{0.00003};
       } agc;
 
       // Configuration of soft transition when radio is first started and when
@@ -198,8 +257,8 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
       // desired level whenever the radio settings affecting modulation are
       // changed. This gives AGC time to re-adjust and avoids popping sound when
       // modulation setting is changed.
-      T soft_startup_time{1};
-      T soft_configure_time{0.1};
+      RealType soft_startup_time{1};
+      RealType soft_configure_time{0.1};
     } audio;
   };
 
@@ -225,14 +284,34 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
     }
 
     ConfigureDecimation(options);
+    ConfigureReceiveFilter(options);
 
     ConfigureInputFrequencyShifter(options);
-    ConfigureReceiveFilter(options);
 
     ConfigureDemodulator(options);
 
     ConfigureAudioOutput(options);
 
+    // The configuration might have changed the sizes of the work buffers.
+    if (max_block_size_) {
+      ReserveUnsafe(max_block_size_);
+    }
+
+    Unlock();
+  }
+
+  // Pre-allocate work buffers for processing blocks of up to the given number
+  // of input samples.
+  //
+  // Pushing blocks which are not bigger than the reserved size does not
+  // allocate memory. The reservation is kept when the path is re-configured.
+  //
+  // When the path uses the ArenaAllocator the buffers are allocated from the
+  // arena which is current for the calling thread.
+  void Reserve(const size_t max_block_size) {
+    Lock();
+    max_block_size_ = max_block_size;
+    ReserveUnsafe(max_block_size);
     Unlock();
   }
 
@@ -277,6 +356,8 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
   // Signal at this stage has passed through frequency shift and the input
   // receive filter.
   //
+  // The sample rate of the signal is GetIFSampleRate().
+  //
   // The signal path references the sink, so caller needs to ensure the lifetime
   // of the sink.
   void AddIFSink(IFSink& sink) { AddSink<Stage::kIF>(sink); }
@@ -297,19 +378,124 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
   void PushSamples(std::span<const BaseComplex<T>> input_iq_samples) override {
     Lock();
 
-    // Make sure the work buffers are big enough for the samples.
+    const NoAllocationScope no_allocation_scope(
+        IsReservedFor(input_iq_samples.size()));
+
+    EnsureSizeAtLeast(if_buffer_,
+                      CalcNeededIFBufferSize(input_iq_samples.size()));
+
+    const std::span<BaseComplex<T>> if_samples =
+        ProcessIFStage(input_iq_samples, if_buffer_);
+    ProcessAFStage(if_samples);
+
+    Unlock();
+  }
 
+  // Get configured sample rate at the different stages.
+  //
+  // The IF sample rate is the sample rate of the demodulator input, which is
+  // lower than the sample rate the receive filter is applied at when the path
+  // demodulates at the receive filter sample rate.
+  auto GetInputSampleRate() const -> int { return input_sample_rate_; }
+  auto GetIFSampleRate() const -> int { return if_sample_rate_; }
+  auto GetAFSampleRate() const -> int { return af_sample_rate_; }
+
+  // Get receive filter configuration.
+  auto GetReceiveFilterDecimationRatio() -> RealType {
+    return RealType(receive_filter_.GetDecimationRatio());
+  }
+  auto GetReceiveFilterBandwidth() -> RealType {
+    return receive_filter_.GetBandwidth();
+  }
+  auto GetReceiveFilterTransitionBand() -> RealType {
+    return receive_filter_.GetTransitionBand();
+  }
+  auto GetReceiveFilterKernelSize() -> size_t {
+    return receive_filter_.GetKernelSize();
+  }
+
+ protected:
+  // Thread synchronization: an explicit lock/unlock functionality.
+  virtual void Lock() {}
+  virtual void Unlock() {}
+
+  // Stages of the signal processing.
+  //
+  // The PushSamples() runs both stages one after another. The stages are
+  // exposed to subclasses so that they can be run from different threads, with
+  // the IF samples handed over between them.
+  //
+  // Each stage uses its own state and work buffers, so the IF stage of the
+  // next block can be processed while the AF stage processes the current one.
+  // The caller is responsible for the thread synchronization.
+
+  // Pre-allocate work buffers of the stages for processing blocks of up to the
+  // given number of input samples.
+  //
+  // Subclasses which have their own work buffers extend this function.
+  // Is called with the signal path locked.
+  virtual void ReserveUnsafe(const size_t max_block_size) {
+    const size_t if_buffer_size = CalcNeededIFBufferSize(max_block_size);
+
+    EnsureSizeAtLeast(iq_buffer_, CalcNeededIQBufferSize(max_block_size));
+    EnsureSizeAtLeast(if_buffer_, if_buffer_size);
+    if constexpr (kConvertIFSamples) {
+      EnsureSizeAtLeast(demodulator_buffer_, if_buffer_size);
+    }
+    EnsureSizeAtLeast(
+        af_buffer_,
+        Max(if_buffer_size,
+            af_resampler_.CalcNeededOutputBufferSize(if_buffer_size)));
+
+    if_decimator_.Reserve(max_block_size);
+    receive_filter_.Reserve(
+        if_decimator_.CalcNeededOutputBufferSize(max_block_size));
+    af_resampler_.Reserve(if_buffer_size);
+  }
+
+  // Returns true if the work buffers are reserved for processing a block of
+  // the given number of input samples.
+  inline auto IsReservedFor(const size_t num_input_samples) const -> bool {
+    return num_input_samples <= max_block_size_;
+  }
+
+  // Calculate size of the IQ work buffer needed to process the given number of
+  // input samples by the ProcessIFStage().
+  auto CalcNeededIQBufferSize(const size_t num_input_samples) const
+      -> size_t {
+    if (fused_shift_decimate_) {
+      return signal::kShiftDecimateChunkSize;
+    }
+    return num_input_samples;
+  }
+
+  // Calculate size of the IF buffer needed to process the given number of
+  // input samples by the ProcessIFStage().
+  auto CalcNeededIFBufferSize(const size_t num_input_samples) const -> size_t {
     const size_t decimated_if_size =
-        if_decimator_.CalcNeededOutputBufferSize(input_iq_samples.size());
+        if_decimator_.CalcNeededOutputBufferSize(num_input_samples);
     const size_t filtered_if_size =
         receive_filter_.CalcNeededOutputBufferSize(decimated_if_size);
-    const size_t if_buffer_size = Max(decimated_if_size, filtered_if_size);
-
-    EnsureSizeAtLeast(iq_buffer_, input_iq_samples.size());
-    EnsureSizeAtLeast(if_buffer_, if_buffer_size);
-    EnsureSizeAtLeast(af_buffer_, if_buffer_.size());
+    return Max(decimated_if_size, filtered_if_size);
+  }
 
-    // Shift the frequency.
+  // Shift, decimate and filter the input IQ samples, and push the result to
+  // the IF sinks.
+  //
+  // The IF buffer is to have at least the CalcNeededIFBufferSize() elements.
+  //
+  // Returns subspan of the IF buffer with the samples to be demodulated.
+  auto ProcessIFStage(std::span<const BaseComplex<T>> input_iq_samples,
+                      std::span<BaseComplex<T>> if_buffer)
+      -> std::span<BaseComplex<T>> {
+    assert(if_buffer.size() >=
+           CalcNeededIFBufferSize(input_iq_samples.size()));
+
+    EnsureSizeAtLeast(iq_buffer_,
+                      CalcNeededIQBufferSize(input_iq_samples.size()));
+
+    // Shift the frequency and decimate IQ samples from the radio sampling rate
+    // to the IF sampling rate.
     //
     // TODO(sergey): Look into some const-expression way to disable the shift,
     // to help using the pipeline on a slow hardware.
@@ -317,17 +503,23 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
     // On a fast hardware always use the frequency shift to avoid situations
     // when user input increases compute power, and help debugging the
     // bottlenecks and thr worst case processing scenario.
-    const std::span<BaseComplex<T>> shifted_iq_samples =
-        iq_frequency_shifter_(input_iq_samples, iq_buffer_);
-
-    // Decimated IQ samples from the radio sampling rate to the IF sampling
-    // rate.
-    const std::span<BaseComplex<T>> if_samples =
-        if_decimator_(shifted_iq_samples, if_buffer_);
+    std::span<BaseComplex<T>> if_samples;
+    if (fused_shift_decimate_) {
+      if_samples = signal::ShiftAndDecimate<T>(
+          iq_frequency_shifter_,
+          if_decimator_,
+          input_iq_samples,
+          std::span(iq_buffer_).subspan(0, signal::kShiftDecimateChunkSize),
+          if_buffer);
+    } else {
+      const std::span<BaseComplex<T>> shifted_iq_samples =
+          iq_frequency_shifter_(input_iq_samples, iq_buffer_);
+      if_samples = if_decimator_(shifted_iq_samples, if_buffer);
+    }
 
     // Apply bandwidth filter.
     const std::span<BaseComplex<T>> filtered_if_samples =
-        receive_filter_(if_samples, if_buffer_);
+        receive_filter_(if_samples, if_buffer);
 
     // Move the sideband back: the input frequency shifter centered the side
     // band around DC, but for de-modulation it needs to be moved to where it
@@ -336,59 +528,61 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
 
     sinks_.if_sink.PushSamples(filtered_if_samples);
 
+    return filtered_if_samples;
+  }
+
+  // Demodulate the IF samples, resample them to the audio sample rate, apply
+  // AGC and soft start volume, and push the result to the AF sinks.
+  void ProcessAFStage(std::span<const BaseComplex<T>> if_samples) {
+    EnsureSizeAtLeast(
+        af_buffer_,
+        Max(if_samples.size(),
+            af_resampler_.CalcNeededOutputBufferSize(if_samples.size())));
+
     // Demodulate the audio.
-    const std::span<T> demodulated_samples =
-        demodulator_(filtered_if_samples, af_buffer_);
-    const std::span<T> af_samples = af_decimator_(demodulated_samples);
+    const std::span<RealType> demodulated_samples =
+        demodulator_(ConvertIFSamples(if_samples), af_buffer_);
+    const std::span<RealType> af_samples =
+        af_resampler_(demodulated_samples, af_buffer_);
 
-    // AGC and soft start volume.
-    for (T& af_sample : af_samples) {
-      // TODO(sergey): Implement squelch.
+    // TODO(sergey): Implement squelch.
 
-      if (agc_enabled_) {
-        af_sample = agc_(af_sample);
-      }
-      af_sample *= soft_start_volume_ * soft_configure_volume_;
+    // AGC.
+    if (agc_enabled_) {
+      agc_(af_samples);
+    }
 
-      soft_start_volume_ = Min(T(1), soft_start_volume_ + soft_start_weight_);
-      soft_configure_volume_ =
-          Min(T(1), soft_configure_volume_ + soft_configure_weight_);
+    // Soft start volume.
+    //
+    // Once the volume has reached its maximum the ramp is a no-op, which is
+    // the case most of the time.
+    if (soft_start_volume_ < RealType(1)) {
+      kernel::GainRamp<RealType>(af_samples,
+                                 af_samples,
+                                 soft_start_volume_,
+                                 soft_start_weight_,
+                                 RealType(1));
+    }
+    if (soft_configure_volume_ < RealType(1)) {
+      kernel::GainRamp<RealType>(af_samples,
+                                 af_samples,
+                                 soft_configure_volume_,
+                                 soft_configure_weight_,
+                                 RealType(1));
     }
 
     // TODO(sergey): Consider adding an explicit AF filter, for modulation types
     // which has much lower bandwidth than the audio sink.
 
     sinks_.af_sink.PushSamples(af_samples);
-
-    Unlock();
   }
 
-  // Get configured sample rate at the different stages.
-  auto GetInputSampleRate() const -> int { return input_sample_rate_; }
-  auto GetIFSampleRate() const -> int { return if_sample_rate_; }
-  auto GetAFSampleRate() const -> int { return af_sample_rate_; }
-
-  // Get receive filter configuration.
-  auto GetReceiveFilterDecimationRatio() -> T {
-    return receive_filter_.GetDecimationRatio();
-  }
-  auto GetReceiveFilterBandwidth() -> T {
-    return receive_filter_.GetBandwidth();
-  }
-  auto GetReceiveFilterTransitionBand() -> T {
-    return receive_filter_.GetTransitionBand();
-  }
-  auto GetReceiveFilterKernelSize() -> size_t {
-    return receive_filter_.GetKernelSize();
-  }
-
- protected:
-  // Thread synchronization: an explicit lock/unlock functionality.
-  virtual void Lock() {}
-  virtual void Unlock() {}
-
  private:
-  using StagesDecimation = internal::StagesDecimation<T>;
+  using StagesDecimation = internal::StagesDecimation<RealType>;
+
+  // The IF samples are converted to the ComputeType prior to demodulation when
+  // the path operates on half precision samples.
+  static constexpr bool kConvertIFSamples = !std::is_same_v<T, RealType>;
 
   //////////////////////////////////////////////////////////////////////////////
   // Helpers.
@@ -400,9 +594,28 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
     return SinkAccessor<kStage>::Get(sinks_);
   }
 
+  // Convert the IF samples to the type the demodulator operates on.
+  // Returns the IF samples as-is when no conversion is needed.
+  auto ConvertIFSamples(std::span<const BaseComplex<T>> if_samples)
+      -> std::span<const BaseComplex<RealType>> {
+    if constexpr (kConvertIFSamples) {
+      EnsureSizeAtLeast(demodulator_buffer_, if_samples.size());
+
+      const size_t num_samples = if_samples.size();
+      for (size_t i = 0; i < num_samples; ++i) {
+        demodulator_buffer_[i] = BaseComplex<RealType>(
+            RealType(if_samples[i].real), RealType(if_samples[i].imag));
+      }
+
+      return std::span(demodulator_buffer_).subspan(0, num_samples);
+    } else {
+      return if_samples;
+    }
+  }
+
   // Non-thread guarded implementation of soft audio start configuration.
   inline void ResetSoftAudioStartUnsafe() {
-    soft_configure_volume_ = T(0);
+    soft_configure_volume_ = RealType(0);
     agc_.Reset();
   }
 
@@ -418,8 +631,8 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
   //
   // This offset allows to use simple low pass filter with real coefficients as
   // a receiver filter.
-  auto GetBandwidthOffsetToCenter(const Options& options) -> T {
-    const Interval<T> bandwidth_interval =
+  auto GetBandwidthOffsetToCenter(const Options& options) -> RealType {
+    const Interval<RealType> bandwidth_interval =
         modulation::analog::GetBandwidthIntervalAroundCenterFrequency(
             options.demodulator.modulation_type,
             options.receive_filter.bandwidth);
@@ -429,7 +642,7 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
   }
 
   void ConfigureInputFrequencyShifter(const Options& options) {
-    const T bandwidth_offset = GetBandwidthOffsetToCenter(options);
+    const RealType bandwidth_offset = GetBandwidthOffsetToCenter(options);
 
     // Configure the input frequency shifter, which applies the user-configured
     // frequency shift, as well as the shift needed to be able to use simple
@@ -449,29 +662,86 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
     af_sample_rate_ = options.audio.sample_rate;
 
     // Calculate decimation ratio between various stages.
-    const typename StagesDecimation::Ratio stage_ratio =
-        StagesDecimation::Calculate(
-            input_sample_rate_,
-            af_sample_rate_,
-            options.receive_filter.bandwidth *
-                options.receive_filter.bandwidth_accuracy);
-
-    if_decimator_.SetRatio(stage_ratio.iq_to_if);
-    af_decimator_.SetRatio(stage_ratio.if_to_af);
-
-    // Store calculated intermediate frequency stage sample rate.
-    if_sample_rate_ = input_sample_rate_ / stage_ratio.iq_to_if;
+    stage_ratio_ = StagesDecimation::Calculate(
+        input_sample_rate_,
+        af_sample_rate_,
+        options.receive_filter.bandwidth *
+            options.receive_filter.bandwidth_accuracy);
+
+    if_decimator_.SetRatio(stage_ratio_.iq_to_if);
+    fused_shift_decimate_ = options.input.fused_shift_decimate;
+
+    // Store calculated sample rate of the signal after decimation.
+    // This is the sample rate the receive filter operates on.
+    decimated_if_sample_rate_ = input_sample_rate_ / stage_ratio_.iq_to_if;
   }
 
+  // Configure the receive filter and the resampling to the audio sample rate.
   void ConfigureReceiveFilter(const Options& options) {
-    const typename ReceiveFilter::Options filter_options = {
-        .sample_rate = T(if_sample_rate_),
+    typename ReceiveFilter::Options filter_options = {
+        .sample_rate = RealType(decimated_if_sample_rate_),
         .bandwidth = options.receive_filter.bandwidth,
         .transition_band = options.receive_filter.bandwidth *
                            options.receive_filter.transition_band_factor,
     };
 
+    // Decimation ratio of the receive filter which is not followed by the
+    // interpolation back to the decimated IF sample rate.
+    int filter_decimation_ratio = 1;
+
+    if (options.receive_filter.demodulate_at_filter_rate) {
+      filter_options.decimation_ratio =
+          CalculateReceiveFilterDecimationRatio(options, filter_options);
+      filter_options.interpolate = false;
+      filter_decimation_ratio = filter_options.decimation_ratio;
+    }
+
+    if_sample_rate_ = decimated_if_sample_rate_ / filter_decimation_ratio;
+
     receive_filter_.Configure(filter_options);
+
+    // Resample from the IF to the AF sample rate using the ratio calculated
+    // for the stages, taking the decimation of the receive filter into
+    // account: resampling by L/M of the signal decimated by R is the same as
+    // resampling by L*R/M.
+    //
+    // NOTE: The resampler reduces the ratio to its lowest terms.
+    af_resampler_.SetRatio(
+        stage_ratio_.if_to_af_interpolation * filter_decimation_ratio,
+        stage_ratio_.if_to_af);
+  }
+
+  // Calculate decimation ratio of the receive filter for the case when the
+  // demodulator operates at the receive filter sample rate.
+  //
+  // The ratio is the one which the receive filter would choose on its own,
+  // lowered if needed to have an integer demodulator sample rate, and to keep
+  // the space needed by the demodulator.
+  auto CalculateReceiveFilterDecimationRatio(
+      const Options& options,
+      const typename ReceiveFilter::Options& filter_options) -> int {
+    // The CW demodulator shifts the signal by the tone frequency, so the
+    // sample rate needs to be high enough to fit the shifted band.
+    RealType min_sample_rate = 0;
+    if (options.demodulator.modulation_type == modulation::analog::Type::kCW) {
+      min_sample_rate = (options.demodulator.cw.tone_frequency +
+                         options.receive_filter.bandwidth / 2) *
+                        2;
+    }
+
+    for (int ratio = ReceiveFilter::CalculateDecimationRatio(filter_options);
+         ratio > 1;
+         --ratio) {
+      if (decimated_if_sample_rate_ % ratio) {
+        continue;
+      }
+      if (RealType(decimated_if_sample_rate_ / ratio) < min_sample_rate) {
+        continue;
+      }
+      return ratio;
+    }
+
+    return 1;
   }
 
   void ConfigureDemodulator(const Options& options) {
@@ -492,9 +762,9 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
                    options.audio.agc.discharge_rate);
 
     soft_start_weight_ =
-        T(1) / (options.audio.soft_startup_time * af_sample_rate);
+        RealType(1) / (options.audio.soft_startup_time * af_sample_rate);
     soft_configure_weight_ =
-        T(1) / (options.audio.soft_configure_time * af_sample_rate);
+        RealType(1) / (options.audio.soft_configure_time * af_sample_rate);
   }
 
   // Return true if the new configuration requires the audio to perform the soft
@@ -524,10 +794,19 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
 
   // Downsampler from radio sampling rate to a sample rate of an intermediate
   // frequency (IF).
-  signal::Decimator<BaseComplex<T>, T, Allocator> if_decimator_;
+  //
+  // The ratio is typically large, so use cascade of decimation stages.
+  signal::MultiStageDecimator<BaseComplex<T>, T, Allocator> if_decimator_;
 
-  // Downsampler from demodulated sample rate to the audio output sample rate.
-  signal::Decimator<T, T, Allocator> af_decimator_;
+  // Resampler from demodulated sample rate to the audio output sample rate.
+  //
+  // The sample rate of the demodulated signal is not necessarily an integer
+  // multiple of the audio sample rate, so use rational resampler. When the
+  // ratio is an integer it behaves the same way as a decimator.
+  //
+  // When the demodulator operates at the receive filter sample rate the
+  // demodulated signal might need to be upsampled to the audio sample rate.
+  signal::RationalResampler<RealType, RealType, Allocator> af_resampler_;
 
   // Receive filter.
   // It is applied on the IF stage which is expected to have the bandwidth of
@@ -546,23 +825,34 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
 
   // Automatic gain control for audio.
   bool agc_enabled_{true};
-  signal::EMAAGC<T> agc_;
+  signal::EMAAGC<RealType> agc_;
 
   // Configuration of the soft startup and soft re-configure.
-  T soft_start_volume_ = 0;
-  T soft_start_weight_ = 0;
-  T soft_configure_volume_ = 1;
-  T soft_configure_weight_ = 0;
+  RealType soft_start_volume_ = 0;
+  RealType soft_start_weight_ = 0;
+  RealType soft_configure_volume_ = 1;
+  RealType soft_configure_weight_ = 0;
 
   // Work buffer for IQ preprocessor (such as frequency shifting).
+  //
+  // When the shift and decimation are fused it only holds a single chunk of
+  // the input samples.
   std::vector<BaseComplex<T>, Allocator<BaseComplex<T>>> iq_buffer_;
 
   // Work buffer for decimation, bandwidth filter, and decimation to
   // demodulation sample rate.
+  //
+  // Only used by the PushSamples(): subclasses which run the stages on their
+  // own provide their IF buffers.
   std::vector<BaseComplex<T>, Allocator<BaseComplex<T>>> if_buffer_;
 
+  // Work buffer for the IF samples converted to the type the demodulator
+  // operates on. Only used when the path operates on half precision samples.
+  std::vector<BaseComplex<RealType>, Allocator<BaseComplex<RealType>>>
+      demodulator_buffer_;
+
   // Work buffer for audio demodulation and AGC.
-  std::vector<T, Allocator<T>> af_buffer_;
+  std::vector<RealType, Allocator<RealType>> af_buffer_;
 
   // Sinks and templated accessor to them.
   template <Stage kStage>
@@ -571,8 +861,17 @@ class BaseSignalPath : public Sink<BaseComplex<T>> {
 
   // Sample rates at the different stages of the processing path.
   int input_sample_rate_{0};
+  int decimated_if_sample_rate_{0};
   int if_sample_rate_{0};
   int af_sample_rate_{0};
+
+  // Ratio between the sample rates of the stages.
+  typename StagesDecimation::Ratio stage_ratio_;
+
+  // The maximum size of the input block the work buffers are reserved for.
+  size_t max_block_size_{0};
+
+  bool fused_shift_decimate_{true};
 };
 
 }  // namespace radio_core::signal_path
@@ -0,0 +1,398 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Asynchronous sink which owns a copy of the pushed samples.
+//
+// Unlike the AsyncSink, which references the samples of the caller, this sink
+// copies the samples into a lock-free single-producer single-consumer ring
+// buffer, and the worker thread processes them in batches. This allows the
+// caller to re-use its buffer as soon as the PushSamples() returns, and the
+// producer and consumer to run at their own pace as long as the ring buffer
+// has enough capacity to absorb the difference.
+//
+// When the ring buffer is full the behavior is defined by the overflow policy:
+// the producer either blocks until the worker thread frees some space, or drops
+// either the oldest samples in the buffer, or the newest pushed samples.
+//
+// The PushSamples() is to be called from a single thread.
+//
+// NOTE: The worker thread is started on the first PushSamples(). Subclasses
+// are expected to call StopAndWait() from their destructor, so that the
+// ProcessSamples() is not called on a partially destroyed object.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "radio_core/base/algorithm.h"
+#include "radio_core/base/verify.h"
+#include "radio_core/signal_path/sink.h"
+
+namespace radio_core::signal_path {
+
+template <class T, template <class> class Allocator = std::allocator>
+class BufferedAsyncSink : public Sink<T> {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+ public:
+  using SampleType = T;
+
+  // Behavior of the PushSamples() when there is not enough space in the ring
+  // buffer for the new samples.
+  enum class OverflowPolicy {
+    // Block until the worker thread frees enough space.
+    kBlock,
+
+    // Drop the oldest samples which were not yet processed by the worker.
+    kDropOldest,
+
+    // Drop the new samples which do not fit into the buffer.
+    kDropNewest,
+  };
+
+  struct Options {
+    // The number of samples the ring buffer can hold.
+    // Rounded up to the nearest power of two.
+    size_t capacity{65536};
+
+    OverflowPolicy overflow_policy{OverflowPolicy::kBlock};
+
+    // The maximum number of samples passed to a single ProcessSamples() call.
+    size_t max_batch_size{4096};
+  };
+
+  BufferedAsyncSink() : BufferedAsyncSink(Options()) {}
+
+  explicit BufferedAsyncSink(const Options& options)
+      : overflow_policy_(options.overflow_policy) {
+    Verify(options.capacity > 0, "Ring buffer capacity must be positive");
+    Verify(options.max_batch_size > 0, "Batch size must be positive");
+
+    size_t capacity = 1;
+    while (capacity < options.capacity) {
+      capacity *= 2;
+    }
+
+    ring_.resize(capacity);
+    mask_ = capacity - 1;
+
+    batch_.resize(Min(options.max_batch_size, capacity));
+  }
+
+  ~BufferedAsyncSink() override { StopAndWait(); }
+
+  void PushSamples(std::span<const SampleType> samples) override {
+    if (!thread_.joinable()) {
+      thread_ = std::thread([&]() { Run(); });
+    }
+
+    switch (overflow_policy_) {
+      case OverflowPolicy::kBlock: PushSamplesBlocking(samples); return;
+      case OverflowPolicy::kDropOldest: PushSamplesDropOldest(samples); return;
+      case OverflowPolicy::kDropNewest: PushSamplesDropNewest(samples); return;
+    }
+  }
+
+  // Wait for all samples which were pushed so far to be processed.
+  virtual void Wait() {
+    const uint64_t target_index =
+        write_index_.load(std::memory_order_acquire);
+
+    uint64_t processed_index;
+    while ((processed_index = processed_index_.load(
+                std::memory_order_acquire)) < target_index) {
+      if (stop_requested_.load(std::memory_order_acquire)) {
+        return;
+      }
+      processed_index_.wait(processed_index, std::memory_order_acquire);
+    }
+  }
+
+  // Signal worker thread to stop and wait for it to finish.
+  // The samples which were not yet processed are discarded.
+  void StopAndWait() {
+    if (stop_requested_.exchange(true)) {
+      return;
+    }
+
+    WakeConsumer();
+    WakeProducer();
+
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  // Get the number of samples the ring buffer can hold.
+  inline auto GetCapacity() const -> size_t { return ring_.size(); }
+
+  // Get the number of samples which are in the ring buffer waiting to be
+  // processed.
+  inline auto GetNumBufferedSamples() const -> size_t {
+    return write_index_.load(std::memory_order_acquire) -
+           read_index_.load(std::memory_order_acquire);
+  }
+
+  // Get the highest number of buffered samples observed after pushing new
+  // samples.
+  inline auto GetPeakNumBufferedSamples() const -> size_t {
+    return peak_num_buffered_samples_.load(std::memory_order_relaxed);
+  }
+
+  // Get the number of samples which were dropped due to the buffer overflow.
+  inline auto GetNumDroppedSamples() const -> uint64_t {
+    return num_dropped_samples_.load(std::memory_order_relaxed);
+  }
+
+ protected:
+  // The function is called from the thread before starting loop which handles
+  // samples processing.
+  // Allows subclasses to define thread affinity and priority.
+  virtual void ConfigureThread() {}
+
+  virtual void ProcessSamples(std::span<const SampleType> samples) = 0;
+
+ private:
+  //////////////////////////////////////////////////////////////////////////////
+  // Producer side.
+
+  void PushSamplesBlocking(std::span<const SampleType> samples) {
+    while (!samples.empty()) {
+      const uint32_t wake_counter =
+          producer_wake_counter_.load(std::memory_order_acquire);
+
+      const size_t num_free = GetNumFreeSamples();
+      if (num_free == 0) {
+        if (stop_requested_.load(std::memory_order_acquire)) {
+          return;
+        }
+        producer_wake_counter_.wait(wake_counter, std::memory_order_acquire);
+        continue;
+      }
+
+      const size_t num_samples = Min(num_free, samples.size());
+      Write(samples.subspan(0, num_samples));
+      samples = samples.subspan(num_samples);
+    }
+  }
+
+  void PushSamplesDropNewest(std::span<const SampleType> samples) {
+    const size_t num_samples = Min(GetNumFreeSamples(), samples.size());
+
+    if (num_samples != samples.size()) {
+      num_dropped_samples_.fetch_add(samples.size() - num_samples,
+                                     std::memory_order_relaxed);
+    }
+
+    Write(samples.subspan(0, num_samples));
+  }
+
+  void PushSamplesDropOldest(std::span<const SampleType> samples) {
+    const size_t capacity = ring_.size();
+
+    // Samples which do not fit into the buffer even when it is empty.
+    if (samples.size() > capacity) {
+      num_dropped_samples_.fetch_add(samples.size() - capacity,
+                                     std::memory_order_relaxed);
+      samples = samples.last(capacity);
+    }
+
+    // Advance the read index past the oldest samples to free the space.
+    //
+    // The samples which the worker thread has already claimed for copying can
+    // not be dropped: the advance fails, and is retried with the new index.
+    const uint64_t write_index = write_index_.load(std::memory_order_relaxed);
+    uint64_t read_index = read_index_.load(std::memory_order_acquire);
+    while (true) {
+      const size_t num_free = capacity - size_t(write_index - read_index);
+      if (num_free >= samples.size()) {
+        break;
+      }
+
+      const size_t num_drop = samples.size() - num_free;
+      if (read_index_.compare_exchange_weak(read_index,
+                                            read_index + num_drop,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+        num_dropped_samples_.fetch_add(num_drop, std::memory_order_relaxed);
+        break;
+      }
+    }
+
+    // The worker thread might still be copying samples which it claimed before
+    // the oldest samples were dropped. Wait for it to release them, which takes
+    // at most a copy of a single batch.
+    while (true) {
+      const uint64_t copy_index = copy_index_.load(std::memory_order_acquire);
+      if (GetNumFreeSamples() >= samples.size()) {
+        break;
+      }
+      copy_index_.wait(copy_index, std::memory_order_acquire);
+    }
+
+    Write(samples);
+  }
+
+  // Get the number of samples which can be written to the ring buffer without
+  // overwriting samples which are not yet read, or are being copied by the
+  // worker thread.
+  inline auto GetNumFreeSamples() const -> size_t {
+    const uint64_t read_index = read_index_.load(std::memory_order_acquire);
+    const uint64_t copy_index = copy_index_.load(std::memory_order_acquire);
+    return ring_.size() - size_t(write_index_.load(std::memory_order_relaxed) -
+                                 Min(read_index, copy_index));
+  }
+
+  // Write samples to the ring buffer.
+  // The caller ensures there is enough space for them.
+  void Write(const std::span<const SampleType> samples) {
+    if (samples.empty()) {
+      return;
+    }
+
+    const uint64_t write_index = write_index_.load(std::memory_order_relaxed);
+
+    const size_t offset = write_index & mask_;
+    const size_t num_head_samples = Min(samples.size(), ring_.size() - offset);
+    std::copy(samples.begin(),
+              samples.begin() + num_head_samples,
+              ring_.begin() + offset);
+    std::copy(
+        samples.begin() + num_head_samples, samples.end(), ring_.begin());
+
+    write_index_.store(write_index + samples.size(),
+                       std::memory_order_release);
+
+    const size_t num_buffered_samples = GetNumBufferedSamples();
+    if (num_buffered_samples >
+        peak_num_buffered_samples_.load(std::memory_order_relaxed)) {
+      peak_num_buffered_samples_.store(num_buffered_samples,
+                                       std::memory_order_relaxed);
+    }
+
+    WakeConsumer();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Consumer side.
+
+  // Work thread callback.
+  void Run() {
+    ConfigureThread();
+
+    while (!stop_requested_.load(std::memory_order_acquire)) {
+      const uint32_t wake_counter =
+          consumer_wake_counter_.load(std::memory_order_acquire);
+
+      uint64_t read_index = read_index_.load(std::memory_order_acquire);
+      const uint64_t write_index =
+          write_index_.load(std::memory_order_acquire);
+
+      if (read_index == write_index) {
+        consumer_wake_counter_.wait(wake_counter, std::memory_order_acquire);
+        continue;
+      }
+
+      // Claim the samples before copying them from the ring buffer, so that
+      // the producer does not drop them while they are copied. The copy index
+      // is published before the claim, so that the producer which observes the
+      // claim does not overwrite the samples until they are copied.
+      //
+      // Failure to claim means the producer has dropped some of the samples.
+      const size_t num_samples =
+          Min(size_t(write_index - read_index), batch_.size());
+      copy_index_.store(read_index, std::memory_order_release);
+      if (!read_index_.compare_exchange_strong(read_index,
+                                               read_index + num_samples,
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_acquire)) {
+        ReleaseCopiedSamples();
+        continue;
+      }
+
+      // Copy the samples from the ring buffer, so that the space is freed for
+      // the producer while the samples are processed.
+      const size_t offset = read_index & mask_;
+      const size_t num_head_samples = Min(num_samples, ring_.size() - offset);
+      std::copy(ring_.begin() + offset,
+                ring_.begin() + offset + num_head_samples,
+                batch_.begin());
+      std::copy(ring_.begin(),
+                ring_.begin() + (num_samples - num_head_samples),
+                batch_.begin() + num_head_samples);
+
+      ReleaseCopiedSamples();
+      WakeProducer();
+
+      ProcessSamples(
+          std::span<const SampleType>(batch_).subspan(0, num_samples));
+
+      processed_index_.store(read_index + num_samples,
+                             std::memory_order_release);
+      processed_index_.notify_all();
+    }
+  }
+
+  // Mark that the worker thread is not copying samples from the ring buffer.
+  inline void ReleaseCopiedSamples() {
+    copy_index_.store(kNoCopyIndex, std::memory_order_release);
+    copy_index_.notify_one();
+  }
+
+  inline void WakeConsumer() {
+    consumer_wake_counter_.fetch_add(1, std::memory_order_release);
+    consumer_wake_counter_.notify_one();
+  }
+
+  inline void WakeProducer() {
+    producer_wake_counter_.fetch_add(1, std::memory_order_release);
+    producer_wake_counter_.notify_one();
+  }
+
+  OverflowPolicy overflow_policy_;
+
+  // Ring buffer storage. The size is a power of two.
+  std::vector<SampleType, Allocator<SampleType>> ring_;
+  size_t mask_{0};
+
+  // Samples which are currently processed by the worker thread.
+  std::vector<SampleType, Allocator<SampleType>> batch_;
+
+  // Monotonic indices of the samples.
+  //
+  // The write index is only modified by the producer. The read index is
+  // modified by the consumer when it claims samples, and by the producer when
+  // it drops the oldest samples. The copy index is the index of the first
+  // sample which the consumer is copying from the ring buffer, or kNoCopyIndex.
+  // The processed index is the index past the last sample processed by the
+  // worker.
+  static constexpr uint64_t kNoCopyIndex = UINT64_MAX;
+  std::atomic<uint64_t> write_index_{0};
+  std::atomic<uint64_t> read_index_{0};
+  std::atomic<uint64_t> copy_index_{kNoCopyIndex};
+  std::atomic<uint64_t> processed_index_{0};
+
+  // Counters which are incremented to wake up a side which waits for the
+  // other one.
+  std::atomic<uint32_t> consumer_wake_counter_{0};
+  std::atomic<uint32_t> producer_wake_counter_{0};
+
+  std::atomic<bool> stop_requested_{false};
+
+  // Statistics.
+  std::atomic<size_t> peak_num_buffered_samples_{0};
+  std::atomic<uint64_t> num_dropped_samples_{0};
+
+  std::thread thread_;
+};
+
+}  // namespace radio_core::signal_path
@@ -0,0 +1,390 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Channelizer which splits a wideband IQ signal into multiple narrowband
+// channels.
+//
+// Every channel is shifted to the DC, filtered and decimated, and the result is
+// pushed to the sink of the channel. Typically the channel sink is a signal
+// path which is configured to operate on the channel sample rate, so that it
+// only performs the receive filter, demodulation, and audio processing.
+//
+// The channelizer is implemented as an overlap-save fast convolution filter
+// bank [1]: the input signal is split into overlapping blocks, and the forward
+// FFT of every block is calculated once for all channels. Every channel then
+// takes the FFT bins around its center frequency, multiplies them by the
+// frequency response of the channel filter, and performs the inverse FFT of a
+// size which is decimation ratio times smaller than the forward one. This gives
+// the filtered and decimated signal of the channel.
+//
+// The cost of the forward FFT is shared by all channels, and the per-channel
+// cost only depends on the channel sample rate. This makes it much cheaper to
+// process many channels compared to running a frequency shifter and decimator
+// at the input sample rate for every channel.
+//
+// The center frequency of a channel is rounded to the nearest FFT bin, and the
+// remaining offset is removed by a frequency shifter operating at the channel
+// sample rate.
+//
+// The FFT implementation is provided as a template argument. It is expected to
+// implement the fft::FFT<BaseComplex<T>> API, and to have a constructor from
+// the SetupOptions. For example, fft::PFFFT<Complex>.
+//
+// The channelizer does not perform any thread synchronization: it is not to be
+// modified or re-configured while it processes samples.
+//
+// References:
+//
+//   [1] Mark Borgerding, "Turning overlap-save into a multiband mixing,
+//       downsampling filter bank", IEEE Signal Processing Magazine, 2006.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "radio_core/base/algorithm.h"
+#include "radio_core/base/constants.h"
+#include "radio_core/base/verify.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/fft_api.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal/filter_design.h"
+#include "radio_core/signal/filter_window_heuristic.h"
+#include "radio_core/signal/frequency_shifter.h"
+#include "radio_core/signal/window.h"
+#include "radio_core/signal_path/sink.h"
+
+namespace radio_core::signal_path {
+
+template <class T,
+          class FFTType,
+          template <class> class Allocator = std::allocator>
+class Channelizer : public Sink<BaseComplex<T>> {
+  template <class U>
+  using Vector = std::vector<U, Allocator<U>>;
+
+  // Buffers which are passed to the FFT.
+  using FFTBuffer =
+      std::vector<BaseComplex<T>, fft::FFTAllocator<BaseComplex<T>>>;
+
+ public:
+  using ChannelSink = Sink<BaseComplex<T>>;
+
+  struct Options {
+    // Sample rate of the input signal.
+    int sample_rate{0};
+
+    // Decimation ratio from the input sample rate to the sample rate of the
+    // channels.
+    int decimation_ratio{1};
+
+    // Number of points of the forward FFT.
+    //
+    // Must be a multiple of the decimation ratio, and both this number and
+    // this number divided by the decimation ratio must be supported by the FFT
+    // implementation.
+    int num_points{1024};
+
+    // Number of taps of the channel filter.
+    //
+    // The value of 0 means a quarter of the number of FFT points. The size is
+    // rounded down to the closest value for which the size minus one is a
+    // multiple of the decimation ratio.
+    //
+    // The larger filter gives sharper transition band, but less new samples
+    // are processed by every FFT.
+    int filter_size{0};
+
+    // Width of the transition band of the channel filter, in Hz.
+    //
+    // The stopband of the filter starts at the Nyquist frequency of the
+    // channel sample rate, so that the transition band is below of it and the
+    // frequencies at the edge of the channel do not alias into the channel.
+    //
+    // The value of 0 means the transition band is estimated from the filter
+    // size. It is to be set explicitly when the filter size is chosen to give
+    // a wider passband at the expense of a lower attenuation at the channel
+    // edges.
+    T transition_band{0};
+  };
+
+  Channelizer() = default;
+  explicit Channelizer(const Options& options) { Configure(options); }
+
+  // Configure the channelizer.
+  //
+  // The channels are kept, but their state is reset.
+  void Configure(const Options& options) {
+    Verify(options.decimation_ratio > 0,
+           "Channelizer decimation ratio must be positive");
+    Verify(options.num_points % options.decimation_ratio == 0,
+           "Channelizer FFT size must be a multiple of the decimation ratio");
+
+    sample_rate_ = options.sample_rate;
+    decimation_ratio_ = options.decimation_ratio;
+    num_points_ = options.num_points;
+    num_channel_points_ = num_points_ / decimation_ratio_;
+
+    const int requested_filter_size =
+        options.filter_size ? options.filter_size : num_points_ / 4;
+    filter_size_ =
+        (requested_filter_size - 1) / decimation_ratio_ * decimation_ratio_ + 1;
+    Verify(filter_size_ > 1 && filter_size_ < num_points_,
+           "Invalid channelizer filter size");
+
+    // Number of new input samples consumed by every FFT.
+    block_size_ = num_points_ - (filter_size_ - 1);
+
+    transition_band_ =
+        options.transition_band > 0
+            ? options.transition_band
+            : signal::EstimateNormalizedTransitionBandwidth<T>(filter_size_) *
+                  T(sample_rate_);
+    Verify(transition_band_ < GetChannelSampleRate(),
+           "Channelizer transition band is wider than the channel");
+
+    forward_fft_.Configure({.num_points = num_points_});
+    backward_fft_.Configure({.num_points = num_channel_points_});
+
+    DesignFilter();
+
+    input_buffer_.resize(num_points_);
+    std::fill(input_buffer_.begin(), input_buffer_.end(), BaseComplex<T>(0));
+    num_buffered_samples_ = filter_size_ - 1;
+
+    spectrum_.resize(num_points_);
+    channel_spectrum_.resize(num_channel_points_);
+    channel_samples_.resize(num_channel_points_);
+
+    for (Channel& channel : channels_) {
+      ConfigureChannel(channel);
+    }
+  }
+
+  // Sample rate of the signal which is pushed to the channel sinks.
+  inline auto GetChannelSampleRate() const -> T {
+    return T(sample_rate_) / decimation_ratio_;
+  }
+
+  // Number of taps of the channel filter.
+  inline auto GetFilterSize() const -> int { return filter_size_; }
+
+  // Width of the transition band of the channel filter, in Hz.
+  inline auto GetTransitionBand() const -> T { return transition_band_; }
+
+  // Add new channel centered at the given frequency.
+  //
+  // The frequency is an offset from the center of the input signal, in Hz.
+  //
+  // The channelizer references the sink, so caller needs to ensure the
+  // lifetime of the sink.
+  //
+  // Returns index of the channel.
+  auto AddChannel(const T frequency, ChannelSink& sink) -> size_t {
+    Channel& channel = channels_.emplace_back();
+    channel.frequency = frequency;
+    channel.sink = &sink;
+    ConfigureChannel(channel);
+    return channels_.size() - 1;
+  }
+
+  // Change the center frequency of the channel with the given index.
+  void SetChannelFrequency(const size_t index, const T frequency) {
+    assert(index < channels_.size());
+    channels_[index].frequency = frequency;
+    ConfigureChannel(channels_[index]);
+  }
+
+  // Remove all channels which use the given sink.
+  //
+  // NOTE: Indices of the channels which were added after the removed one are
+  // changed.
+  void RemoveChannel(const ChannelSink& sink) {
+    std::erase_if(channels_, [&](const Channel& channel) {
+      return channel.sink == &sink;
+    });
+  }
+
+  inline auto GetNumChannels() const -> size_t { return channels_.size(); }
+
+  void PushSamples(std::span<const BaseComplex<T>> samples) override {
+    assert(num_points_ != 0);
+
+    while (!samples.empty()) {
+      const size_t num_samples_to_copy =
+          Min(samples.size(), size_t(num_points_) - num_buffered_samples_);
+
+      std::copy(samples.begin(),
+                samples.begin() + num_samples_to_copy,
+                input_buffer_.begin() + num_buffered_samples_);
+
+      num_buffered_samples_ += num_samples_to_copy;
+      samples = samples.subspan(num_samples_to_copy);
+
+      if (num_buffered_samples_ == size_t(num_points_)) {
+        ProcessBlock();
+
+        // Keep the overlap with the next block.
+        std::copy(input_buffer_.begin() + block_size_,
+                  input_buffer_.end(),
+                  input_buffer_.begin());
+        num_buffered_samples_ = filter_size_ - 1;
+      }
+    }
+  }
+
+ private:
+  struct Channel {
+    // Requested center frequency of the channel, in Hz.
+    T frequency{0};
+
+    ChannelSink* sink{nullptr};
+
+    // Index of the FFT bin which is the closest to the center frequency.
+    int bin{0};
+
+    // Phase correction of the block.
+    //
+    // Taking the FFT bins around the channel center bin is the same as mixing
+    // the signal with the frequency of the bin relative to the beginning of the
+    // block. The per-block correction turns it into a continuous mixing.
+    BaseComplex<T> block_phase{1, 0};
+    BaseComplex<T> block_phase_increment{1, 0};
+
+    // Shifter of the remaining frequency offset between the bin and the
+    // requested center frequency.
+    signal::FrequencyShifter<T> frequency_shifter;
+  };
+
+  // Design the channel filter and calculate its frequency response.
+  //
+  // The filter is a low-pass filter with the stopband starting at the Nyquist
+  // frequency of the channel sample rate: the cutoff is half of the transition
+  // band below it. It is designed at the input sample rate.
+  //
+  // The response is scaled by 1/num_points, which normalizes the combination
+  // of the forward FFT and the unnormalized inverse FFT of the channel.
+  void DesignFilter() {
+    Vector<T> kernel(filter_size_);
+    signal::DesignLowPassFilter<T>(
+        kernel,
+        signal::WindowEquation<T, signal::Window::kHamming>(),
+        GetChannelSampleRate() / 2 - transition_band_ / 2,
+        T(sample_rate_));
+
+    FFTBuffer padded_kernel(num_points_, BaseComplex<T>(0));
+    const T scale = T(1) / num_points_;
+    for (int i = 0; i < filter_size_; ++i) {
+      padded_kernel[i] = BaseComplex<T>(kernel[i] * scale);
+    }
+
+    // Only the bins which are kept by the decimation are needed.
+    FFTBuffer response(num_points_);
+    forward_fft_.Forward(padded_kernel, response);
+
+    filter_response_.resize(num_channel_points_);
+    for (int i = 0; i < num_channel_points_; ++i) {
+      filter_response_[i] = response[BinIndex(ChannelBinOffset(i))];
+    }
+  }
+
+  void ConfigureChannel(Channel& channel) {
+    const T bin_width = T(sample_rate_) / num_points_;
+
+    channel.bin = RoundToInt(channel.frequency / bin_width);
+
+    const int64_t phase_per_block_in_bins =
+        int64_t(channel.bin) * int64_t(block_size_) % num_points_;
+    const T phase_per_block = T(-2) * T(constants::pi) *
+                              T(phase_per_block_in_bins) / T(num_points_);
+    channel.block_phase = BaseComplex<T>(1, 0);
+    channel.block_phase_increment =
+        BaseComplex<T>(Cos(phase_per_block), Sin(phase_per_block));
+
+    const T residual_offset = channel.frequency - T(channel.bin) * bin_width;
+    channel.frequency_shifter.Configure(-residual_offset,
+                                        GetChannelSampleRate());
+  }
+
+  // Offset of the bin of the channel spectrum relative to the center bin of
+  // the channel, in the natural FFT order.
+  inline auto ChannelBinOffset(const int index) const -> int {
+    return index < num_channel_points_ / 2 ? index
+                                           : index - num_channel_points_;
+  }
+
+  // Wrap bin index to the [0 .. num_points) range.
+  inline auto BinIndex(const int bin) const -> size_t {
+    const int index = bin % num_points_;
+    return index < 0 ? index + num_points_ : index;
+  }
+
+  // Process full input buffer.
+  void ProcessBlock() {
+    if (channels_.empty()) {
+      return;
+    }
+
+    forward_fft_.Forward(input_buffer_, spectrum_);
+
+    // The first samples of the inverse FFT are affected by the circular
+    // convolution and are discarded.
+    const size_t num_discarded_samples = (filter_size_ - 1) / decimation_ratio_;
+
+    for (Channel& channel : channels_) {
+      for (int i = 0; i < num_channel_points_; ++i) {
+        const int offset = ChannelBinOffset(i);
+        channel_spectrum_[i] =
+            spectrum_[BinIndex(channel.bin + offset)] * filter_response_[i];
+      }
+
+      const std::span<BaseComplex<T>> samples =
+          backward_fft_.Backward(channel_spectrum_, channel_samples_)
+              .subspan(num_discarded_samples);
+
+      for (BaseComplex<T>& sample : samples) {
+        sample = channel.frequency_shifter(sample * channel.block_phase);
+      }
+
+      channel.block_phase *= channel.block_phase_increment;
+      channel.block_phase /= Abs(channel.block_phase);
+
+      channel.sink->PushSamples(samples);
+    }
+  }
+
+  int sample_rate_{0};
+  int decimation_ratio_{1};
+  int num_points_{0};
+  int num_channel_points_{0};
+  int filter_size_{0};
+  T transition_band_{0};
+  size_t block_size_{0};
+
+  FFTType forward_fft_;
+  FFTType backward_fft_;
+
+  // Frequency response of the channel filter, for the bins of the channel
+  // spectrum.
+  Vector<BaseComplex<T>> filter_response_;
+
+  // Input samples: the overlap with the previous block followed by the new
+  // samples.
+  FFTBuffer input_buffer_;
+  size_t num_buffered_samples_{0};
+
+  // Work buffers for the FFT.
+  FFTBuffer spectrum_;
+  FFTBuffer channel_spectrum_;
+  FFTBuffer channel_samples_;
+
+  Vector<Channel> channels_;
+};
+
+}  // namespace radio_core::signal_path
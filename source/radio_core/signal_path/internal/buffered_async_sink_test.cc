@@ -0,0 +1,197 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal_path/buffered_async_sink.h"
+
+#include <array>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+#include "radio_core/unittest/mock.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal_path {
+
+using testing::ElementsAre;
+using testing::FloatNear;
+using testing::Pointwise;
+
+class MyBufferedAsyncSink : public BufferedAsyncSink<float> {
+ public:
+  MyBufferedAsyncSink(const Options& options, std::vector<float>& out)
+      : BufferedAsyncSink<float>(options), out_(out) {}
+
+  ~MyBufferedAsyncSink() override { StopAndWait(); }
+
+  // Make the worker thread to wait in the ProcessSamples() until Release() is
+  // called.
+  void Hold() { hold_ = true; }
+  void Release() {
+    hold_ = false;
+    hold_.notify_all();
+  }
+
+  // Wait for the worker thread to enter the ProcessSamples().
+  void WaitProcessing() {
+    int num_calls;
+    while ((num_calls = num_process_calls_.load()) == 0) {
+      num_process_calls_.wait(num_calls);
+    }
+  }
+
+ protected:
+  void ProcessSamples(const std::span<const float> samples) override {
+    ++num_process_calls_;
+    num_process_calls_.notify_all();
+
+    hold_.wait(true);
+
+    for (const float sample : samples) {
+      out_.push_back(sample * 2);
+    }
+  }
+
+  std::vector<float>& out_;
+
+  std::atomic<bool> hold_{false};
+  std::atomic<int> num_process_calls_{0};
+};
+
+TEST(BufferedAsyncSink, Basic) {
+  const std::array in = std::to_array<float>({1, 2, 3, 4, 5, 6});
+  std::vector<float> out;
+
+  MyBufferedAsyncSink sink({}, out);
+
+  sink.PushSamples(in);
+  sink.Wait();
+
+  EXPECT_THAT(
+      out,
+      Pointwise(FloatNear(1e-6f), std::to_array<float>({2, 4, 6, 8, 10, 12})));
+  EXPECT_EQ(sink.GetNumDroppedSamples(), 0);
+  EXPECT_EQ(sink.GetNumBufferedSamples(), 0);
+}
+
+TEST(BufferedAsyncSink, Capacity) {
+  std::vector<float> out;
+
+  MyBufferedAsyncSink sink({.capacity = 100}, out);
+  EXPECT_EQ(sink.GetCapacity(), 128);
+}
+
+TEST(BufferedAsyncSink, Block) {
+  // Push much more samples than the buffer can hold, in chunks which are
+  // larger than the buffer.
+  std::vector<float> in(10000);
+  std::iota(in.begin(), in.end(), 0.0f);
+
+  std::vector<float> out;
+
+  MyBufferedAsyncSink sink({.capacity = 64, .max_batch_size = 16}, out);
+
+  const std::span<const float> in_span(in);
+  for (size_t i = 0; i < in.size(); i += 100) {
+    sink.PushSamples(in_span.subspan(i, 100));
+  }
+  sink.Wait();
+
+  ASSERT_EQ(out.size(), in.size());
+  for (size_t i = 0; i < in.size(); ++i) {
+    EXPECT_EQ(out[i], in[i] * 2) << "i=" << i;
+  }
+
+  EXPECT_EQ(sink.GetNumDroppedSamples(), 0);
+  EXPECT_LE(sink.GetPeakNumBufferedSamples(), 64);
+}
+
+TEST(BufferedAsyncSink, DropNewest) {
+  std::vector<float> out;
+
+  MyBufferedAsyncSink sink(
+      {.capacity = 4,
+       .overflow_policy = MyBufferedAsyncSink::OverflowPolicy::kDropNewest},
+      out);
+
+  // Make sure the worker holds the first sample, so that the ring buffer is
+  // empty.
+  sink.Hold();
+  sink.PushSamples(std::to_array<float>({1}));
+  sink.WaitProcessing();
+
+  sink.PushSamples(std::to_array<float>({2, 3, 4}));
+  sink.PushSamples(std::to_array<float>({5, 6, 7}));
+
+  EXPECT_EQ(sink.GetNumBufferedSamples(), 4);
+  EXPECT_EQ(sink.GetPeakNumBufferedSamples(), 4);
+  EXPECT_EQ(sink.GetNumDroppedSamples(), 2);
+
+  sink.Release();
+  sink.Wait();
+
+  EXPECT_THAT(out, ElementsAre(2, 4, 6, 8, 10));
+}
+
+TEST(BufferedAsyncSink, DropOldest) {
+  std::vector<float> out;
+
+  MyBufferedAsyncSink sink(
+      {.capacity = 4,
+       .overflow_policy = MyBufferedAsyncSink::OverflowPolicy::kDropOldest},
+      out);
+
+  // Make sure the worker holds the first sample, so that the ring buffer is
+  // empty.
+  sink.Hold();
+  sink.PushSamples(std::to_array<float>({1}));
+  sink.WaitProcessing();
+
+  sink.PushSamples(std::to_array<float>({2, 3, 4}));
+  sink.PushSamples(std::to_array<float>({5, 6, 7}));
+
+  EXPECT_EQ(sink.GetNumBufferedSamples(), 4);
+  EXPECT_EQ(sink.GetNumDroppedSamples(), 2);
+
+  // Push more samples than the capacity.
+  sink.PushSamples(std::to_array<float>({8, 9, 10, 11, 12, 13}));
+
+  EXPECT_EQ(sink.GetNumBufferedSamples(), 4);
+  EXPECT_EQ(sink.GetNumDroppedSamples(), 8);
+
+  sink.Release();
+  sink.Wait();
+
+  EXPECT_THAT(out, ElementsAre(2, 20, 22, 24, 26));
+}
+
+TEST(BufferedAsyncSink, DropOldestConcurrent) {
+  // Push samples while the worker thread is running, so that the oldest
+  // samples are dropped while the worker copies them.
+  std::vector<float> in(100000);
+  std::iota(in.begin(), in.end(), 0.0f);
+
+  std::vector<float> out;
+
+  MyBufferedAsyncSink sink(
+      {.capacity = 64,
+       .overflow_policy = MyBufferedAsyncSink::OverflowPolicy::kDropOldest,
+       .max_batch_size = 16},
+      out);
+
+  const std::span<const float> in_span(in);
+  for (size_t i = 0; i < in.size(); i += 40) {
+    sink.PushSamples(in_span.subspan(i, 40));
+  }
+  sink.Wait();
+
+  // The processed samples are the pushed ones in their order.
+  ASSERT_EQ(out.size() + sink.GetNumDroppedSamples(), in.size());
+  for (size_t i = 1; i < out.size(); ++i) {
+    EXPECT_LT(out[i - 1], out[i]) << "i=" << i;
+  }
+  EXPECT_EQ(out.back(), in.back() * 2);
+}
+
+}  // namespace radio_core::signal_path
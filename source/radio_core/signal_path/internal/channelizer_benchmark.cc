@@ -0,0 +1,101 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "radio_core/benchmark/base_app.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/fft_api_pffft.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal_path/channelizer.h"
+
+namespace radio_core::benchmark {
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+// Sink which only keeps the last received sample.
+class LastSampleSink : public signal_path::Sink<Complex> {
+ public:
+  void PushSamples(std::span<const SampleType> samples) override {
+    if (!samples.empty()) {
+      last_sample = samples.back();
+    }
+  }
+
+  Complex last_sample{0};
+};
+
+class ChannelizerBenchmark : public Benchmark {
+ public:
+  using Benchmark::Benchmark;
+
+ protected:
+  static constexpr int kNumChannels = 20;
+
+  auto GetBenchmarkName() -> std::string override { return "Channelizer"; }
+
+  void Initialize() override {
+    channelizer_.Configure({.sample_rate = 2048000,
+                            .decimation_ratio = 64,
+                            .num_points = 4096});
+
+    // NFM channels with 12.5 kHz spacing.
+    sinks_.resize(kNumChannels);
+    for (int i = 0; i < kNumChannels; ++i) {
+      channelizer_.AddChannel(float(i - kNumChannels / 2) * 12500, sinks_[i]);
+    }
+
+    input_samples_.resize(65536);
+
+    std::random_device random_device;
+    std::mt19937 random_engine(random_device());
+    std::uniform_real_distribution<float> distribution(0, 1);
+    for (Complex& input_sample : input_samples_) {
+      input_sample =
+          Complex(distribution(random_engine), distribution(random_engine));
+    }
+
+    cout << endl;
+    cout << "Configuration" << endl;
+    cout << "=============" << endl;
+
+    cout << "Number of input samples : " << input_samples_.size() << endl;
+    cout << "Number of channels      : " << channelizer_.GetNumChannels()
+         << endl;
+    cout << "Channel sample rate     : "
+         << channelizer_.GetChannelSampleRate() << endl;
+    cout << "Filter size             : " << channelizer_.GetFilterSize()
+         << endl;
+    cout << "Number of iterations    : " << GetNumIterations() << endl;
+  }
+
+  void Iteration() override { channelizer_.PushSamples(input_samples_); }
+
+  void Finalize() override {
+    // Sanity check and endurance that the evaluation is not optimized out.
+    for (const LastSampleSink& sink : sinks_) {
+      if (!IsFinite(sink.last_sample.real) ||
+          !IsFinite(sink.last_sample.imag)) {
+        std::cerr << "Result has non-finite values" << std::endl;
+        ::exit(1);
+      }
+    }
+  }
+
+ private:
+  signal_path::Channelizer<float, fft::PFFFT<Complex>> channelizer_;
+  std::vector<LastSampleSink> sinks_;
+  std::vector<Complex> input_samples_;
+};
+
+}  // namespace radio_core::benchmark
+
+auto main(int argc, char** argv) -> int {
+  radio_core::benchmark::ChannelizerBenchmark app;
+  return app.Run(argc, argv);
+}
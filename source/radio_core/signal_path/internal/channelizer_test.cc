@@ -0,0 +1,217 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal_path/channelizer.h"
+
+#include <vector>
+
+#include "radio_core/base/constants.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/fft_api_pffft.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal_path/simple_signal_path.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal_path {
+
+namespace {
+
+using ComplexChannelizer = Channelizer<float, fft::PFFFT<Complex>>;
+
+// Sink which stores all received samples.
+class StoringSink : public Sink<Complex> {
+ public:
+  void PushSamples(std::span<const SampleType> new_samples) override {
+    samples.insert(samples.end(), new_samples.begin(), new_samples.end());
+  }
+
+  std::vector<Complex> samples;
+};
+
+// Sink for the AF stage which counts the number of received samples.
+class CountingAFSink : public Sink<float> {
+ public:
+  void PushSamples(std::span<const SampleType> samples) override {
+    num_samples += samples.size();
+  }
+
+  size_t num_samples{0};
+};
+
+// Generate sum of complex tones of the given frequencies and amplitudes.
+auto GenerateTones(const std::vector<std::pair<float, float>>& tones,
+                   const float sample_rate,
+                   const size_t num_samples) -> std::vector<Complex> {
+  std::vector<Complex> samples(num_samples);
+  for (size_t i = 0; i < num_samples; ++i) {
+    for (const auto& [frequency, amplitude] : tones) {
+      const double phase = 2 * constants::pi * double(frequency) * double(i) /
+                           double(sample_rate);
+      samples[i] += Complex(float(double(amplitude) * Cos(phase)),
+                            float(double(amplitude) * Sin(phase)));
+    }
+  }
+  return samples;
+}
+
+// Get the average amplitude and frequency of a single tone signal.
+// The samples at the beginning of the signal are ignored, giving time for the
+// filter to stabilize.
+void MeasureTone(const std::span<const Complex> samples,
+                 const float sample_rate,
+                 float& amplitude,
+                 float& frequency) {
+  const size_t start = samples.size() / 4;
+
+  double amplitude_sum = 0;
+  double phase_sum = 0;
+  for (size_t i = start + 1; i < samples.size(); ++i) {
+    amplitude_sum += double(Abs(samples[i]));
+    phase_sum += double(Arg(samples[i] * Conj(samples[i - 1])));
+  }
+
+  const size_t num_samples = samples.size() - start - 1;
+  amplitude = float(amplitude_sum / num_samples);
+  frequency = float(phase_sum / num_samples / (2 * constants::pi) *
+                    double(sample_rate));
+}
+
+}  // namespace
+
+TEST(Channelizer, Configure) {
+  ComplexChannelizer channelizer({.sample_rate = 1024000,
+                                  .decimation_ratio = 32,
+                                  .num_points = 1024});
+
+  EXPECT_EQ(channelizer.GetChannelSampleRate(), 32000);
+  EXPECT_EQ(channelizer.GetFilterSize(), 225);
+
+  // The transition band is estimated from the filter size.
+  EXPECT_NEAR(channelizer.GetTransitionBand(), 18204.4f, 1);
+
+  channelizer.Configure({.sample_rate = 1024000,
+                         .decimation_ratio = 32,
+                         .num_points = 1024,
+                         .transition_band = 8000});
+  EXPECT_EQ(channelizer.GetTransitionBand(), 8000);
+}
+
+TEST(Channelizer, Channels) {
+  constexpr float kSampleRate = 1024000;
+
+  // Use filter which is long enough to have a passband which covers all the
+  // tones.
+  ComplexChannelizer channelizer({.sample_rate = int(kSampleRate),
+                                  .decimation_ratio = 32,
+                                  .num_points = 4096});
+
+  // Channel aligned with the FFT bin, channel which is not aligned with the FFT
+  // bin, and a channel with negative frequency.
+  StoringSink sink_a, sink_b, sink_c;
+  channelizer.AddChannel(100000, sink_a);
+  channelizer.AddChannel(-250300, sink_b);
+  channelizer.AddChannel(-400000, sink_c);
+  EXPECT_EQ(channelizer.GetNumChannels(), 3);
+
+  const std::vector<Complex> samples = GenerateTones(
+      {{101000, 1.0f}, {-252300, 0.5f}, {-395000, 0.25f}}, kSampleRate, 102400);
+
+  // Push samples in blocks of size which does not match the FFT size.
+  for (size_t i = 0; i < samples.size(); i += 1000) {
+    channelizer.PushSamples(std::span(samples).subspan(
+        i, Min(size_t(1000), samples.size() - i)));
+  }
+
+  // The output is delayed by the filter and the block processing, so allow
+  // up to a block of samples to be still buffered.
+  EXPECT_NEAR(float(sink_a.samples.size()), 3200.0f, 128);
+  EXPECT_EQ(sink_a.samples.size(), sink_b.samples.size());
+  EXPECT_EQ(sink_a.samples.size(), sink_c.samples.size());
+
+  float amplitude, frequency;
+
+  MeasureTone(sink_a.samples, 32000, amplitude, frequency);
+  EXPECT_NEAR(amplitude, 1.0f, 1e-2f);
+  EXPECT_NEAR(frequency, 1000, 1);
+
+  MeasureTone(sink_b.samples, 32000, amplitude, frequency);
+  EXPECT_NEAR(amplitude, 0.5f, 1e-2f);
+  EXPECT_NEAR(frequency, -2000, 1);
+
+  MeasureTone(sink_c.samples, 32000, amplitude, frequency);
+  EXPECT_NEAR(amplitude, 0.25f, 1e-2f);
+  EXPECT_NEAR(frequency, 5000, 1);
+}
+
+// Tone which is outside of the channel is rejected.
+TEST(Channelizer, Rejection) {
+  constexpr float kSampleRate = 1024000;
+
+  ComplexChannelizer channelizer({.sample_rate = int(kSampleRate),
+                                  .decimation_ratio = 32,
+                                  .num_points = 1024});
+
+  StoringSink sink;
+  channelizer.AddChannel(100000, sink);
+
+  const std::vector<Complex> samples =
+      GenerateTones({{150000, 1.0f}}, kSampleRate, 102400);
+  channelizer.PushSamples(samples);
+
+  float amplitude, frequency;
+  MeasureTone(sink.samples, 32000, amplitude, frequency);
+  EXPECT_LT(amplitude, 1e-2f);
+}
+
+// Tone which is just outside of the channel edge does not alias into the
+// channel.
+TEST(Channelizer, EdgeRejection) {
+  constexpr float kSampleRate = 1024000;
+
+  ComplexChannelizer channelizer({.sample_rate = int(kSampleRate),
+                                  .decimation_ratio = 32,
+                                  .num_points = 4096});
+
+  StoringSink sink;
+  channelizer.AddChannel(100000, sink);
+
+  // The Nyquist frequency of the channel is 16 kHz. The tone is not aligned
+  // with the FFT bins, so that its energy leaks into the bins of the channel.
+  const std::vector<Complex> samples =
+      GenerateTones({{116300, 1.0f}}, kSampleRate, 204800);
+  channelizer.PushSamples(samples);
+
+  float amplitude, frequency;
+  MeasureTone(sink.samples, 32000, amplitude, frequency);
+  EXPECT_LT(amplitude, 1e-2f);
+}
+
+// Channelizer feeding a signal path which operates at the channel sample rate.
+TEST(Channelizer, SignalPath) {
+  using SignalPath = SimpleSignalPath<float>;
+
+  ComplexChannelizer channelizer(
+      {.sample_rate = 1024000, .decimation_ratio = 32, .num_points = 1024});
+
+  SignalPath::Options options;
+  options.input.sample_rate = int(channelizer.GetChannelSampleRate());
+  options.receive_filter.bandwidth = 12500;
+  options.demodulator.modulation_type = modulation::analog::Type::kNFM;
+  options.audio.sample_rate = 48000;
+
+  SignalPath signal_path;
+  signal_path.Configure(options);
+
+  CountingAFSink af_sink;
+  signal_path.AddAFSink(af_sink);
+
+  channelizer.AddChannel(100000, signal_path);
+
+  const std::vector<Complex> samples(102400, Complex(1, 0));
+  channelizer.PushSamples(samples);
+
+  EXPECT_NEAR(float(af_sink.num_samples), 4800.0f, 96);
+}
+
+}  // namespace radio_core::signal_path
@@ -7,8 +7,10 @@
 
 #pragma once
 
+#include <numeric>
 #include <ostream>
 
+#include "radio_core/base/algorithm.h"
 #include "radio_core/base/verify.h"
 
 namespace radio_core::signal_path::internal {
@@ -22,11 +24,16 @@ class StagesDecimation {
    public:
     Ratio() = default;
 
-    Ratio(const int new_iq_to_if, const int new_if_to_af)
-        : iq_to_if(new_iq_to_if), if_to_af(new_if_to_af) {}
+    Ratio(const int new_iq_to_if,
+          const int new_if_to_af,
+          const int new_if_to_af_interpolation = 1)
+        : iq_to_if(new_iq_to_if),
+          if_to_af(new_if_to_af),
+          if_to_af_interpolation(new_if_to_af_interpolation) {}
 
     constexpr inline auto operator==(const Ratio& other) const -> bool {
-      return iq_to_if == other.iq_to_if && if_to_af == other.if_to_af;
+      return iq_to_if == other.iq_to_if && if_to_af == other.if_to_af &&
+             if_to_af_interpolation == other.if_to_af_interpolation;
     }
     constexpr inline auto operator!=(const Ratio& other) const -> bool {
       return !(*this == other);
@@ -34,7 +41,11 @@ class StagesDecimation {
 
     friend auto operator<<(std::ostream& os,
                            const Ratio& ratio) -> std::ostream& {
-      os << "IQ to IF: " << ratio.iq_to_if << ", IF to AF: " << ratio.if_to_af;
+      os << "IQ to IF: " << ratio.iq_to_if << ", IF to AF: ";
+      if (ratio.if_to_af_interpolation != 1) {
+        os << ratio.if_to_af_interpolation << "/";
+      }
+      os << ratio.if_to_af;
       return os;
     }
 
@@ -47,6 +58,13 @@ class StagesDecimation {
     // At this stage audio processing performed, and this is also the audio
     // output sample rate of the signal processing path.
     int if_to_af{1};
+
+    // Interpolation ratio from the IF to the AF stage.
+    //
+    // Is different from 1 when the ratio between the IQ and the AF sample
+    // rates is not an integer. In this case the IF signal is resampled to the
+    // AF sample rate by the rational factor of if_to_af_interpolation/if_to_af.
+    int if_to_af_interpolation{1};
   };
 
   // Calculate decimation ratio for the given signal path configuration:
@@ -62,13 +80,16 @@ class StagesDecimation {
   // so that the receive filter is applied as computationally efficient as
   // possible.
   //
-  // NOTE: Only integer decimation factors are suported.
+  // If the ratio between the IQ and the AF sample rates is not an integer the
+  // IF to AF stage uses rational resampling. The ratio of the IQ and IF sample
+  // rates is always an integer.
   static inline auto Calculate(const int iq_sample_rate,
                                const int af_sample_rate,
                                const T receive_filter_bandwidth) -> Ratio {
-    // TODO(sergey): Support rational factor downsampling.
-    Verify(iq_sample_rate % af_sample_rate == 0,
-           "Only integer downsampling ratio is supported");
+    if (iq_sample_rate % af_sample_rate) {
+      return CalculateRational(
+          iq_sample_rate, af_sample_rate, receive_filter_bandwidth);
+    }
 
     const int iq_to_af_ratio = iq_sample_rate / af_sample_rate;
 
@@ -109,6 +130,61 @@ class StagesDecimation {
     // after demodulation.
     return {1, iq_to_af_ratio};
   }
+
+ private:
+  // The maximum decimation factor of the rational resampling from the IF to
+  // the AF stage.
+  //
+  // The cost of the resampling and the size of its filter grow linearly with
+  // the decimation factor, so the IF sample rate is chosen in a way that the
+  // factor stays below this limit.
+  static constexpr int kMaxRationalDecimation = 1000;
+
+  // Calculate ratio for the case when the IQ sample rate is not an integer
+  // multiple of the AF sample rate.
+  //
+  // The IF sample rate is chosen to be the lowest integer fraction of the IQ
+  // sample rate which is not lower than the AF sample rate and the receive
+  // filter bandwidth, and for which the rational resampling to the AF sample
+  // rate is feasible.
+  static inline auto CalculateRational(const int iq_sample_rate,
+                                       const int af_sample_rate,
+                                       const T receive_filter_bandwidth)
+      -> Ratio {
+    const T min_if_sample_rate =
+        Max(T(af_sample_rate), T(receive_filter_bandwidth));
+
+    // NOTE: If the IQ sample rate is below the minimum IF sample rate (which
+    // happens, for example, for the channels of a channelizer) the IF stage
+    // operates at the IQ sample rate, and the IF signal is upsampled to the AF
+    // sample rate.
+    for (int iq_to_if = Max(int(T(iq_sample_rate) / min_if_sample_rate), 1);
+         iq_to_if >= 1;
+         --iq_to_if) {
+      if (iq_sample_rate % iq_to_if) {
+        continue;
+      }
+
+      const int if_sample_rate = iq_sample_rate / iq_to_if;
+      if (iq_to_if != 1 && if_sample_rate < min_if_sample_rate) {
+        continue;
+      }
+
+      const int divisor = std::gcd(if_sample_rate, af_sample_rate);
+      const int interpolation = af_sample_rate / divisor;
+      const int decimation = if_sample_rate / divisor;
+
+      if (decimation > kMaxRationalDecimation) {
+        continue;
+      }
+
+      return {iq_to_if, decimation, interpolation};
+    }
+
+    Verify(false, "Unsupported ratio of the IQ and AF sample rates");
+
+    return {};
+  }
 };
 
 }  // namespace radio_core::signal_path::internal
@@ -29,4 +29,25 @@ TEST(CalculateStagesDecimationRadio, AirSpyTo48kHz) {
             StagesDecimation<float>::Ratio(25, 5));
 }
 
+TEST(CalculateStagesDecimationRadio, RTLSDRToAudio) {
+  // Typical NFM configuration.
+  EXPECT_EQ(StagesDecimation<float>::Calculate(2400000, 48000, 12500),
+            StagesDecimation<float>::Ratio(50, 1));
+
+  // Non-integer ratio of the IQ and AF sample rates.
+  // The IF is 48 kHz which is then resampled to 44.1 kHz.
+  EXPECT_EQ(StagesDecimation<float>::Calculate(2400000, 44100, 12500),
+            StagesDecimation<float>::Ratio(50, 160, 147));
+
+  // Typical WFM configuration.
+  EXPECT_EQ(StagesDecimation<float>::Calculate(2400000, 44100, 142500),
+            StagesDecimation<float>::Ratio(16, 500, 147));
+}
+
+TEST(CalculateStagesDecimationRadio, UpsampleToAudio) {
+  // IQ sample rate which is lower than the audio sample rate.
+  EXPECT_EQ(StagesDecimation<float>::Calculate(32000, 48000, 12500),
+            StagesDecimation<float>::Ratio(1, 2, 3));
+}
+
 }  // namespace radio_core::signal_path::internal
@@ -0,0 +1,133 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Fork-join dispatcher of independent tasks to a pool of worker threads.
+//
+// The Run() invokes the callback for every task index in the [0, num_tasks)
+// range, distributing the tasks across the worker threads and the calling
+// thread, and returns once all tasks are finished. This makes it possible for
+// the tasks to reference data owned by the caller, such as a block of samples.
+//
+// Calls to Run() from multiple threads are serialized.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace radio_core::signal_path::internal {
+
+class ParallelDispatcher {
+ public:
+  explicit ParallelDispatcher(const int num_threads) {
+    threads_.reserve(num_threads);
+    for (int i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([&]() { RunWorker(); });
+    }
+  }
+
+  ~ParallelDispatcher() {
+    {
+      std::unique_lock lock(mutex_);
+      stop_requested_ = true;
+    }
+    work_cv_.notify_all();
+
+    for (std::thread& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  inline auto GetNumThreads() const -> int { return int(threads_.size()); }
+
+  void Run(const size_t num_tasks,
+           const std::function<void(size_t task_index)>& callback) {
+    std::unique_lock run_lock(run_mutex_);
+
+    {
+      std::unique_lock lock(mutex_);
+      callback_ = &callback;
+      num_tasks_ = num_tasks;
+      next_task_.store(0, std::memory_order_relaxed);
+      num_active_workers_ = threads_.size();
+      ++generation_;
+    }
+    work_cv_.notify_all();
+
+    // The calling thread participates in the processing.
+    RunTasks(callback);
+
+    std::unique_lock lock(mutex_);
+    done_cv_.wait(lock, [&] { return num_active_workers_ == 0; });
+    callback_ = nullptr;
+  }
+
+ private:
+  // Pick up tasks until all of them are taken.
+  inline void RunTasks(const std::function<void(size_t)>& callback) {
+    size_t task_index;
+    while ((task_index = next_task_.fetch_add(
+                1, std::memory_order_relaxed)) < num_tasks_) {
+      callback(task_index);
+    }
+  }
+
+  // Work thread callback.
+  void RunWorker() {
+    uint64_t handled_generation = 0;
+
+    while (true) {
+      const std::function<void(size_t)>* callback;
+
+      {
+        std::unique_lock lock(mutex_);
+        work_cv_.wait(lock, [&] {
+          return generation_ != handled_generation || stop_requested_;
+        });
+        if (stop_requested_) {
+          return;
+        }
+        handled_generation = generation_;
+        callback = callback_;
+      }
+
+      RunTasks(*callback);
+
+      {
+        std::unique_lock lock(mutex_);
+        --num_active_workers_;
+      }
+      done_cv_.notify_one();
+    }
+  }
+
+  // Serializes the Run() calls.
+  std::mutex run_mutex_;
+
+  // Guards the state of the current run, and the thread wake-up.
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+
+  const std::function<void(size_t)>* callback_{nullptr};
+  size_t num_tasks_{0};
+  std::atomic<size_t> next_task_{0};
+
+  // Number of workers which did not yet finish the current run.
+  size_t num_active_workers_{0};
+
+  // Incremented on every run, so that the workers can tell a new run.
+  uint64_t generation_{0};
+
+  bool stop_requested_{false};
+
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace radio_core::signal_path::internal
@@ -0,0 +1,161 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Benchmark of the WFM signal path running at 10 Msps, with all the stages
+// processed serially on one thread, and with the IF and AF stages processed on
+// separate threads.
+//
+// Every iteration pushes 0.1 seconds worth of samples, so the signal path keeps
+// up with the real-time as long as an iteration takes less than 100 ms.
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "radio_core/benchmark/base_app.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal_path/pipelined_signal_path.h"
+#include "radio_core/signal_path/simple_signal_path.h"
+
+namespace radio_core::benchmark {
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+// Sink which only keeps the last received sample.
+class LastSampleSink : public signal_path::Sink<float> {
+ public:
+  void PushSamples(std::span<const SampleType> samples) override {
+    if (!samples.empty()) {
+      last_sample = samples.back();
+    }
+  }
+
+  float last_sample{0};
+};
+
+class PipelinedSignalPathBenchmark : public Benchmark {
+ public:
+  using Benchmark::Benchmark;
+
+ protected:
+  static constexpr int kSampleRate = 10000000;
+
+  // Number of samples pushed to the signal path by a single call.
+  static constexpr int kBlockSize = 65536;
+
+  auto GetBenchmarkName() -> std::string override {
+    return "PipelinedSignalPath";
+  }
+
+  void ConfigureParser(argparse::ArgumentParser& parser) override {
+    parser.add_argument("implementation")
+        .help("Implementation of the signal path: simple, pipelined");
+  }
+
+  auto HandleArguments(argparse::ArgumentParser& parser) -> bool override {
+    implementation_ = parser.get<std::string>("implementation");
+    if (implementation_ != "simple" && implementation_ != "pipelined") {
+      cerr << "Unknown implementation " << implementation_ << endl;
+      cerr << "Supported: simple, pipelined" << endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  void Initialize() override {
+    if (implementation_ == "simple") {
+      signal_path_ = std::make_unique<signal_path::SimpleSignalPath<float>>();
+    } else {
+      pipelined_signal_path_ =
+          new signal_path::PipelinedSignalPath<float>();
+      signal_path_.reset(pipelined_signal_path_);
+    }
+
+    SignalPath::Options options;
+    options.input.sample_rate = kSampleRate;
+    options.audio.sample_rate = 48000;
+    options.receive_filter.bandwidth = 200000;
+    options.demodulator.modulation_type = modulation::analog::Type::kWFM;
+    options.demodulator.wfm.deviation = 75000;
+
+    signal_path_->Configure(options);
+    signal_path_->AddAFSink(sink_);
+
+    input_samples_.resize(kSampleRate / 10);
+
+    std::random_device random_device;
+    std::mt19937 random_engine(random_device());
+    std::uniform_real_distribution<float> distribution(-1, 1);
+    for (Complex& input_sample : input_samples_) {
+      input_sample =
+          Complex(distribution(random_engine), distribution(random_engine));
+    }
+
+    cout << endl;
+    cout << "Configuration" << endl;
+    cout << "=============" << endl;
+
+    cout << "Implementation       : " << implementation_ << endl;
+    cout << "Input sample rate    : " << signal_path_->GetInputSampleRate()
+         << endl;
+    cout << "IF sample rate       : " << signal_path_->GetIFSampleRate()
+         << endl;
+    cout << "AF sample rate       : " << signal_path_->GetAFSampleRate()
+         << endl;
+    cout << "Number of iterations : " << GetNumIterations() << endl;
+  }
+
+  void Iteration() override {
+    const std::span<const Complex> samples(input_samples_);
+    for (size_t i = 0; i < samples.size(); i += kBlockSize) {
+      signal_path_->PushSamples(
+          samples.subspan(i, Min(size_t(kBlockSize), samples.size() - i)));
+    }
+
+    if (pipelined_signal_path_) {
+      pipelined_signal_path_->Wait();
+    }
+  }
+
+  void Finalize() override {
+    if (pipelined_signal_path_) {
+      cout << endl;
+      cout << "Max latency : "
+           << std::chrono::duration<double, std::milli>(
+                  pipelined_signal_path_->GetMaxLatency())
+                  .count()
+           << " ms" << endl;
+    }
+
+    // Sanity check and endurance that the evaluation is not optimized out.
+    if (!IsFinite(sink_.last_sample)) {
+      std::cerr << "Result has non-finite values" << std::endl;
+      ::exit(1);
+    }
+  }
+
+ private:
+  using SignalPath = signal_path::BaseSignalPath<float>;
+
+  std::string implementation_;
+
+  std::unique_ptr<SignalPath> signal_path_;
+  signal_path::PipelinedSignalPath<float>* pipelined_signal_path_{nullptr};
+
+  LastSampleSink sink_;
+
+  std::vector<Complex> input_samples_;
+};
+
+}  // namespace radio_core::benchmark
+
+auto main(int argc, char** argv) -> int {
+  radio_core::benchmark::PipelinedSignalPathBenchmark app;
+  return app.Run(argc, argv);
+}
@@ -0,0 +1,122 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "radio_core/signal_path/pipelined_signal_path.h"
+
+#include <vector>
+
+#include "radio_core/base/arena_allocator.h"
+#include "radio_core/base/constants.h"
+#include "radio_core/math/complex.h"
+#include "radio_core/math/math.h"
+#include "radio_core/signal_path/simple_signal_path.h"
+#include "radio_core/unittest/test.h"
+
+namespace radio_core::signal_path {
+
+namespace {
+
+// Sink which stores all received samples.
+template <class T>
+class StoringSink : public Sink<T> {
+ public:
+  void PushSamples(std::span<const T> new_samples) override {
+    samples.insert(samples.end(), new_samples.begin(), new_samples.end());
+  }
+
+  std::vector<T> samples;
+};
+
+}  // namespace
+
+TEST(PipelinedSignalPath, SameAsSimple) {
+  using SimplePath = SimpleSignalPath<float>;
+  using PipelinedPath = PipelinedSignalPath<float>;
+
+  SimplePath::Options options;
+  options.input.sample_rate = 1200000;
+  options.audio.sample_rate = 48000;
+  options.receive_filter.bandwidth = 12500;
+  options.demodulator.modulation_type = modulation::analog::Type::kNFM;
+  options.demodulator.nfm.deviation = 2500;
+
+  SimplePath simple_path;
+  simple_path.Configure(options);
+  StoringSink<Complex> simple_if_sink;
+  StoringSink<float> simple_af_sink;
+  simple_path.AddIFSink(simple_if_sink);
+  simple_path.AddAFSink(simple_af_sink);
+
+  PipelinedPath pipelined_path;
+  pipelined_path.Configure(options);
+  StoringSink<Complex> pipelined_if_sink;
+  StoringSink<float> pipelined_af_sink;
+  pipelined_path.AddIFSink(pipelined_if_sink);
+  pipelined_path.AddAFSink(pipelined_af_sink);
+
+  // Frequency modulated tone.
+  std::vector<Complex> input(12000);
+  const float two_pi = 2 * float(constants::pi);
+  const float sample_rate = float(options.input.sample_rate);
+  float phase = 0;
+  for (size_t i = 0; i < input.size(); ++i) {
+    const float t = float(i) / sample_rate;
+    phase += two_pi * 2500 * Sin(two_pi * 1000 * t) / sample_rate;
+    input[i] = Complex(Cos(phase), Sin(phase));
+  }
+
+  const std::span<const Complex> input_span(input);
+  for (size_t i = 0; i < input.size(); i += 1000) {
+    simple_path.PushSamples(input_span.subspan(i, 1000));
+    pipelined_path.PushSamples(input_span.subspan(i, 1000));
+  }
+  pipelined_path.Wait();
+
+  ASSERT_EQ(pipelined_if_sink.samples.size(), simple_if_sink.samples.size());
+  for (size_t i = 0; i < simple_if_sink.samples.size(); ++i) {
+    EXPECT_EQ(pipelined_if_sink.samples[i], simple_if_sink.samples[i]);
+  }
+
+  ASSERT_EQ(simple_af_sink.samples.size(), 480);
+  ASSERT_EQ(pipelined_af_sink.samples.size(), simple_af_sink.samples.size());
+  for (size_t i = 0; i < simple_af_sink.samples.size(); ++i) {
+    EXPECT_EQ(pipelined_af_sink.samples[i], simple_af_sink.samples[i]);
+  }
+
+  EXPECT_GT(pipelined_path.GetLastLatency().count(), 0);
+  EXPECT_GE(pipelined_path.GetMaxLatency(), pipelined_path.GetLastLatency());
+}
+
+TEST(PipelinedSignalPath, Reserve) {
+  using PipelinedPath = PipelinedSignalPath<float, ArenaAllocator>;
+
+  PipelinedPath::Options options;
+  options.input.sample_rate = 1200000;
+  options.audio.sample_rate = 48000;
+  options.receive_filter.bandwidth = 12500;
+  options.demodulator.modulation_type = modulation::analog::Type::kNFM;
+  options.demodulator.nfm.deviation = 2500;
+
+  Arena arena(16 * 1024 * 1024);
+  Arena::Scope arena_scope(arena);
+
+  PipelinedPath pipelined_path;
+  pipelined_path.Configure(options);
+  pipelined_path.Reserve(4000);
+
+  // Any allocation done by the IF stage would increase the arena usage.
+  // Additionally, debug builds assert that there are no allocations in both
+  // stages.
+  const size_t num_used_bytes = arena.GetNumUsedBytes();
+
+  const std::vector<Complex> samples(4000, Complex(1, 0));
+  for (const size_t num_samples : {4000, 1, 2001, 3999, 4000}) {
+    pipelined_path.PushSamples(std::span(samples).subspan(0, num_samples));
+  }
+  pipelined_path.Wait();
+
+  EXPECT_EQ(arena.GetNumUsedBytes(), num_used_bytes);
+}
+
+}  // namespace radio_core::signal_path
@@ -10,42 +10,78 @@
 // filter bandwidth.
 //
 // The filter implements a down-fir-up algorithm for cases when the signal
-// sampling rate is much higher than the filter bandwidth.
+// sampling rate is much higher than the filter bandwidth. Optionally the final
+// up-sampling is skipped, and the filtered signal is output at the decimated
+// sample rate. This is useful when the consumer of the filtered signal does not
+// need the original sample rate, as it avoids interpolation which is followed
+// by the decimation again.
+//
+// The configuration and the design of the filter kernel happen in the
+// ComputeType of the sample type, which allows to configure filter of the half
+// precision samples for the sample rates outside of the half precision range.
+//
+// The filter kernel is typically long for narrow transition bands. Optionally
+// an FFT implementation can be provided as a template argument, in which case
+// the filter uses the FFT-based fast convolution for the kernels which are long
+// enough to benefit from it (see FastFIRFilter). It is expected to implement
+// the fft::FFT<BaseComplex<T>> API, for example fft::PFFFT<Complex>. When the
+// FFT type is void the direct form of the FIR filter is always used.
 
 #pragma once
 
 #include <memory>
 #include <span>
+#include <type_traits>
 #include <vector>
 
 #include "radio_core/base/algorithm.h"
 #include "radio_core/base/container.h"
 #include "radio_core/math/complex.h"
 #include "radio_core/math/math.h"
-#include "radio_core/signal/decimator.h"
+#include "radio_core/signal/fast_fir_filter.h"
 #include "radio_core/signal/filter_design.h"
 #include "radio_core/signal/filter_window_heuristic.h"
 #include "radio_core/signal/interpolator.h"
+#include "radio_core/signal/multi_stage_decimator.h"
 #include "radio_core/signal/simple_fir_filter.h"
 #include "radio_core/signal/window.h"
 
 namespace radio_core::signal_path::internal {
 
-template <class T, template <class> class Allocator = std::allocator>
+template <class T,
+          template <class> class Allocator = std::allocator,
+          class FFTType = void>
 class ReceiveFilter {
+  using RealType = ComputeType<T>;
+
+  using Filter = std::conditional_t<
+      std::is_void_v<FFTType>,
+      signal::SimpleFIRFilter<BaseComplex<T>, T, Allocator>,
+      signal::FastFIRFilter<BaseComplex<T>, T, FFTType, Allocator>>;
+
  public:
   struct Options {
     // Sample rate of signal this filter operates on.
-    T sample_rate{0};
+    RealType sample_rate{0};
 
     // Bandwidth of the filter, Hertz.
     // The signal around DC of this bandwidth is passed through.
-    T bandwidth{0};
+    RealType bandwidth{0};
 
     // Transition band, Hertz.
     // Defines transition with measured in hertz between a passband and a
     // stopband.
-    T transition_band{0};
+    RealType transition_band{0};
+
+    // Decimation ratio which is applied prior to the filter.
+    // The value of 0 means the ratio is calculated automatically from the
+    // sample rate and the bandwidth of the filter.
+    int decimation_ratio{0};
+
+    // Interpolate the filtered signal back to the input sample rate.
+    // When false the output signal is sampled at the sample rate divided by
+    // the decimation ratio.
+    bool interpolate{true};
 
     constexpr auto operator<=>(const Options& other) const = default;
   };
@@ -57,18 +93,21 @@ class ReceiveFilter {
       return;
     }
 
-    decimation_ratio_ = GetDecimationRatio(options);
+    decimation_ratio_ = options.decimation_ratio != 0
+                            ? options.decimation_ratio
+                            : CalculateDecimationRatio(options);
+    interpolate_ = options.interpolate;
 
     decimator_.SetRatio(decimation_ratio_);
     interpolator_.SetRatio(decimation_ratio_);
 
-    const T filter_sample_rate = options.sample_rate / decimation_ratio_;
+    const RealType filter_sample_rate = options.sample_rate / decimation_ratio_;
 
     const size_t kernel_size =
-        signal::EstimateFilterSizeForTransitionBandwidth<T>(
+        signal::EstimateFilterSizeForTransitionBandwidth<RealType>(
             options.transition_band, filter_sample_rate);
 
-    filter_.SetKernelSize(kernel_size);
+    kernel_.resize(kernel_size);
 
     // The cutoff frequency is the half of the receive filter bandwidth because
     // the band is centered around the DC.
@@ -76,25 +115,29 @@ class ReceiveFilter {
     // Clamp the frequency to the IF sample rate, so that there are no
     // mathematical issues and the filter gives usable results under the extreme
     // configuration.
-    const T clamped_cutoff_frequency =
-        Min<T>(options.bandwidth / 2, filter_sample_rate / 2);
+    const RealType clamped_cutoff_frequency =
+        Min<RealType>(options.bandwidth / 2, filter_sample_rate / 2);
 
     DesignLowPassFilter<T>(
-        filter_.GetKernel(),
-        signal::WindowEquation<T, signal::Window::kHamming>(),
+        kernel_,
+        signal::WindowEquation<RealType, signal::Window::kHamming>(),
         clamped_cutoff_frequency,
         filter_sample_rate);
+    filter_.SetKernel(kernel_);
 
     // Store the actual filter configuration.
     filter_bandwidth_ = clamped_cutoff_frequency * 2;
     filter_transition_band_ = options.transition_band;
+    output_sample_rate_ =
+        interpolate_ ? options.sample_rate : filter_sample_rate;
   }
 
   // Filter the given input samples.
   //
-  // The output samples must have at least the same number of elements as the
-  // input samples. It is possible to pass a buffer of a bigger size. It is also
-  // possible to do in-place processing.
+  // The output buffer must have enough elements to hold the filtered samples.
+  // Use the `CalcNeededOutputBufferSize()` to calculate the needed buffer
+  // size. It is possible to pass a buffer of a bigger size. It is also possible
+  // to do in-place processing.
   //
   // Returns the span of actually written samples in the output.
   auto operator()(const std::span<const BaseComplex<T>> input_samples,
@@ -104,6 +147,13 @@ class ReceiveFilter {
       return filter_(input_samples, output_samples);
     }
 
+    if (!interpolate_) {
+      const std::span<BaseComplex<T>> downsampled_signal =
+          decimator_(input_samples, output_samples);
+      filter_(downsampled_signal);
+      return downsampled_signal;
+    }
+
     // Make sure the buffer is large enough.
     EnsureSizeAtLeast(
         downsample_buffer_,
@@ -137,24 +187,54 @@ class ReceiveFilter {
 
     const size_t decimated_size =
         decimator_.CalcNeededOutputBufferSize(num_input_samples);
+    if (!interpolate_) {
+      return decimated_size;
+    }
+
     return interpolator_.CalcNeededOutputBufferSize(decimated_size);
   }
 
+  // Pre-allocate work buffers for filtering up to the given number of input
+  // samples at a time.
+  //
+  // Filtering of input buffers which are not bigger than the reserved size
+  // does not allocate memory.
+  //
+  // The reservation is to be done after the filter is configured.
+  void Reserve(const size_t max_num_input_samples) {
+    if (decimation_ratio_ == 1) {
+      ReserveFilter(max_num_input_samples);
+      return;
+    }
+
+    decimator_.Reserve(max_num_input_samples);
+    ReserveFilter(decimator_.CalcNeededOutputBufferSize(max_num_input_samples));
+
+    if (interpolate_) {
+      EnsureSizeAtLeast(
+          downsample_buffer_,
+          decimator_.CalcNeededOutputBufferSize(max_num_input_samples));
+    }
+  }
+
   // Get actual filter configuration.
   auto GetDecimationRatio() -> int { return decimation_ratio_; }
-  auto GetBandwidth() -> T { return filter_bandwidth_; }
-  auto GetTransitionBand() -> T { return filter_transition_band_; }
+  auto GetBandwidth() -> RealType { return filter_bandwidth_; }
+  auto GetTransitionBand() -> RealType { return filter_transition_band_; }
   auto GetKernelSize() -> size_t { return filter_.GetKernelSize(); }
 
- private:
-  // Get the decimation ratio which is applied prior to the filter.
+  // Get sample rate of the filtered signal.
+  auto GetOutputSampleRate() -> RealType { return output_sample_rate_; }
+
+  // Calculate the decimation ratio which is applied prior to the filter when
+  // the ratio is not explicitly specified in the options.
   // The same ratio is used for interpolation after the filter.
-  auto GetDecimationRatio(const Options& options) const -> int {
-    const T filter_cutoff = options.bandwidth / 2;
+  static auto CalculateDecimationRatio(const Options& options) -> int {
+    const RealType filter_cutoff = options.bandwidth / 2;
 
     // Minimum sample rate for the good performance of the filter and the
     // radio. Give some extra margin above the Nyquist frequency.
-    const T min_sample_rate = filter_cutoff * 4;
+    const RealType min_sample_rate = filter_cutoff * 4;
 
     if (options.sample_rate <= min_sample_rate) {
       return 1;
@@ -167,20 +247,33 @@ class ReceiveFilter {
     return Min(25, Max(ratio, 1));
   }
 
+ private:
+  // Pre-allocate work buffers of the filter for filtering up to the given
+  // number of samples at a time.
+  void ReserveFilter(const size_t max_num_samples) {
+    if constexpr (!std::is_void_v<FFTType>) {
+      filter_.Reserve(max_num_samples);
+    }
+  }
+
   // Options the filter is configured for.
   // This is the requested configuration.
   Options configured_options_;
 
   // The actual bandwidth and transition band of the filter.
   // It might be different from the requested one due to clamping.
-  T filter_bandwidth_{0};
-  T filter_transition_band_{0};
+  RealType filter_bandwidth_{0};
+  RealType filter_transition_band_{0};
+  RealType output_sample_rate_{0};
 
-  signal::SimpleFIRFilter<BaseComplex<T>, T, Allocator> filter_;
+  // Kernel of the filter. The filter keeps its own copy of the kernel.
+  std::vector<T, Allocator<T>> kernel_;
+  Filter filter_;
 
   int decimation_ratio_{1};
+  bool interpolate_{true};
 
-  signal::Decimator<BaseComplex<T>, T, Allocator> decimator_;
+  signal::MultiStageDecimator<BaseComplex<T>, T, Allocator> decimator_;
   signal::Interpolator<BaseComplex<T>, T, Allocator> interpolator_;
 
   // Buffer used to hold downsampled input signal.
@@ -4,10 +4,20 @@
 
 #include "radio_core/signal_path/internal/receive_filter.h"
 
+#include <random>
+#include <vector>
+
+#include "radio_core/math/fft_api_pffft.h"
+#include "radio_core/math/unittest/complex_matchers.h"
+#include "radio_core/signal/fast_fir_filter.h"
+#include "radio_core/unittest/mock.h"
 #include "radio_core/unittest/test.h"
 
 namespace radio_core::signal_path::internal {
 
+using testing::ComplexNear;
+using testing::Pointwise;
+
 // Compilation check to ensure no warnings or compilation are generated.
 TEST(ReceiveFilter, Compilation) {
   ReceiveFilter<float> receive_filter;
@@ -16,4 +26,68 @@ TEST(ReceiveFilter, Compilation) {
   receive_filter.Configure(options);
 }
 
+TEST(ReceiveFilter, FastConvolution) {
+  using FastReceiveFilter =
+      ReceiveFilter<float, std::allocator, fft::PFFFT<Complex>>;
+  using FastFIRFilter =
+      signal::FastFIRFilter<Complex, float, fft::PFFFT<Complex>>;
+
+  std::mt19937 random_engine(0);
+  std::uniform_real_distribution<float> distribution(-1, 1);
+
+  std::vector<Complex> samples(4000);
+  for (Complex& sample : samples) {
+    sample = Complex(distribution(random_engine), distribution(random_engine));
+  }
+
+  for (const bool interpolate : {false, true}) {
+    // The options type depends on the filter type, so they are configured
+    // from the same initializer.
+    auto configure = [interpolate](auto& filter) {
+      filter.Configure({
+          .sample_rate = 240000,
+          .bandwidth = 12500,
+          .transition_band = 400,
+          .decimation_ratio = 4,
+          .interpolate = interpolate,
+      });
+    };
+
+    ReceiveFilter<float> direct_filter;
+    configure(direct_filter);
+
+    FastReceiveFilter fast_filter;
+    configure(fast_filter);
+
+    // Make sure the kernel is long enough for the fast convolution to be used.
+    EXPECT_GE(fast_filter.GetKernelSize(),
+              FastFIRFilter::kDefaultFastConvolutionKernelSize);
+
+    std::vector<Complex> direct_samples(samples.size());
+    std::vector<Complex> fast_samples(samples.size());
+
+    // Filter in blocks, so that the state is carried over between them.
+    const std::span<const Complex> input(samples);
+    size_t num_direct_samples = 0;
+    size_t num_fast_samples = 0;
+    for (size_t i = 0; i < samples.size(); i += 1000) {
+      num_direct_samples +=
+          direct_filter(input.subspan(i, 1000),
+                        std::span(direct_samples).subspan(num_direct_samples))
+              .size();
+      num_fast_samples +=
+          fast_filter(input.subspan(i, 1000),
+                      std::span(fast_samples).subspan(num_fast_samples))
+              .size();
+    }
+
+    ASSERT_EQ(num_direct_samples, num_fast_samples);
+    direct_samples.resize(num_direct_samples);
+    fast_samples.resize(num_fast_samples);
+
+    EXPECT_THAT(fast_samples, Pointwise(ComplexNear(1e-5f), direct_samples))
+        << "interpolate=" << interpolate;
+  }
+}
+
 }  // namespace radio_core::signal_path::internal
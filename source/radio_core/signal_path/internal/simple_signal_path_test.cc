@@ -4,11 +4,25 @@
 
 #include "radio_core/signal_path/simple_signal_path.h"
 
+#include <vector>
+
+#include "radio_core/base/arena_allocator.h"
+#include "radio_core/base/constants.h"
+#include "radio_core/base/half.h"
 #include "radio_core/math/complex.h"
+#include "radio_core/math/math.h"
+#include "radio_core/math/unittest/complex_matchers.h"
 #include "radio_core/unittest/test.h"
 
+#if RADIO_CORE_HAVE_HALF
+#  include "radio_core/math/half_complex.h"
+#endif
+
 namespace radio_core::signal_path {
 
+using testing::ComplexNear;
+using testing::Pointwise;
+
 namespace {
 
 // Dummy sink for the IF stage. Performs no real processing.
@@ -17,12 +31,125 @@ class DummyIFSink : public Sink<Complex> {
   void PushSamples(std::span<const SampleType> /*samples*/) override {}
 };
 
+// Sink for the IF stage which stores all received samples.
+class StoringIFSink : public Sink<Complex> {
+ public:
+  void PushSamples(std::span<const SampleType> new_samples) override {
+    samples.insert(samples.end(), new_samples.begin(), new_samples.end());
+  }
+
+  std::vector<Complex> samples;
+};
+
 // Dummy sink for the AF stage. Performs no real processing.
 class DummyAFSink : public Sink<float> {
  public:
   void PushSamples(std::span<const SampleType> /*samples*/) override {}
 };
 
+// Sink for the AF stage which counts the number of received samples.
+class CountingAFSink : public Sink<float> {
+ public:
+  void PushSamples(std::span<const SampleType> samples) override {
+    num_samples += samples.size();
+  }
+
+  size_t num_samples{0};
+};
+
+// Sink for the AF stage which stores all received samples.
+class StoringAFSink : public Sink<float> {
+ public:
+  void PushSamples(std::span<const SampleType> new_samples) override {
+    samples.insert(samples.end(), new_samples.begin(), new_samples.end());
+  }
+
+  std::vector<float> samples;
+};
+
+// Demodulate NFM signal of a 1 kHz tone which is offset from the center of the
+// input band, and return the audio samples.
+template <class T>
+auto DemodulateNFMTone() -> std::vector<float> {
+  using SignalPath = SimpleSignalPath<T>;
+
+  constexpr int kSampleRate = 6000000;
+  constexpr double kCarrierOffset = 50000;
+  constexpr double kDeviation = 2500;
+  constexpr double kToneFrequency = 1000;
+
+  typename SignalPath::Options options;
+  options.input.sample_rate = kSampleRate;
+  options.input.frequency_shift = -kCarrierOffset;
+  options.receive_filter.bandwidth = 12500;
+  options.demodulator.modulation_type = modulation::analog::Type::kNFM;
+  options.demodulator.nfm.deviation = kDeviation;
+  options.audio.sample_rate = 48000;
+
+  SignalPath signal_path;
+  signal_path.Configure(options);
+
+  StoringAFSink af_sink;
+  signal_path.AddAFSink(af_sink);
+
+  std::vector<BaseComplex<T>> samples(kSampleRate / 100);
+  double phase = 0;
+  int64_t sample_index = 0;
+  for (int block = 0; block < 30; ++block) {
+    for (BaseComplex<T>& sample : samples) {
+      const double t = double(sample_index++) / kSampleRate;
+      const double tone = Sin(2 * constants::pi * kToneFrequency * t);
+      phase += 2 * constants::pi * kDeviation * tone / kSampleRate;
+
+      const double carrier_phase = 2 * constants::pi * kCarrierOffset * t;
+      sample = BaseComplex<T>(T(0.5 * Cos(phase + carrier_phase)),
+                              T(0.5 * Sin(phase + carrier_phase)));
+    }
+    signal_path.PushSamples(samples);
+  }
+
+  return af_sink.samples;
+}
+
+// Shift and decimate a tone at the given input sample rate to the IF sample
+// rate of 48 kHz, and return the IF samples.
+auto ShiftAndDecimateTone(const int sample_rate,
+                          const bool fused_shift_decimate)
+    -> std::vector<Complex> {
+  using SignalPath = SimpleSignalPath<float>;
+
+  constexpr double kToneFrequency = 30000;
+
+  SignalPath::Options options;
+  options.input.sample_rate = sample_rate;
+  options.input.frequency_shift = -kToneFrequency;
+  options.input.fused_shift_decimate = fused_shift_decimate;
+  options.receive_filter.bandwidth = 12500;
+  options.audio.sample_rate = 48000;
+
+  SignalPath signal_path;
+  signal_path.Configure(options);
+  EXPECT_EQ(signal_path.GetIFSampleRate(), 48000);
+
+  StoringIFSink if_sink;
+  signal_path.AddIFSink(if_sink);
+
+  // Blocks which are bigger than the chunk of the fused processing, and are
+  // not a multiple of it.
+  std::vector<Complex> samples(10000);
+  int64_t sample_index = 0;
+  for (int block = 0; block < 10; ++block) {
+    for (Complex& sample : samples) {
+      const double phase = 2 * constants::pi * kToneFrequency *
+                           double(sample_index++) / sample_rate;
+      sample = Complex(float(Cos(phase)), float(Sin(phase)));
+    }
+    signal_path.PushSamples(samples);
+  }
+
+  return if_sink.samples;
+}
+
 }  // namespace
 
 TEST(SignalPath, Configure) {
@@ -78,4 +205,154 @@ TEST(SignalPath, AFSink) {
   }
 }
 
+TEST(SignalPath, DemodulateAtFilterRate) {
+  using SignalPath = SimpleSignalPath<float>;
+
+  SignalPath::Options options;
+  options.input.sample_rate = 6000000;
+  options.receive_filter.bandwidth = 12500;
+  options.demodulator.modulation_type = modulation::analog::Type::kNFM;
+  options.audio.sample_rate = 48000;
+
+  SignalPath signal_path;
+
+  signal_path.Configure(options);
+  EXPECT_EQ(signal_path.GetIFSampleRate(), 48000);
+
+  // The receive filter operates at 24 kHz: the demodulator operates at this
+  // sample rate, and the audio is upsampled to the audio sample rate.
+  options.receive_filter.demodulate_at_filter_rate = true;
+  signal_path.Configure(options);
+  EXPECT_EQ(signal_path.GetIFSampleRate(), 24000);
+  EXPECT_EQ(signal_path.GetAFSampleRate(), 48000);
+
+  CountingAFSink af_sink;
+  signal_path.AddAFSink(af_sink);
+
+  const std::vector<Complex> samples(6000, Complex(1, 0));
+  for (int i = 0; i < 10; ++i) {
+    signal_path.PushSamples(samples);
+  }
+
+  EXPECT_EQ(af_sink.num_samples, 480);
+}
+
+// The ratio of the input and audio sample rates is not an integer, so the
+// audio is resampled by a rational factor.
+TEST(SignalPath, RationalRatio) {
+  using SignalPath = SimpleSignalPath<float>;
+
+  SignalPath::Options options;
+  options.input.sample_rate = 1024000;
+  options.receive_filter.bandwidth = 12500;
+  options.demodulator.modulation_type = modulation::analog::Type::kNFM;
+  options.audio.sample_rate = 48000;
+
+  for (const bool demodulate_at_filter_rate : {false, true}) {
+    options.receive_filter.demodulate_at_filter_rate =
+        demodulate_at_filter_rate;
+
+    SignalPath signal_path;
+    signal_path.Configure(options);
+    EXPECT_EQ(signal_path.GetAFSampleRate(), 48000);
+
+    CountingAFSink af_sink;
+    signal_path.AddAFSink(af_sink);
+
+    const std::vector<Complex> samples(10240, Complex(1, 0));
+    for (int i = 0; i < 10; ++i) {
+      signal_path.PushSamples(samples);
+    }
+
+    // The resampler delays a few samples.
+    EXPECT_NEAR(float(af_sink.num_samples), 4800.0f, 2)
+        << "demodulate_at_filter_rate=" << demodulate_at_filter_rate;
+  }
+}
+
+// The fused shift and decimation gives the same result as the separate one,
+// both at low and high decimation ratios of the input stage.
+TEST(SignalPath, FusedShiftDecimate) {
+  for (const int sample_rate : {192000, 6000000}) {
+    const std::vector<Complex> separate =
+        ShiftAndDecimateTone(sample_rate, false);
+    const std::vector<Complex> fused = ShiftAndDecimateTone(sample_rate, true);
+
+    ASSERT_FALSE(separate.empty());
+    EXPECT_THAT(fused, Pointwise(ComplexNear(1e-4f), separate))
+        << "sample rate " << sample_rate;
+  }
+}
+
+TEST(SignalPath, Reserve) {
+  using SignalPath = SimpleSignalPath<float, ArenaAllocator>;
+
+  SignalPath::Options options;
+  options.input.sample_rate = 6000000;
+  options.receive_filter.bandwidth = 12500;
+  options.demodulator.modulation_type = modulation::analog::Type::kNFM;
+  options.demodulator.nfm.deviation = 2500;
+  options.audio.sample_rate = 48000;
+
+  Arena arena(16 * 1024 * 1024);
+  Arena::Scope arena_scope(arena);
+
+  SignalPath signal_path;
+  signal_path.Configure(options);
+  signal_path.Reserve(10000);
+
+  CountingAFSink af_sink;
+  signal_path.AddAFSink(af_sink);
+
+  // Any allocation done by the processing would increase the arena usage.
+  // Additionally, debug builds assert that there are no allocations.
+  const size_t num_used_bytes = arena.GetNumUsedBytes();
+
+  const std::vector<Complex> samples(10000, Complex(1, 0));
+  for (const size_t num_samples : {10000, 1, 5001, 9999, 10000}) {
+    signal_path.PushSamples(std::span(samples).subspan(0, num_samples));
+  }
+
+  EXPECT_EQ(arena.GetNumUsedBytes(), num_used_bytes);
+
+  // The reservation is kept when the path is re-configured.
+  options.receive_filter.demodulate_at_filter_rate = true;
+  signal_path.Configure(options);
+
+  const size_t num_reconfigured_used_bytes = arena.GetNumUsedBytes();
+
+  for (const size_t num_samples : {10000, 1, 5001, 9999, 10000}) {
+    signal_path.PushSamples(std::span(samples).subspan(0, num_samples));
+  }
+
+  EXPECT_EQ(arena.GetNumUsedBytes(), num_reconfigured_used_bytes);
+}
+
+#if RADIO_CORE_HAVE_HALF
+
+// The half precision signal path is expected to produce the same audio as the
+// single precision one, up to the rounding errors of the IQ and IF samples.
+TEST(SignalPath, HalfMatchesFloat) {
+  const std::vector<float> float_samples = DemodulateNFMTone<float>();
+  const std::vector<float> half_samples = DemodulateNFMTone<Half>();
+
+  ASSERT_EQ(half_samples.size(), float_samples.size());
+
+  // Compare the second half of the audio, where the AGC has settled.
+  double signal_power = 0;
+  double error_power = 0;
+  for (size_t i = float_samples.size() / 2; i < float_samples.size(); ++i) {
+    ASSERT_TRUE(IsFinite(half_samples[i])) << "i=" << i;
+
+    const double error = double(half_samples[i]) - double(float_samples[i]);
+    signal_power += double(float_samples[i]) * double(float_samples[i]);
+    error_power += error * error;
+  }
+
+  EXPECT_GT(signal_power, 0);
+  EXPECT_GT(10 * Log10(signal_power / error_power), 50);
+}
+
+#endif  // RADIO_CORE_HAVE_HALF
+
 }  // namespace radio_core::signal_path
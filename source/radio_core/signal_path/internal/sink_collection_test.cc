@@ -5,6 +5,8 @@
 #include "radio_core/signal_path/sink_collection.h"
 
 #include <array>
+#include <atomic>
+#include <thread>
 #include <vector>
 
 #include "radio_core/signal_path/sink.h"
@@ -84,4 +86,82 @@ TEST(SinkCollection, Multiple) {
                             {2, 4, 6, 8, 10, 12, 2, 4, 6, 8, 10, 12})));
 }
 
+TEST(SinkCollection, ParallelDispatch) {
+  const std::array in = std::to_array<float>({1, 2, 3, 4, 5, 6});
+
+  std::array<std::vector<float>, 4> outs;
+  std::vector<MyAsyncSink> sinks;
+  for (std::vector<float>& out : outs) {
+    sinks.emplace_back(out);
+  }
+
+  SinkCollection<float> sink_collection;
+  for (MyAsyncSink& sink : sinks) {
+    sink_collection.AddSink(sink);
+  }
+
+  sink_collection.SetNumDispatchThreads(2);
+  EXPECT_EQ(sink_collection.GetNumDispatchThreads(), 2);
+
+  sink_collection.PushSamples(in);
+  sink_collection.PushSamples(in);
+
+  for (const std::vector<float>& out : outs) {
+    EXPECT_THAT(out,
+                Pointwise(FloatNear(1e-6f),
+                          std::to_array<float>(
+                              {2, 4, 6, 8, 10, 12, 2, 4, 6, 8, 10, 12})));
+  }
+
+  sink_collection.SetNumDispatchThreads(0);
+  EXPECT_EQ(sink_collection.GetNumDispatchThreads(), 0);
+
+  sink_collection.PushSamples(in);
+  for (const std::vector<float>& out : outs) {
+    EXPECT_EQ(out.size(), 18);
+  }
+}
+
+// Add and remove sink while samples are being pushed from another thread.
+TEST(SinkCollection, ConcurrentModification) {
+  class CountingSink : public Sink<float> {
+   public:
+    void PushSamples(const std::span<const float> samples) override {
+      num_samples += samples.size();
+    }
+
+    std::atomic<size_t> num_samples{0};
+  };
+
+  const std::array in = std::to_array<float>({1, 2, 3, 4});
+
+  CountingSink permanent_sink;
+
+  SinkCollection<float> sink_collection;
+  sink_collection.AddSink(permanent_sink);
+
+  std::atomic<bool> stop{false};
+  std::thread push_thread([&]() {
+    while (!stop) {
+      sink_collection.PushSamples(in);
+    }
+  });
+
+  for (int i = 0; i < 100; ++i) {
+    CountingSink temporary_sink;
+    sink_collection.AddSink(temporary_sink);
+    sink_collection.RemoveSink(temporary_sink);
+
+    // The sink is not referenced after the removal.
+    const size_t num_samples = temporary_sink.num_samples;
+    std::this_thread::yield();
+    EXPECT_EQ(temporary_sink.num_samples, num_samples);
+  }
+
+  stop = true;
+  push_thread.join();
+
+  EXPECT_GT(permanent_sink.num_samples, 0);
+}
+
 }  // namespace radio_core::signal_path
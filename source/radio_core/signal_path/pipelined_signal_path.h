@@ -0,0 +1,242 @@
+// Copyright (c) 2024 radio core authors
+//
+// SPDX-License-Identifier: MIT
+
+// An implementation of signal path processor which runs the IF and AF stages
+// of the signal processing on separate threads.
+//
+// The IF stage (frequency shift, decimation to the IF sample rate, and the
+// receive filter) runs on the thread which pushes the samples. The filtered IF
+// samples are handed over to a worker thread which runs the AF stage
+// (demodulation, resampling to the audio sample rate, AGC, and AF sinks).
+//
+// The handover is double-buffered: while the worker processes block k the
+// pushing thread processes block k+1 into the other buffer. This allows a
+// single signal path to use two CPU cores, which is important for high input
+// sample rates and wide-band modulations where neither of the stages is cheap.
+//
+// The PushSamples() blocks when both buffers are waiting for the AF stage. This
+// bounds the latency added by the pipeline to the time of processing of one
+// extra block. The measured latency between the moment the block is pushed and
+// the moment its AF samples are pushed to the AF sinks is reported by the
+// GetLastLatency() and GetMaxLatency().
+//
+// The IF sinks are called from the pushing thread, and the AF sinks are called
+// from the worker thread.
+//
+// Same as the SimpleSignalPath this signal path allows re-configuration from
+// another thread. The configuration waits for both stages to finish their
+// current block.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "radio_core/base/container.h"
+#include "radio_core/base/no_allocation_scope.h"
+#include "radio_core/signal_path/base_signal_path.h"
+
+namespace radio_core::signal_path {
+
+template <class T,
+          template <class> class Allocator = std::allocator,
+          class FFTType = void>
+class PipelinedSignalPath : public BaseSignalPath<T, Allocator, FFTType> {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  PipelinedSignalPath() {
+    thread_ = std::thread([&]() { RunAFStage(); });
+  }
+
+  ~PipelinedSignalPath() override {
+    {
+      std::unique_lock lock(handover_mutex_);
+      stop_requested_ = true;
+    }
+    handover_cv_.notify_all();
+
+    thread_.join();
+  }
+
+  void PushSamples(std::span<const BaseComplex<T>> input_iq_samples) override {
+    const Clock::time_point push_time = Clock::now();
+
+    IFBlock& block = if_blocks_[next_if_block_];
+    next_if_block_ = (next_if_block_ + 1) % if_blocks_.size();
+
+    // Wait for the AF stage to finish with the samples of the buffer.
+    {
+      std::unique_lock lock(handover_mutex_);
+      handover_cv_.wait(lock, [&] { return !block.has_samples; });
+    }
+
+    if_mutex_.lock();
+    {
+      const NoAllocationScope no_allocation_scope(
+          this->IsReservedFor(input_iq_samples.size()));
+
+      EnsureSizeAtLeast(block.buffer,
+                        this->CalcNeededIFBufferSize(input_iq_samples.size()));
+      block.samples = this->ProcessIFStage(input_iq_samples, block.buffer);
+      block.is_reserved = this->IsReservedFor(input_iq_samples.size());
+    }
+    if_mutex_.unlock();
+
+    {
+      std::unique_lock lock(handover_mutex_);
+      block.push_time = push_time;
+      block.has_samples = true;
+      ++num_pushed_blocks_;
+    }
+    handover_cv_.notify_all();
+  }
+
+  // Wait for all samples which were pushed so far to be processed by the AF
+  // stage.
+  void Wait() {
+    std::unique_lock lock(handover_mutex_);
+    handover_cv_.wait(
+        lock, [&] { return num_processed_blocks_ == num_pushed_blocks_; });
+  }
+
+  // Latency between the moment samples were pushed to the signal path and the
+  // moment the corresponding AF samples were pushed to the AF sinks.
+  //
+  // The last latency is the one of the most recently processed block, and the
+  // max latency is the highest one since the signal path was constructed, or
+  // the ResetLatencyStatistics() was called.
+  auto GetLastLatency() const -> Clock::duration {
+    std::unique_lock lock(handover_mutex_);
+    return last_latency_;
+  }
+  auto GetMaxLatency() const -> Clock::duration {
+    std::unique_lock lock(handover_mutex_);
+    return max_latency_;
+  }
+
+  void ResetLatencyStatistics() {
+    std::unique_lock lock(handover_mutex_);
+    last_latency_ = {};
+    max_latency_ = {};
+  }
+
+ protected:
+  // The configuration is to be consistent across both stages, so lock them
+  // both. Each of the stages only locks its own mutex, so there is no lock
+  // order inversion.
+  void Lock() override {
+    if_mutex_.lock();
+    af_mutex_.lock();
+  }
+  void Unlock() override {
+    af_mutex_.unlock();
+    if_mutex_.unlock();
+  }
+
+  void ReserveUnsafe(const size_t max_block_size) override {
+    BaseSignalPath<T, Allocator, FFTType>::ReserveUnsafe(max_block_size);
+
+    // The samples of a block which waits for the AF stage are preserved when
+    // the buffer is re-allocated, and only need to be re-referenced. Neither of
+    // the stages access the blocks while the signal path is locked.
+    const size_t if_buffer_size = this->CalcNeededIFBufferSize(max_block_size);
+    for (IFBlock& block : if_blocks_) {
+      const size_t num_samples = block.samples.size();
+      const size_t offset =
+          num_samples ? block.samples.data() - block.buffer.data() : 0;
+
+      EnsureSizeAtLeast(block.buffer, if_buffer_size);
+
+      block.samples =
+          std::span<BaseComplex<T>>(block.buffer).subspan(offset, num_samples);
+    }
+  }
+
+ private:
+  // Samples handed over from the IF stage to the AF stage.
+  struct IFBlock {
+    std::vector<BaseComplex<T>, Allocator<BaseComplex<T>>> buffer;
+    std::span<BaseComplex<T>> samples;
+
+    Clock::time_point push_time;
+
+    // True when the samples were pushed in a block of the reserved size.
+    bool is_reserved{false};
+
+    // True when the samples are ready to be processed by the AF stage.
+    // Guarded by the handover mutex.
+    bool has_samples{false};
+  };
+
+  // Work thread callback.
+  void RunAFStage() {
+    size_t block_index = 0;
+
+    while (true) {
+      IFBlock& block = if_blocks_[block_index];
+      block_index = (block_index + 1) % if_blocks_.size();
+
+      {
+        std::unique_lock lock(handover_mutex_);
+        handover_cv_.wait(
+            lock, [&] { return block.has_samples || stop_requested_; });
+        if (!block.has_samples) {
+          return;
+        }
+      }
+
+      af_mutex_.lock();
+      {
+        const NoAllocationScope no_allocation_scope(block.is_reserved);
+        this->ProcessAFStage(block.samples);
+      }
+      af_mutex_.unlock();
+
+      {
+        std::unique_lock lock(handover_mutex_);
+
+        last_latency_ = Clock::now() - block.push_time;
+        if (last_latency_ > max_latency_) {
+          max_latency_ = last_latency_;
+        }
+
+        block.has_samples = false;
+        ++num_processed_blocks_;
+      }
+      handover_cv_.notify_all();
+    }
+  }
+
+  // Locks which ensure thread safety of the configuration and processing of
+  // the corresponding stages.
+  std::mutex if_mutex_;
+  std::mutex af_mutex_;
+
+  // Double-buffered handover of the IF samples.
+  std::array<IFBlock, 2> if_blocks_;
+  size_t next_if_block_{0};
+
+  // Synchronization of the handover, and the statistics.
+  mutable std::mutex handover_mutex_;
+  std::condition_variable handover_cv_;
+
+  bool stop_requested_{false};
+
+  uint64_t num_pushed_blocks_{0};
+  uint64_t num_processed_blocks_{0};
+
+  Clock::duration last_latency_{};
+  Clock::duration max_latency_{};
+
+  std::thread thread_;
+};
+
+}  // namespace radio_core::signal_path
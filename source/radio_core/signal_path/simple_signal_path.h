@@ -18,8 +18,10 @@
 
 namespace radio_core::signal_path {
 
-template <class T, template <class> class Allocator = std::allocator>
-class SimpleSignalPath : public BaseSignalPath<T, Allocator> {
+template <class T,
+          template <class> class Allocator = std::allocator,
+          class FFTType = void>
+class SimpleSignalPath : public BaseSignalPath<T, Allocator, FFTType> {
  protected:
   void Lock() override { mutex_.lock(); }
   void Unlock() override { mutex_.unlock(); }
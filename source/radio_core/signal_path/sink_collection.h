@@ -9,13 +9,30 @@
 //
 // This implementation is thread safe which means one thread can be pushing
 // samples to the sink while other thread adds or removes sinks.
+//
+// Pushing samples does not lock any mutex: the sinks are stored in two
+// contiguous arrays, one of which is used for pushing samples while the other
+// one is modified by the AddSink() and RemoveSink(). Once modified, the arrays
+// swap their roles, and the modification waits for the pushes which are still
+// using the previous array to finish. This way, after the RemoveSink() returns
+// the removed sink is no longer referenced, same as with a lock-guarded list.
+//
+// Optionally the samples can be pushed to the sinks in parallel, using a pool
+// of worker threads. This is beneficial when multiple sinks perform expensive
+// processing which is independent from each other. The PushSamples() returns
+// once all sinks have processed the samples.
 
 #pragma once
 
-#include <list>
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
 
+#include "radio_core/signal_path/internal/parallel_dispatcher.h"
 #include "radio_core/signal_path/sink.h"
 
 namespace radio_core::signal_path {
@@ -31,7 +48,8 @@ class SinkCollection : public Sink<T> {
   // of the sink.
   inline void AddSink(Sink<SampleType>& sink) {
     std::unique_lock lock(mutex_);
-    sinks_.push_back(&sink);
+
+    Update([&](Snapshot& snapshot) { snapshot.sinks.push_back(&sink); });
   }
 
   // Remove sink from the collection.
@@ -41,29 +59,131 @@ class SinkCollection : public Sink<T> {
   inline void RemoveSink(const Sink<SampleType>& sink) {
     std::unique_lock lock(mutex_);
 
-    std::erase(sinks_, &sink);
+    Update([&](Snapshot& snapshot) { std::erase(snapshot.sinks, &sink); });
+  }
+
+  // Set the number of worker threads which push samples to the sinks in
+  // parallel.
+  //
+  // The value of 0 disables the parallel dispatch, and the samples are pushed
+  // to the sinks one after another from the thread which pushes samples to the
+  // collection. Otherwise the pushing thread is processing sinks together with
+  // the worker threads, so the number of threads is typically one less than
+  // the number of the sinks which are to be processed in parallel.
+  //
+  // NOTE: With the parallel dispatch sinks are called from different threads,
+  // and the sinks of a single collection are to be independent from each
+  // other.
+  void SetNumDispatchThreads(const int num_threads) {
+    std::unique_lock lock(mutex_);
+
+    std::unique_ptr<Dispatcher> dispatcher;
+    if (num_threads > 0) {
+      dispatcher = std::make_unique<Dispatcher>(num_threads);
+    }
+
+    Update([&](Snapshot& snapshot) { snapshot.dispatcher = dispatcher.get(); });
+
+    // The previous dispatcher is no longer referenced by the pushes.
+    dispatcher_.swap(dispatcher);
+  }
+
+  inline auto GetNumDispatchThreads() const -> int {
+    std::unique_lock lock(mutex_);
+    return dispatcher_ ? dispatcher_->GetNumThreads() : 0;
   }
 
   // Push samples to all currently registered sinks.
   void PushSamples(std::span<const SampleType> samples) override {
-    std::unique_lock lock(mutex_);
+    const int index = AcquireSnapshot();
+    const Snapshot& snapshot = snapshots_[index];
 
-    for (Sink<SampleType>* sink : sinks_) {
-      sink->PushSamples(samples);
+    if (snapshot.dispatcher && snapshot.sinks.size() > 1) {
+      snapshot.dispatcher->Run(snapshot.sinks.size(), [&](const size_t i) {
+        snapshot.sinks[i]->PushSamples(samples);
+      });
+    } else {
+      for (Sink<SampleType>* sink : snapshot.sinks) {
+        sink->PushSamples(samples);
+      }
     }
+
+    ReleaseSnapshot(index);
   }
 
  private:
   using SinkPtr = Sink<SampleType>*;
+  using Dispatcher = internal::ParallelDispatcher;
+
+  // State of the collection used by the PushSamples().
+  struct Snapshot {
+    std::vector<SinkPtr, Allocator<SinkPtr>> sinks;
+    Dispatcher* dispatcher{nullptr};
+  };
+
+  // Mark the active snapshot as used by the calling thread.
+  // Returns index of the snapshot.
+  inline auto AcquireSnapshot() -> int {
+    while (true) {
+      const int index = active_snapshot_.load(std::memory_order_seq_cst);
+      num_readers_[index].fetch_add(1, std::memory_order_seq_cst);
+
+      // Make sure the snapshot did not become inactive before the reader was
+      // registered, otherwise it might be modified while being used.
+      if (active_snapshot_.load(std::memory_order_seq_cst) == index) {
+        return index;
+      }
+
+      num_readers_[index].fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  inline void ReleaseSnapshot(const int index) {
+    num_readers_[index].fetch_sub(1, std::memory_order_release);
+  }
+
+  // Wait for all threads which use the snapshot with the given index to
+  // release it.
+  inline void WaitForReaders(const int index) {
+    while (num_readers_[index].load(std::memory_order_acquire) != 0) {
+      std::this_thread::yield();
+    }
+  }
+
+  // Modify the inactive snapshot to be a copy of the active one modified by
+  // the given function, make it active, and wait for the previously active
+  // snapshot to be no longer used.
+  //
+  // Is to be called with the mutex locked.
+  template <class F>
+  void Update(const F& modify) {
+    const int active_index = active_snapshot_.load(std::memory_order_relaxed);
+    const int inactive_index = 1 - active_index;
+
+    // Nothing uses the inactive snapshot as the previous update has waited for
+    // its readers, and new readers do not register in it.
+    snapshots_[inactive_index] = snapshots_[active_index];
+    modify(snapshots_[inactive_index]);
+
+    active_snapshot_.store(inactive_index, std::memory_order_seq_cst);
+
+    WaitForReaders(active_index);
+  }
+
+  // Mutex to serialize modifications of the collection.
+  // Not used by the PushSamples().
+  mutable std::mutex mutex_;
+
+  // Snapshots of the sinks: one is used by the PushSamples(), and the other
+  // one is modified on the collection change.
+  std::array<Snapshot, 2> snapshots_;
+  std::atomic<int> active_snapshot_{0};
 
-  // Mutex to ensure thread safety between sink list manipulation and signal
-  // processing thread.
-  std::mutex mutex_;
+  // The number of PushSamples() calls which are using the corresponding
+  // snapshot.
+  std::array<std::atomic<int>, 2> num_readers_{0, 0};
 
-  // Sinks of this collection.
-  // Stored in the list to help memory fragmentation on a resource-limited
-  // systems, as well as helping removing sinks.
-  std::list<SinkPtr, Allocator<SinkPtr>> sinks_;
+  std::unique_ptr<Dispatcher> dispatcher_;
 };
 
 }  // namespace radio_core::signal_path
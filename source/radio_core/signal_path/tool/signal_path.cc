@@ -21,7 +21,9 @@
 #include "radio_core/base/half.h"
 #include "radio_core/base/scoped_timer.h"
 #include "radio_core/math/complex.h"
+#include "radio_core/math/fft_api_pffft.h"
 #include "radio_core/math/half_complex.h"
+#include "radio_core/math/math.h"
 #include "radio_core/modulation/analog/info.h"
 #include "radio_core/signal_path/simple_signal_path.h"
 #include "radio_core/tool/buffered_wav_reader.h"
@@ -42,16 +44,15 @@ using File = tiny_lib::io_file::File;
 namespace audio_wav_reader = tiny_lib::audio_wav_reader;
 namespace audio_wav_writer = tiny_lib::audio_wav_writer;
 
-// NOTE: This is a part of a work-in-progress half-float signal processing.
-// While the core math supports half-floats, the signal path configuration
-// needs work as there are overflows caused by high sample rate values.
-#if RADIO_CORE_HAVE_HALF && 0
-using DSPReal = Half;
-using DSPComplex = BaseComplex<DSPReal>;
-#else
-using DSPReal = float;
-using DSPComplex = Complex;
-#endif
+// The default signal path uses single precision signal processing, with the
+// FFT-based fast convolution of the receive filter.
+//
+// When it is supported by the platform the half-float signal processing can be
+// requested from the command line. The IQ and IF samples are stored in half
+// precision, while the configuration of the signal path and the audio stage use
+// the single precision values (see ComputeType). The FFT-based fast convolution
+// of the receive filter is only available for the single precision samples, so
+// the half-float signal path uses the direct convolution.
 
 struct CLIOptions {
   inline static constexpr int kDefaultAudioSampleRate{48000};
@@ -64,9 +65,12 @@ struct CLIOptions {
   // Value of 0 means the default bandwidth for the modulation type.
   int filter_bandwidth{0};
   int filter_transition{0};
+  bool demodulate_at_filter_rate{false};
 
   int audio_sample_rate = kDefaultAudioSampleRate;
   float audio_volume{1.0f};
+
+  bool half_precision{false};
 };
 
 // Parse command line arguments and return parsed result.
@@ -95,6 +99,11 @@ auto ParseCLIAndGetOptions(int argc, char** argv) -> CLIOptions {
       .help("Receive filter transition band, Hz")
       .scan<'i', int>();
 
+  program.add_argument("--demodulate-at-filter-rate")
+      .default_value(false)
+      .implicit_value(true)
+      .help("Demodulate at the sample rate of the receive filter");
+
   program.add_argument("--modulation")
       .help("Modulation type (AM, NFM, WFM, USB, LSB, CW)")
       .required();
@@ -111,6 +120,13 @@ auto ParseCLIAndGetOptions(int argc, char** argv) -> CLIOptions {
       .help("Audio volume, in percentage")
       .scan<'i', int>();
 
+#if RADIO_CORE_HAVE_HALF
+  program.add_argument("--half-precision")
+      .default_value(false)
+      .implicit_value(true)
+      .help("Use half precision floating point for the IQ and IF samples");
+#endif
+
   try {
     program.parse_args(argc, argv);
   } catch (const std::runtime_error& err) {
@@ -126,12 +142,18 @@ auto ParseCLIAndGetOptions(int argc, char** argv) -> CLIOptions {
 
   options.filter_bandwidth = program.get<int>("--filter-bandwidth");
   options.filter_transition = program.get<int>("--filter-transition");
+  options.demodulate_at_filter_rate =
+      program.get<bool>("--demodulate-at-filter-rate");
 
   options.modulation_str = program.get<std::string>("--modulation");
 
   options.audio_sample_rate = program.get<int>("--audio-rate");
   options.audio_volume = float(program.get<int>("--audio-volume")) / 100.0f;
 
+#if RADIO_CORE_HAVE_HALF
+  options.half_precision = program.get<bool>("--half-precision");
+#endif
+
   return options;
 }
 
@@ -169,15 +191,10 @@ auto CheckCLIOptionsValidOrReport(const CLIOptions& cli_options) -> bool {
 // The configuration might fail, for example, if there is no supported
 // combination of downsamplers to achieve downsampling at different stages.
 // The details about it will be logged to the stderr.
+template <class SignalPath>
 auto ConfigureSignalPath(const CLIOptions cli_options,
                          const audio_wav_reader::FormatSpec iq_format_spec,
-                         SimpleSignalPath<DSPReal>& signal_path) -> bool {
-  if (iq_format_spec.sample_rate % cli_options.audio_sample_rate) {
-    cerr << "Non-integer ratio of sample rates at the input and audio stages"
-         << endl;
-    return false;
-  }
-
+                         SignalPath& signal_path) -> bool {
   modulation::analog::Type modulation_type;
   if (!modulation::analog::TypeFromName(cli_options.modulation_str,
                                         modulation_type)) {
@@ -186,7 +203,7 @@ auto ConfigureSignalPath(const CLIOptions cli_options,
     return false;
   }
 
-  SimpleSignalPath<DSPReal>::Options options;
+  typename SignalPath::Options options;
 
   options.input.sample_rate = iq_format_spec.sample_rate;
   options.input.frequency_shift = 0;
@@ -205,15 +222,18 @@ auto ConfigureSignalPath(const CLIOptions cli_options,
         float(cli_options.filter_transition) / options.receive_filter.bandwidth;
   }
 
+  options.receive_filter.demodulate_at_filter_rate =
+      cli_options.demodulate_at_filter_rate;
+
   options.demodulator.modulation_type = modulation_type;
 
-  const DSPReal fm_deviation = options.receive_filter.bandwidth / 2;
+  const auto fm_deviation = options.receive_filter.bandwidth / 2;
   options.demodulator.nfm.deviation = fm_deviation;
   options.demodulator.wfm.deviation = fm_deviation;
 
   options.audio.sample_rate = cli_options.audio_sample_rate;
-  options.audio.agc.charge_rate = DSPReal(0.007f);
-  options.audio.agc.discharge_rate = DSPReal(0.00003f);
+  options.audio.agc.charge_rate = 0.007f;
+  options.audio.agc.discharge_rate = 0.00003f;
 
   signal_path.Configure(options);
 
@@ -221,14 +241,19 @@ auto ConfigureSignalPath(const CLIOptions cli_options,
 }
 
 // Sink of samples to a single-channel WAV file.
+//
+// The samples are provided by the audio stage of the signal path which uses
+// the given type for its calculation.
 template <class WAVWriter, class T>
 class WAVFileSink : public SimpleSignalPath<T>::AFSink {
+  using SampleType = ComputeType<T>;
+
  public:
-  WAVFileSink(WAVWriter& wav_writer, const T volume)
+  WAVFileSink(WAVWriter& wav_writer, const SampleType volume)
       : wav_writer_(&wav_writer), volume_{volume} {}
 
-  void PushSamples(std::span<const T> samples) override {
-    for (const T& sample : samples) {
+  void PushSamples(std::span<const SampleType> samples) override {
+    for (const SampleType& sample : samples) {
       const float scaled_sample = float(sample * volume_);
       wav_writer_->WriteSingleSample(std::span(&scaled_sample, 1));
     }
@@ -236,66 +261,25 @@ class WAVFileSink : public SimpleSignalPath<T>::AFSink {
 
  private:
   WAVWriter* wav_writer_{nullptr};
-  T volume_{1.0};
+  SampleType volume_{1.0};
 };
 
-auto Main(int argc, char** argv) -> int {
-  // clang-format off
-  cout
-    << "**********************************************************************"
-    << endl
-    << "** Radio Signal Path" << endl
-    << "**********************************************************************"
-    << endl;
-  // clang-format on
-
-  // Parse command line argument and validate them.
-  const CLIOptions cli_options = ParseCLIAndGetOptions(argc, argv);
-  if (!CheckCLIOptionsValidOrReport(cli_options)) {
-    return EXIT_FAILURE;
-  }
-
-  // Open input IQ WAV file for read.
-  File iq_file;
-  if (!iq_file.Open(cli_options.input_iq_filepath, File::kRead)) {
-    cerr << "Error opening IQ WAV file for read." << endl;
-    return EXIT_FAILURE;
-  }
-
-  // Open input IQ WAV reader to access format of the file.
-  audio_wav_reader::Reader<File> iq_wav_file_reader;
-  if (!iq_wav_file_reader.Open(iq_file)) {
-    cerr << "Error reading input IQ WAV file." << endl;
-    return EXIT_FAILURE;
-  }
+// Demodulate the IQ file using the signal path which processes the IQ and IF
+// samples of the given type, and write the audio to the output file.
+template <class T, class FFTType>
+auto ProcessIQFile(const CLIOptions& cli_options,
+                   audio_wav_reader::Reader<File>& iq_wav_file_reader,
+                   const float iq_file_duration_in_seconds) -> int {
+  using SignalPath = SimpleSignalPath<T, std::allocator, FFTType>;
+  using DSPComplex = BaseComplex<T>;
 
-  // Open input IQ file and print its information.
   const audio_wav_reader::FormatSpec iq_format_spec =
       iq_wav_file_reader.GetFormatSpec();
-  const float iq_file_duration_in_seconds =
-      iq_wav_file_reader.GetDurationInSeconds();
-
-  cout << endl;
-  cout << "Input file specification" << endl;
-  cout << "========================" << endl;
-  cout << iq_format_spec.sample_rate << " samples per second, "
-       << iq_format_spec.bit_depth << " bits depth, "
-       << iq_format_spec.num_channels << " audio channel(s)." << endl;
-
-  cout << "File duration: " << iq_file_duration_in_seconds << " seconds."
-       << endl;
-
-  // Validate the channel configuration.
-  if (iq_format_spec.num_channels < 2) {
-    cerr << "The processor requires at least 2 channels in the IQ WAV file."
-         << endl;
-    return EXIT_FAILURE;
-  }
 
   // Configure the signal processing path.
-  SimpleSignalPath<DSPReal> signal_path;
+  SignalPath signal_path;
   if (!ConfigureSignalPath(cli_options, iq_format_spec, signal_path)) {
-    return false;
+    return EXIT_FAILURE;
   }
 
   // Print derived configuration.
@@ -329,7 +313,7 @@ auto Main(int argc, char** argv) -> int {
   // an existing file with 0 size if there is an error in the command line.
   File audio_file;
   audio_wav_writer::Writer<File> audio_wav_writer;
-  WAVFileSink<audio_wav_writer::Writer<File>, DSPReal> audio_sink(
+  WAVFileSink<audio_wav_writer::Writer<File>, T> audio_sink(
       audio_wav_writer, cli_options.audio_volume);
   bool is_output_open = false;
   if (cli_options.output_audio_filepath != "-") {
@@ -394,6 +378,71 @@ auto Main(int argc, char** argv) -> int {
   return EXIT_SUCCESS;
 }
 
+auto Main(int argc, char** argv) -> int {
+  // clang-format off
+  cout
+    << "**********************************************************************"
+    << endl
+    << "** Radio Signal Path" << endl
+    << "**********************************************************************"
+    << endl;
+  // clang-format on
+
+  // Parse command line argument and validate them.
+  const CLIOptions cli_options = ParseCLIAndGetOptions(argc, argv);
+  if (!CheckCLIOptionsValidOrReport(cli_options)) {
+    return EXIT_FAILURE;
+  }
+
+  // Open input IQ WAV file for read.
+  File iq_file;
+  if (!iq_file.Open(cli_options.input_iq_filepath, File::kRead)) {
+    cerr << "Error opening IQ WAV file for read." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Open input IQ WAV reader to access format of the file.
+  audio_wav_reader::Reader<File> iq_wav_file_reader;
+  if (!iq_wav_file_reader.Open(iq_file)) {
+    cerr << "Error reading input IQ WAV file." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Open input IQ file and print its information.
+  const audio_wav_reader::FormatSpec iq_format_spec =
+      iq_wav_file_reader.GetFormatSpec();
+  const float iq_file_duration_in_seconds =
+      iq_wav_file_reader.GetDurationInSeconds();
+
+  cout << endl;
+  cout << "Input file specification" << endl;
+  cout << "========================" << endl;
+  cout << iq_format_spec.sample_rate << " samples per second, "
+       << iq_format_spec.bit_depth << " bits depth, "
+       << iq_format_spec.num_channels << " audio channel(s)." << endl;
+
+  cout << "File duration: " << iq_file_duration_in_seconds << " seconds."
+       << endl;
+
+  // Validate the channel configuration.
+  if (iq_format_spec.num_channels < 2) {
+    cerr << "The processor requires at least 2 channels in the IQ WAV file."
+         << endl;
+    return EXIT_FAILURE;
+  }
+
+#if RADIO_CORE_HAVE_HALF
+  if (cli_options.half_precision) {
+    return ProcessIQFile<Half, void>(cli_options,
+                                     iq_wav_file_reader,
+                                     iq_file_duration_in_seconds);
+  }
+#endif
+
+  return ProcessIQFile<float, fft::PFFFT<Complex>>(
+      cli_options, iq_wav_file_reader, iq_file_duration_in_seconds);
+}
+
 }  // namespace
 }  // namespace radio_core::signal_path
 